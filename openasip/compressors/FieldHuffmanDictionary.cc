@@ -0,0 +1,940 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+ */
+/**
+ * @file FieldHuffmanDictionary.cc
+ *
+ * Implementation of a field level dictionary compressor with entropy
+ * coded dictionary indices.  Warning! This compressor works correctly
+ * only when there is one instruction per MAU in the final program
+ * image. That is, the MAU of the address space should be the same as
+ * the width of the compressed instructions or wider. Otherwise jump
+ * and call addresses are invalid in the code.
+ *
+ * The instruction is split to the fields defined by the BEM: the
+ * immediate control field, the long immediate fields and the guard,
+ * source and destination fields of each move slot. Each field gets its
+ * own dictionary. The dictionary index of a field is encoded either with
+ * a fixed width or with a length limited canonical Huffman code, chosen
+ * per field so that the width of the widest compressed instruction is
+ * minimized.
+ *
+ * Decoding long codes can be given extra clock cycles. The decompressor
+ * then locks the core for those cycles, and the compressor can write
+ * the stall cycles of each instruction to a file for ttasim to account
+ * for them.
+ *
+ * @note rating: red
+ */
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <algorithm>
+#include <cmath>
+#include <boost/format.hpp>
+
+#include "CodeCompressor.hh"
+#include "CodeCompressorPlugin.hh"
+#include "Program.hh"
+#include "BinaryEncoding.hh"
+#include "MoveSlot.hh"
+#include "GuardField.hh"
+#include "SourceField.hh"
+#include "DestinationField.hh"
+#include "ImmediateSlotField.hh"
+#include "ImmediateControlField.hh"
+#include "LImmDstRegisterField.hh"
+#include "InstructionBitVector.hh"
+#include "HuffmanCode.hh"
+#include "NullInstruction.hh"
+#include "AsciiImageWriter.hh"
+#include "Application.hh"
+#include "Conversion.hh"
+#include "FileSystem.hh"
+#include "MapTools.hh"
+#include "MathTools.hh"
+
+using std::vector;
+using std::string;
+using std::endl;
+using std::pair;
+
+using TTAProgram::Program;
+using TTAProgram::Instruction;
+using TTAProgram::NullInstruction;
+using namespace TPEF;
+
+const string ENCODING = "encoding";
+const string MAX_CODE_LENGTH = "max_code_length";
+const string FAST_CODE_LENGTH = "fast_code_length";
+const string SLOW_DECODE_CYCLES = "slow_decode_cycles";
+const string STALL_FILE = "stall_file";
+
+/// The default length limit of the Huffman codes.
+const unsigned int DEFAULT_MAX_CODE_LENGTH = 12;
+
+class FieldHuffmanDictionary : public CodeCompressorPlugin {
+public:
+
+    /**
+     * The constructor
+     */
+    FieldHuffmanDictionary() :
+        CodeCompressorPlugin(), dictionaryCreated_(false),
+        compressedWidth_(0), maxCodeLength_(DEFAULT_MAX_CODE_LENGTH),
+        fastCodeLength_(0), slowDecodeCycles_(0) {
+    }
+
+    /**
+     * The destructor
+     */
+    virtual ~FieldHuffmanDictionary() {
+    }
+
+    /**
+     * Creates compressed code of the program and returns it in bit vector
+     */
+    virtual InstructionBitVector*
+    compress(const string& programName) {
+        if (!dictionaryCreated_) {
+            readParameters();
+            createFields();
+            createDictionaries();
+            chooseEncodings();
+            setImemWidth(compressedWidth_);
+
+            if (Application::verboseLevel() > 0) {
+                printDetails();
+            }
+        }
+        startNewProgram(programName);
+        setAllInstructionsToStartAtBeginningOfMAU();
+        addInstructions();
+        if (hasParameter(STALL_FILE)) {
+            writeStallFile(programName);
+        }
+        return programBits();
+    }
+
+    /**
+     * Generates the decompressor in VHDL.
+     *
+     * Note! The programs must be compressed by compress method before
+     * calling this method.
+     *
+     * @param stream The stream to write.
+     */
+    virtual void
+    generateDecompressor(std::ostream& stream, TCEString entityStr) {
+        generateDecompressorEntity(stream, entityStr);
+        generateDecompressorArchitecture(stream, entityStr);
+    }
+
+    /**
+     * Prints the description of the plugin to the given stream.
+     *
+     * @param stream The stream.
+     */
+    virtual void
+    printDescription(std::ostream& stream) {
+        stream << "Generates the program image using field level dictionary "
+               << "compression with Huffman coded dictionary indices."
+               << endl << endl
+               << "Warning! This compressor works correctly only when "
+               << "there is one instruction per MAU in the final program "
+               << "image. That is, the MAU of the address space should be "
+               << "the same as the width of the compressed instructions or "
+               << "wider. Otherwise jump and call addresses are invalid in "
+               << "the code. This compressor creates a dictionary for each "
+               << "guard, source, destination, immediate and immediate "
+               << "control field of the BEM." << endl << endl
+               << "Parameters:" << endl
+               << "  " << ENCODING << "=auto|fixed|huffman: How the "
+               << "dictionary indices are encoded. 'auto' chooses per field "
+               << "the encoding giving the narrowest instruction word. "
+               << "Default is auto." << endl
+               << "  " << MAX_CODE_LENGTH << "=N: Length limit of the "
+               << "Huffman codes. Default is " << DEFAULT_MAX_CODE_LENGTH
+               << "." << endl
+               << "  " << FAST_CODE_LENGTH << "=N: Instructions with "
+               << "a Huffman code longer than N bits take the slow decoding "
+               << "path. By default all instructions are decoded in the "
+               << "fetch cycle." << endl
+               << "  " << SLOW_DECODE_CYCLES << "=N: Number of cycles the "
+               << "decompressor locks the core on the slow decoding path. "
+               << "Default is 1." << endl
+               << "  " << STALL_FILE << "=FILE: Writes the decompressor "
+               << "stall cycles of each instruction to FILE, or to "
+               << "FILE.<program> if several programs are compressed. "
+               << "The file is read by the 'decompressor_stalls' setting "
+               << "of ttasim." << endl << endl;
+    }
+
+private:
+
+    /// Ways to encode the dictionary indices of a field.
+    enum Encoding {
+        ENC_AUTO,    ///< Choose per field.
+        ENC_FIXED,   ///< Fixed width binary index.
+        ENC_HUFFMAN  ///< Length limited canonical Huffman code.
+    };
+
+    /// One field of the instruction and its dictionary.
+    struct Field {
+        /// Description of the field for the reports.
+        string name;
+        /// Index of the first bit of the field in the BEM instruction.
+        unsigned int begin;
+        /// Width of the field in the BEM instruction.
+        unsigned int width;
+        /// The distinct bit patterns of the field.
+        vector<BitVector> patterns;
+        /// Dictionary index of each pattern.
+        std::map<BitVector, unsigned int> index;
+        /// Number of instructions using each pattern.
+        vector<unsigned int> frequencies;
+        /// The Huffman code lengths of the patterns.
+        vector<unsigned int> huffmanLengths;
+        /// The canonical Huffman codes of the patterns.
+        vector<BitVector> huffmanCodes;
+        /// Is the field encoded with the Huffman codes.
+        bool huffman;
+
+        /// Width of the fixed width index.
+        unsigned int fixedWidth() const {
+            return MathTools::requiredBits0Bit0(patterns.size() - 1);
+        }
+
+        /// Length of the code of the given pattern.
+        unsigned int codeLength(unsigned int pattern) const {
+            return huffman ? huffmanLengths.at(pattern) : fixedWidth();
+        }
+    };
+
+    /**
+     * Reads the plugin parameters.
+     *
+     * @exception InvalidData If a parameter value is invalid.
+     */
+    void
+    readParameters() {
+        encoding_ = ENC_AUTO;
+        if (hasParameter(ENCODING)) {
+            string value = parameterValue(ENCODING);
+            if (value == "fixed") {
+                encoding_ = ENC_FIXED;
+            } else if (value == "huffman") {
+                encoding_ = ENC_HUFFMAN;
+            } else if (value != "auto") {
+                throw InvalidData(
+                    __FILE__, __LINE__, __func__,
+                    "Unknown " + ENCODING + ": " + value);
+            }
+        }
+        maxCodeLength_ = positiveParameter(
+            MAX_CODE_LENGTH, DEFAULT_MAX_CODE_LENGTH);
+        if (maxCodeLength_ > 32) {
+            throw InvalidData(
+                __FILE__, __LINE__, __func__,
+                "Parameter " + MAX_CODE_LENGTH + " must be at most 32.");
+        }
+        fastCodeLength_ = positiveParameter(FAST_CODE_LENGTH, 0);
+        slowDecodeCycles_ = 0;
+        if (hasParameter(FAST_CODE_LENGTH)) {
+            slowDecodeCycles_ = positiveParameter(SLOW_DECODE_CYCLES, 1);
+        }
+    }
+
+    /**
+     * Returns the value of a positive integer parameter.
+     *
+     * @param name Name of the parameter.
+     * @param defaultValue Value used if the parameter is not given.
+     * @exception InvalidData If the value is not a positive integer.
+     */
+    unsigned int
+    positiveParameter(const string& name, unsigned int defaultValue) {
+        if (!hasParameter(name)) {
+            return defaultValue;
+        }
+        int value = 0;
+        try {
+            value = Conversion::toInt(parameterValue(name));
+        } catch (const NumberFormatException&) {
+            value = 0;
+        }
+        if (value <= 0) {
+            throw InvalidData(
+                __FILE__, __LINE__, __func__,
+                "Parameter " + name + " must be a positive integer.");
+        }
+        return value;
+    }
+
+    /**
+     * Splits the BEM instruction to the fields to compress.
+     *
+     * The move slots are split to their guard, source and destination
+     * fields. Bits of a move slot not covered by them form a field of
+     * their own.
+     */
+    void
+    createFields() {
+        const BinaryEncoding& bem = binaryEncoding();
+        const unsigned int bemWidth = bem.width();
+
+        // the field boundaries as bit indices of the BEM instruction
+        // vector, whose first bit is the most significant one
+        std::map<unsigned int, string> boundaries;
+        for (int i = bem.childFieldCount() - 1; i >= 0; i--) {
+            InstructionField& field = bem.childField(i);
+            string name;
+            if (dynamic_cast<ImmediateControlField*>(&field) != NULL) {
+                name = "immediate control";
+            } else if (dynamic_cast<ImmediateSlotField*>(&field) != NULL) {
+                name = "immediate slot " +
+                    dynamic_cast<ImmediateSlotField&>(field).name();
+            } else if (dynamic_cast<LImmDstRegisterField*>(&field) != NULL) {
+                name = "limm destination";
+            } else if (dynamic_cast<MoveSlot*>(&field) != NULL) {
+                name = dynamic_cast<MoveSlot&>(field).name() + " extra";
+            }
+            unsigned int end = bemWidth - field.bitPosition();
+            boundaries[end - field.width()] = name;
+
+            MoveSlot* slot = dynamic_cast<MoveSlot*>(&field);
+            if (slot == NULL) {
+                continue;
+            }
+            for (int c = slot->childFieldCount() - 1; c >= 0; c--) {
+                InstructionField& child = slot->childField(c);
+                string childName = slot->name();
+                if (dynamic_cast<GuardField*>(&child) != NULL) {
+                    childName += " guard";
+                } else if (dynamic_cast<SourceField*>(&child) != NULL) {
+                    childName += " source";
+                } else if (dynamic_cast<DestinationField*>(&child) != NULL) {
+                    childName += " destination";
+                }
+                unsigned int childEnd =
+                    end - child.bitPosition();
+                boundaries[childEnd - child.width()] = childName;
+                // the bits after the child belong to the slot again
+                if (boundaries.find(childEnd) == boundaries.end()) {
+                    boundaries[childEnd] = slot->name() + " extra";
+                }
+            }
+        }
+        boundaries[bemWidth] = "";
+
+        fields_.clear();
+        std::map<unsigned int, string>::const_iterator iter =
+            boundaries.begin();
+        while (iter != boundaries.end()) {
+            std::map<unsigned int, string>::const_iterator next = iter;
+            ++next;
+            if (next == boundaries.end()) {
+                break;
+            }
+            if (next->first > iter->first) {
+                Field field;
+                field.name = iter->second;
+                field.begin = iter->first;
+                field.width = next->first - iter->first;
+                field.huffman = false;
+                fields_.push_back(field);
+            }
+            iter = next;
+        }
+    }
+
+    /**
+     * Collects the dictionaries of the fields from all the programs.
+     */
+    void
+    createDictionaries() {
+        instructionPatterns_.clear();
+        for (int i = 0; i < numberOfPrograms(); i++) {
+            TPEFMap::const_iterator iter = programElement(i);
+            string name = iter->first;
+            startNewProgram(name);
+            setAllInstructionsToStartAtBeginningOfMAU();
+            updateDictionaries(currentProgram());
+        }
+
+        for (unsigned int f = 0; f < fields_.size(); f++) {
+            createHuffmanCodes(fields_.at(f));
+        }
+        dictionaryCreated_ = true;
+    }
+
+    /**
+     * Adds the field patterns of one program to the dictionaries.
+     */
+    void
+    updateDictionaries(const Program& program) {
+        Instruction* instruction = &program.firstInstruction();
+        while (instruction != &NullInstruction::instance()) {
+            InstructionBitVector* instructionBits =
+                bemInstructionBits(*instruction);
+            vector<unsigned int> patterns;
+            for (unsigned int f = 0; f < fields_.size(); f++) {
+                Field& field = fields_.at(f);
+                BitVector bits(
+                    *instructionBits, field.begin,
+                    field.begin + field.width - 1);
+                std::map<BitVector, unsigned int>::iterator entry =
+                    field.index.find(bits);
+                if (entry == field.index.end()) {
+                    entry = field.index.insert(
+                        std::make_pair(bits, field.patterns.size())).first;
+                    field.patterns.push_back(bits);
+                    field.frequencies.push_back(0);
+                }
+                field.frequencies.at(entry->second)++;
+                patterns.push_back(entry->second);
+            }
+            instructionPatterns_.push_back(patterns);
+            instruction = &program.nextInstruction(*instruction);
+            delete instructionBits;
+        }
+    }
+
+    /**
+     * Computes the length limited canonical Huffman codes of a field.
+     */
+    void
+    createHuffmanCodes(Field& field) {
+        HuffmanCode code(field.frequencies, maxCodeLength_);
+        field.huffmanLengths.assign(code.symbolCount(), 0);
+        field.huffmanCodes.assign(code.symbolCount(), BitVector());
+        for (unsigned int i = 0; i < code.symbolCount(); i++) {
+            field.huffmanLengths.at(i) = code.length(i);
+            field.huffmanCodes.at(i) = code.code(i);
+        }
+    }
+
+    /**
+     * Chooses the encoding of each field and computes the width of the
+     * compressed instruction.
+     *
+     * In the automatic mode the fields are switched to the Huffman codes
+     * one at a time as long as it makes the widest instruction narrower,
+     * or keeps its width and shortens the code in total.
+     */
+    void
+    chooseEncodings() {
+        for (unsigned int f = 0; f < fields_.size(); f++) {
+            fields_.at(f).huffman =
+                encoding_ == ENC_HUFFMAN && fields_.at(f).patterns.size() > 1;
+        }
+
+        vector<unsigned int> lengths(instructionPatterns_.size(), 0);
+        for (unsigned int i = 0; i < instructionPatterns_.size(); i++) {
+            lengths.at(i) = instructionLength(instructionPatterns_.at(i));
+        }
+
+        if (encoding_ == ENC_AUTO) {
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (unsigned int f = 0; f < fields_.size(); f++) {
+                    Field& field = fields_.at(f);
+                    if (field.huffman || field.patterns.size() < 2) {
+                        continue;
+                    }
+                    unsigned long long oldTotal = 0;
+                    unsigned long long newTotal = 0;
+                    unsigned int oldWidth = 0;
+                    unsigned int newWidth = 0;
+                    for (unsigned int i = 0; i < lengths.size(); i++) {
+                        unsigned int pattern = instructionPatterns_[i][f];
+                        unsigned int length = lengths[i] -
+                            field.fixedWidth() +
+                            field.huffmanLengths.at(pattern);
+                        oldTotal += lengths[i];
+                        newTotal += length;
+                        oldWidth = std::max(oldWidth, lengths[i]);
+                        newWidth = std::max(newWidth, length);
+                    }
+                    if (newWidth < oldWidth ||
+                        (newWidth == oldWidth && newTotal < oldTotal)) {
+                        field.huffman = true;
+                        for (unsigned int i = 0; i < lengths.size(); i++) {
+                            unsigned int pattern = instructionPatterns_[i][f];
+                            lengths[i] = lengths[i] - field.fixedWidth() +
+                                field.huffmanLengths.at(pattern);
+                        }
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        compressedWidth_ = 0;
+        for (unsigned int i = 0; i < lengths.size(); i++) {
+            compressedWidth_ = std::max(compressedWidth_, lengths.at(i));
+        }
+        // an instruction memory must be at least one bit wide
+        compressedWidth_ = std::max(compressedWidth_, 1u);
+    }
+
+    /**
+     * Returns the length of the compressed instruction with the given
+     * field patterns.
+     */
+    unsigned int
+    instructionLength(const vector<unsigned int>& patterns) const {
+        unsigned int length = 0;
+        for (unsigned int f = 0; f < fields_.size(); f++) {
+            length += fields_.at(f).codeLength(patterns.at(f));
+        }
+        return length;
+    }
+
+    /**
+     * Returns the decompressor stall cycles of an instruction.
+     */
+    unsigned int
+    stallCycles(const vector<unsigned int>& patterns) const {
+        if (slowDecodeCycles_ == 0) {
+            return 0;
+        }
+        for (unsigned int f = 0; f < fields_.size(); f++) {
+            const Field& field = fields_.at(f);
+            if (field.huffman &&
+                field.huffmanLengths.at(patterns.at(f)) > fastCodeLength_) {
+                return slowDecodeCycles_;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Tells whether some instruction can take the slow decoding path.
+     */
+    bool
+    hasSlowPath() const {
+        if (slowDecodeCycles_ == 0) {
+            return false;
+        }
+        for (unsigned int f = 0; f < fields_.size(); f++) {
+            const Field& field = fields_.at(f);
+            for (unsigned int p = 0; field.huffman &&
+                     p < field.patterns.size(); p++) {
+                if (field.huffmanLengths.at(p) > fastCodeLength_) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Adds the compressed instructions to the program.
+     */
+    void
+    addInstructions() {
+        stalls_.clear();
+        Instruction* instruction = &currentProgram().firstInstruction();
+        while (instruction != &NullInstruction::instance()) {
+            InstructionBitVector* bemBits = bemInstructionBits(*instruction);
+            InstructionBitVector* compressedInstruction =
+                new InstructionBitVector();
+            // Take a BitVector pointer to the compressed instruction because
+            // we _need_ to use BitVector pushBack-methods!
+            BitVector* compressPtr =
+                static_cast<BitVector*>(compressedInstruction);
+
+            vector<unsigned int> patterns;
+            for (unsigned int f = 0; f < fields_.size(); f++) {
+                const Field& field = fields_.at(f);
+                BitVector bits(
+                    *bemBits, field.begin, field.begin + field.width - 1);
+                unsigned int pattern = MapTools::valueForKey<unsigned int>(
+                    field.index, bits);
+                patterns.push_back(pattern);
+                if (field.huffman) {
+                    compressPtr->pushBack(field.huffmanCodes.at(pattern));
+                } else if (field.fixedWidth() > 0) {
+                    compressPtr->pushBack(pattern, field.fixedWidth());
+                }
+            }
+            // pad to the instruction word so that the codes of the
+            // instruction are found from its MAU only
+            while (compressPtr->size() < compressedWidth_) {
+                compressPtr->pushBack(false);
+            }
+            addInstruction(*instruction, compressedInstruction);
+
+            unsigned int stall = stallCycles(patterns);
+            if (stall > 0) {
+                stalls_.push_back(
+                    std::make_pair(memoryAddress(*instruction), stall));
+            }
+            instruction = &currentProgram().nextInstruction(*instruction);
+            delete bemBits;
+        }
+    }
+
+    /**
+     * Writes the decompressor stall cycles of the current program.
+     *
+     * @param programName Name of the program.
+     * @exception IOException If the file cannot be written.
+     */
+    void
+    writeStallFile(const string& programName) {
+        string fileName = parameterValue(STALL_FILE);
+        if (numberOfPrograms() > 1) {
+            fileName += "." + FileSystem::fileOfPath(programName);
+        }
+        std::ofstream stallFile(fileName.c_str());
+        if (!stallFile.is_open()) {
+            throw IOException(
+                __FILE__, __LINE__, __func__,
+                "Cannot write the stall file " + fileName);
+        }
+        stallFile << "# decompressor stall cycles of " << programName << endl
+                  << "# instruction address, stall cycles" << endl;
+        for (unsigned int i = 0; i < stalls_.size(); i++) {
+            stallFile << stalls_.at(i).first << " "
+                      << stalls_.at(i).second << endl;
+        }
+    }
+
+    void
+    generateDecompressorEntity(std::ostream& stream, TCEString entityStr) {
+        stream << "library ieee;" << endl;
+        stream << "use ieee.std_logic_1164.all;" << endl;
+        stream << "use ieee.std_logic_arith.all;" << endl;
+        stream << "use work." << entityStr << "_globals.all;" << endl;
+        stream << "use work." << entityStr << "_imem_mau.all;" << endl << endl;
+
+        stream << "entity " << entityStr << "_decompressor is" << endl;
+        stream << indentation(1) << "port (" << endl;
+        stream << indentation(2) << "fetch_en : out std_logic;" << endl;
+        stream << indentation(2) << "lock : in std_logic;" << endl;
+        stream << indentation(2)
+               << "fetchblock : in std_logic_vector("
+               << "IMEMWIDTHINMAUS*IMEMMAUWIDTH-1 downto 0);" << endl;
+        stream << indentation(2)
+               << "instructionword : out std_logic_vector("
+               << "INSTRUCTIONWIDTH-1 downto 0);" << endl;
+        stream << indentation(2) << "glock : out std_logic;" << endl;
+        stream << indentation(2) << "lock_r : in std_logic;" << endl;
+        stream << indentation(2) << "clk : in std_logic;" << endl;
+        stream << indentation(2) << "rstx : in std_logic);" << endl << endl;
+        stream << "end " << entityStr << "_decompressor;" << endl << endl;
+    }
+
+    void
+    generateDecompressorArchitecture(
+        std::ostream& stream, TCEString entityStr) {
+        stream << "architecture field_huffman of " << entityStr
+               << "_decompressor is" << endl << endl;
+
+        generateDecompressorSignals(stream);
+
+        stream << "begin" << endl << endl;
+        stream << indentation(1) << "fetch_en <= not lock_r;" << endl;
+        if (hasSlowPath()) {
+            generateStallLogic(stream);
+        } else {
+            stream << indentation(1) << "glock <= lock;" << endl << endl;
+        }
+        generateDecoderProcess(stream);
+
+        stream << "end field_huffman;" << endl;
+    }
+
+    void
+    generateDecompressorSignals(std::ostream& stream) {
+        for (unsigned int f = 0; f < fields_.size(); f++) {
+            const Field& field = fields_.at(f);
+            if (field.huffman) {
+                // the Huffman coded patterns are in the decoder process
+                continue;
+            }
+            stream << indentation(1) << "-- " << field.name << endl;
+            if (field.patterns.size() == 1) {
+                stream << indentation(1) << "constant field_" << f
+                       << "_value : std_logic_vector(" << field.width - 1
+                       << " downto 0) := \"" << bitString(field.patterns.at(0))
+                       << "\";" << endl << endl;
+                continue;
+            }
+            stream << indentation(1) << "type field_" << f
+                   << "_dict_type is array (0 to " << field.patterns.size() - 1
+                   << ") of std_logic_vector(" << field.width - 1
+                   << " downto 0);" << endl;
+            stream << indentation(1) << "constant field_" << f
+                   << "_dict : field_" << f << "_dict_type := (" << endl;
+            for (unsigned int p = 0; p < field.patterns.size(); p++) {
+                stream << indentation(2) << "\""
+                       << bitString(field.patterns.at(p)) << "\"";
+                if (p + 1 < field.patterns.size()) {
+                    stream << "," << endl;
+                } else {
+                    stream << ");" << endl << endl;
+                }
+            }
+        }
+        if (hasSlowPath()) {
+            stream << indentation(1) << "signal decode_slow : std_logic;"
+                   << endl;
+            stream << indentation(1)
+                   << "signal stall_count : integer range 0 to "
+                   << slowDecodeCycles_ << ";" << endl;
+            stream << indentation(1) << "signal decode_stall : std_logic;"
+                   << endl << endl;
+        }
+    }
+
+    /**
+     * Generates the logic that locks the core while an instruction is
+     * decoded on the slow path.
+     */
+    void
+    generateStallLogic(std::ostream& stream) {
+        stream << indentation(1)
+               << "decode_stall <= '1' when decode_slow = '1' and "
+               << "stall_count < " << slowDecodeCycles_ << " else '0';"
+               << endl;
+        stream << indentation(1) << "glock <= lock or decode_stall;"
+               << endl << endl;
+        stream << indentation(1) << "stall : process (clk, rstx)" << endl
+               << indentation(1) << "begin" << endl
+               << indentation(2) << "if rstx = '0' then" << endl
+               << indentation(3) << "stall_count <= 0;" << endl
+               << indentation(2) << "elsif clk'event and clk = '1' then"
+               << endl
+               << indentation(3) << "if lock = '0' then" << endl
+               << indentation(4) << "if decode_stall = '1' then" << endl
+               << indentation(5) << "stall_count <= stall_count + 1;" << endl
+               << indentation(4) << "else" << endl
+               << indentation(5) << "stall_count <= 0;" << endl
+               << indentation(4) << "end if;" << endl
+               << indentation(3) << "end if;" << endl
+               << indentation(2) << "end if;" << endl
+               << indentation(1) << "end process stall;" << endl << endl;
+    }
+
+    /**
+     * Generates the process that decodes the fields one after another.
+     *
+     * The codes of a field start where the codes of the previous field
+     * end, so the remaining codes are kept in a window that is shifted
+     * left by the length of each decoded code.
+     */
+    void
+    generateDecoderProcess(std::ostream& stream) {
+        const unsigned int bemWidth = binaryEncoding().width();
+        const unsigned int high = compressedWidth_ - 1;
+        const bool slowPath = hasSlowPath();
+
+        stream << indentation(1) << "decode : process (fetchblock)" << endl
+               << indentation(2) << "variable window : std_logic_vector("
+               << high << " downto 0);" << endl;
+        if (slowPath) {
+            stream << indentation(2) << "variable slow : std_logic;" << endl;
+        }
+        stream << indentation(1) << "begin" << endl
+               << indentation(2) << "window := fetchblock(fetchblock'length-1"
+               << " downto fetchblock'length-" << compressedWidth_ << ");"
+               << endl;
+        if (slowPath) {
+            stream << indentation(2) << "slow := '0';" << endl;
+        }
+        stream << endl;
+
+        for (unsigned int f = 0; f < fields_.size(); f++) {
+            const Field& field = fields_.at(f);
+            TCEString target = (boost::format(
+                "instructionword(%d downto %d)")
+                % (bemWidth - field.begin - 1)
+                % (bemWidth - field.begin - field.width)).str();
+
+            stream << indentation(2) << "-- " << field.name << endl;
+            if (field.patterns.size() == 1) {
+                stream << indentation(2) << target << " <= field_" << f
+                       << "_value;" << endl << endl;
+            } else if (!field.huffman) {
+                unsigned int width = field.fixedWidth();
+                stream << indentation(2) << target << " <= field_" << f
+                       << "_dict(conv_integer(unsigned(window(" << high
+                       << " downto " << compressedWidth_ - width << "))));"
+                       << endl;
+                stream << indentation(2) << shiftWindow(width) << endl
+                       << endl;
+            } else {
+                for (unsigned int p = 0; p < field.patterns.size(); p++) {
+                    unsigned int length = field.huffmanLengths.at(p);
+                    stream << indentation(2) << (p == 0 ? "if" : "elsif")
+                           << " window(" << high << " downto "
+                           << compressedWidth_ - length << ") = \""
+                           << bitString(field.huffmanCodes.at(p))
+                           << "\" then" << endl;
+                    stream << indentation(3) << target << " <= \""
+                           << bitString(field.patterns.at(p)) << "\";"
+                           << endl;
+                    stream << indentation(3) << shiftWindow(length) << endl;
+                    if (slowPath && length > fastCodeLength_) {
+                        stream << indentation(3) << "slow := '1';" << endl;
+                    }
+                }
+                stream << indentation(2) << "else" << endl
+                       << indentation(3) << target << " <= (others => '0');"
+                       << endl
+                       << indentation(2) << "end if;" << endl << endl;
+            }
+        }
+        if (slowPath) {
+            stream << indentation(2) << "decode_slow <= slow;" << endl;
+        }
+        stream << indentation(1) << "end process decode;" << endl << endl;
+    }
+
+    /**
+     * Returns the VHDL statement that drops the given number of bits from
+     * the beginning of the decoding window.
+     */
+    string
+    shiftWindow(unsigned int bits) const {
+        if (bits >= compressedWidth_) {
+            return "window := (others => '0');";
+        }
+        return (boost::format(
+            "window := window(%d downto 0) & \"%s\";")
+            % (compressedWidth_ - bits - 1) % string(bits, '0')).str();
+    }
+
+    /**
+     * Returns the bits as a string of ones and zeros.
+     */
+    static string
+    bitString(const BitVector& bits) {
+        string result;
+        for (unsigned int i = 0; i < bits.size(); i++) {
+            result += bits.at(i) ? '1' : '0';
+        }
+        return result;
+    }
+
+    void
+    printDetails() {
+        const unsigned int bemWidth = binaryEncoding().width();
+        int widthInBytes = static_cast<int>(
+            std::ceil(compressedWidth_ / 8.0));
+        Application::logStream()
+            << "uncompressed instruction width: " << bemWidth << endl
+            << "compressed instruction width: " << compressedWidth_ << " ("
+            << widthInBytes << " bytes)" << endl;
+
+        std::size_t totalSize = 0;
+        for (unsigned int f = 0; f < fields_.size(); f++) {
+            const Field& field = fields_.at(f);
+            unsigned long long codeBits = 0;
+            unsigned long long uses = 0;
+            unsigned int longest = 0;
+            for (unsigned int p = 0; p < field.patterns.size(); p++) {
+                codeBits += static_cast<unsigned long long>(
+                    field.codeLength(p)) * field.frequencies.at(p);
+                uses += field.frequencies.at(p);
+                longest = std::max(longest, field.codeLength(p));
+            }
+            std::size_t entries = field.patterns.size();
+            std::size_t size = entries > 1 ? entries * field.width : 0;
+            totalSize += size;
+            Application::logStream()
+                << (boost::format(
+                        "Field %d (%s): width %d bits, entries: %d, "
+                        "%s code, average %.2f bits, longest %d bits, "
+                        "dictionary size: %d bits\n")
+                    % f % field.name % field.width % entries
+                    % (field.huffman ? "Huffman" : "fixed")
+                    % (uses > 0 ? double(codeBits) / uses : 0.0)
+                    % longest % size).str();
+        }
+
+        unsigned long long totalBits = 0;
+        unsigned int slowInstructions = 0;
+        for (unsigned int i = 0; i < instructionPatterns_.size(); i++) {
+            totalBits += instructionLength(instructionPatterns_.at(i));
+            if (stallCycles(instructionPatterns_.at(i)) > 0) {
+                slowInstructions++;
+            }
+        }
+        Application::logStream()
+            << (boost::format(
+                    "Average compressed instruction: %.2f bits\n"
+                    "Total dictionary size: %d bits (%d bytes)\n")
+                % (instructionPatterns_.empty() ? 0.0 :
+                   double(totalBits) / instructionPatterns_.size())
+                % totalSize
+                % std::size_t(std::ceil(totalSize / 8.0))).str();
+        if (slowDecodeCycles_ > 0) {
+            Application::logStream()
+                << (boost::format(
+                        "Instructions on the slow decoding path: %d of %d "
+                        "(%d stall cycles each)\n")
+                    % slowInstructions % instructionPatterns_.size()
+                    % slowDecodeCycles_).str();
+        }
+        Application::logStream() << endl;
+    }
+
+    /// The fields of the instruction and their dictionaries.
+    vector<Field> fields_;
+
+    /// The dictionary indices of the fields of each instruction in the
+    /// compressed programs.
+    vector<vector<unsigned int> > instructionPatterns_;
+
+    /// Addresses and stall cycles of the slow instructions of the current
+    /// program.
+    vector<pair<unsigned int, unsigned int> > stalls_;
+
+    /// Indicates whether the dictionary has been created
+    bool dictionaryCreated_;
+
+    /// Width of the compressed instruction.
+    unsigned int compressedWidth_;
+
+    /// The requested encoding of the dictionary indices.
+    Encoding encoding_;
+
+    /// Length limit of the Huffman codes.
+    unsigned int maxCodeLength_;
+
+    /// Longest code decoded in the fetch cycle when there is a slow path.
+    unsigned int fastCodeLength_;
+
+    /// Stall cycles of the slow decoding path, 0 if there is none.
+    unsigned int slowDecodeCycles_;
+};
+
+EXPORT_CODE_COMPRESSOR(FieldHuffmanDictionary)
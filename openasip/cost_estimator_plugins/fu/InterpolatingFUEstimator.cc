@@ -37,7 +37,7 @@
 #include "Exception.hh"
 #include "HDBManager.hh"
 #include "FunctionUnit.hh"
-#include "ExecutionTrace.hh"
+#include "ActivityCounters.hh"
 #include "CostDatabase.hh"
 #include "EntryKeyProperty.hh"
 #include "CostDBTypes.hh"
@@ -64,6 +64,7 @@ public:
     InterpolatingFUEstimator(const std::string& name) :
         FUCostEstimationPlugin(name) {
         costDatabaseRegistry_ = &CostDatabaseRegistry::instance();
+        costdb_ = NULL;
     }
 
     virtual ~InterpolatingFUEstimator() {
@@ -264,7 +265,7 @@ public:
         const TTAMachine::FunctionUnit& fu,
         const IDF::FUImplementationLocation& implementation,
         const TTAProgram::Program& /*program*/,
-        const ExecutionTrace& trace,
+        const ActivityCounters& trace,
         EnergyInMilliJoules& energy,
         HDB::HDBManager& hdb) {
 
@@ -279,19 +280,19 @@ public:
             Application::logStream() 
                 << "## function unit " << fu.name() << ": " << std::endl;
 #endif
-            ExecutionTrace::FUOperationTriggerCountList* operationTriggers =
-                trace.functionUnitOperationTriggerCounts(fu.name());
-            for (ExecutionTrace::FUOperationTriggerCountList::
+            ActivityCounters::FUOperationTriggerCountList* operationTriggers =
+                trace.functionUnitOperationTriggerCounts(fu);
+            for (ActivityCounters::FUOperationTriggerCountList::
                      const_iterator i = operationTriggers->begin(); 
                  i != operationTriggers->end(); ++i) {
 
-                const ExecutionTrace::FUOperationTriggerCount& triggerCount = 
-                    *i;
+                const ActivityCounters::FUOperationTriggerCount&
+                    triggerCount = *i;
 
-                const ExecutionTrace::OperationID operation = 
+                const ActivityCounters::OperationID operation = 
                     StringTools::stringToLower(triggerCount.get<0>());
 
-                const ExecutionTrace::OperationTriggerCount count = 
+                const ActivityCounters::OperationTriggerCount count = 
                     triggerCount.get<1>();
 
                 const std::string dataName = 
@@ -399,8 +400,6 @@ private:
     CostDatabaseRegistry* costDatabaseRegistry_;
     /// Cost database being used.
     CostDatabase* costdb_;
-    /// Search strategy to be used with the cost database.
-    SearchStrategy* strategy_;
     /// Entry key property of function unit.
     EntryKeyProperty* unitProperty_;
     /// Search type for each entry type.
@@ -414,17 +413,29 @@ private:
 /**
  * Initializes the plugin.
  *
+ * The cost database and the search types are set up only once per HDB,
+ * so the results of the earlier queries stay cached between estimations.
+ *
  * @param hdb The HDB to be used in searching entries. Cost database is created
  * in basis of this HDB.
  */
 void
 initializeEstimator(const HDBManager& hdb) {
     
-    costdb_ = &costDatabaseRegistry_->costDatabase(hdb);
-    strategy_ = new FilterSearch();
-    costdb_->setSearchStrategy(strategy_);
+    CostDatabase* costdb = &costDatabaseRegistry_->costDatabase(hdb);
+    if (costdb == costdb_) {
+        // keep the search strategy and the results it has cached
+        return;
+    }
+    costdb_ = costdb;
+    if (!costdb_->hasSearchStrategy()) {
+        FilterSearch strategy;
+        costdb_->setSearchStrategy(&strategy);
+    }
     unitProperty_ = EntryKeyProperty::find(CostDBTypes::EK_UNIT);
-    createSearchTypes();
+    if (unitMatchType_.empty()) {
+        createSearchTypes();
+    }
 }
 
 /**
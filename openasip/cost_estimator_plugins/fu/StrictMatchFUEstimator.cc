@@ -38,7 +38,7 @@
 #include "Exception.hh"
 #include "HDBManager.hh"
 #include "FunctionUnit.hh"
-#include "ExecutionTrace.hh"
+#include "ActivityCounters.hh"
 #include "StringTools.hh"
 
 using namespace CostEstimator;
@@ -209,7 +209,7 @@ public:
         const TTAMachine::FunctionUnit& fu,
         const IDF::FUImplementationLocation& implementation,
         const TTAProgram::Program& /*program*/,
-        const ExecutionTrace& trace,
+        const ActivityCounters& trace,
         EnergyInMilliJoules& energy,
         HDB::HDBManager& hdb) {
 
@@ -221,19 +221,19 @@ public:
             << "## function unit " << fu.name() << ": " << std::endl;
 #endif
         try {
-            ExecutionTrace::FUOperationTriggerCountList* operationTriggers =
-                trace.functionUnitOperationTriggerCounts(fu.name());
-            for (ExecutionTrace::FUOperationTriggerCountList::
+            ActivityCounters::FUOperationTriggerCountList* operationTriggers =
+                trace.functionUnitOperationTriggerCounts(fu);
+            for (ActivityCounters::FUOperationTriggerCountList::
                      const_iterator i = operationTriggers->begin(); 
                  i != operationTriggers->end(); ++i) {
 
-                const ExecutionTrace::FUOperationTriggerCount& triggerCount = 
-                    *i;
+                const ActivityCounters::FUOperationTriggerCount&
+                    triggerCount = *i;
 
-                const ExecutionTrace::OperationID operation = 
+                const ActivityCounters::OperationID operation = 
                     StringTools::stringToLower(triggerCount.get<0>());
 
-                const ExecutionTrace::OperationTriggerCount count = 
+                const ActivityCounters::OperationTriggerCount count = 
                     triggerCount.get<1>();
 
                 const std::string dataName = 
@@ -38,7 +38,7 @@
 #include "HDBManager.hh"
 #include "BaseRegisterFile.hh"
 #include "RegisterFile.hh"
-#include "ExecutionTrace.hh"
+#include "ActivityCounters.hh"
 #include "CostDatabase.hh"
 #include "EntryKeyProperty.hh"
 #include "CostDBTypes.hh"
@@ -57,6 +57,7 @@ public:
     InterpolatingRFEstimator(const std::string& name) :
         RFCostEstimationPlugin(name) {
         costDatabaseRegistry_ = &CostDatabaseRegistry::instance();
+        costdb_ = NULL;
     }
 
     virtual ~InterpolatingRFEstimator() {
@@ -269,7 +270,7 @@ public:
         const TTAMachine::BaseRegisterFile& rf,
         const IDF::RFImplementationLocation&,
         const TTAProgram::Program&,
-        const ExecutionTrace& trace,
+        const ActivityCounters& trace,
         EnergyInMilliJoules& energy,
         HDB::HDBManager& hdb) {
 
@@ -286,13 +287,13 @@ public:
                 << "## register file " << rf.name() << ": " << std::endl;
 #endif
             
-            ExecutionTrace::ConcurrentRFAccessCountList* accessList =
-                trace.registerFileAccessCounts(rf.name());
-            for (ExecutionTrace::ConcurrentRFAccessCountList::
+            ActivityCounters::ConcurrentRFAccessCountList* accessList =
+                trace.registerFileAccessCounts(rf);
+            for (ActivityCounters::ConcurrentRFAccessCountList::
                      const_iterator i = accessList->begin(); 
                  i != accessList->end(); ++i) {
-                const ExecutionTrace::ConcurrentRFAccessCount& accessCount = 
-                    *i;
+                const ActivityCounters::ConcurrentRFAccessCount&
+                    accessCount = *i;
                 
                 const std::size_t reads = accessCount.get<0>();
                 const std::size_t writes = accessCount.get<1>();
@@ -405,8 +406,6 @@ private:
     CostDatabaseRegistry* costDatabaseRegistry_;
     /// Cost database being used.
     CostDatabase* costdb_;
-    /// Search strategy to be used with the cost database.
-    SearchStrategy* strategy_;
     /// Entry key property of register file.
     EntryKeyProperty* rfileProperty_;
     /// Search type for each entry type.
@@ -420,17 +419,29 @@ private:
 /**
  * Initializes the plugin.
  *
+ * The cost database and the search types are set up only once per HDB,
+ * so the results of the earlier queries stay cached between estimations.
+ *
  * @param hdb The HDB to be used in searching entries. Cost database is created
  * in basis of this HDB.
  */
 void 
 initializeEstimator(const HDBManager& hdb) {
 
-    costdb_ = &costDatabaseRegistry_->costDatabase(hdb);
-    strategy_ = new FilterSearch();
-    costdb_->setSearchStrategy(strategy_);
+    CostDatabase* costdb = &costDatabaseRegistry_->costDatabase(hdb);
+    if (costdb == costdb_) {
+        // keep the search strategy and the results it has cached
+        return;
+    }
+    costdb_ = costdb;
+    if (!costdb_->hasSearchStrategy()) {
+        FilterSearch strategy;
+        costdb_->setSearchStrategy(&strategy);
+    }
     rfileProperty_ = EntryKeyProperty::find(CostDBTypes::EK_RFILE);
-    createSearchTypes();
+    if (interpMatchType_.empty()) {
+        createSearchTypes();
+    }
 }
 
 /**
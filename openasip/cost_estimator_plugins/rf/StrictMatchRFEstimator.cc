@@ -38,7 +38,7 @@
 #include "Exception.hh"
 #include "HDBManager.hh"
 #include "BaseRegisterFile.hh"
-#include "ExecutionTrace.hh"
+#include "ActivityCounters.hh"
 #include "Conversion.hh"
 
 using namespace CostEstimator;
@@ -231,7 +231,7 @@ public:
         const TTAMachine::BaseRegisterFile& rf,
         const IDF::RFImplementationLocation& implementation,
         const TTAProgram::Program&,
-        const ExecutionTrace& trace,
+        const ActivityCounters& trace,
         EnergyInMilliJoules& energy,
         HDB::HDBManager& hdb) {
 
@@ -244,13 +244,13 @@ public:
             << "## register file " << rf.name() << ": " << std::endl;
 #endif
         try {
-            ExecutionTrace::ConcurrentRFAccessCountList* accessList =
-                trace.registerFileAccessCounts(rf.name());
-            for (ExecutionTrace::ConcurrentRFAccessCountList::
+            ActivityCounters::ConcurrentRFAccessCountList* accessList =
+                trace.registerFileAccessCounts(rf);
+            for (ActivityCounters::ConcurrentRFAccessCountList::
                      const_iterator i = accessList->begin(); 
                  i != accessList->end(); ++i) {
-                const ExecutionTrace::ConcurrentRFAccessCount& accessCount = 
-                    *i;
+                const ActivityCounters::ConcurrentRFAccessCount&
+                    accessCount = *i;
 
                 const std::size_t reads = accessCount.get<0>();
                 const std::size_t writes = accessCount.get<1>();
@@ -125,8 +125,8 @@ class ConnectionSweeper : public DesignSpaceExplorerPlugin {
             dsdb.configuration(startPointConfigurationID);
             
         // loads starting configuration
-        Machine* origMach = NULL;
-        origMach = dsdb.architecture(startConf.architectureID);
+        std::shared_ptr<const Machine> origMach =
+            dsdb.sharedArchitecture(startConf.architectureID);
         // get cycle counts for the original architecture for each app
         std::set<RowID> appIds = dsdb.applicationIDs();
         for (std::set<RowID>::const_iterator appI = appIds.begin(); 
@@ -200,8 +200,10 @@ class ConnectionSweeper : public DesignSpaceExplorerPlugin {
         DSDBManager::MachineConfiguration startConf = 
             db().configuration(startPointConfigurationID);
             
-        // loads starting configuration
-        Machine* mach = db().architecture(startConf.architectureID);
+        // loads starting configuration, the collected connections point
+        // to this machine so it is kept alive until the sweep ends
+        std::shared_ptr<const Machine> mach =
+            db().sharedArchitecture(startConf.architectureID);
         DSDBManager::MachineConfiguration bestConf = startConf;
 
 
@@ -279,8 +281,10 @@ class ConnectionSweeper : public DesignSpaceExplorerPlugin {
         DSDBManager::MachineConfiguration startConf = 
             db().configuration(startPointConfigurationID);
             
-        // loads starting configuration
-        Machine* mach = db().architecture(startConf.architectureID);
+        // loads starting configuration, the collected connections point
+        // to this machine so it is kept alive until the sweep ends
+        std::shared_ptr<const Machine> mach =
+            db().sharedArchitecture(startConf.architectureID);
         DSDBManager::MachineConfiguration bestConf = startConf;
 
         std::list<RowID> result;
@@ -434,15 +438,9 @@ private:
         bool success = evaluate(conf, estimates, false);
         float worsening = averageWorsening(confId);
         if (success) {
-#if (!defined(HAVE_CXX11) && !defined(HAVE_CXX0X))
-            std::auto_ptr<TTAMachine::Machine> arch
-                (db().architecture(
-                    db().configuration(confId).architectureID));
-#else
-            std::unique_ptr<TTAMachine::Machine> arch
-                (db().architecture(
-                    db().configuration(confId).architectureID));
-#endif
+            std::shared_ptr<const TTAMachine::Machine> arch =
+                db().sharedArchitecture(
+                    db().configuration(confId).architectureID);
 
             
             if (worsening <= ccWorseningThreshold_) {
@@ -493,8 +491,8 @@ private:
             couldRemove = false;
             const TTAMachine::Connection* mostUnneededConn = NULL;
             float bestAvgccWorsening = 100.0;
-            TTAMachine::Machine* currentMachine = 
-                db().architecture(bestConf.architectureID);
+            std::shared_ptr<const TTAMachine::Machine> currentMachine =
+                db().sharedArchitecture(bestConf.architectureID);
             RowID bestConfInThisIteration = -1;
             std::vector<const TTAMachine::Connection*>::iterator unneededPos = 
                 connections.end();
@@ -530,7 +528,7 @@ private:
                         s << (int)bestAvgccWorsening << "% " 
                           << " total connections: "
                           << MachineConnectivityCheck::totalConnectionCount(
-                              *db().architecture(
+                              *db().sharedArchitecture(
                                   db().configuration(confId).architectureID));
                         verboseLog(s);
                     }
@@ -552,7 +550,7 @@ private:
                   << bestConfInThisIteration << " avg worsening: ";
                 s << (int)bestAvgccWorsening << "% " << " total connections: "
                   << MachineConnectivityCheck::totalConnectionCount(
-                      *db().architecture(bestConf.architectureID));
+                      *db().sharedArchitecture(bestConf.architectureID));
                 verboseLog(s);
             }
         }
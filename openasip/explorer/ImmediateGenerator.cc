@@ -33,6 +33,8 @@
 #include <vector>
 #include <string>
 #include <set>
+#include <map>
+#include <algorithm>
 
 #include "DesignSpaceExplorerPlugin.hh"
 #include "DSDBManager.hh"
@@ -56,6 +58,11 @@
 #include "Procedure.hh"
 #include "MachineResourceModifier.hh"
 #include "Conversion.hh"
+#include "ExecutionProfile.hh"
+#include "Immediate.hh"
+#include "TerminalImmediate.hh"
+#include "MathTools.hh"
+#include "Bus.hh"
 
 using namespace TTAProgram;
 using namespace TTAMachine;
@@ -78,7 +85,10 @@ class ImmediateGenerator : public DesignSpaceExplorerPlugin {
         width_(32),
         widthPart_(8),
         split_(false),
-        dstImmUnitName_("") {
+        dstImmUnitName_(""),
+        tpef_(""),
+        profile_(""),
+        coverage_(99) {
 
         // compulsory parameters
         // no compulsory parameters
@@ -92,6 +102,9 @@ class ImmediateGenerator : public DesignSpaceExplorerPlugin {
         addParameter(widthPartPN_, UINT, false, Conversion::toString(widthPart_));
         addParameter(splitPN_, BOOL, false, Conversion::toString(split_));
         addParameter(dstImmUnitNamePN_, STRING, false, dstImmUnitName_);
+        addParameter(tpefPN_, STRING, false, tpef_);
+        addParameter(profilePN_, STRING, false, profile_);
+        addParameter(coveragePN_, UINT, false, Conversion::toString(coverage_));
     }
 
     virtual bool requiresStartingPointArchitecture() const { return true; }
@@ -113,6 +126,13 @@ class ImmediateGenerator : public DesignSpaceExplorerPlugin {
      * - width_part, int, minimum size of width per slot. Default 8.
      * - split, boolean, split immediate among slots.
      * - dst_imm_unit, string, destination immediate unit.
+     * - tpef, string, program scheduled for the starting point machine.
+     * - profile, string, execution profile of the program written by
+     *   ttasim --execution-profile. With tpef, overrides width with the
+     *   narrowest width that covers the given percentage of the executed
+     *   long immediates.
+     * - coverage, int, percentage of the executed long immediates the
+     *   profile guided width has to cover, 0-100. Default 99.
      *
      * @param startPointConfigurationID Configuration to optimize.
      */
@@ -148,6 +168,11 @@ class ImmediateGenerator : public DesignSpaceExplorerPlugin {
                 removeInsTemplate(*mach, removeInsTemplateName_);
             }
 
+            if (!addInsTemplateName_.empty() && !tpef_.empty() &&
+                !profile_.empty()) {
+                selectProfiledWidth(*mach);
+            }
+
             if (!addInsTemplateName_.empty()) {
                 if (split_) {
                     addSplitInsTemplate(*mach, addInsTemplateName_);    
@@ -209,6 +234,9 @@ private:
     static const std::string widthPartPN_;
     static const std::string splitPN_;
     static const std::string dstImmUnitNamePN_;
+    static const std::string tpefPN_;
+    static const std::string profilePN_;
+    static const std::string coveragePN_;
 
     // parameters
     /// print values
@@ -227,6 +255,12 @@ private:
     bool split_;
     /// destination immediate unit name
     std::string dstImmUnitName_;
+    /// program scheduled for the starting point machine
+    std::string tpef_;
+    /// execution profile of the program
+    std::string profile_;
+    /// percentage of executed long immediates the template has to cover
+    unsigned int coverage_;
 
 
     /**
@@ -241,6 +275,131 @@ private:
         readCompulsoryParameter(widthPartPN_, widthPart_);
         readCompulsoryParameter(splitPN_, split_);
         readCompulsoryParameter(dstImmUnitNamePN_, dstImmUnitName_);
+        readOptionalParameter(tpefPN_, tpef_);
+        readOptionalParameter(profilePN_, profile_);
+        readOptionalParameter(coveragePN_, coverage_);
+        if (coverage_ > 100) {
+            throw IllegalParameters(
+                __FILE__, __LINE__, __func__,
+                "Parameter " + coveragePN_ + " must be a percentage "
+                "between 0 and 100.");
+        }
+    }
+
+    /**
+     * Returns the number of bits needed to transport the given immediate.
+     *
+     * @param mach The machine.
+     * @param value The immediate.
+     * @param signExtends True if the immediate is sign extended.
+     * @return The number of bits, 0 for immediates that are not numbers
+     * or instruction addresses.
+     */
+    int requiredBits(
+        const TTAMachine::Machine& mach, const Terminal& value,
+        bool signExtends) {
+
+        if (value.isInstructionAddress() || value.isBasicBlockReference() ||
+            value.isCodeSymbolReference()) {
+            ULongWord end = mach.controlUnit()->addressSpace()->end();
+            return signExtends ?
+                MathTools::requiredBitsSigned(SLongWord(end)) :
+                MathTools::requiredBits(end);
+        } else if (value.isImmediate()) {
+            return signExtends ?
+                MathTools::requiredBitsSigned(value.value().sLongWordValue()) :
+                MathTools::requiredBits(value.value().uLongWordValue());
+        }
+        return 0;
+    }
+
+    /**
+     * Sets the width of the added template according to the execution
+     * profile of the program.
+     *
+     * The long immediates of the program are weighted with their
+     * execution counts, that is, the immediates written by the scheduled
+     * long immediate instructions and the move sources that do not fit to
+     * the short immediate field of their bus. The width is set to the
+     * narrowest width that covers the coverage percentage of the weighted
+     * immediates, the rest are left to the wider templates of the machine.
+     *
+     * @param mach The starting point machine.
+     */
+    void selectProfiledWidth(TTAMachine::Machine& mach) {
+        std::map<int, CycleCount> widths;
+        CycleCount total = 0;
+        try {
+            ExecutionProfile profile;
+            profile.readFromFile(profile_);
+            Program* program = Program::loadFromTPEF(tpef_, mach);
+            for (int p = 0; p < program->procedureCount(); p++) {
+                const Procedure& proc = program->procedure(p);
+                for (int i = 0; i < proc.instructionCount(); i++) {
+                    const Instruction& ins = proc.instructionAtIndex(i);
+                    // instructions without moves execute as often as
+                    // their procedure
+                    CycleCount insCount = ins.moveCount() > 0 ?
+                        0 : profile.procedureCount(proc.name());
+                    for (int m = 0; m < ins.moveCount(); m++) {
+                        const Move& move = ins.move(m);
+                        CycleCount count =
+                            profile.moveCount(move, proc.name());
+                        insCount = std::max(insCount, count);
+                        if (!move.source().isImmediate()) {
+                            continue;
+                        }
+                        const Bus& bus = move.bus();
+                        int bits = requiredBits(
+                            mach, move.source(), bus.signExtends());
+                        if (bits > bus.immediateWidth()) {
+                            widths[bits] += count;
+                            total += count;
+                        }
+                    }
+                    for (int imm = 0; imm < ins.immediateCount(); imm++) {
+                        const Immediate& immediate = ins.immediate(imm);
+                        bool signExtends =
+                            immediate.destination().immediateUnit().
+                            extensionMode() == Machine::SIGN;
+                        int bits = requiredBits(
+                            mach, immediate.value(), signExtends);
+                        widths[bits] += insCount;
+                        total += insCount;
+                    }
+                }
+            }
+            delete program;
+        } catch (const Exception& e) {
+            std::ostringstream msg(std::ostringstream::out);
+            msg << "Error while using ImmediateGenerator:" << endl
+                << e.errorMessage() << endl;
+            verboseLog(msg.str());
+            return;
+        }
+
+        if (total == 0) {
+            verboseLog(
+                "ImmediateGenerator: no executed long immediates in the "
+                "profile, using width " + Conversion::toString(width_) +
+                ".");
+            return;
+        }
+
+        CycleCount covered = 0;
+        for (std::map<int, CycleCount>::const_iterator i = widths.begin();
+             i != widths.end(); ++i) {
+            covered += i->second;
+            if (covered * 100 >= total * static_cast<CycleCount>(coverage_)) {
+                width_ = std::max(i->first, 1);
+                break;
+            }
+        }
+        std::ostringstream msg(std::ostringstream::out);
+        msg << "ImmediateGenerator: profile guided template width "
+            << width_ << " bits covers " << (covered * 100 / total)
+            << "% of the executed long immediates." << endl;
+        verboseLog(msg.str());
     }
     
 
@@ -473,5 +632,8 @@ const std::string ImmediateGenerator::widthPN_("width");
 const std::string ImmediateGenerator::widthPartPN_("width_part");
 const std::string ImmediateGenerator::splitPN_("split");
 const std::string ImmediateGenerator::dstImmUnitNamePN_("dst_imm_unit");
+const std::string ImmediateGenerator::tpefPN_("tpef");
+const std::string ImmediateGenerator::profilePN_("profile");
+const std::string ImmediateGenerator::coveragePN_("coverage");
 
 EXPORT_DESIGN_SPACE_EXPLORER_PLUGIN(ImmediateGenerator)
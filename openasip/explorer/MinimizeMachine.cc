@@ -425,13 +425,12 @@ private:
         DSDBManager::MachineConfiguration configuration =
             dsdb.configuration(confToMinimize);
 
-        const TTAMachine::Machine* origMach = NULL;
+        std::shared_ptr<const TTAMachine::Machine> origMach;
         try {
-            origMach = dsdb.architecture(configuration.architectureID);
+            origMach = dsdb.sharedArchitecture(configuration.architectureID);
         } catch (const Exception& e) {
             debugLog(std::string("No machine architecture found in config id "
                         "by MimimizeMachine plugin. "));
-            delete origMach;
             return confToMinimize;
         }
 
@@ -447,15 +446,11 @@ private:
         // evaluates the desing with all dsdb apps
         if (!explorer.evaluate(startConf, estimates, false)) {
             // can't evaluate the given configuration
-            delete origMach;
-            origMach = NULL;
             return confToMinimize;
         }
         
         // check if some apps maxCycles was exceeded
         if (!checkCycleCounts(startConf, maxCycleCounts)) {
-            delete origMach;
-            origMach = NULL;
             return confToMinimize;
         }
 
@@ -519,8 +514,6 @@ private:
             }
         }
 
-        delete origMach;
-        origMach = NULL;
         if (latestConfID != 0) {
             return latestConfID;
         } else {
@@ -555,13 +548,12 @@ private:
         DSDBManager::MachineConfiguration configuration =
             dsdb.configuration(confToMinimize);
 
-        const TTAMachine::Machine* origMach = NULL;
+        std::shared_ptr<const TTAMachine::Machine> origMach;
         try {
-            origMach = dsdb.architecture(configuration.architectureID);
+            origMach = dsdb.sharedArchitecture(configuration.architectureID);
         } catch (const Exception& e) {
             debugLog(std::string("No machine architecture found in config id "
                         "by MimimizeMachine plugin. "));
-            delete origMach;
             return confToMinimize;
         }
 
@@ -575,15 +567,11 @@ private:
 
         if (!explorer.evaluate(startConf, estimates, false)) {
             // can't evaluate the given configuration
-            delete origMach;
-            origMach = NULL;
             return confToMinimize;
         }
 
         // check if some apps maxCycles was exceeded
         if (!checkCycleCounts(startConf, maxCycleCounts)) {
-            delete origMach;
-            origMach = NULL;
             return confToMinimize;
         }
 
@@ -643,8 +631,6 @@ private:
                 i++;
             }
         }
-        delete origMach;
-        origMach = NULL;
         if (latestConfID != 0) {
             return latestConfID;
         } else {
@@ -134,10 +134,10 @@ class SimpleICOptimizer : public DesignSpaceExplorerPlugin {
                 dsdb.configuration(startPointConfigurationID);
             
             // loads starting configuration
-            Machine* origMach = NULL;
+            std::shared_ptr<const Machine> origMach;
             Machine* mach = NULL;
             try {
-                origMach = dsdb.architecture(conf.architectureID);
+                origMach = dsdb.sharedArchitecture(conf.architectureID);
                 mach = dsdb.architecture(conf.architectureID);
             } catch (const Exception& e) {
                 std::ostringstream msg(std::ostringstream::out);
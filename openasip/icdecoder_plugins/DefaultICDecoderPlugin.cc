@@ -59,7 +59,7 @@
 #include "MachineImplementation.hh"
 #include "ICDecoderEstimatorPlugin.hh"
 #include "Program.hh"
-#include "ExecutionTrace.hh"
+#include "ActivityCounters.hh"
 
 #include "ICDecoderGeneratorPlugin.hh"
 #include "ProGeTypes.hh"
@@ -353,14 +353,14 @@ public:
         const TTAMachine::Machine& machine,
         const IDF::MachineImplementation& machineImplementation,
         const TTAProgram::Program& /*program*/,
-        const ExecutionTrace& traceDB,
+        const ActivityCounters& activity,
         EnergyInMilliJoules& energy) {
     
 //#define DEBUG_ENERGY_ESTIMATION
 
         energy = 0.0;
 
-        ClockCycleCount totalCycles = traceDB.simulatedCycleCount();
+        ClockCycleCount totalCycles = activity.simulatedCycleCount();
 
         std::string socketName = "";
         try {
@@ -408,7 +408,7 @@ public:
                         doubleValue();
 
                     ClockCycleCount activeCycles = 
-                        traceDB.socketWriteCount(socket.name());
+                        activity.socketWriteCount(socket);
 
                     EnergyInMilliJoules totalActiveEnergy = 
                         activeEnergy*activeCycles;
@@ -474,7 +474,7 @@ public:
                         doubleValue();
 
                     ClockCycleCount activeCycles = 
-                        traceDB.busWriteCount(bus.name());
+                        activity.busWriteCount(bus);
                     
                     EnergyInMilliJoules totalActiveEnergy = 
                         activeEnergy*activeCycles;
@@ -0,0 +1,146 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2026 Tampere University.
+#
+# This file is part of TTA-Based Codesign Environment (TCE).
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+
+"""
+Finds and builds the test cases of scheduler_benchmark.py and
+simulator_benchmark.py.
+
+A test case is a scheduler_tester.py test directory with the sources of the
+program and a Makefile in src/. The sources are compiled to LLVM bitcode
+with compile_sources.make the same way scheduler_tester.py -s does, once
+for each byte order, and the bitcode matching the machine is then compiled
+with tcecc.
+"""
+
+import os, sys, shlex, shutil, subprocess
+
+rootDir = os.path.dirname(os.path.abspath(__file__))
+ADFDir = os.path.normpath(rootDir + "/ADF")
+operationDir = os.path.normpath(rootDir + "/Operations")
+compileSourcesDefs = os.path.normpath(rootDir + "/compile_sources.make")
+
+# The test cases the benchmarks run unless another root is given.
+defaultTestRootDir = os.path.normpath(
+    rootDir + "/../../../testsuite/systemtest_long/bintools/Scheduler/tests")
+
+# The bitcode files compile_sources.make builds, by byte order.
+bitcodeFiles = {
+    "be": "generated_program.be.bc",
+    "le": "generated_program.le.bc",
+    "64": "generated_program.64.bc",
+}
+
+def findADF(name):
+    if os.path.isabs(name) or os.access(name, os.R_OK):
+        return os.path.abspath(name)
+    return os.path.join(ADFDir, name)
+
+def byteOrder(adf):
+    """Returns the key of the bitcode to compile for the machine."""
+    with open(adf) as adfFile:
+        contents = adfFile.read()
+    if "<little-endian/>" not in contents:
+        return "be"
+    return "64" if "<bitness64/>" in contents else "le"
+
+def findTestCases(testRootDir, testCaseFilters=None):
+    """
+    Returns the test case directories that have the sources to compile.
+
+    The matching to the filters is done from the right of the test case
+    pathname, as in scheduler_tester.py.
+    """
+    found = []
+    for root, dirs, files in os.walk(testRootDir, followlinks=True):
+        dirs.sort()
+        if "description.txt" not in files or "disabled.txt" in files:
+            continue
+        if not os.access(os.path.join(root, "src", "Makefile"), os.R_OK):
+            continue
+        if testCaseFilters is not None and \
+                not any(root.endswith(f) for f in testCaseFilters):
+            continue
+        found.append(root)
+    return found
+
+def extraCompileFlags(testDir):
+    flagsFileName = os.path.join(testDir, "extraCompileFlags")
+    if not os.access(flagsFileName, os.R_OK):
+        return []
+    with open(flagsFileName) as flagsFile:
+        return shlex.split(flagsFile.read())
+
+def linkOperations(testDir):
+    """
+    Links the testbench operations to the test and its sources as the
+    scheduler tester does. Returns the links created, for unlinkOperations.
+    """
+    created = []
+    for link in [os.path.join(testDir, "data"),
+                 os.path.join(testDir, "src", "data")]:
+        if not os.path.lexists(link):
+            os.symlink(operationDir, link)
+            created.append(link)
+    return created
+
+def unlinkOperations(links):
+    for link in links:
+        os.remove(link)
+
+def compileSources(testDir, tceccExe, outputDir, verbose=False):
+    """
+    Compiles the sources of the test case to bitcode files in outputDir.
+
+    Returns a dictionary from the byte order keys to the bitcode files and
+    the output of the build, or None and the output if the build failed.
+    """
+    srcDir = os.path.join(testDir, "src")
+    environment = dict(os.environ)
+    environment["SCHEDULER_BENCHMARK_TEST_MAKEFILE_DEFS"] = \
+        compileSourcesDefs
+    environment["SCHEDULER_TESTER_FLAGS"] = \
+        " ".join(extraCompileFlags(testDir))
+
+    output = ""
+    for command in [["make", "clean"],
+                    ["make", "GCCLLVM=" + tceccExe, "llvm"]]:
+        if verbose:
+            sys.stderr.write("cd %s; %s\n" % (srcDir, " ".join(command)))
+        process = subprocess.Popen(
+            command, cwd=srcDir, env=environment,
+            stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        output += process.communicate()[0].decode("utf-8", "replace")
+        if process.returncode != 0:
+            return None, output
+
+    programs = {}
+    os.makedirs(outputDir, exist_ok=True)
+    for key, name in bitcodeFiles.items():
+        built = os.path.join(srcDir, name)
+        if not os.access(built, os.R_OK):
+            return None, output + name + " was not built.\n"
+        programs[key] = os.path.join(outputDir, name)
+        shutil.move(built, programs[key])
+    return programs, output
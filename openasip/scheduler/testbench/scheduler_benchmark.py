@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2026 Tampere University.
+#
+# This file is part of TTA-Based Codesign Environment (TCE).
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+
+"""
+Measures the compilation speed of the scheduler test cases.
+
+Builds the test cases found under the test root directory (the
+scheduler_tester.py layout) from their sources, compiles them with tcecc
+against a set of reference ADFs and collects the wall time and peak memory
+usage of each compilation, broken down to the code generation phases
+reported by llvm-tce --phase-times. Building the sources is not measured.
+The results are written as JSON and can be compared against the results of
+an earlier run.
+"""
+
+import getopt, sys, os, json, tempfile, time, shutil, subprocess
+
+from benchmark_cases import findADF, byteOrder, findTestCases, \
+    extraCompileFlags, linkOperations, unlinkOperations, compileSources, \
+    defaultTestRootDir
+
+def usage():
+    print("Usage: scheduler_benchmark.py [options]")
+    print("""
+Options:
+  -a <ADFs> Comma separated list of ADFs to compile against. Relative names
+     are searched from the ADF directory of the scheduler testbench.
+     Defaults to the reference ADFs listed in this script.
+  -b <list of test case directories to include> The matching is done from the
+     right of the test case pathname, as in scheduler_tester.py.
+  -c <baseline.json> Compare the results against the given earlier results.
+  -e The root directory from which to find the test cases. Defaults to
+     testsuite/systemtest_long/bintools/Scheduler/tests.
+  -h This help text.
+  -n <count> Compile each program this many times and keep the fastest run.
+     Default is 1.
+  -o <results.json> Write the results to the given file instead of stdout.
+  -t <path> The tcecc to benchmark.
+  -v Verbose output. Print the commands executed.
+  -w <limit> Exit with an error if the total time of a phase or the total
+     wall time is worse than the baseline by more than the given
+     percentage. Default is 10.
+""")
+
+rootDir = os.path.dirname(os.path.abspath(sys.argv[0]))
+tceccExe = os.path.normpath(rootDir + "/../../src/bintools/Compiler/tcecc")
+
+# The machines the benchmark compiles against unless -a is given. They
+# range from a minimal machine to a clustered one so that both the
+# connectivity handling and the bypassing heavy paths are exercised.
+referenceArchitectures = [
+    "minimal_with_io.adf",
+    "3_bus_reduced_connectivity.adf",
+    "10_bus_full_connectivity.adf",
+    "clustered_mul4.adf",
+]
+
+# The order in which the phases are printed.
+phaseOrder = [
+    "llvm_codegen", "cfg_build", "ddg_build", "bf2_scheduler",
+    "register_copy_adder", "delay_slot_filler", "pom_emission",
+]
+
+testRootDir = defaultTestRootDir
+architectures = []
+testCaseFilters = None
+baselineFile = None
+outputFile = None
+repeatCount = 1
+worseningLimit = 10.0
+verboseOutput = False
+
+# Smaller slowdowns than this are considered timing noise.
+noiseSeconds = 0.1
+
+def parseCommandLine():
+    global testRootDir, architectures, testCaseFilters, baselineFile, \
+        outputFile, repeatCount, worseningLimit, verboseOutput, tceccExe
+
+    try:
+        opts, args = getopt.getopt(sys.argv[1:], "a:b:c:e:hn:o:t:vw:")
+    except getopt.GetoptError as e:
+        print(str(e))
+        usage()
+        sys.exit(1)
+
+    for opt, arg in opts:
+        if opt == "-a":
+            architectures = [a.strip() for a in arg.split(",") if a.strip()]
+        elif opt == "-b":
+            testCaseFilters = [f.strip() for f in arg.split(",")]
+        elif opt == "-c":
+            baselineFile = arg
+        elif opt == "-e":
+            testRootDir = arg
+        elif opt == "-h":
+            usage()
+            sys.exit(0)
+        elif opt == "-n":
+            repeatCount = max(1, int(arg))
+        elif opt == "-o":
+            outputFile = arg
+        elif opt == "-t":
+            tceccExe = os.path.abspath(arg)
+        elif opt == "-v":
+            verboseOutput = True
+        elif opt == "-w":
+            worseningLimit = float(arg)
+
+    if len(architectures) == 0:
+        architectures = referenceArchitectures
+
+def compileOnce(testDir, program, adf, workDir):
+    """
+    Compiles the test program once and returns its measurements, or None
+    if the compilation failed.
+    """
+    phaseFile = os.path.join(workDir, "phases.json")
+    outputProgram = os.path.join(workDir, "program.tpef")
+    logFileName = os.path.join(workDir, "tcecc.log")
+    if os.path.exists(phaseFile):
+        os.remove(phaseFile)
+
+    command = [tceccExe] + extraCompileFlags(testDir) + \
+        ["--phase-times=" + phaseFile, "-o", outputProgram, "-a", adf,
+         program]
+    if verboseOutput:
+        sys.stderr.write(" ".join(command) + "\n")
+
+    with open(logFileName, "w") as log:
+        start = time.monotonic()
+        process = subprocess.Popen(
+            command, cwd=testDir, stdout=log, stderr=subprocess.STDOUT)
+        # wait4 gives the peak RSS of the compiler and the tools it ran
+        pid, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status)
+        wallSeconds = time.monotonic() - start
+
+    if process.returncode != 0 or not os.access(phaseFile, os.R_OK):
+        with open(logFileName) as log:
+            sys.stderr.write(
+                "Compiling %s for %s failed:\n%s\n" %
+                (testDir, os.path.basename(adf), log.read()))
+        return None
+
+    with open(phaseFile) as f:
+        phases = json.load(f)
+    return {
+        "wall_seconds": wallSeconds,
+        "peak_rss_kb": usage.ru_maxrss,
+        "backend_wall_seconds": phases["wall_seconds"],
+        "backend_peak_rss_kb": phases["peak_rss_kb"],
+        "phases": phases["phases"],
+    }
+
+def runBenchmark():
+    results = {}
+    failures = 0
+    warmedUp = set()
+    workDir = tempfile.mkdtemp(prefix="scheduler_benchmark_")
+    try:
+        for testDir in findTestCases(testRootDir, testCaseFilters):
+            title = os.path.relpath(testDir, testRootDir)
+            testDir = os.path.abspath(testDir)
+            links = linkOperations(testDir)
+            try:
+                programs, output = compileSources(
+                    testDir, tceccExe, os.path.join(workDir, "bitcode"),
+                    verboseOutput)
+                if programs is None:
+                    sys.stderr.write(
+                        "Building %s from sources failed:\n%s\n" %
+                        (title, output))
+                    failures += len(architectures)
+                    continue
+                for arch in architectures:
+                    adf = findADF(arch)
+                    program = programs[byteOrder(adf)]
+                    if adf not in warmedUp:
+                        # the first compilation for a machine generates the
+                        # backend plugin, which is not what is measured
+                        compileOnce(testDir, program, adf, workDir)
+                        warmedUp.add(adf)
+                    best = None
+                    for i in range(repeatCount):
+                        run = compileOnce(testDir, program, adf, workDir)
+                        if run is None:
+                            break
+                        if best is None or \
+                                run["wall_seconds"] < best["wall_seconds"]:
+                            best = run
+                    key = title + "|" + os.path.basename(adf)
+                    if best is None:
+                        failures += 1
+                        continue
+                    results[key] = best
+                    if verboseOutput:
+                        sys.stderr.write(
+                            "%-60s %8.2f s %8d KiB\n" %
+                            (key, best["wall_seconds"], best["peak_rss_kb"]))
+            finally:
+                unlinkOperations(links)
+    finally:
+        shutil.rmtree(workDir)
+
+    return {
+        "tcecc": tceccExe,
+        "repeat": repeatCount,
+        "results": results,
+        "totals": totals(results),
+        "failures": failures,
+    }
+
+def totals(results):
+    """
+    Sums the times and RSS changes over all compilations and takes the
+    worst RSS values.
+    """
+    total = {"wall_seconds": 0.0, "peak_rss_kb": 0, "phases": {}}
+    for run in results.values():
+        total["wall_seconds"] += run["wall_seconds"]
+        total["peak_rss_kb"] = max(total["peak_rss_kb"], run["peak_rss_kb"])
+        for name, phase in run["phases"].items():
+            entry = total["phases"].setdefault(
+                name, {"seconds": 0.0, "rss_delta_kb": 0, "max_rss_kb": 0})
+            entry["seconds"] += phase["seconds"]
+            entry["rss_delta_kb"] += phase.get("rss_delta_kb", 0)
+            entry["max_rss_kb"] = max(
+                entry["max_rss_kb"], phase.get("max_rss_kb", 0))
+    return total
+
+def orderedPhases(names):
+    known = [p for p in phaseOrder if p in names]
+    return known + sorted(n for n in names if n not in phaseOrder)
+
+def change(old, new):
+    if old == 0:
+        return 0.0
+    return (new - old) * 100.0 / old
+
+def compareResults(baseline, current):
+    """
+    Prints the changes against the baseline and returns False if a total
+    got worse than the allowed limit.
+    """
+    ok = True
+    # only the compilations found in both runs are comparable
+    common = [k for k in current["results"] if k in baseline["results"]]
+    old = totals(dict((k, baseline["results"][k]) for k in common))
+    new = totals(dict((k, current["results"][k]) for k in common))
+
+    print("%-24s %12s %12s %9s" %
+          ("phase", "baseline s", "current s", "change"))
+    rows = [("total wall", old["wall_seconds"], new["wall_seconds"])]
+    for name in orderedPhases(set(old["phases"]) | set(new["phases"])):
+        rows.append(
+            (name, old["phases"].get(name, {"seconds": 0.0})["seconds"],
+             new["phases"].get(name, {"seconds": 0.0})["seconds"]))
+    for name, oldTime, newTime in rows:
+        percent = change(oldTime, newTime)
+        flag = ""
+        if percent > worseningLimit and newTime - oldTime > noiseSeconds:
+            flag = " WORSE"
+            ok = False
+        print("%-24s %12.3f %12.3f %+8.1f%%%s" %
+              (name, oldTime, newTime, percent, flag))
+
+    print("%-24s %12d %12d %+8.1f%%" %
+          ("peak RSS KiB", old["peak_rss_kb"], new["peak_rss_kb"],
+           change(old["peak_rss_kb"], new["peak_rss_kb"])))
+
+    missing = [k for k in baseline["results"] if k not in current["results"]]
+    for key in missing:
+        print("missing from the current run: " + key)
+    return ok
+
+def main():
+    parseCommandLine()
+
+    current = runBenchmark()
+    output = json.dumps(current, indent=2, sort_keys=True)
+    if outputFile is not None:
+        with open(outputFile, "w") as f:
+            f.write(output + "\n")
+    elif baselineFile is None:
+        print(output)
+
+    status = 0 if current["failures"] == 0 else 1
+    if baselineFile is not None:
+        with open(baselineFile) as f:
+            baseline = json.load(f)
+        if not compareResults(baseline, current):
+            status = 1
+    return status
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -76,6 +76,9 @@ Options:
      containing the OSAL operations needed by the tests after the test
      cases have been executed.
   -p Do not delete the parallel programs from scheduling after simulation.
+  -P Profile-guided compilation. Simulate the program first to collect an
+     execution profile and then recompile and simulate it using the profile.
+     The cycle counts of the latter run are reported.
   -q Use compiled simulation (slow initialization, fast simulation, basic
      block simulation granularity).
   -r Regression test mode. Do not output anything unless there's an error, in
@@ -166,6 +169,7 @@ leaveDirty = False
 testCaseFilters = None
 compiledSimulation = False
 loosenResults = False
+profileGuided = False
 
 # How large can the average worsening be without it being
 # an error, thus affect the result of -r
@@ -195,13 +199,13 @@ def ParseCommandLine():
            recompile, leaveDirty, latexTable, moreStats, \
            normalOutput, testCaseFilters, \
            extraCompileFlags, compiledSimulation, worsenedIsErrorLimit,\
-           loosenResults, testRootDir
+           loosenResults, testRootDir, profileGuided
 
     try:
         args_start = 1
 
         opts, args = getopt.getopt(\
-            sys.argv[args_start:], "g:a:b:shtTvVCopqrxw:dlLi:e:", ["help"])
+            sys.argv[args_start:], "g:a:b:shtTvVCopPqrxw:dlLi:e:", ["help"])
 
     except getopt.GetoptError as e:
         # print help information and exit:
@@ -227,6 +231,8 @@ def ParseCommandLine():
             csvFormat = True
         elif o == "-p":
             saveParallelPrograms = True
+        elif o == "-P":
+            profileGuided = True
         elif o == "-o":
             deleteOSALLink = True
         elif o == "-r":
@@ -573,6 +579,7 @@ class TestCase:
         tryRemove("operations_executed")
         tryRemove("registers_read")
         tryRemove("registers_written")
+        tryRemove("execution_profile")
 
         if not saveParallelPrograms:
             for tpef in self.parallelPrograms:
@@ -623,7 +630,8 @@ class TestCase:
 
         return True
 
-    def schedule(self, archFilename, seqProgFileName, dstProgFileName):
+    def schedule(self, archFilename, seqProgFileName, dstProgFileName,
+                 profileFileName=None):
 
         schedulingCommand = tceccExe + ' ' + self.testExtraCompileFlags + ' '
         if get_backend_cache_dir() != '':
@@ -635,6 +643,9 @@ class TestCase:
         if (veryVerboseOutput):
             schedulingCommand += ' -v '
 
+        if profileFileName is not None:
+            schedulingCommand += ' --execution-profile=' + profileFileName
+
         schedulingCommand += ' ' + self.testExtraCompileFlags;
         schedulingCommand += " -o " + dstProgFileName + \
                              " -a " + archFilename + \
@@ -661,7 +672,7 @@ class TestCase:
 
         return True
 
-    def simulate(self, archFilename, progFilename):
+    def simulate(self, archFilename, progFilename, profileFileName=None):
 
         global compiledSimulation
 
@@ -722,6 +733,9 @@ close $cycle_file
         if compiledSimulation:
             simulationCommand += " -q"
 
+        if profileFileName is not None:
+            simulationCommand += " --execution-profile=" + profileFileName
+
         exitOk, stdoutContents, stderrContents = runWithTimeout(simulationCommand,
                                                                 simulationTimeoutSec,
                                                                 simulationScript)
@@ -832,7 +846,27 @@ close $cycle_file
         # let's try to remove file if exists..
         tryRemove(progFileName)
 
-        if not self.schedule(archFilename, seqProgFile, progFileName):
+        profileFileName = None
+        trainingCycles = None
+        if profileGuided:
+            # Training run: collect the execution profile with the
+            # program compiled without it.
+            profileFileName = os.getcwd() + "/execution_profile"
+            tryRemove(profileFileName)
+            if not self.schedule(archFilename, seqProgFile, progFileName):
+                return False
+            if not self.simulate(archFilename, progFileName, profileFileName):
+                return False
+            if not self.verifySimulation():
+                return False
+            if not access(profileFileName, R_OK):
+                self.testFailed("no execution profile from simulation")
+                return False
+            trainingCycles = self.lastStats.cycleCount
+            tryRemove(progFileName)
+
+        if not self.schedule(archFilename, seqProgFile, progFileName,
+                             profileFileName):
             return False
 
         if not self.simulate(archFilename, progFileName):
@@ -877,6 +911,8 @@ close $cycle_file
                 for stat in moreStats:
                     name, short, value = self.lastStats.decodeStatString(stat)
                     sys.stdout.write(' %s: %s' % (short, value))
+            if trainingCycles is not None:
+                sys.stdout.write(' without profile: %.0f' % trainingCycles)
             sys.stdout.write('\n')
 
         self.results[architecture] = (self.lastStats.cycleCount, difference, percentage)
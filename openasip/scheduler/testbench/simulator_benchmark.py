@@ -0,0 +1,340 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2026 Tampere University.
+#
+# This file is part of TTA-Based Codesign Environment (TCE).
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+
+"""
+Measures the simulation speed of ttasim.
+
+Builds a corpus of TPEFs from the sources of the test cases found under
+the test root directory (the scheduler_tester.py layout) for a set of
+reference ADFs and simulates each of them with the selected simulation
+engines. The performance counters reported by ttasim --benchmark
+(simulated cycles per second, host instructions per cycle, load and
+initialization times, peak memory) are collected to a JSON file which can
+be compared against the results of an earlier run.
+"""
+
+import getopt, sys, os, json, time, tempfile, shutil, subprocess, math
+
+from benchmark_cases import findADF, byteOrder, findTestCases, \
+    extraCompileFlags, linkOperations, unlinkOperations, compileSources, \
+    defaultTestRootDir
+
+def usage():
+    print("Usage: simulator_benchmark.py [options]")
+    print("""
+Options:
+  -a <ADFs> Comma separated list of ADFs to build the corpus for. Relative
+     names are searched from the ADF directory of the scheduler testbench.
+     Defaults to the reference ADFs listed in this script.
+  -b <list of test case directories to include> The matching is done from the
+     right of the test case pathname, as in scheduler_tester.py.
+  -c <baseline.json> Compare the results against the given earlier results.
+  -e The root directory from which to find the test cases. Defaults to
+     testsuite/systemtest_long/bintools/Scheduler/tests.
+  -g <engines> Comma separated list of the engines to benchmark:
+     interpretive, compiled_static, compiled_dynamic and ota. Defaults to
+     all but ota, which needs an operation-triggered machine.
+  -h This help text.
+  -k <dir> The directory of the TPEF corpus. Existing TPEFs are reused so
+     that all runs simulate the same programs. Defaults to
+     ./simulator_benchmark_corpus.
+  -o <results.json> Write the results to the given file instead of stdout.
+  -s <path> The ttasim to benchmark.
+  -t <path> The tcecc used to build the corpus.
+  -v Verbose output. Print the commands executed.
+  -w <limit> Exit with an error if the simulation speed of an engine drops
+     more than the given percentage from the baseline. Default is 10.
+""")
+
+rootDir = os.path.dirname(os.path.abspath(sys.argv[0]))
+tceccExe = os.path.normpath(rootDir + "/../../src/bintools/Compiler/tcecc")
+simulatorExe = os.path.normpath(rootDir + "/../../src/codesign/ttasim/ttasim")
+
+# The machines the corpus is built for unless -a is given.
+referenceArchitectures = [
+    "minimal_with_io.adf",
+    "3_bus_reduced_connectivity.adf",
+    "10_bus_full_connectivity.adf",
+]
+
+# The ttasim switches and the setting script of each engine.
+engineSwitches = {
+    "interpretive": ([], ""),
+    "compiled_static": (["-q"], "setting static_compilation 1; "),
+    "compiled_dynamic": (["-q"], "setting static_compilation 0; "),
+    "ota": (["--ota"], ""),
+}
+
+testRootDir = defaultTestRootDir
+architectures = []
+engines = ["interpretive", "compiled_static", "compiled_dynamic"]
+testCaseFilters = None
+baselineFile = None
+outputFile = None
+corpusDir = "simulator_benchmark_corpus"
+worseningLimit = 10.0
+verboseOutput = False
+
+def parseCommandLine():
+    global testRootDir, architectures, engines, testCaseFilters, \
+        baselineFile, outputFile, corpusDir, worseningLimit, \
+        verboseOutput, tceccExe, simulatorExe
+
+    try:
+        opts, args = getopt.getopt(sys.argv[1:], "a:b:c:e:g:hk:o:s:t:vw:")
+    except getopt.GetoptError as e:
+        print(str(e))
+        usage()
+        sys.exit(1)
+
+    for opt, arg in opts:
+        if opt == "-a":
+            architectures = [a.strip() for a in arg.split(",") if a.strip()]
+        elif opt == "-b":
+            testCaseFilters = [f.strip() for f in arg.split(",")]
+        elif opt == "-c":
+            baselineFile = arg
+        elif opt == "-e":
+            testRootDir = arg
+        elif opt == "-g":
+            engines = [e.strip() for e in arg.split(",") if e.strip()]
+            for engine in engines:
+                if engine not in engineSwitches:
+                    print("Unknown engine: " + engine)
+                    sys.exit(1)
+        elif opt == "-h":
+            usage()
+            sys.exit(0)
+        elif opt == "-k":
+            corpusDir = arg
+        elif opt == "-o":
+            outputFile = arg
+        elif opt == "-s":
+            simulatorExe = os.path.abspath(arg)
+        elif opt == "-t":
+            tceccExe = os.path.abspath(arg)
+        elif opt == "-v":
+            verboseOutput = True
+        elif opt == "-w":
+            worseningLimit = float(arg)
+
+    if len(architectures) == 0:
+        architectures = referenceArchitectures
+    corpusDir = os.path.abspath(corpusDir)
+
+def runCommand(command, cwd):
+    """Runs the command and returns its exit code and output."""
+    if verboseOutput:
+        sys.stderr.write(" ".join(command) + "\n")
+    process = subprocess.Popen(
+        command, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    output = process.communicate()[0].decode("utf-8", "replace")
+    return process.returncode, output
+
+def buildCorpus(testDir, title, workDir):
+    """
+    Compiles the test program for the reference machines, reusing the
+    TPEFs of earlier runs. The sources are built only if a TPEF is missing.
+    Returns a list of (key, adf, tpef).
+    """
+    corpus = []
+    programs = None
+    for arch in architectures:
+        adf = findADF(arch)
+        key = title + "|" + os.path.basename(adf)
+        tpef = os.path.join(
+            corpusDir, key.replace(os.sep, "_").replace("|", "__") + ".tpef")
+        if not os.access(tpef, os.R_OK):
+            if programs is None:
+                programs, output = compileSources(
+                    testDir, tceccExe, os.path.join(workDir, "bitcode"),
+                    verboseOutput)
+                if programs is None:
+                    sys.stderr.write(
+                        "Building %s from sources failed:\n%s\n" %
+                        (title, output))
+                    return corpus
+            os.makedirs(corpusDir, exist_ok=True)
+            status, output = runCommand(
+                [tceccExe] + extraCompileFlags(testDir) +
+                ["-o", tpef, "-a", adf, programs[byteOrder(adf)]],
+                testDir)
+            if status != 0:
+                sys.stderr.write(
+                    "Compiling %s failed:\n%s\n" % (key, output))
+                continue
+        corpus.append((key, adf, tpef))
+    return corpus
+
+def simulate(testDir, adf, tpef, engine):
+    """
+    Simulates the program with the engine and returns the performance
+    counters, or None if the simulation failed.
+    """
+    countersFile = tpef + "." + engine + ".json"
+    if os.path.exists(countersFile):
+        os.remove(countersFile)
+    switches, settings = engineSwitches[engine]
+    # the settings must be in effect before the program is loaded
+    script = settings + "mach " + adf + "; prog " + tpef + "; run"
+    command = [simulatorExe, "--no-debugmode",
+               "--benchmark=" + countersFile] + switches + ["-e", script]
+
+    start = time.monotonic()
+    status, output = runCommand(command, testDir)
+    wallSeconds = time.monotonic() - start
+
+    if status != 0 or not os.access(countersFile, os.R_OK):
+        sys.stderr.write(
+            "Simulating %s with %s failed:\n%s\n" % (tpef, engine, output))
+        return None
+    with open(countersFile) as f:
+        counters = json.load(f)
+    os.remove(countersFile)
+    counters["wall_seconds"] = wallSeconds
+    return counters
+
+def runBenchmark():
+    results = {}
+    failures = 0
+    workDir = tempfile.mkdtemp(prefix="simulator_benchmark_")
+    try:
+        for testDir in findTestCases(testRootDir, testCaseFilters):
+            title = os.path.relpath(testDir, testRootDir)
+            testDir = os.path.abspath(testDir)
+            links = linkOperations(testDir)
+            try:
+                corpus = buildCorpus(testDir, title, workDir)
+                failures += len(architectures) - len(corpus)
+                for key, adf, tpef in corpus:
+                    for engine in engines:
+                        counters = simulate(testDir, adf, tpef, engine)
+                        if counters is None:
+                            failures += 1
+                            continue
+                        results[key + "|" + engine] = counters
+                        if verboseOutput:
+                            sys.stderr.write(
+                                "%-60s %14.0f cycles/s\n" %
+                                (key + "|" + engine,
+                                 counters["cycles_per_second"]))
+            finally:
+                unlinkOperations(links)
+    finally:
+        shutil.rmtree(workDir)
+
+    return {
+        "ttasim": simulatorExe,
+        "results": results,
+        "engines": engineSummary(results),
+        "failures": failures,
+    }
+
+def engineSummary(results):
+    """
+    Returns the geometric mean of the simulation speed of each engine and
+    the worst peak RSS.
+    """
+    summary = {}
+    for key, counters in results.items():
+        engine = key.rsplit("|", 1)[1]
+        entry = summary.setdefault(
+            engine, {"log_speed": 0.0, "count": 0, "peak_rss_kb": 0})
+        if counters["cycles_per_second"] > 0:
+            entry["log_speed"] += math.log(counters["cycles_per_second"])
+            entry["count"] += 1
+        entry["peak_rss_kb"] = max(
+            entry["peak_rss_kb"], counters["peak_rss_kb"])
+    for entry in summary.values():
+        entry["cycles_per_second"] = \
+            math.exp(entry["log_speed"] / entry["count"]) \
+            if entry["count"] > 0 else 0.0
+        del entry["log_speed"]
+        del entry["count"]
+    return summary
+
+def change(old, new):
+    if old == 0:
+        return 0.0
+    return (new - old) * 100.0 / old
+
+def compareResults(baseline, current):
+    """
+    Prints the speed changes against the baseline and returns False if an
+    engine got slower than the allowed limit.
+    """
+    ok = True
+    # only the simulations found in both runs are comparable
+    common = [k for k in current["results"] if k in baseline["results"]]
+    old = engineSummary(dict((k, baseline["results"][k]) for k in common))
+    new = engineSummary(dict((k, current["results"][k]) for k in common))
+
+    print("%-20s %16s %16s %9s" %
+          ("engine", "baseline cyc/s", "current cyc/s", "change"))
+    for engine in sorted(new):
+        oldSpeed = old[engine]["cycles_per_second"]
+        newSpeed = new[engine]["cycles_per_second"]
+        percent = change(oldSpeed, newSpeed)
+        flag = ""
+        if -percent > worseningLimit:
+            flag = " SLOWER"
+            ok = False
+        print("%-20s %16.0f %16.0f %+8.1f%%%s" %
+              (engine, oldSpeed, newSpeed, percent, flag))
+
+    for key in common:
+        percent = change(
+            baseline["results"][key]["cycles_per_second"],
+            current["results"][key]["cycles_per_second"])
+        if -percent > worseningLimit:
+            print("%-60s %+8.1f%%" % (key, percent))
+
+    missing = [k for k in baseline["results"] if k not in current["results"]]
+    for key in missing:
+        print("missing from the current run: " + key)
+    return ok
+
+def main():
+    parseCommandLine()
+
+    current = runBenchmark()
+    output = json.dumps(current, indent=2, sort_keys=True)
+    if outputFile is not None:
+        with open(outputFile, "w") as f:
+            f.write(output + "\n")
+    elif baselineFile is None:
+        print(output)
+
+    status = 0 if current["failures"] == 0 else 1
+    if baselineFile is not None:
+        with open(baselineFile) as f:
+            baseline = json.load(f)
+        if not compareResults(baseline, current):
+            status = 1
+    return status
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -424,8 +424,8 @@ Estimator::registerFileArea(
  *
  * @param machine Architecture of the processor.
  * @param machineImplementation Implementation information of the processor.
- * @param traceDB The execution trace database obtained from simulating the
- *                program.
+ * @param activity The activity of the machine components while running
+ *                 the program.
  * @return Energy in milli joules.
  * @exception CannotEstimateCost If the energy could not be estimated.
  */
@@ -433,12 +433,12 @@ EnergyInMilliJoules
 Estimator::totalEnergy(
     const TTAMachine::Machine& machine,
     const IDF::MachineImplementation& machineImplementation,
-    const TTAProgram::Program& program, const ExecutionTrace& traceDB) {
+    const TTAProgram::Program& program, const ActivityCounters& activity) {
     return totalEnergyOfFunctionUnits(
-        machine, machineImplementation, program, traceDB) +
+        machine, machineImplementation, program, activity) +
         totalEnergyOfRegisterFiles(
-            machine, machineImplementation, program, traceDB) +
-        icEnergy(machine, machineImplementation, program, traceDB);
+            machine, machineImplementation, program, activity) +
+        icEnergy(machine, machineImplementation, program, activity);
 }
 
 /**
@@ -447,8 +447,8 @@ Estimator::totalEnergy(
  *
  * @param machine Architecture of the processor.
  * @param machineImplementation Implementation information of the processor.
- * @param traceDB The simulation trace database obtained from simulating the
- *                program.
+ * @param activity The activity of the machine components while running
+ *                 the program.
  * @return Energy in milli joules.
  * @exception CannotEstimateCost If the energy could not be estimated.
  */
@@ -456,7 +456,7 @@ EnergyInMilliJoules
 Estimator::icEnergy(
     const TTAMachine::Machine& machine,
     const IDF::MachineImplementation& machineImplementation,
-    const TTAProgram::Program& program, const ExecutionTrace& traceDB) {
+    const TTAProgram::Program& program, const ActivityCounters& activity) {
     if (!machineImplementation.hasICDecoderPluginName() ||
         !machineImplementation.hasICDecoderPluginFile() ||
         !machineImplementation.hasICDecoderHDB()) {
@@ -475,7 +475,7 @@ Estimator::icEnergy(
 
         if (!plugin.estimateICEnergy(
                 HDBRegistry::instance(), machine, machineImplementation,
-                program, traceDB, energy)) {
+                program, activity, energy)) {
             throw CannotEstimateCost(
                 __FILE__, __LINE__, __func__, 
                 (boost::format(
@@ -501,8 +501,8 @@ Estimator::icEnergy(
  * @param implementationEntry The implementation information of FU. Can be
  *                       an instance of NullFUImplementationLocation.
  * @param program The program of which energy to calculate.
- * @param traceDB The simulation trace database of the program running in the
- *                target architecture.
+ * @param activity The activity of the machine components while running
+ *                 the program.
  * @return Estimate of consumed energy.
  * @exception CannotEstimateCost In case the energy could not be estimated. 
  */
@@ -510,14 +510,14 @@ EnergyInMilliJoules
 Estimator::functionUnitEnergy(
     const TTAMachine::FunctionUnit& architecture,
     const IDF::FUImplementationLocation& implementationEntry,
-    const TTAProgram::Program& program, const ExecutionTrace& traceDB) {
+    const TTAProgram::Program& program, const ActivityCounters& activity) {
     try {
         AreaInGates area = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
         if (!fuCostFunctionPluginOfImplementation(implementationEntry).
             estimateEnergy(
-                architecture, implementationEntry, program, traceDB, area, 
+                architecture, implementationEntry, program, activity, area, 
                 hdb)) {
             throw CannotEstimateCost(
                 __FILE__, __LINE__, __func__,
@@ -542,8 +542,8 @@ Estimator::functionUnitEnergy(
  * @param implementationEntry The implementation information of RF. Can be
  *                       an instance of NullRFImplementationLocation.
  * @param program The program of which energy to calculate.
- * @param traceDB The simulation trace database of the program running in the
- *                target architecture.
+ * @param activity The activity of the machine components while running
+ *                 the program.
  * @return Estimate of consumed energy.
  * @exception CannotEstimateCost In case the energy could not be estimated. 
  */
@@ -551,14 +551,14 @@ EnergyInMilliJoules
 Estimator::registerFileEnergy(
     const TTAMachine::BaseRegisterFile& architecture,
     const IDF::RFImplementationLocation& implementationEntry,
-    const TTAProgram::Program& program, const ExecutionTrace& traceDB) {
+    const TTAProgram::Program& program, const ActivityCounters& activity) {
     try {
         AreaInGates area = 0.0;
         HDB::HDBManager& hdb = HDBRegistry::instance().hdb(
             implementationEntry.hdbFile());
         if (!rfCostFunctionPluginOfImplementation(implementationEntry).
             estimateEnergy(
-                architecture, implementationEntry, program, traceDB, area,
+                architecture, implementationEntry, program, activity, area,
                 hdb)) {
             throw CannotEstimateCost(
                 __FILE__, __LINE__, __func__,
@@ -583,8 +583,8 @@ Estimator::registerFileEnergy(
  * @param machine The machine architecture to estimate.
  * @param machineImplementation The machine implementation information.
  * @param program The program of which energy to calculate.
- * @param traceDB The simulation trace database of the program running in the
- *                target architecture.
+ * @param activity The activity of the machine components while running
+ *                 the program.
  * @exception CannotEstimateCost In case cost cannot be estimated for some 
  *                               reason. Reason is given in error message.
  */
@@ -592,7 +592,7 @@ EnergyInMilliJoules
 Estimator::totalEnergyOfFunctionUnits(
     const TTAMachine::Machine& machine,
     const IDF::MachineImplementation& machineImplementation,
-    const TTAProgram::Program& program, const ExecutionTrace& traceDB) {
+    const TTAProgram::Program& program, const ActivityCounters& activity) {
     EnergyInMilliJoules total = 0.0;
     TTAMachine::Machine::FunctionUnitNavigator nav = 
         machine.functionUnitNavigator();
@@ -607,7 +607,7 @@ Estimator::totalEnergyOfFunctionUnits(
                 fuArchitecture->name());
         }
         total += functionUnitEnergy(
-            *fuArchitecture, *fuImplementation, program, traceDB);
+            *fuArchitecture, *fuImplementation, program, activity);
     }
     // GCU is not included in the MOM FU navigation, so we have to treat it
     // separately
@@ -623,7 +623,7 @@ Estimator::totalEnergyOfFunctionUnits(
             fuArchitecture->name());
     }
     total += functionUnitEnergy(
-        *fuArchitecture, *fuImplementation, program, traceDB);
+        *fuArchitecture, *fuImplementation, program, activity);
     */
     return total;
 }
@@ -636,8 +636,8 @@ Estimator::totalEnergyOfFunctionUnits(
  * @param machine The machine architecture to estimate.
  * @param machineImplementation The machine implementation information.
  * @param program The program of which energy to calculate.
- * @param traceDB The simulation trace database of the program running in the
- *                target architecture.
+ * @param activity The activity of the machine components while running
+ *                 the program.
  * @exception CannotEstimateCost In case cost cannot be estimated for some 
  *                               reason. Reason is given in error message.
  */
@@ -645,7 +645,7 @@ EnergyInMilliJoules
 Estimator::totalEnergyOfRegisterFiles(
     const TTAMachine::Machine& machine,
     const IDF::MachineImplementation& machineImplementation,
-    const TTAProgram::Program& program, const ExecutionTrace& traceDB) {
+    const TTAProgram::Program& program, const ActivityCounters& activity) {
     EnergyInMilliJoules total = 0.0;
     TTAMachine::Machine::RegisterFileNavigator nav = 
         machine.registerFileNavigator();
@@ -660,7 +660,7 @@ Estimator::totalEnergyOfRegisterFiles(
                 rfArchitecture->name());
         }
         total += registerFileEnergy(
-            *rfArchitecture, *rfImplementation, program, traceDB);
+            *rfArchitecture, *rfImplementation, program, activity);
     }
     return total;
 }
@@ -48,7 +48,7 @@
 #include "TransportPath.hh"
 #include "FUCostEstimationPlugin.hh"
 
-class ExecutionTrace;
+class ActivityCounters;
 class UtilizationStats;
 class FUCostEstimationPlugin;
 class RFCostEstimationPlugin;
@@ -118,32 +118,32 @@ public:
     EnergyInMilliJoules totalEnergy(
         const TTAMachine::Machine& machine,
         const IDF::MachineImplementation& machineImplementation,
-        const TTAProgram::Program& program, const ExecutionTrace& traceDB);
+        const TTAProgram::Program& program, const ActivityCounters& activity);
 
     EnergyInMilliJoules icEnergy(
         const TTAMachine::Machine& machine,
         const IDF::MachineImplementation& machineImplementation,
-        const TTAProgram::Program& program, const ExecutionTrace& traceDB);
+        const TTAProgram::Program& program, const ActivityCounters& activity);
 
     EnergyInMilliJoules functionUnitEnergy(
         const TTAMachine::FunctionUnit& architecture,
         const IDF::FUImplementationLocation& implementationEntry,
-        const TTAProgram::Program& program, const ExecutionTrace& traceDB);
+        const TTAProgram::Program& program, const ActivityCounters& activity);
 
     EnergyInMilliJoules registerFileEnergy(
         const TTAMachine::BaseRegisterFile& architecture,
         const IDF::RFImplementationLocation& implementationEntry,
-        const TTAProgram::Program& program, const ExecutionTrace& traceDB);
+        const TTAProgram::Program& program, const ActivityCounters& activity);
 
     EnergyInMilliJoules totalEnergyOfFunctionUnits(
         const TTAMachine::Machine& machine,
         const IDF::MachineImplementation& machineImplementation,
-        const TTAProgram::Program& program, const ExecutionTrace& traceDB);
+        const TTAProgram::Program& program, const ActivityCounters& activity);
 
     EnergyInMilliJoules totalEnergyOfRegisterFiles(
         const TTAMachine::Machine& machine,
         const IDF::MachineImplementation& machineImplementation,
-        const TTAProgram::Program& program, const ExecutionTrace& traceDB);
+        const TTAProgram::Program& program, const ActivityCounters& activity);
 
     /// delay estimation functions
 
@@ -79,8 +79,8 @@ FUCostEstimationPlugin::estimateArea(
  * @param implementation (The location of) the implementation of FU. Can be
  *                        an instance of NullFUImplementationLocation.
  * @param program The program of which energy to calculate.
- * @param traceDB The simulation trace database of the program running in the
- *                target architecture.
+ * @param activity The activity of the machine components while running
+ *                 the program.
  * @param energy The variable to store the energy estimate into.
  * @return True only if energy could be estimated successfully.
  */
@@ -89,7 +89,7 @@ FUCostEstimationPlugin::estimateEnergy(
     const TTAMachine::FunctionUnit&,
     const IDF::FUImplementationLocation&,
     const TTAProgram::Program&,
-    const ExecutionTrace&,
+    const ActivityCounters&,
     EnergyInMilliJoules&,
     HDB::HDBManager&) {
 
@@ -55,7 +55,7 @@ namespace TTAMachine {
     class FUPort;
 }
 
-class ExecutionTrace;
+class ActivityCounters;
 class UtilizationStats;
 
 namespace CostEstimator {
@@ -78,7 +78,7 @@ public:
         const TTAMachine::FunctionUnit& architecture,
         const IDF::FUImplementationLocation& implementation,
         const TTAProgram::Program& program,
-        const ExecutionTrace& traceDB,
+        const ActivityCounters& activity,
         EnergyInMilliJoules& energy,
         HDB::HDBManager& hdb);
 
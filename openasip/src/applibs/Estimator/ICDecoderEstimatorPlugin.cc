@@ -115,8 +115,8 @@ ICDecoderEstimatorPlugin::estimateICArea(
  * @param hdbRegistry The registry for accessing HDBs.
  * @param machine Architecture of the processor.
  * @param machineImplementation Implementation defintions of the processor.
- * @param traceDB The simulation trace database obtained from running the
- *                program.
+ * @param activity The activity of the machine components while running
+ *                 the program.
  * @param energy The calculated energy should be stored in this argument.
  * @return True in case energy can be estimated, false if it cannot.
  */
@@ -126,7 +126,7 @@ ICDecoderEstimatorPlugin::estimateICEnergy(
     const TTAMachine::Machine&,
     const IDF::MachineImplementation&,
     const TTAProgram::Program&,
-    const ExecutionTrace&,
+    const ActivityCounters&,
     EnergyInMilliJoules&) {
 
     return false;
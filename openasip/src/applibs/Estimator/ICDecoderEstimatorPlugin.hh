@@ -54,7 +54,7 @@ namespace IDF {
     class MachineImplementation;
 }
 
-class ExecutionTrace;
+class ActivityCounters;
 
 namespace CostEstimator {
 /**
@@ -89,7 +89,7 @@ public:
         const TTAMachine::Machine& machine,
         const IDF::MachineImplementation& machineImplementation,
         const TTAProgram::Program& program,
-        const ExecutionTrace& traceDB,
+        const ActivityCounters& activity,
         EnergyInMilliJoules& energy);
 
     virtual TTAMachine::ControlUnit* generateControlUnit();
@@ -78,8 +78,8 @@ RFCostEstimationPlugin::estimateArea(
  * @param implementation (The location of) the implementation of RF. Can be
  *                        an instance of NullFUImplementationLocation.
  * @param program The program of which energy to calculate.
- * @param traceDB The simulation trace database of the program running in the
- *                target architecture which can be used in the estimation 
+ * @param activity The activity of the machine components while running
+ *                 the program.
  *                algorithm.
  * @param energy The variable to store the energy estimate into.
  * @return True only if energy could be estimated successfully.
@@ -89,7 +89,7 @@ RFCostEstimationPlugin::estimateEnergy(
     const TTAMachine::BaseRegisterFile&,
     const IDF::RFImplementationLocation&,
     const TTAProgram::Program&,
-    const ExecutionTrace&,
+    const ActivityCounters&,
     EnergyInMilliJoules&,
     HDB::HDBManager&) {
 
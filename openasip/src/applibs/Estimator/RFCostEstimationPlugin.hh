@@ -55,7 +55,7 @@ namespace TTAMachine {
     class RFPort;
 }
 
-class ExecutionTrace;
+class ActivityCounters;
 class UtilizationStats;
 
 namespace CostEstimator {
@@ -79,7 +79,7 @@ public:
         const TTAMachine::BaseRegisterFile& architecture,
         const IDF::RFImplementationLocation& implementation,
         const TTAProgram::Program& program,
-        const ExecutionTrace& traceDB,
+        const ActivityCounters& activity,
         EnergyInMilliJoules& energy,
         HDB::HDBManager& hdb);
 
@@ -44,7 +44,8 @@
 #include "ExplorerCmdLineOptions.hh"
 #include "DesignSpaceExplorerPlugin.hh"
 #include "CostEstimates.hh"
-#include "ExecutionTrace.hh"
+#include "ActivityCounters.hh"
+#include "SimulationActivityCounters.hh"
 #include "DSDBManager.hh"
 #include "Machine.hh"
 #include "Program.hh"
@@ -133,13 +134,12 @@ DesignSpaceExplorer::evaluate(
     const DSDBManager::MachineConfiguration& configuration,
     CostEstimates& result, bool estimate) {
 
-    TTAMachine::Machine* adf = NULL;
+    // the machine is only read, so the cached one is used without copying
+    std::shared_ptr<const TTAMachine::Machine> adf =
+        dsdb_->sharedArchitecture(configuration.architectureID);
     IDF::MachineImplementation* idf = NULL;
     if (configuration.hasImplementation) {
-        adf = dsdb_->architecture(configuration.architectureID);
         idf = dsdb_->implementation(configuration.implementationID);
-    } else {
-        adf = dsdb_->architecture(configuration.architectureID);
     }
 
     try {
@@ -182,8 +182,6 @@ DesignSpaceExplorer::evaluate(
 
             // test that program is found
             if (applicationFile.length() < 1) {
-                delete adf;
-                adf = NULL;
                 delete idf;
                 idf = NULL;
                 throw InvalidData(
@@ -204,8 +202,6 @@ DesignSpaceExplorer::evaluate(
 
             if (scheduledProgram.get() == NULL) {
                 dsdb_->setUnschedulable((*i), configuration.architectureID);
-                delete adf;
-                adf = NULL;
                 delete idf;
                 idf = NULL;
                 return false;
@@ -213,9 +209,9 @@ DesignSpaceExplorer::evaluate(
 
             // simulate the scheduled program
             ClockCycleCount runnedCycles;
-            const ExecutionTrace* traceDB = NULL;
+            const ActivityCounters* activity = NULL;
             if (configuration.hasImplementation && estimate) {
-                traceDB = simulate(
+                activity = simulate(
                     *scheduledProgram, *adf, testApplication, 0, runnedCycles,
                     true);
             } else {
@@ -246,8 +242,6 @@ DesignSpaceExplorer::evaluate(
                     std::cerr << "**********" << std::endl;
                     delete idf;
                     idf = NULL;
-                    delete adf;
-                    adf = NULL;
                     return false;
                 }
                 //std::cerr << "DEBUG: simulation OK" << std::endl;
@@ -266,17 +260,15 @@ DesignSpaceExplorer::evaluate(
                 // energy estimate the simulated program
                 EnergyInMilliJoules programEnergy =
                     estimator_.totalEnergy(
-                        *adf, *idf, *scheduledProgram, *traceDB);
+                        *adf, *idf, *scheduledProgram, *activity);
                 dsdb_->addEnergyEstimate(
                     (*i), configuration.implementationID, programEnergy);
                 result.setEnergy(*scheduledProgram, programEnergy);
             }
-            delete traceDB;
-            traceDB = NULL;
+            delete activity;
+            activity = NULL;
         }
     } catch (const Exception& e) {
-        delete adf;
-        adf = NULL;
         delete idf;
         idf = NULL;
         debugLog(e.errorMessageStack());
@@ -284,8 +276,6 @@ DesignSpaceExplorer::evaluate(
     }
     delete idf;
     idf = NULL;
-    delete adf;
-    adf = NULL;
     return true;
 }
 
@@ -313,7 +303,7 @@ DesignSpaceExplorer::db() {
 TTAProgram::Program*
 DesignSpaceExplorer::schedule(
     const std::string bytecodeFile,
-    TTAMachine::Machine& target,
+    const TTAMachine::Machine& target,
     TCEString paramOptions) {
 
     TCEString compilerOptions;
@@ -327,6 +317,10 @@ DesignSpaceExplorer::schedule(
         } else {
             compilerOptions = paramOptions;
         }
+        if (options->schedulerEffort()) {
+            compilerOptions +=
+                " --scheduler-effort=" + options->schedulerEffortLevel();
+        }
     }
     // If compiler options did not provide optimization, we use default.
     if (compilerOptions.find("-O") == std::string::npos) {
@@ -404,14 +398,16 @@ DesignSpaceExplorer::schedule(
  * @param maxCycles Maximum amount of clock cycles that program is allowed to
  * run. Not used by this implementation.
  * @param runnedCycles Simulated cycle amount is stored here.
- * @param tracing Flag indicating is the tracing used.
- * @return Execution trace of the program.
+ * @param tracing Flag indicating is the activity of the machine components
+ * collected for energy estimation.
+ * @return Activity of the machine components, NULL if tracing is off.
+ * Becomes property of the client.
  * @exception Exception All exceptions produced by simulator engine except
  * SimulationCycleLimitReached in case of max cycles are reached without
  * program finishing and SimulationTimeOut in case of simulation is killed
  * after simulating maximum time that is currently 10h.
  */
-const ExecutionTrace*
+const ActivityCounters*
 DesignSpaceExplorer::simulate(
     const TTAProgram::Program& program, const TTAMachine::Machine& machine,
     const TestApplication& testApplication, const ClockCycleCount&,
@@ -427,15 +423,8 @@ DesignSpaceExplorer::simulate(
     // setting simulator timeout in seconds
     simulator.setTimeout(480);
 
-    // use memory file in sqlite
-    // TODO: should use a tmp dir as now TraceDB produces multiple
-    // text files, thus only the SQL part goes to memory
-    const string traceFile = ":memory:";
-    simulator.forceTraceDBFileName(traceFile);
-    if (!useCompiledSimulation)
-        simulator.setRFAccessTracing(tracing);
-    simulator.setUtilizationDataSaving(tracing);
-    simulator.setExecutionTracing(tracing);
+    // the activity is collected in memory, no trace database is needed
+    simulator.setActivityCounting(tracing);
 
     simulator.loadMachine(machine);
     simulator.loadProgram(program);
@@ -494,15 +483,15 @@ DesignSpaceExplorer::simulate(
         }
     }
 
-    // Flush data collected during simulation to the trace file.
-    const ExecutionTrace* db = NULL;
+    // Fetch the activity before the collected data is freed.
+    const ActivityCounters* activity = NULL;
     if (tracing) {
-        db = simulator.lastTraceDB();
+        activity = simulator.activityCounters();
     }
     
     simulator.killSimulation();
     
-    return db;
+    return activity;
 }
 
 #pragma GCC diagnostic ignored "-Wstrict-aliasing"
@@ -601,7 +590,8 @@ DesignSpaceExplorer::createImplementationAndStore(
     const std::string& icDec,
     const std::string& icDecHDB) {
 
-    const TTAMachine::Machine* mach = dsdb_->architecture(conf.architectureID);
+    std::shared_ptr<const TTAMachine::Machine> mach =
+        dsdb_->sharedArchitecture(conf.architectureID);
     IDF::MachineImplementation* idf = NULL;
 
     idf = selectComponents(*mach, frequency, maxArea, icDec, icDecHDB);
@@ -615,8 +605,7 @@ DesignSpaceExplorer::createImplementationAndStore(
         createEstimateData(*mach, *idf, area, longestPathDelay);
     }
 
-    delete mach;
-    mach = NULL;
+    mach.reset();
 
     DSDBManager::MachineConfiguration newConf;
     newConf.architectureID = conf.architectureID;
@@ -655,7 +644,8 @@ DesignSpaceExplorer::createImplementation(
     const std::string& icDec,
     const std::string& icDecHDB) {
 
-    const TTAMachine::Machine* mach = dsdb_->architecture(conf.architectureID);
+    std::shared_ptr<const TTAMachine::Machine> mach =
+        dsdb_->sharedArchitecture(conf.architectureID);
     IDF::MachineImplementation* idf = NULL;
 
     idf = selectComponents(*mach, frequency, maxArea, icDec, icDecHDB);
@@ -669,8 +659,7 @@ DesignSpaceExplorer::createImplementation(
         createEstimateData(*mach, *idf, area, longestPathDelay);
     }
 
-    delete mach;
-    mach = NULL;
+    mach.reset();
 
     newConf.architectureID = conf.architectureID;
     newConf.implementationID = dsdb_->addImplementation(*idf, longestPathDelay, area);
@@ -46,7 +46,7 @@
 #include "BaseLineReader.hh"
     
 class CostEstimates;
-class ExecutionTrace;
+class ActivityCounters;
 class DesignSpaceExplorerPlugin;
 
 namespace TTAMachine {
@@ -116,10 +116,10 @@ public:
 protected:
     TTAProgram::Program* schedule(
         const std::string applicationFile,
-        TTAMachine::Machine& machine,
+        const TTAMachine::Machine& machine,
         TCEString paramOptions = "-O3");
 
-    const ExecutionTrace* simulate(
+    const ActivityCounters* simulate(
         const TTAProgram::Program& program, const TTAMachine::Machine& machine,
         const TestApplication& testApplication,
         const ClockCycleCount& maxCycles, ClockCycleCount& runnedCycles,
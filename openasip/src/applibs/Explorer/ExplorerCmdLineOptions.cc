@@ -108,6 +108,8 @@ const std::string SWL_IDF_FILE = "idf";
 const std::string SWS_COMPILER_OPTIONS = "f";
 /// Long switch string of options to pass to compiler
 const std::string SWL_COMPILER_OPTIONS = "compiler_options";
+/// Long switch string for the scheduler effort level used in compilation
+const std::string SWL_SCHEDULER_EFFORT = "scheduler_effort";
 
 /**
  * Constructor.
@@ -206,6 +208,12 @@ ExplorerCmdLineOptions::ExplorerCmdLineOptions() : CmdLineOptions("") {
             SWL_COMPILER_OPTIONS,
             "Options to pass to the compiler.",
             SWS_COMPILER_OPTIONS));
+    addOption(
+        new StringCmdLineOptionParser(
+            SWL_SCHEDULER_EFFORT,
+            "Scheduler effort level used when compiling the applications: "
+            "'normal' (default) or 'fast'. The fast level gives quick cycle "
+            "count estimates for exploring large numbers of machines.", ""));
     addOption(
         new StringCmdLineOptionParser(
             SWL_ADF_OUT_FILE,
@@ -623,3 +631,36 @@ ExplorerCmdLineOptions::compilerOptionsString() const {
     }
     return optsString;
 }
+
+/**
+ * Returns true if a scheduler effort level is given as an option.
+ *
+ * @return True if a scheduler effort level is given as an option.
+ */
+bool
+ExplorerCmdLineOptions::schedulerEffort() const {
+    return findOption(SWL_SCHEDULER_EFFORT)->isDefined();
+}
+
+/**
+ * Returns the scheduler effort level given as an option.
+ *
+ * Returns an empty string if no effort level was given.
+ *
+ * @return The scheduler effort level.
+ * @exception IllegalCommandLine If an unknown effort level was given.
+ */
+std::string
+ExplorerCmdLineOptions::schedulerEffortLevel() const {
+    if (!schedulerEffort()) {
+        return "";
+    }
+    std::string effort = findOption(SWL_SCHEDULER_EFFORT)->String();
+    if (effort != "fast" && effort != "normal") {
+        throw IllegalCommandLine(
+            __FILE__, __LINE__, __func__,
+            "Unknown scheduler effort level '" + effort +
+            "'. Valid levels are 'fast' and 'normal'.");
+    }
+    return effort;
+}
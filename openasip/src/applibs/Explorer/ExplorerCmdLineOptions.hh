@@ -85,6 +85,9 @@ public:
     bool compilerOptions() const;
     std::string compilerOptionsString() const;
 
+    bool schedulerEffort() const;
+    std::string schedulerEffortLevel() const;
+
 private:
     /// Copying not allowed.
     ExplorerCmdLineOptions(const ExplorerCmdLineOptions&);
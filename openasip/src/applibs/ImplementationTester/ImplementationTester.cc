@@ -39,7 +39,9 @@
 #include <fstream>
 #include <vector>
 #include <map>
+#include <iomanip>
 #include <stdint.h>
+#include <dlfcn.h>
 
 #include "ImplementationTester.hh"
 #include "HDBManager.hh"
@@ -63,6 +65,14 @@
 #include "GhdlSimulator.hh"
 #include "ModelsimSimulator.hh"
 #include "HWBlockImplementation.hh"
+#include "FUPortImplementation.hh"
+#include "RFPortImplementation.hh"
+#include "HWOperation.hh"
+#include "FUPort.hh"
+#include "OperationPool.hh"
+#include "OperationIndex.hh"
+#include "OperationModule.hh"
+#include "FileSystem.hh"
 
 using std::string;
 using std::vector;
@@ -390,6 +400,122 @@ ImplementationTester::rfEntryIDs() const {
     return hdb_->rfEntryIDs();
 }
 
+/**
+ * Returns a digest of everything a test of the given FU entry depends on.
+ *
+ * The digest covers the architecture, the implementation, the contents
+ * of the implementation files, the OSAL modules that define the behavior
+ * of the operations and the testbench generator. Two test runs of an
+ * entry with the same digest exercise exactly the same design against
+ * the same reference, so a passed result can be reused.
+ *
+ * @param entryID Entry ID of the FU
+ * @return Digest as a hexadecimal string
+ */
+std::string
+ImplementationTester::fuTestDigest(const int entryID) const {
+
+    HDB::FUEntry* fuEntry = fuEntryFromHdb(entryID);
+    std::ostringstream description;
+    description << "FU " << simulator_ << "\n";
+    describeTestbenchGenerator(description);
+    if (fuEntry->hasArchitecture()) {
+        const TTAMachine::FunctionUnit& fu =
+            fuEntry->architecture().architecture();
+        for (int i = 0; i < fu.portCount(); i++) {
+            TTAMachine::BaseFUPort* port = fu.port(i);
+            description << "port " << port->name() << " " << port->width()
+                        << " " << port->isTriggering() << "\n";
+        }
+        for (int i = 0; i < fu.operationCount(); i++) {
+            TTAMachine::HWOperation* operation = fu.operation(i);
+            description << "operation " << operation->name() << " "
+                        << operation->latency();
+            for (int p = 0; p < fu.operationPortCount(); p++) {
+                TTAMachine::FUPort* port = fu.operationPort(p);
+                if (operation->isBound(*port)) {
+                    description << " " << port->name() << ":"
+                                << operation->io(*port);
+                }
+            }
+            description << "\n";
+            describeOperationBehavior(operation->name(), description);
+        }
+        description << "pipeline " << fu.pipelineElementCount() << "\n";
+    }
+    if (fuEntry->hasImplementation()) {
+        HDB::FUImplementation& impl = fuEntry->implementation();
+        describeImplementation(impl, description);
+        description << "opcode port " << impl.opcodePort() << "\n";
+        for (int i = 0; i < impl.opcodeCount(); i++) {
+            string operation = impl.opcodeOperation(i);
+            description << "opcode " << operation << " "
+                        << impl.opcode(operation) << "\n";
+        }
+        for (int i = 0; i < impl.architecturePortCount(); i++) {
+            HDB::FUPortImplementation& port = impl.architecturePort(i);
+            description << "port impl " << port.name() << " "
+                        << port.architecturePort() << " "
+                        << port.widthFormula() << " " << port.loadPort()
+                        << " " << port.guardPort() << "\n";
+        }
+        for (int i = 0; i < impl.parameterCount(); i++) {
+            HDB::Parameter param = impl.parameter(i);
+            description << "parameter " << param.name << " " << param.type
+                        << " " << param.value << "\n";
+        }
+    }
+    delete fuEntry;
+    return digestOf(description.str());
+}
+
+/**
+ * Returns a digest of everything a test of the given RF entry depends on.
+ *
+ * @param entryID Entry ID of the RF
+ * @return Digest as a hexadecimal string
+ * @see fuTestDigest
+ */
+std::string
+ImplementationTester::rfTestDigest(const int entryID) const {
+
+    HDB::RFEntry* rfEntry = rfEntryFromHdb(entryID);
+    std::ostringstream description;
+    description << "RF " << simulator_ << "\n";
+    describeTestbenchGenerator(description);
+    if (rfEntry->hasArchitecture()) {
+        HDB::RFArchitecture& arch = rfEntry->architecture();
+        description << "size " << arch.size() << " width " << arch.width()
+                    << " ports " << arch.readPortCount() << " "
+                    << arch.writePortCount() << " "
+                    << arch.bidirPortCount() << " latency "
+                    << arch.latency() << " guard " << arch.hasGuardSupport()
+                    << " " << arch.guardLatency() << " zero "
+                    << arch.zeroRegister() << "\n";
+    }
+    if (rfEntry->hasImplementation()) {
+        HDB::RFImplementation& impl = rfEntry->implementation();
+        describeImplementation(impl, description);
+        description << "size param " << impl.sizeParameter()
+                    << " width param " << impl.widthParameter()
+                    << " guard port " << impl.guardPort() << "\n";
+        for (int i = 0; i < impl.portCount(); i++) {
+            HDB::RFPortImplementation& port = impl.port(i);
+            description << "port impl " << port.name() << " "
+                        << port.direction() << " " << port.loadPort()
+                        << " " << port.opcodePort() << " "
+                        << port.opcodePortWidthFormula() << "\n";
+        }
+        for (int i = 0; i < impl.parameterCount(); i++) {
+            HDB::Parameter param = impl.parameter(i);
+            description << "parameter " << param.name << " " << param.type
+                        << " " << param.value << "\n";
+        }
+    }
+    delete rfEntry;
+    return digestOf(description.str());
+}
+
 
 bool 
 ImplementationTester::fuHasMemoryAccess(HDB::FUEntry* fuEntry) const {
@@ -524,6 +650,121 @@ ImplementationTester::createListOfSimulationFiles(
     }
 }
 
+/**
+ * Writes the parts common to FU and RF implementations to a description.
+ *
+ * The HDL files are included by contents so that edits to them change the
+ * description even when the HDB itself is untouched.
+ *
+ * @param impl FU/RF implementation
+ * @param description Stream to write the description to
+ */
+void
+ImplementationTester::describeImplementation(
+    const HDB::HWBlockImplementation& impl,
+    std::ostream& description) const {
+
+    description << "module " << impl.moduleName() << " " << impl.clkPort()
+                << " " << impl.rstPort() << " " << impl.glockPort() << "\n";
+
+    vector<string> files;
+    createListOfSimulationFiles(&impl, files);
+    for (unsigned int i = 0; i < files.size(); i++) {
+        description << "file " << files.at(i) << "\n";
+        std::ifstream file(files.at(i).c_str());
+        if (file.is_open()) {
+            description << file.rdbuf();
+        } else {
+            description << "<missing>";
+        }
+        description << "\n";
+    }
+}
+
+/**
+ * Writes the OSAL definition of an operation to a description.
+ *
+ * The expected results of an FU testbench come from simulating the
+ * operations with their OSAL behavior, so the properties and the behavior
+ * modules of the operation are included by contents.
+ *
+ * @param operation Name of the operation
+ * @param description Stream to write the description to
+ */
+void
+ImplementationTester::describeOperationBehavior(
+    const std::string& operation,
+    std::ostream& description) const {
+
+    OperationPool pool;
+    OperationModule& module = pool.index().moduleOf(operation);
+    if (&module == &NullOperationModule::instance()) {
+        description << "osal " << operation << " <missing>\n";
+        return;
+    }
+    vector<string> files;
+    files.push_back(module.propertiesModule());
+    if (module.definesBehavior()) {
+        files.push_back(module.behaviorModule());
+    }
+    for (unsigned int i = 0; i < files.size(); i++) {
+        description << "osal " << operation << " " << files.at(i) << "\n";
+        std::ifstream file(files.at(i).c_str(), std::ios::binary);
+        if (file.is_open()) {
+            description << file.rdbuf();
+        } else {
+            description << "<missing>";
+        }
+        description << "\n";
+    }
+}
+
+/**
+ * Writes the identity of the testbench generator to a description.
+ *
+ * The testbenches are generated by code in the library this function is
+ * in, so a rebuilt library changes the description. The library is
+ * identified by its path, size and modification time.
+ *
+ * @param description Stream to write the description to
+ */
+void
+ImplementationTester::describeTestbenchGenerator(
+    std::ostream& description) {
+
+    Dl_info info;
+    if (dladdr(
+            reinterpret_cast<void*>(
+                &ImplementationTester::describeTestbenchGenerator),
+            &info) == 0 || info.dli_fname == NULL) {
+        description << "generator <unknown>\n";
+        return;
+    }
+    const string library = info.dli_fname;
+    description << "generator " << library << " "
+                << FileSystem::sizeInBytes(library) << " "
+                << FileSystem::lastModificationTime(library) << "\n";
+}
+
+/**
+ * Computes a 64-bit FNV-1a hash of the given text.
+ *
+ * @param text Text to hash
+ * @return The hash as a 16 digit hexadecimal string
+ */
+std::string
+ImplementationTester::digestOf(const std::string& text) {
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (unsigned int i = 0; i < text.size(); i++) {
+        hash ^= static_cast<unsigned char>(text[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    std::ostringstream digest;
+    digest << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return digest.str();
+}
+
 /**
  * Compiles and simulates the testbech
  *
@@ -77,6 +77,10 @@ public:
 
     std::set<int> rfEntryIDs() const;
 
+    std::string fuTestDigest(const int entryID) const;
+
+    std::string rfTestDigest(const int entryID) const;
+
 private:
 
     bool fuHasMemoryAccess(HDB::FUEntry* fuEntry) const;
@@ -104,6 +108,18 @@ private:
         const HDB::HWBlockImplementation* impl,
         std::vector<std::string>& files) const;
 
+    void describeImplementation(
+        const HDB::HWBlockImplementation& impl,
+        std::ostream& description) const;
+
+    void describeOperationBehavior(
+        const std::string& operation,
+        std::ostream& description) const;
+
+    static void describeTestbenchGenerator(std::ostream& description);
+
+    static std::string digestOf(const std::string& text);
+
     void
     createTestbench(TestbenchGenerator* tbGen, std::string tbName) const;
 
@@ -119,6 +119,7 @@ IGNORE_COMPILER_WARNING("-Wcomment")
 #include "Machine.hh"
 #include "MachineInfo.hh"
 #include "ConstantTransformer.hh"
+#include "PhaseTimes.hh"
 //#define DEBUG_TDGEN
 
 #define DS TCEString(FileSystem::DIRECTORY_SEPARATOR)
@@ -811,7 +812,11 @@ LLVMBackend::compile(
     }
     addPass(new ConstantTransformer(*mach_));
     addPass(builder);
-    Passes.run(module);
+    {
+        // the TCE phases run by the builder pass record their own times
+        PhaseTimes::Scope phaseScope("llvm_codegen");
+        Passes.run(module);
+    }
 
     if (ipData_ != NULL) {
         if (builder->isProgramUsingRestrictedPointers()) {
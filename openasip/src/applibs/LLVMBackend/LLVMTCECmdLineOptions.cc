@@ -61,6 +61,13 @@ const std::string LLVMTCECmdLineOptions::SWL_BU_SCHEDULER =
 const std::string LLVMTCECmdLineOptions::SWL_BUBBLEFISH2_SCHEDULER =
     "bubblefish2-scheduler";
 const std::string LLVMTCECmdLineOptions::SWL_TD_SCHEDULER = "td-scheduler";
+const std::string LLVMTCECmdLineOptions::SWL_SCHEDULER_EFFORT =
+    "scheduler-effort";
+const std::string LLVMTCECmdLineOptions::SWL_SCHEDULER_THREADS =
+    "scheduler-threads";
+const std::string LLVMTCECmdLineOptions::SWL_PHASE_TIMES = "phase-times";
+const std::string LLVMTCECmdLineOptions::SWL_EXECUTION_PROFILE =
+    "execution-profile";
 const std::string LLVMTCECmdLineOptions::SWL_USE_OLD_BACKEND_SOURCES =
     "use-old-backend-src";
 const std::string LLVMTCECmdLineOptions::SWL_ANALYZE_INSTRUCTION_PATTERNS =
@@ -178,6 +185,35 @@ LLVMTCECmdLineOptions::LLVMTCECmdLineOptions() {
             SWL_TD_SCHEDULER,
             "Use the old top-down instruction scheduler(previous default)."));
 
+    addOption(
+        new StringCmdLineOptionParser(
+            SWL_SCHEDULER_EFFORT,
+            "Instruction scheduler effort level: 'normal' (default) or "
+            "'fast'. The fast level uses a single-pass list scheduler "
+            "without the iterative search or loop scheduling. It is "
+            "meant for quick cycle count estimates during design space "
+            "exploration."));
+
+    addOption(
+        new IntegerCmdLineOptionParser(
+            SWL_SCHEDULER_THREADS,
+            "Schedule the functions of the program in parallel using the "
+            "given number of threads, 0 uses all hardware threads. The "
+            "scheduled program does not depend on the number of threads."));
+
+    addOption(
+        new StringCmdLineOptionParser(
+            SWL_PHASE_TIMES,
+            "Write the wall time and peak memory usage of the compiler "
+            "phases to the given file in JSON format."));
+
+    addOption(
+        new StringCmdLineOptionParser(
+            SWL_EXECUTION_PROFILE,
+            "Use the given execution profile written by ttasim "
+            "--execution-profile to prefer compact instruction templates "
+            "in the hot code."));
+
     addOption(
         new BoolCmdLineOptionParser(
             SWL_USE_OLD_BACKEND_SOURCES,
@@ -385,6 +421,92 @@ LLVMTCECmdLineOptions::useTDScheduler() const {
     return findOption(SWL_TD_SCHEDULER)->isDefined();
 }
 
+/**
+ * Returns the requested instruction scheduler effort level.
+ *
+ * @return "fast" or "normal" (the default).
+ * @exception IllegalCommandLine If an unknown effort level was given.
+ */
+std::string
+LLVMTCECmdLineOptions::schedulerEffort() const {
+    if (!findOption(SWL_SCHEDULER_EFFORT)->isDefined()) {
+        return "normal";
+    }
+    std::string effort = findOption(SWL_SCHEDULER_EFFORT)->String();
+    if (effort != "fast" && effort != "normal") {
+        throw IllegalCommandLine(
+            __FILE__, __LINE__, __func__,
+            "Unknown scheduler effort level '" + effort +
+            "'. Valid levels are 'fast' and 'normal'.");
+    }
+    return effort;
+}
+
+/**
+ * Returns true if the fast, exploration-oriented scheduler was requested.
+ */
+bool
+LLVMTCECmdLineOptions::useFastScheduler() const {
+    return schedulerEffort() == "fast";
+}
+
+/**
+ * Returns true if parallel scheduling of the functions was requested.
+ */
+bool
+LLVMTCECmdLineOptions::isSchedulerThreadsDefined() const {
+    return findOption(SWL_SCHEDULER_THREADS)->isDefined();
+}
+
+/**
+ * Returns the number of threads to schedule the functions with.
+ *
+ * @return The number of threads, 0 for one per hardware thread.
+ * @exception IllegalCommandLine If the given number is negative.
+ */
+int
+LLVMTCECmdLineOptions::schedulerThreads() const {
+    int threads = findOption(SWL_SCHEDULER_THREADS)->integer();
+    if (threads < 0) {
+        throw IllegalCommandLine(
+            __FILE__, __LINE__, __func__,
+            "The number of scheduler threads cannot be negative.");
+    }
+    return threads;
+}
+
+/**
+ * Returns true if the compiler phase times should be written to a file.
+ */
+bool
+LLVMTCECmdLineOptions::isPhaseTimesFileDefined() const {
+    return findOption(SWL_PHASE_TIMES)->isDefined();
+}
+
+/**
+ * Returns the name of the file to write the compiler phase times to.
+ */
+std::string
+LLVMTCECmdLineOptions::phaseTimesFile() const {
+    return findOption(SWL_PHASE_TIMES)->String();
+}
+
+/**
+ * Returns true if an execution profile of the program was given.
+ */
+bool
+LLVMTCECmdLineOptions::isExecutionProfileDefined() const {
+    return findOption(SWL_EXECUTION_PROFILE)->isDefined();
+}
+
+/**
+ * Returns the name of the execution profile file.
+ */
+std::string
+LLVMTCECmdLineOptions::executionProfile() const {
+    return findOption(SWL_EXECUTION_PROFILE)->String();
+}
+
 bool
 LLVMTCECmdLineOptions::useOldBackendSources() const {
     return findOption(SWL_USE_OLD_BACKEND_SOURCES)->isDefined();
@@ -73,6 +73,14 @@ public:
     bool useBUScheduler() const;
     bool useTDScheduler() const;
     bool useBubbleFish2Scheduler() const;
+    std::string schedulerEffort() const;
+    bool useFastScheduler() const;
+    bool isSchedulerThreadsDefined() const;
+    int schedulerThreads() const;
+    bool isPhaseTimesFileDefined() const;
+    std::string phaseTimesFile() const;
+    bool isExecutionProfileDefined() const;
+    std::string executionProfile() const;
 
     bool useOldBackendSources() const;
 
@@ -137,6 +145,10 @@ private:
     static const std::string SWL_BU_SCHEDULER;
     static const std::string SWL_BUBBLEFISH2_SCHEDULER;
     static const std::string SWL_TD_SCHEDULER;
+    static const std::string SWL_SCHEDULER_EFFORT;
+    static const std::string SWL_SCHEDULER_THREADS;
+    static const std::string SWL_PHASE_TIMES;
+    static const std::string SWL_EXECUTION_PROFILE;
     static const std::string SWL_USE_OLD_BACKEND_SOURCES;
     static const std::string SWL_TEMP_DIR;
     static const std::string SWL_ENABLE_VECTOR_BACKEND;
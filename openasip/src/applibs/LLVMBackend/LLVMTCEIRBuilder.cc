@@ -71,8 +71,17 @@ IGNORE_COMPILER_WARNING("-Wunused-parameter")
 #include "PostpassOperandSharer.hh"
 #include "CallsToJumps.hh"
 #include "AbsoluteToRelativeJumps.hh"
+#include "RegisterFile.hh"
+#include "GraphNode.hh"
+#include "GraphEdge.hh"
+#include "ProgramOperation.hh"
+#include "PhaseTimes.hh"
+#include "ExecutionProfile.hh"
 
 #include <stdlib.h>
+#include <algorithm>
+#include <atomic>
+#include <boost/thread.hpp>
 #include <llvm/ADT/SmallString.h>
 #include <llvm/MC/MCContext.h>
 #include <llvm/MC/MCSymbol.h>
@@ -107,7 +116,8 @@ LLVMTCEIRBuilder::LLVMTCEIRBuilder(
     LLVMTCEBuilder(tm, mach, ID, functionAtATime), ipData_(&ipd), 
     ddgBuilder_(ipd), AA_(AA), modifyMF_(modifyMF),
     scheduler_(NULL), dsf_(NULL),
-    bypasser_(NULL), loopFinder_(NULL) {
+    bypasser_(NULL), loopFinder_(NULL), schedulerThreads_(-1),
+    executionProfile_(NULL) {
     RegisterCopyAdder::findTempRegisters(*mach, ipd);
 
     if (functionAtATime_) {
@@ -125,6 +135,26 @@ LLVMTCEIRBuilder::LLVMTCEIRBuilder(
 
     } 
     delaySlotFilling_ = !options_->disableDelaySlotFiller();
+
+    // the LLVM->TCE->LLVM chain needs the LLVM function to be around
+    // after scheduling so it is always scheduled function by function
+    if (!functionAtATime_ && !modifyMF_ &&
+        options_->isSchedulerThreadsDefined()) {
+        schedulerThreads_ = options_->schedulerThreads();
+    }
+
+    if (options_->isExecutionProfileDefined()) {
+        executionProfile_ = new ExecutionProfile();
+        try {
+            executionProfile_->readFromFile(options_->executionProfile());
+        } catch (const Exception& e) {
+            Application::errorStream()
+                << "Warning: ignoring the execution profile: "
+                << e.errorMessage() << std::endl;
+            delete executionProfile_;
+            executionProfile_ = NULL;
+        }
+    }
 }
 
 void
@@ -190,9 +220,12 @@ LLVMTCEIRBuilder::writeMachineFunction(MachineFunction& mf) {
         ctj.handleControlFlowGraph(*cfg, *mach_);
     }
 
+    DataDependenceGraph* ddg = NULL;
     if (fastCompilation || !isHotFunction(mf)) {
         verboseLog(TCEString("###      compiling (fast): ") + fnName);
-        EXIT_IF_THROWS(compileFast(*cfg));
+        if (schedulerThreads_ < 0) {
+            EXIT_IF_THROWS(compileFast(*cfg));
+        }
     } else {
         verboseLog(TCEString("### compiling (optimized): ") + fnName);
         AliasAnalysis* AA = NULL;
@@ -210,13 +243,34 @@ LLVMTCEIRBuilder::writeMachineFunction(MachineFunction& mf) {
             // got them for us and passed through.        
             AA = AA_;
         }
-        EXIT_IF_THROWS(compileOptimized(*cfg, AA));
+        if (schedulerThreads_ < 0) {
+            EXIT_IF_THROWS(compileOptimized(*cfg, AA));
+        } else {
+            // the DDG needs the alias analysis of the function, so it is
+            // built now and the rest is done in doFinalization()
+            EXIT_IF_THROWS(ddg = prepareOptimized(*cfg, AA));
+        }
+    }
+
+    if (schedulerThreads_ >= 0) {
+        PendingFunction pending = { procedure, cfg, ddg, 0, 0, 0 };
+        pendingFunctions_.push_back(pending);
+        if (Application::verboseLevel() > 0 && spillMoveCount_ > 0) {
+            Application::logStream()
+                << "spill moves in " <<
+                (std::string)(mf.getFunction().getName()) << ": "
+                << spillMoveCount_ << std::endl;
+        }
+        return false;
     }
 
     if (!modifyMF_) {
         cfg->convertBBRefsToInstRefs();
     }
-    cfg->copyToProcedure(*procedure, irm);
+    {
+        PhaseTimes::Scope phaseScope("pom_emission");
+        cfg->copyToProcedure(*procedure, irm);
+    }
 #ifdef WRITE_CFG_DOTS
     cfg->writeToDotFile(fnName + "_cfg4.dot");
 #endif
@@ -271,6 +325,7 @@ LLVMTCEIRBuilder::isHotFunction(llvm::MachineFunction& mf) const {
 
 ControlFlowGraph*
 LLVMTCEIRBuilder::buildTCECFG(llvm::MachineFunction& mf) {
+    PhaseTimes::Scope phaseScope("cfg_build");
 
     SmallString<256> Buffer;
     mang_->getNameWithPrefix(Buffer, &mf.getFunction(), false);
@@ -888,22 +943,41 @@ LLVMTCEIRBuilder::compileFast(ControlFlowGraph& cfg) {
 BBSchedulerController&
 LLVMTCEIRBuilder::scheduler() {
     if (scheduler_ == NULL) {
-        bypasser_ = new CycleLookBackSoftwareBypasser;
         // disabled for the LLVM->TCE->LLVM scheduling chain as
         // it crashes
         CopyingDelaySlotFiller* dsf = NULL;
         if (!modifyMF_ && delaySlotFilling_) 
             dsf = &delaySlotFiller();
-        scheduler_ = 
-            new BBSchedulerController(*mach_, *ipData_, bypasser_, dsf);
+        scheduler_ = createScheduler(bypasser_, dsf);
     } 
     return *scheduler_;
 }
 
+/**
+ * Creates a new basic block scheduler.
+ *
+ * @param bypasser Set to the created software bypasser, NULL if none.
+ *        Owned by the caller, must outlive the scheduler.
+ * @param dsf The delay slot filler to use, NULL to not fill delay slots.
+ * @return The new scheduler, owned by the caller.
+ */
+BBSchedulerController*
+LLVMTCEIRBuilder::createScheduler(
+    CycleLookBackSoftwareBypasser*& bypasser,
+    CopyingDelaySlotFiller* dsf) {
+    bypasser = new CycleLookBackSoftwareBypasser;
+    BBSchedulerController* scheduler =
+        new BBSchedulerController(*mach_, *ipData_, bypasser, dsf);
+    scheduler->setExecutionProfile(executionProfile_);
+    return scheduler;
+}
+
 CopyingDelaySlotFiller&
 LLVMTCEIRBuilder::delaySlotFiller() {
-    if (dsf_ == NULL)
+    if (dsf_ == NULL) {
         dsf_ = new CopyingDelaySlotFiller;
+        dsf_->setExecutionProfile(executionProfile_);
+    }
     return *dsf_;    
 }
 
@@ -912,10 +986,32 @@ LLVMTCEIRBuilder::compileOptimized(
     ControlFlowGraph& cfg, 
     llvm::AliasAnalysis* llvmAA) {
 
+    DataDependenceGraph* ddg = prepareOptimized(cfg, llvmAA);
+    scheduleOptimized(
+        cfg, ddg, scheduler(),
+        delaySlotFilling_ ? &delaySlotFiller() : NULL);
+}
+
+/**
+ * Runs the optimizations before scheduling and builds the DDG of the CFG.
+ *
+ * @param cfg The CFG of the function.
+ * @param llvmAA LLVM alias analysis of the function, can be NULL.
+ * @return The DDG, owned by the caller.
+ */
+DataDependenceGraph*
+LLVMTCEIRBuilder::prepareOptimized(
+    ControlFlowGraph& cfg,
+    llvm::AliasAnalysis* llvmAA) {
+
     SimpleIfConverter ifConverter(*ipData_, *mach_);
     ifConverter.handleControlFlowGraph(cfg, *mach_);
-    Peel2BBLoops peel2bbLoops(*ipData_, *mach_);
-    peel2bbLoops.handleControlFlowGraph(cfg, *mach_);
+    // peeling only helps the loop scheduler which is not used with
+    // the fast scheduler effort level
+    if (options_ == NULL || !options_->useFastScheduler()) {
+        Peel2BBLoops peel2bbLoops(*ipData_, *mach_);
+        peel2bbLoops.handleControlFlowGraph(cfg, *mach_);
+    }
 
 #if 0
     SchedulerCmdLineOptions* options =
@@ -929,16 +1025,17 @@ LLVMTCEIRBuilder::compileOptimized(
         DataDependenceGraph::INTRA_BB_ANTIDEPS, *mach_,
         NULL, true, true, llvmAA);
 
-    TCEString fnName = cfg.name();
 #ifdef WRITE_DDG_DOTS
     ddg->writeToDotFile(cfg.name() + "_ddg1.dot");
 #endif
-    cfg.optimizeBBOrdering(true, cfg.instructionReferenceManager(), ddg);
+    cfg.optimizeBBOrdering(
+        true, cfg.instructionReferenceManager(), ddg, executionProfile_);
 
     PreOptimizer preOpt(*ipData_);
     preOpt.handleCFGDDG(cfg, *ddg);
 
-    cfg.optimizeBBOrdering(true, cfg.instructionReferenceManager(), ddg);
+    cfg.optimizeBBOrdering(
+        true, cfg.instructionReferenceManager(), ddg, executionProfile_);
 
 #ifdef WRITE_DDG_DOTS
     ddg->writeToDotFile(cfg.name() + "_ddg2.dot");
@@ -950,13 +1047,31 @@ LLVMTCEIRBuilder::compileOptimized(
         // need the BB refs to rebuild the LLVM CFG 
         cfg.convertBBRefsToInstRefs();
     }
+    return ddg;
+}
+
+/**
+ * Schedules the CFG and runs the post-pass optimizations on it.
+ *
+ * @param cfg The CFG to schedule.
+ * @param ddg The DDG of the CFG from prepareOptimized(), deleted here.
+ * @param scheduler The scheduler to use.
+ * @param dsf The delay slot filler to use, NULL if delay slots are not
+ *        filled.
+ */
+void
+LLVMTCEIRBuilder::scheduleOptimized(
+    ControlFlowGraph& cfg,
+    DataDependenceGraph* ddg,
+    BBSchedulerController& scheduler,
+    CopyingDelaySlotFiller* dsf) {
 
-    if (delaySlotFilling_)
-        delaySlotFiller().initialize(cfg, *ddg, *mach_);
-    scheduler().handleCFGDDG(cfg, ddg, *mach_ );
+    if (dsf != NULL)
+        dsf->initialize(cfg, *ddg, *mach_);
+    scheduler.handleCFGDDG(cfg, ddg, *mach_ );
 
+    TCEString fnName = cfg.name();
 #ifdef WRITE_CFG_DOTS
-    fnName = cfg.name();
     cfg.writeToDotFile(fnName + "_cfg2.dot");
 #endif
 #ifdef WRITE_DDG_DOTS
@@ -967,8 +1082,8 @@ LLVMTCEIRBuilder::compileOptimized(
         // TODO: make DS filler work with FAAT
         // sched yield emitter does not work with the delay slot filler
 
-        if (delaySlotFilling_) {
-            delaySlotFiller().fillDelaySlots(cfg, *ddg, *mach_);
+        if (dsf != NULL) {
+            dsf->fillDelaySlots(cfg, *ddg, *mach_);
         } 
     }
 
@@ -1123,6 +1238,9 @@ LLVMTCEIRBuilder::doInitialization(Module& m) {
 bool
 LLVMTCEIRBuilder::doFinalization(Module& m) { 
 
+    // the data definitions need the code labels of the functions
+    schedulePendingFunctions();
+
     // Catch the exception here as throwing exceptions
     // through library boundaries is flaky. It crashes 
     // on x86-32 Linux at least. See:
@@ -1143,6 +1261,132 @@ LLVMTCEIRBuilder::doFinalization(Module& m) {
     return false; 
 }
 
+/**
+ * Schedules the functions deferred by writeMachineFunction() in parallel
+ * threads and adds them to the program in the original function order.
+ *
+ * Every function is scheduled with its own scheduler instances and starts
+ * the graph node, edge and program operation numbering from the same
+ * point, so the scheduled program does not depend on the number of
+ * threads or on which thread schedules which function.
+ */
+void
+LLVMTCEIRBuilder::schedulePendingFunctions() {
+
+    if (pendingFunctions_.empty()) {
+        return;
+    }
+
+    const int nextNodeID = GraphNode::nextID();
+    const int nextEdgeID = GraphEdge::nextID();
+    const unsigned int nextPoID = ProgramOperation::nextID();
+
+    unsigned int threads = schedulerThreads_;
+    if (threads == 0) {
+        threads = std::max(1u, boost::thread::hardware_concurrency());
+    }
+    threads = std::min<std::size_t>(threads, pendingFunctions_.size());
+
+    // the threads share the instruction references of the program
+    TTAProgram::InstructionReferenceManager& refManager =
+        prog_->instructionReferenceManager();
+    refManager.setThreadSafe(threads > 1);
+
+    std::atomic<std::size_t> nextFunction(0);
+    {
+        // the wall time the main thread waits for the workers, the phases
+        // run in the workers are summed over the threads
+        PhaseTimes::Scope phaseScope("parallel_scheduling");
+        boost::thread_group workers;
+        for (unsigned int t = 0; t < threads; ++t) {
+            workers.create_thread([&]() {
+                for (std::size_t f = nextFunction++;
+                     f < pendingFunctions_.size(); f = nextFunction++) {
+                    schedulePendingFunction(
+                        pendingFunctions_[f], nextNodeID, nextEdgeID,
+                        nextPoID);
+                }
+            });
+        }
+        workers.join_all();
+    }
+    refManager.setThreadSafe(false);
+
+    int maxNodeID = nextNodeID;
+    int maxEdgeID = nextEdgeID;
+    unsigned int maxPoID = nextPoID;
+    for (PendingFunction& function : pendingFunctions_) {
+        TTAProgram::Procedure& procedure = *function.procedure;
+        {
+            PhaseTimes::Scope emissionScope("pom_emission");
+            function.cfg->copyToProcedure(
+                procedure, &prog_->instructionReferenceManager());
+        }
+        if (procedure.instructionCount() > 0) {
+            codeLabels_[procedure.name()] = &procedure.firstInstruction();
+        }
+
+        AbsoluteToRelativeJumps jumpConv(*ipData_);
+        jumpConv.handleProcedure(procedure, *mach_);
+
+        delete function.cfg;
+        maxNodeID = std::max(maxNodeID, function.nextNodeID);
+        maxEdgeID = std::max(maxEdgeID, function.nextEdgeID);
+        maxPoID = std::max(maxPoID, function.nextPoID);
+    }
+    pendingFunctions_.clear();
+
+    // keep the IDs of the graphs built from now on unique
+    GraphNode::setNextID(maxNodeID);
+    GraphEdge::setNextID(maxEdgeID);
+    ProgramOperation::setNextID(maxPoID);
+}
+
+/**
+ * Schedules a deferred function. Called from the scheduler threads.
+ *
+ * @param function The function to schedule.
+ * @param nextNodeID First graph node ID for the nodes created while
+ *        scheduling.
+ * @param nextEdgeID First graph edge ID for the created edges.
+ * @param nextPoID First ID for the created program operations.
+ */
+void
+LLVMTCEIRBuilder::schedulePendingFunction(
+    PendingFunction& function, int nextNodeID, int nextEdgeID,
+    unsigned int nextPoID) {
+
+    GraphNode::setNextID(nextNodeID);
+    GraphEdge::setNextID(nextEdgeID);
+    ProgramOperation::setNextID(nextPoID);
+
+    ControlFlowGraph& cfg = *function.cfg;
+    if (function.ddg == NULL) {
+        EXIT_IF_THROWS(compileFast(cfg));
+    } else {
+        // the shared scheduler instances keep state between the
+        // scheduled functions, so each function gets its own
+        CopyingDelaySlotFiller* dsf =
+            delaySlotFilling_ ? new CopyingDelaySlotFiller : NULL;
+        if (dsf != NULL) {
+            dsf->setExecutionProfile(executionProfile_);
+        }
+        CycleLookBackSoftwareBypasser* bypasser = NULL;
+        BBSchedulerController* scheduler = createScheduler(bypasser, dsf);
+        EXIT_IF_THROWS(
+            scheduleOptimized(cfg, function.ddg, *scheduler, dsf));
+        function.ddg = NULL;
+        delete scheduler;
+        delete bypasser;
+        delete dsf;
+    }
+    cfg.convertBBRefsToInstRefs();
+
+    function.nextNodeID = GraphNode::nextID();
+    function.nextEdgeID = GraphEdge::nextID();
+    function.nextPoID = ProgramOperation::nextID();
+}
+
 TCEString 
 LLVMTCEIRBuilder::operationName(const MachineInstr& mi) const {
     if (dynamic_cast<const TCETargetMachine*>(&targetMachine()) 
@@ -1298,5 +1542,6 @@ LLVMTCEIRBuilder::~LLVMTCEIRBuilder() {
     delete scheduler_;
     delete bypasser_;
     delete dsf_;
+    delete executionProfile_;
 }
 }
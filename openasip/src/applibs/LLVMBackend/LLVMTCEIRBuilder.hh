@@ -34,6 +34,8 @@
 #ifndef LLVM_TCE_IR_BUILDER_H
 #define LLVM_TCE_IR_BUILDER_H
 
+#include <vector>
+
 #include <llvm/CodeGen/MachineFunctionPass.h>
 #include <llvm/Analysis/AliasAnalysis.h>
 
@@ -46,6 +48,7 @@ class LLVMTCECmdLineOptions;
 class BBSchedulerController;
 class CopyingDelaySlotFiller;
 class CycleLookBackSoftwareBypasser;
+class ExecutionProfile;
 struct InnerLoopFinder;
 
 namespace TTAMachine {
@@ -130,6 +133,24 @@ namespace llvm {
 
     private:
 
+        /**
+         * A function whose scheduling is deferred to doFinalization() to
+         * schedule the functions of the module in parallel.
+         */
+        struct PendingFunction {
+            /// The procedure the scheduled code is copied to.
+            TTAProgram::Procedure* procedure;
+            /// The CFG to schedule.
+            ControlFlowGraph* cfg;
+            /// The DDG of the CFG, NULL for fast compilation.
+            DataDependenceGraph* ddg;
+            /// Next graph node, edge and program operation IDs after the
+            /// function was scheduled.
+            int nextNodeID;
+            int nextEdgeID;
+            unsigned int nextPoID;
+        };
+
         bool isHotFunction(llvm::MachineFunction& mf) const;
         bool isRealInstruction(const MachineInstr& instr) const;
         bool hasRealInstructions(
@@ -144,11 +165,27 @@ namespace llvm {
         void compileOptimized(
             ControlFlowGraph& cfg, 
             llvm::AliasAnalysis* llvmAA);
+        DataDependenceGraph* prepareOptimized(
+            ControlFlowGraph& cfg,
+            llvm::AliasAnalysis* llvmAA);
+        void scheduleOptimized(
+            ControlFlowGraph& cfg,
+            DataDependenceGraph* ddg,
+            BBSchedulerController& scheduler,
+            CopyingDelaySlotFiller* dsf);
+
+        void schedulePendingFunctions();
+        void schedulePendingFunction(
+            PendingFunction& function, int nextNodeID, int nextEdgeID,
+            unsigned int nextPoID);
 
         bool isExplicitReturn(const llvm::MachineInstr& mi) const;
 
         CopyingDelaySlotFiller& delaySlotFiller();
         BBSchedulerController& scheduler();
+        BBSchedulerController* createScheduler(
+            CycleLookBackSoftwareBypasser*& bypasser,
+            CopyingDelaySlotFiller* dsf);
 
         ControlFlowGraph* buildTCECFG(llvm::MachineFunction& mf);
         void markJumpTableDestinations(
@@ -183,6 +220,14 @@ namespace llvm {
         CycleLookBackSoftwareBypasser* bypasser_;
 
         InnerLoopFinder* loopFinder_;
+
+        /// Number of threads to schedule the functions with, -1 when they
+        /// are scheduled one by one as they are built.
+        int schedulerThreads_;
+        /// Functions waiting to be scheduled in parallel, in module order.
+        std::vector<PendingFunction> pendingFunctions_;
+        /// Execution profile given with --execution-profile, NULL if none.
+        ExecutionProfile* executionProfile_;
     };
 }
 
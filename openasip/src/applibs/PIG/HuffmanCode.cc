@@ -0,0 +1,222 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+/**
+ * @file HuffmanCode.cc
+ *
+ * Implementation of HuffmanCode class.
+ *
+ * @note rating: red
+ */
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+
+#include "HuffmanCode.hh"
+#include "MathTools.hh"
+#include "Conversion.hh"
+
+using std::vector;
+
+/**
+ * The constructor.
+ *
+ * The code lengths of a Huffman tree over the frequencies are clamped to
+ * the length limit, after which the shortest codes are lengthened until
+ * the lengths satisfy the Kraft inequality again. A single symbol gets an
+ * empty code.
+ *
+ * @param frequencies The frequency of each symbol.
+ * @param maxLength Length limit of the codes. Raised to the width of a
+ *        fixed width index if it does not leave room for all the symbols.
+ */
+HuffmanCode::HuffmanCode(
+    const vector<unsigned int>& frequencies, unsigned int maxLength) {
+
+    const unsigned int count = frequencies.size();
+    lengths_.assign(count, 0);
+    codes_.assign(count, BitVector());
+    if (count < 2) {
+        return;
+    }
+
+    // the nodes of the Huffman tree, leaves first
+    vector<int> parent(2 * count - 1, -1);
+    typedef std::pair<unsigned long long, unsigned int> Node;
+    std::priority_queue<Node, vector<Node>, std::greater<Node> > queue;
+    for (unsigned int i = 0; i < count; i++) {
+        queue.push(Node(frequencies.at(i), i));
+    }
+    unsigned int nextNode = count;
+    while (queue.size() > 1) {
+        Node first = queue.top();
+        queue.pop();
+        Node second = queue.top();
+        queue.pop();
+        parent.at(first.second) = nextNode;
+        parent.at(second.second) = nextNode;
+        queue.push(Node(first.first + second.first, nextNode));
+        nextNode++;
+    }
+
+    const unsigned int limit = std::max(
+        maxLength,
+        static_cast<unsigned int>(MathTools::requiredBits0Bit0(count - 1)));
+    for (unsigned int i = 0; i < count; i++) {
+        unsigned int depth = 0;
+        for (int node = i; parent.at(node) != -1; node = parent.at(node)) {
+            depth++;
+        }
+        lengths_.at(i) = std::min(depth, limit);
+    }
+
+    // restore the Kraft inequality by lengthening the codes of the
+    // least frequent symbols that still have room to grow
+    unsigned long long kraft = 0;
+    for (unsigned int i = 0; i < count; i++) {
+        kraft += 1ULL << (limit - lengths_.at(i));
+    }
+    while (kraft > (1ULL << limit)) {
+        int victim = -1;
+        for (unsigned int i = 0; i < count; i++) {
+            unsigned int length = lengths_.at(i);
+            if (length >= limit) {
+                continue;
+            }
+            if (victim == -1 || length > lengths_.at(victim) ||
+                (length == lengths_.at(victim) &&
+                 frequencies.at(i) < frequencies.at(victim))) {
+                victim = i;
+            }
+        }
+        assert(victim != -1);
+        unsigned int length = lengths_.at(victim);
+        kraft -= 1ULL << (limit - length - 1);
+        lengths_.at(victim) = length + 1;
+    }
+
+    // assign the canonical codes in the order of length and index
+    vector<unsigned int> order(count);
+    for (unsigned int i = 0; i < count; i++) {
+        order.at(i) = i;
+    }
+    std::stable_sort(order.begin(), order.end(), LengthOrder(lengths_));
+    unsigned long long code = 0;
+    unsigned int previousLength = lengths_.at(order.at(0));
+    for (unsigned int i = 0; i < count; i++) {
+        unsigned int symbol = order.at(i);
+        unsigned int length = lengths_.at(symbol);
+        code <<= (length - previousLength);
+        codes_.at(symbol).pushBack(code, length);
+        previousLength = length;
+        code++;
+    }
+}
+
+/**
+ * The destructor.
+ */
+HuffmanCode::~HuffmanCode() {
+}
+
+/**
+ * Returns the number of symbols.
+ */
+unsigned int
+HuffmanCode::symbolCount() const {
+    return lengths_.size();
+}
+
+/**
+ * Returns the length of the code of the given symbol.
+ *
+ * @param symbol The symbol.
+ * @return The code length in bits.
+ * @exception OutOfRange If there is no such symbol.
+ */
+unsigned int
+HuffmanCode::length(unsigned int symbol) const {
+    if (symbol >= lengths_.size()) {
+        throw OutOfRange(
+            __FILE__, __LINE__, __func__,
+            "No symbol " + Conversion::toString(symbol) + ".");
+    }
+    return lengths_.at(symbol);
+}
+
+/**
+ * Returns the code of the given symbol.
+ *
+ * @param symbol The symbol.
+ * @return The code, the first bit is sent first.
+ * @exception OutOfRange If there is no such symbol.
+ */
+const BitVector&
+HuffmanCode::code(unsigned int symbol) const {
+    length(symbol);
+    return codes_.at(symbol);
+}
+
+/**
+ * Appends the code of the given symbol to the bits.
+ *
+ * @param symbol The symbol.
+ * @param bits The bit vector to append to.
+ * @exception OutOfRange If there is no such symbol.
+ */
+void
+HuffmanCode::encode(unsigned int symbol, BitVector& bits) const {
+    bits.pushBack(code(symbol));
+}
+
+/**
+ * Decodes the symbol whose code starts at the given position.
+ *
+ * The codes are matched one bit at a time from the shortest to the
+ * longest, which is the order the codes form a prefix free set in.
+ *
+ * @param bits The encoded bits.
+ * @param position Index of the first bit of the code. Advanced past the
+ *        decoded code.
+ * @return The decoded symbol.
+ * @exception InvalidData If the bits do not start with a code.
+ */
+unsigned int
+HuffmanCode::decode(const BitVector& bits, unsigned int& position) const {
+    if (lengths_.size() == 1) {
+        return 0;
+    }
+    BitVector prefix;
+    for (unsigned int i = position; i < bits.size(); i++) {
+        prefix.pushBack(static_cast<bool>(bits.at(i)));
+        for (unsigned int symbol = 0; symbol < codes_.size(); symbol++) {
+            if (codes_.at(symbol) == prefix) {
+                position = i + 1;
+                return symbol;
+            }
+        }
+    }
+    throw InvalidData(
+        __FILE__, __LINE__, __func__,
+        "No code starts at bit " + Conversion::toString(position) + ".");
+}
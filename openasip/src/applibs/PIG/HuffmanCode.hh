@@ -0,0 +1,78 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+/**
+ * @file HuffmanCode.hh
+ *
+ * Declaration of HuffmanCode class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_HUFFMAN_CODE_HH
+#define TTA_HUFFMAN_CODE_HH
+
+#include <vector>
+
+#include "BitVector.hh"
+#include "Exception.hh"
+
+/**
+ * Length limited canonical Huffman code of a set of symbols.
+ *
+ * The symbols are the indices of the given frequency vector. The code
+ * lengths come from a Huffman tree over the frequencies, clamped to the
+ * length limit. The codes are assigned canonically in the order of length
+ * and symbol index, so codes of the same length are consecutive numbers.
+ */
+class HuffmanCode {
+public:
+    HuffmanCode(
+        const std::vector<unsigned int>& frequencies,
+        unsigned int maxLength);
+    virtual ~HuffmanCode();
+
+    unsigned int symbolCount() const;
+    unsigned int length(unsigned int symbol) const;
+    const BitVector& code(unsigned int symbol) const;
+
+    void encode(unsigned int symbol, BitVector& bits) const;
+    unsigned int decode(const BitVector& bits, unsigned int& position) const;
+
+private:
+    /// Orders symbols by their code length.
+    struct LengthOrder {
+        LengthOrder(const std::vector<unsigned int>& lengths) :
+            lengths_(lengths) {}
+        bool operator()(unsigned int a, unsigned int b) const {
+            return lengths_.at(a) < lengths_.at(b);
+        }
+        const std::vector<unsigned int>& lengths_;
+    };
+
+    /// The code lengths of the symbols.
+    std::vector<unsigned int> lengths_;
+    /// The codes of the symbols.
+    std::vector<BitVector> codes_;
+};
+
+#endif
@@ -65,6 +65,7 @@
 #include "DisassemblyRegister.hh"
 
 #include "LoopAnalyzer.hh"
+#include "ExecutionProfile.hh"
 #include "ScheduleEstimator.hh"
 
 namespace TTAMachine {
@@ -79,6 +80,10 @@ namespace TTAMachine {
 // getting slow with very big II's. limit it. TODO: make this cmdline param.
 static const int MAXIMUM_II = 60;
 static const int DEFAULT_LOWMEM_MODE_THRESHOLD = 200000;
+/// Fraction of the highest execution count a basic block has to reach to
+/// be scheduled also without register renaming. The retry schedules the
+/// block three times, so it is limited to the hottest blocks.
+static const double RESCHEDULE_THRESHOLD = 0.25;
 
 /**
  * Constructs the basic block scheduler.
@@ -97,7 +102,8 @@ BBSchedulerController::BBSchedulerController(
     ProgramPass(data), targetMachine_(targetMachine), 
     scheduledProcedure_(NULL), bigDDG_(bigDDG), 
     softwareBypasser_(bypasser), delaySlotFiller_(delaySlotFiller),
-    basicBlocksScheduled_(0), totalBasicBlocks_(0), progressBar_(NULL) {
+    basicBlocksScheduled_(0), totalBasicBlocks_(0), progressBar_(NULL),
+    profile_(NULL) {
 
     CmdLineOptions *cmdLineOptions = Application::cmdLineOptions();
     options_ = dynamic_cast<LLVMTCECmdLineOptions*>(cmdLineOptions);
@@ -139,6 +145,12 @@ BBSchedulerController::handleBasicBlock(
         dynamic_cast<SchedulerCmdLineOptions*>(
             Application::cmdLineOptions());
 
+    // the fast effort level is used for cycle count estimation in
+    // exploration: a single-pass list scheduler with the same bypassing
+    // and renaming, but no iterative BF2 search or loop scheduling.
+    const bool fastScheduler =
+        options_ != NULL && options_->useFastScheduler();
+
     // create register renamer if enabled and we know the
     // reserved registers.
     if (options != NULL && options->renameRegisters() && bigDDG_ != NULL
@@ -151,7 +163,10 @@ BBSchedulerController::handleBasicBlock(
 
     std::vector<DDGPass*> bbSchedulers;
 
-    if (options_ != NULL && options_->useBubbleFish2Scheduler()) {
+    if (fastScheduler) {
+        bbSchedulers.push_back(new BasicBlockScheduler(
+            BasicBlockPass::interPassData(), softwareBypasser_, rr));
+    } else if (options_ != NULL && options_->useBubbleFish2Scheduler()) {
         bbSchedulers.push_back(new BF2Scheduler(
                                    BasicBlockPass::interPassData(), rr));
     } else if (options_ != NULL && options_->useBUScheduler()) {
@@ -165,7 +180,7 @@ BBSchedulerController::handleBasicBlock(
                                    BasicBlockPass::interPassData(), rr));
     }
 
-    if (options_->isLoopOptDefined() &&
+    if (!fastScheduler && options_->isLoopOptDefined() &&
         cfg_->isSingleBBLoop(*bbn) && 
         bb.lastInstruction().hasJump() &&
         bigDDG_ != NULL) {
@@ -229,6 +244,16 @@ BBSchedulerController::handleBasicBlock(
     }
     if (!bbScheduled) {
 
+        // spend more effort on the hottest basic blocks: try also
+        // scheduling without register renaming, which sometimes gives a
+        // shorter schedule, and keep the shorter one
+        if (!fastScheduler && rr != NULL && bigDDG_ != NULL &&
+            dynamic_cast<BF2Scheduler*>(bbSchedulers[0]) != NULL &&
+            isHotBasicBlock(bb, RESCHEDULE_THRESHOLD)) {
+            bbSchedulers.push_back(new BF2Scheduler(
+                                       BasicBlockPass::interPassData(), NULL));
+        }
+
         executeDDGPass(
             bb, targetMachine, irm, bbSchedulers, bbn);
 
@@ -262,7 +287,7 @@ BBSchedulerController::handleBasicBlock(
 }
 
 #ifdef DEBUG_REG_COPY_ADDER
-static int graphCount = 0;
+static thread_local int graphCount = 0;
 #endif
 
 /**
@@ -442,6 +467,42 @@ BBSchedulerController::longDescription() const {
 }
 
 
+/**
+ * Sets the execution profile used to find the hot basic blocks.
+ *
+ * @param profile The profile, NULL to schedule all blocks alike. Not owned.
+ */
+void
+BBSchedulerController::setExecutionProfile(const ExecutionProfile* profile) {
+    profile_ = profile;
+}
+
+/**
+ * Tells whether the given basic block is hot according to the execution
+ * profile.
+ *
+ * @param bb The basic block.
+ * @param threshold Fraction of the highest execution count the block has
+ *        to reach.
+ * @return True if an execution profile was given and the block is hot.
+ */
+bool
+BBSchedulerController::isHotBasicBlock(
+    const TTAProgram::BasicBlock& bb, double threshold) const {
+
+    if (profile_ == NULL) {
+        return false;
+    }
+    std::string procName;
+    if (cfg_ != NULL) {
+        procName = cfg_->procedureName();
+    } else if (scheduledProcedure_ != NULL) {
+        procName = scheduledProcedure_->name();
+    }
+    return profile_->isHot(bb, procName, threshold);
+}
+
+
 /**
  * Helper function used to create DDG for BBPass.
  *
@@ -475,9 +536,11 @@ BBSchedulerController::executeDDGPass(
     DataDependenceGraph* ddg = NULL;
     SimpleResourceManager* rm = NULL;
     // Used for live info dumping.
-    static int bbNumber = 0;
+    static thread_local int bbNumber = 0;
     int min = INT_MAX;
     int fastest = 0;
+    const bool hotCode =
+        isHotBasicBlock(bb, ExecutionProfile::HOT_THRESHOLD);
     if (ddgPasses.size() > 1) {
         for (unsigned int i = 0; i < ddgPasses.size(); i++) {
             ddg = createDDGFromBB(bb, targetMachine);
@@ -485,6 +548,7 @@ BBSchedulerController::executeDDGPass(
             rm->setDDG(ddg);
             rm->setCFG(cfg_);
             rm->setBBN(bbn);
+            rm->setHotCode(hotCode);
 
             int size =
                 ddgPasses[i]->handleDDG(*ddg, *rm, targetMachine, minCycle, true);
@@ -502,6 +566,7 @@ BBSchedulerController::executeDDGPass(
     rm->setDDG(static_cast<DataDependenceGraph*>(ddg->rootGraph()));
     rm->setCFG(cfg_);
     rm->setBBN(bbn);
+    rm->setHotCode(hotCode);
 
     if (options_ != NULL && options_->printResourceConstraints()) {
         TCEString ddgName = ddg->name();
@@ -47,6 +47,7 @@ class CopyingDelaySlotFiller;
 class LLVMTCECmdLineOptions;
 class DDGPass;
 class DataDependenceGraph;
+class ExecutionProfile;
 
 namespace TTAProgram {
     class Procedure;
@@ -105,11 +106,15 @@ public:
     virtual std::string shortDescription() const override;
     virtual std::string longDescription() const override;
 
+    void setExecutionProfile(const ExecutionProfile* profile);
+
 protected:
     virtual DataDependenceGraph* createDDGFromBB(
         TTAProgram::BasicBlock& bb, const TTAMachine::Machine& mach);
 
 private:
+    bool isHotBasicBlock(
+        const TTAProgram::BasicBlock& bb, double threshold) const;
 
     const TTAMachine::Machine& targetMachine_;
 
@@ -135,6 +140,8 @@ private:
     boost::progress_display* progressBar_;
 
     LLVMTCECmdLineOptions* options_;
+    /// Execution profile of the program, NULL if not available.
+    const ExecutionProfile* profile_;
 };
 
 #endif
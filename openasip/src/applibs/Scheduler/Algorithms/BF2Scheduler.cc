@@ -73,6 +73,7 @@
 #include "BFRemoveLoopChecks.hh"
 #include "LoopAnalyzer.hh"
 #include "BFPostpassBypasser.hh"
+#include "PhaseTimes.hh"
 
 //#define DEBUG_PRE_SHARE
 //#define DEBUG_BUBBLEFISH_SCHEDULER
@@ -244,6 +245,7 @@ int
 BF2Scheduler::handleDDG(
     DataDependenceGraph& ddg, SimpleResourceManager& rm,
     const TTAMachine::Machine& targetMachine, int, bool testOnly) {
+    PhaseTimes::Scope phaseScope("bf2_scheduler");
     loopBufOps_.clear();
 
     scheduleDDG(ddg, rm, targetMachine);
@@ -403,6 +405,7 @@ BF2Scheduler::handleLoopDDG(
     DataDependenceGraph& ddg, SimpleResourceManager& rm,
     const TTAMachine::Machine& targetMachine, int tripCount,
     SimpleResourceManager* prologRM, bool testOnly) {
+    PhaseTimes::Scope phaseScope("bf2_scheduler");
 #ifndef DEBUG_BUBBLEFISH_SCHEDULER
     if (options_ != NULL && options_->dumpDDGsDot()) {
 #endif
@@ -1159,7 +1162,7 @@ void BF2Scheduler::countLoopInvariantValueUsages() {
     invariants_.clear();
     invariantsOfCount_.clear();
 
-    static int iaCounter= 0;
+    static thread_local int iaCounter= 0;
     for (int i = 0; i < ddg().programOperationCount(); i++) {
         ProgramOperation& po = ddg().programOperation(i);
         const Operation& op = po.operation();
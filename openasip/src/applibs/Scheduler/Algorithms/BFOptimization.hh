@@ -143,7 +143,8 @@ protected:
                            const TTAMachine::ImmediateUnit* immu = nullptr,
                            int immRegIndex = -1,
                            bool ignoreGWN = false);
-    static std::map<MoveNode*, MoveNode*, MoveNode::Comparator> prologMoves_;
+    static thread_local std::map<MoveNode*, MoveNode*, MoveNode::Comparator>
+    prologMoves_;
 
     bool putAlsoToPrologEpilog(int cycle, MoveNode& mn);
 
@@ -117,4 +117,4 @@ bool BFPushDepsUp::operator()() {
     return pushed;
 }
 
-int BFPushDepsUp::recurseCounter_ = 0;
+thread_local int BFPushDepsUp::recurseCounter_ = 0;
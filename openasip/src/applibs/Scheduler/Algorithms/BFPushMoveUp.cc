@@ -47,7 +47,7 @@ bool
 BFPushMoveUp::operator()() {
 
 #ifdef DEBUG_BUBBLEFISH_SCHEDULER
-    static int dotCount = 0;
+    static thread_local int dotCount = 0;
 #endif
     bool isTrigger = mn_.isDestinationOperation() &&
         mn_.move().destination().isTriggering();
@@ -154,4 +154,4 @@ BFUnscheduleMove::operator()() {
     return true;
 }
 
-int BFUnscheduleMove::recurseCounter_ = 0;
+thread_local int BFUnscheduleMove::recurseCounter_ = 0;
@@ -438,7 +438,7 @@ BUBasicBlockScheduler::handleLoopDDG(
 }
 
 #ifdef DEBUG_REG_COPY_ADDER
-static int graphCount = 0;
+static thread_local int graphCount = 0;
 #endif
 
 /**
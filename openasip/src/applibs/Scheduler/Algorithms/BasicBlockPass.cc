@@ -107,7 +107,7 @@ BasicBlockPass::executeDDGPass(
     DataDependenceGraph* ddg = createDDGFromBB(bb, targetMachine);
 
     // Used for live info dumping.
-    static int bbNumber = 0;
+    static thread_local int bbNumber = 0;
 
 #ifdef DDG_SNAPSHOTS
     std::string name = "scheduling";
@@ -174,7 +174,7 @@ BasicBlockPass::ddgSnapshot(
     std::string& name,
     DataDependenceGraph::DumpFileFormat format,
     bool final) {
-    static int bbCounter = 0;
+    static thread_local int bbCounter = 0;
 
     if (final) {
 	if (format == DataDependenceGraph::DUMP_DOT) {
@@ -381,7 +381,7 @@ BasicBlockScheduler::handleLoopDDG(
 }
 
 #ifdef DEBUG_REG_COPY_ADDER
-static int graphCount = 0;
+static thread_local int graphCount = 0;
 #endif
 
 /**
@@ -1633,7 +1633,7 @@ BasicBlockScheduler::ddgSnapshot(
         bool final,
         bool resetCounter) const {
 
-    static int bbCounter = 0;
+    static thread_local int bbCounter = 0;
 
     if (resetCounter) {
         bbCounter = 0;
@@ -68,6 +68,8 @@
 #include "CodeGenerator.hh"
 #include "TerminalFUPort.hh"
 #include "Operation.hh"
+#include "PhaseTimes.hh"
+#include "ExecutionProfile.hh"
 
 //using std::set;
 using std::list;
@@ -87,6 +89,7 @@ IGNORE_COMPILER_WARNING("-Wstrict-overflow")
 bool
 CopyingDelaySlotFiller::fillDelaySlots(
     BasicBlockNode& jumpingBB, int delaySlots, bool fillFallThru) {
+    PhaseTimes::Scope phaseScope("delay_slot_filler");
     if (cfg_->hasMultipleUnconditionalSuccessors(jumpingBB)) {
         bbnStatus_[&jumpingBB] = BBN_BOTH_FILLED;
         return false;
@@ -100,6 +103,19 @@ CopyingDelaySlotFiller::fillDelaySlots(
 
     bool cfgChanged = false;
 
+    // the jump is usually not taken, fill the slots from the fall-thru
+    // successor first and let the jump target fill what is left. the
+    // fall-thru can only be filled after all jumps into it, otherwise
+    // fill in the usual order.
+    if (!fillFallThru && bbnStatus_[&jumpingBB] == BBN_SCHEDULED &&
+        isFallThruLikely(jumpingBB)) {
+        BasicBlockNode* ftNode = cfg_->fallThruSuccessor(jumpingBB);
+        if (bbnStatus_[ftNode] > BBN_UNKNOWN &&
+            areAllJumpPredsFilled(*ftNode)) {
+            cfgChanged |= fillDelaySlots(jumpingBB, delaySlots, true);
+        }
+    }
+
     if (fillFallThru) {
         switch (bbnStatus_[&jumpingBB]) {
         case BBN_SCHEDULED:
@@ -391,7 +407,7 @@ bool CopyingDelaySlotFiller::updateFTBBAndCfg(
 /**
  * Constructor.
  */
-CopyingDelaySlotFiller::CopyingDelaySlotFiller() {
+CopyingDelaySlotFiller::CopyingDelaySlotFiller() : profile_(NULL) {
 }
 
 /**
@@ -405,6 +421,7 @@ void
 CopyingDelaySlotFiller::fillDelaySlots(
     ControlFlowGraph& cfg, DataDependenceGraph& ddg,
     const TTAMachine::Machine& machine) {
+    PhaseTimes::Scope phaseScope("delay_slot_filler");
     um_ = &UniversalMachine::instance();
     int delaySlots = machine.controlUnit()->delaySlots();
 
@@ -454,6 +471,44 @@ CopyingDelaySlotFiller::fillDelaySlots(
     tempResultNodes_.clear();
 }
 
+/**
+ * Sets the execution profile used to predict which successor of a
+ * conditional jump is the likely one.
+ *
+ * @param profile The profile, NULL to fill from the jump target first.
+ * Not owned.
+ */
+void
+CopyingDelaySlotFiller::setExecutionProfile(const ExecutionProfile* profile) {
+    profile_ = profile;
+}
+
+/**
+ * Tells whether the execution profile predicts that the conditional jump
+ * at the end of the given basic block is not taken.
+ *
+ * @param jumpingBB The basic block ending with a conditional jump.
+ * @return True if the fall-thru successor executes more often than the
+ * jump target.
+ */
+bool
+CopyingDelaySlotFiller::isFallThruLikely(
+    BasicBlockNode& jumpingBB) const {
+
+    if (profile_ == NULL) {
+        return false;
+    }
+    BasicBlockNode* ftNode = cfg_->fallThruSuccessor(jumpingBB);
+    BasicBlockNode* jumpNode = cfg_->jumpSuccessor(jumpingBB);
+    if (ftNode == NULL || jumpNode == NULL ||
+        !ftNode->isNormalBB() || !jumpNode->isNormalBB()) {
+        return false;
+    }
+    std::string procName = cfg_->procedureName();
+    return profile_->basicBlockCount(ftNode->basicBlock(), procName) >
+        profile_->basicBlockCount(jumpNode->basicBlock(), procName);
+}
+
 /**
  * Deletes all removed basic blocks. Can be called after bigddg is deleted.
  */
@@ -1937,6 +1992,7 @@ void
 CopyingDelaySlotFiller::initialize(
     ControlFlowGraph& cfg, DataDependenceGraph& ddg,
     const TTAMachine::Machine& machine) {
+    PhaseTimes::Scope phaseScope("delay_slot_filler");
     cfg_ = &cfg;
     ddg_ = &ddg;
     um_ = &UniversalMachine::instance();
@@ -50,6 +50,7 @@ class ResourceManager;
 class UniversalMachine;
 class InterPassData;
 class MoveNode;
+class ExecutionProfile;
 
 namespace TTAMachine {
     class Machine;
@@ -84,6 +85,7 @@ public:
 
     void bbnScheduled(BasicBlockNode& bbn);
     void finalizeProcedure();
+    void setExecutionProfile(const ExecutionProfile* profile);
 
     static std::pair<int, TTAProgram::Move*> findJump(
         TTAProgram::BasicBlock& bb,
@@ -180,6 +182,8 @@ private:
 
     bool allowedToSpeculate(MoveNode& mn) const;
 
+    bool isFallThruLikely(BasicBlockNode& jumpingBB) const;
+
     void finishBB(BasicBlockNode& bbn, bool force = false);
 
     DataDependenceGraph* ddg_;
@@ -217,6 +221,9 @@ private:
     int delaySlots_;
 
     ControlFlowGraph::NodeSet killedBBs_;
+
+    /// Execution profile used to predict the branches, NULL if none.
+    const ExecutionProfile* profile_;
 };
 
 #endif
@@ -62,6 +62,7 @@
 #include "SimpleResourceManager.hh"
 #include "Operation.hh"
 #include "Move.hh"
+#include "PhaseTimes.hh"
 
 //#define DEBUG_REG_COPY_ADDER
 
@@ -140,6 +141,7 @@ RegisterCopyAdder::addMinimumRegisterCopies(
     ProgramOperation& programOperation,
     const TTAMachine::Machine& targetMachine,
     DataDependenceGraph* ddg) {
+    PhaseTimes::Scope phaseScope("register_copy_adder");
 
 #ifdef DEBUG_REG_COPY_ADDER
     Application::logStream() 
@@ -212,6 +214,7 @@ RegisterCopyAdder::AddedRegisterCopies
 RegisterCopyAdder::addRegisterCopiesToRRMove(    
     MoveNode& moveNode,
     DataDependenceGraph* ddg) {
+    PhaseTimes::Scope phaseScope("register_copy_adder");
 
     AddedRegisterCopies copies;
     int registerCopyCount = 0;
@@ -260,6 +263,7 @@ RegisterCopyAdder::addRegisterCopies(
     bool countOnly,
     DataDependenceGraph* ddg,
     int neededCopies) {
+    PhaseTimes::Scope phaseScope("register_copy_adder");
     
     AddedRegisterCopies copies;
     int registerCopyCount = 0;
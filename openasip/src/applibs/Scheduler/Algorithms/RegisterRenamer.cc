@@ -87,14 +87,18 @@ void
 RegisterRenamer::initialize() {
     auto regNav = machine_.registerFileNavigator();
 
+    {
+        boost::lock_guard<boost::mutex> lock(tempRegFileCacheMutex_);
         auto trCacheIter = tempRegFileCache_.find(&machine_);
 
-    if (trCacheIter == tempRegFileCache_.end()) {
-        tempRegFiles_ = MachineConnectivityCheck::tempRegisterFiles(machine_);
-        tempRegFileCache_[&machine_] = 
-            tempRegFiles_;
-    } else {
-        tempRegFiles_ = trCacheIter->second;
+        if (trCacheIter == tempRegFileCache_.end()) {
+            tempRegFiles_ =
+                MachineConnectivityCheck::tempRegisterFiles(machine_);
+            tempRegFileCache_[&machine_] =
+                tempRegFiles_;
+        } else {
+            tempRegFiles_ = trCacheIter->second;
+        }
     }
 
     for (int i = 0; i < regNav.count(); i++) {
@@ -1350,3 +1354,5 @@ std::map<const TTAMachine::Machine*,
          std::set <const TTAMachine::RegisterFile*,
                    TTAMachine::MachinePart::Comparator> >
 RegisterRenamer::tempRegFileCache_;
+
+boost::mutex RegisterRenamer::tempRegFileCacheMutex_;
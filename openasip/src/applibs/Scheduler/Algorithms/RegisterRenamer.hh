@@ -37,6 +37,8 @@
 
 #include "TCEString.hh"
 #include <set>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
 #include "MachinePart.hh"
 #include "DataDependenceGraph.hh"
 
@@ -155,6 +157,8 @@ private:
                     std::set <const TTAMachine::RegisterFile*,
                               TTAMachine::MachinePart::Comparator> >
     tempRegFileCache_;
+    /// Guards tempRegFileCache_ for schedulers in parallel threads.
+    static boost::mutex tempRegFileCacheMutex_;
     std::set <const TTAMachine::RegisterFile*,
               TTAMachine::MachinePart::Comparator> tempRegFiles_;
 
@@ -146,7 +146,7 @@ SequentialScheduler::handleBasicBlock(
 }
 
 #ifdef DEBUG_REG_COPY_ADDER
-static int graphCount = 0;
+static thread_local int graphCount = 0;
 #endif
 
 /**
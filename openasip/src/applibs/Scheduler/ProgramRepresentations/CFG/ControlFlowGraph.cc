@@ -102,6 +102,7 @@ POP_CLANG_DIAGS
 #include "HWOperation.hh"
 #include "FUPort.hh"
 #include "LiveRangeData.hh"
+#include "ExecutionProfile.hh"
 
 using TTAProgram::Program;
 using TTAProgram::Procedure;
@@ -365,6 +366,7 @@ ControlFlowGraph::computeLeadersFromRefManager(
     leaders[startAddress_.location()] = &procedure.firstInstruction();
 
     // this can get slow if there are zillion instructionreferences?
+    boost::unique_lock<boost::recursive_mutex> guard = refManager.lock();
     for (InstructionReferenceManager::Iterator i = refManager.begin();
          i != refManager.end(); ++i) {
         Instruction& instruction = i->instruction();
@@ -2514,14 +2516,44 @@ ControlFlowGraph::findUnreachableNodes(
     return unreachableNodes;
 }
 
+/**
+ * Orders control flow edges by the execution count of their head nodes,
+ * the most executed first.
+ */
+class HotterHeadNodeFirst {
+public:
+    HotterHeadNodeFirst(
+        const ControlFlowGraph& cfg, const ExecutionProfile& profile) :
+        cfg_(cfg), profile_(profile), procName_(cfg.procedureName()) {}
+
+    bool operator()(ControlFlowEdge* e1, ControlFlowEdge* e2) const {
+        return count(*e1) > count(*e2);
+    }
+private:
+    CycleCount count(const ControlFlowEdge& e) const {
+        const BasicBlockNode& head = cfg_.headNode(e);
+        if (!head.isNormalBB()) {
+            return 0;
+        }
+        return profile_.basicBlockCount(head.basicBlock(), procName_);
+    }
+
+    const ControlFlowGraph& cfg_;
+    const ExecutionProfile& profile_;
+    const std::string procName_;
+};
+
 /** 
  * The algorithm is same as in CopyToProcedure, but without the copying.
  * Still removes jump, and also does BB mergeing.
+ *
+ * If an execution profile is given, the most often executed jump target
+ * is preferred as the layout successor of a basic block.
  */
 void 
 ControlFlowGraph::optimizeBBOrdering(
     bool removeDeadCode, InstructionReferenceManager& irm,
-    DataDependenceGraph* ddg) {
+    DataDependenceGraph* ddg, const ExecutionProfile* profile) {
 
 #ifdef DEBUG_BB_OPTIMIZER
     writeToDotFile(
@@ -2613,8 +2645,16 @@ ControlFlowGraph::optimizeBBOrdering(
 
         // Select some node, preferably successors without ft-preds
         // The jump can then be removed.
-        EdgeSet oEdges = outEdges(*currentBBN);
-        for (EdgeSet::iterator i = oEdges.begin(); i != oEdges.end(); i++) {
+        EdgeSet outEdgeSet = outEdges(*currentBBN);
+        std::vector<ControlFlowEdge*> oEdges(
+            outEdgeSet.begin(), outEdgeSet.end());
+        if (profile != NULL) {
+            std::stable_sort(
+                oEdges.begin(), oEdges.end(),
+                HotterHeadNodeFirst(*this, *profile));
+        }
+        for (std::vector<ControlFlowEdge*>::iterator i = oEdges.begin();
+             i != oEdges.end(); i++) {
             ControlFlowEdge& e = **i;
             BasicBlockNode& head = headNode(e);
             if (!hasFallThruPredecessor(head) && head.isNormalBB() &&
@@ -90,6 +90,7 @@ using boost::reverse_graph;
 class InterPassData;
 class DataDependenceGraph;
 class CFGStatistics;
+class ExecutionProfile;
 
 /**
  * Control Flow Graph.
@@ -155,7 +156,8 @@ public:
     void optimizeBBOrdering(
         bool removeDeadCode, 
         TTAProgram::InstructionReferenceManager& irm,
-        DataDependenceGraph* ddg);
+        DataDependenceGraph* ddg,
+        const ExecutionProfile* profile = NULL);
     llvm::MachineBasicBlock& getMBB(
         llvm::MachineFunction& mf,
         const TTAProgram::BasicBlock& bb) const;
@@ -89,6 +89,7 @@ IGNORE_COMPILER_WARNING("-Wunused-parameter")
 #include "SchedulerCmdLineOptions.hh"
 
 #include "MachineInfo.hh"
+#include "PhaseTimes.hh"
 
 using namespace TTAProgram;
 using namespace TTAMachine;
@@ -461,6 +462,7 @@ DataDependenceGraphBuilder::build(
     const UniversalMachine* um, 
     bool createMemAndFUDeps,
     llvm::AliasAnalysis* AA) {
+    PhaseTimes::Scope phaseScope("ddg_build");
 
     mach_ = &mach;
     if (AA) {
@@ -2124,6 +2126,7 @@ DataDependenceGraphBuilder::build(
     const UniversalMachine* um, 
     bool createMemAndFUDeps, bool createDeathInformation,
     llvm::AliasAnalysis* AA) {
+    PhaseTimes::Scope phaseScope("ddg_build");
 
     mach_ = &mach;
     if (AA) {
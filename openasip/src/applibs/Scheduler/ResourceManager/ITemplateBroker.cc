@@ -36,6 +36,8 @@ IGNORE_CLANG_WARNING("-Wunused-local-typedef")
 #include <boost/lexical_cast.hpp>
 POP_CLANG_DIAGS
 
+#include <algorithm>
+
 #include "ITemplateBroker.hh"
 #include "ITemplateResource.hh"
 #include "Machine.hh"
@@ -894,10 +896,54 @@ ITemplateBroker::findITemplates(
             result.insert(*(*resIter).second);
         }
     }
-    result.sort();
+    sortTemplates(result, rm_ != NULL && rm_->isHotCode());
     return result;
 }
 
+/**
+ * Orders the candidate templates in the order they are tried.
+ *
+ * Cold code tries the templates in the order of SchedulingResource
+ * comparison: least used first, then by name. Hot code tries first the
+ * templates that use the fewest move slots for long immediates, because
+ * a move slot taken by an immediate is more likely to lengthen the
+ * schedule there. The slot count takes precedence, and the templates
+ * with the same slot count are in the cold code order.
+ *
+ * @param templates The template resources to order.
+ * @param hotCode True if the templates are chosen for hot code.
+ */
+void
+ITemplateBroker::sortTemplates(
+    SchedulingResourceSet& templates, bool hotCode) {
+
+    if (!hotCode) {
+        templates.sort();
+        return;
+    }
+    std::vector<std::pair<int, SchedulingResource*> > ordered;
+    for (int i = 0; i < templates.count(); i++) {
+        SchedulingResource& res = templates.resource(i);
+        // bus resources (slots) are in dependent group 0
+        int slots = res.dependentResourceGroupCount() > 0 ?
+            res.dependentResourceCount(0) : 0;
+        ordered.push_back(std::make_pair(slots, &res));
+    }
+    std::sort(
+        ordered.begin(), ordered.end(),
+        [](const std::pair<int, SchedulingResource*>& a,
+           const std::pair<int, SchedulingResource*>& b) {
+            if (a.first != b.first) {
+                return a.first < b.first;
+            }
+            return *a.second < *b.second;
+        });
+    templates.clear();
+    for (unsigned int i = 0; i < ordered.size(); i++) {
+        templates.insert(*ordered[i].second);
+    }
+}
+
 /**
  * Transfer the instruction ownership away from this object,
  *
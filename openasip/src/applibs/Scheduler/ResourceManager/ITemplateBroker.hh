@@ -119,6 +119,9 @@ public:
         int, std::shared_ptr<TTAProgram::Immediate>) const;
     void clearOldResources();
     void clear() override;
+
+    static void sortTemplates(
+        SchedulingResourceSet& templates, bool hotCode);
 private:
     typedef std::vector<std::shared_ptr<const TTAProgram::Move> > Moves;
     typedef std::vector<std::shared_ptr<const TTAProgram::Immediate> > Immediates;
@@ -58,7 +58,7 @@ using namespace TTAProgram;
 SimpleResourceManager::SimpleResourceManager(
     const TTAMachine::Machine& machine, unsigned int ii):
     ResourceManager(machine), director_(NULL),  initiationInterval_(ii),
-    maxCycle_(INT_MAX-1) {
+    maxCycle_(INT_MAX-1), hotCode_(false) {
 
     buildResourceModel(machine);
 }
@@ -72,10 +72,12 @@ SimpleResourceManager::SimpleResourceManager(
 SimpleResourceManager* 
 SimpleResourceManager::createRM(
     const TTAMachine::Machine& machine, unsigned int ii) {
+    boost::unique_lock<boost::mutex> lock(rmPoolMutex_);
     std::map<int, std::list< SimpleResourceManager*> >& pool =
         rmPool_[&machine];
     std::list<SimpleResourceManager*>& iipool = pool[ii];
     if (iipool.empty()) {
+        lock.unlock();
         return new SimpleResourceManager(machine,ii);
     } else {
         SimpleResourceManager* rm = iipool.back();
@@ -93,10 +95,11 @@ void SimpleResourceManager::disposeRM(
     SimpleResourceManager* rm, bool allowReuse) {
     if (rm == NULL) return;
     if (allowReuse) {
+        rm->clear();
+        boost::lock_guard<boost::mutex> lock(rmPoolMutex_);
         std::map<int, std::list< SimpleResourceManager*> >& pool =
             rmPool_[&rm->machine()];
         pool[rm->initiationInterval()].push_back(rm);
-        rm->clear();
     } else {
         delete rm;
         ExecutionPipelineResourceTable::finalize();
@@ -623,6 +626,7 @@ void SimpleResourceManager::clear() {
     setDDG(NULL);
     setCFG(NULL);
     setBBN(NULL);
+    setHotCode(false);
 }
 
 void
@@ -644,8 +648,23 @@ std::map<const TTAMachine::Machine*,
          std::map<int, std::list< SimpleResourceManager*> > >
 SimpleResourceManager::rmPool_;
 
+boost::mutex SimpleResourceManager::rmPoolMutex_;
+
 void SimpleResourceManager::setMaxCycle(unsigned int maxCycle) {
     director_->setMaxCycle(maxCycle);
     maxCycle_ = maxCycle;
 }
 
+/**
+ * Tells whether the code scheduled with this RM is hot.
+ *
+ * In hot code the instruction templates that leave the most move slots
+ * free are preferred.
+ *
+ * @param hot True if the code is hot according to the execution profile.
+ */
+void
+SimpleResourceManager::setHotCode(bool hot) {
+    hotCode_ = hot;
+}
+
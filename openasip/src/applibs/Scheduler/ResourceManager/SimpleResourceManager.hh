@@ -37,6 +37,8 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
 
 #include "ResourceManager.hh"
 #include "AssignmentPlan.hh"
@@ -140,6 +142,8 @@ public:
 
     void setMaxCycle(unsigned int maxCycle);
     int maxCycle() { return maxCycle_; }
+    void setHotCode(bool hot);
+    bool isHotCode() const { return hotCode_; }
     unsigned int instructionIndex(unsigned int) const;
 private:
     SimpleResourceManager(
@@ -161,12 +165,17 @@ private:
 
     unsigned int initiationInterval_;
     unsigned int maxCycle_;
+    /// True if the scheduled code is hot according to the execution
+    /// profile.
+    bool hotCode_;
 
     unsigned int resources;
     
     static std::map<const TTAMachine::Machine*, 
                     std::map<int, std::list< SimpleResourceManager*> > >
     rmPool_;
+    /// Guards rmPool_ for schedulers running in parallel threads.
+    static boost::mutex rmPoolMutex_;
 };
 
 #endif
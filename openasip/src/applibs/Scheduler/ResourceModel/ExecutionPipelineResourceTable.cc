@@ -163,7 +163,8 @@ ExecutionPipelineResourceTable::setLatency(
 const ExecutionPipelineResourceTable& 
 ExecutionPipelineResourceTable::resourceTable(
     const TTAMachine::FunctionUnit& fu) {
-    
+    boost::lock_guard<boost::mutex> lock(tablesMutex_);
+
     ResourceTableMap::iterator i = allResourceTables_.find(&fu);
 
     if (i != allResourceTables_.end()) {
@@ -183,8 +184,11 @@ ExecutionPipelineResourceTable::resourceTable(
  */
 void
 ExecutionPipelineResourceTable::finalize() {
+    boost::lock_guard<boost::mutex> lock(tablesMutex_);
     MapTools::deleteAllValues(allResourceTables_);
 }
 
 ExecutionPipelineResourceTable::ResourceTableMap 
 ExecutionPipelineResourceTable::allResourceTables_;
+
+boost::mutex ExecutionPipelineResourceTable::tablesMutex_;
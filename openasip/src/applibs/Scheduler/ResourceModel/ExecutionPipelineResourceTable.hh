@@ -35,6 +35,8 @@
 
 #include <string>
 #include <map>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
 #include <vector>
 
 namespace TTAMachine {
@@ -98,6 +100,8 @@ private:
 
     /// Contains these tables for all FU's
     static ResourceTableMap allResourceTables_;
+    /// Guards allResourceTables_ for schedulers in parallel threads.
+    static boost::mutex tablesMutex_;
 };
 
 #include "ExecutionPipelineResourceTable.icc"
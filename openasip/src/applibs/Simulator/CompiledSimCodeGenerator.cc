@@ -944,6 +944,10 @@ CompiledSimCodeGenerator::handleOperation(const TTAMachine::HWOperation& op) {
     ss << endl << "/* Operation: " << op.name() << ", latency: "
        << op.latency() << " */" << endl;
     
+    // Operations that have trigger semantics (a DAG) in OSAL are expanded
+    // inline by OperationDAGConverter, which writes the basic arithmetic
+    // and logic nodes as C operators. This also covers the base operations
+    // whose DAG refers to the operation itself. Others call the behavior.
     if (operationPool_.operation(op.name().c_str()).dagCount() <= 0) {
         ss << handleOperationWithoutDag(op);
     } else {
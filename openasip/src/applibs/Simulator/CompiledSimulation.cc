@@ -138,8 +138,13 @@ void
 CompiledSimulation::cycleEnd() {
     lastExecutedInstruction_ = programCounter_;
     programCounter_++;
-    pimpl_->frontend_->eventHandler().handleEvent(
-        SimulationEventHandler::SE_CYCLE_END);
+    SimulationEventHandler& eventHandler = pimpl_->frontend_->eventHandler();
+    if (eventHandler.hasBatchListeners()) {
+        pimpl_->executedInstruction_[0] = lastExecutedInstruction_;
+        eventHandler.handleInstructionBatch(
+            cycleCount_, pimpl_->executedInstruction_);
+    }
+    eventHandler.handleEvent(SimulationEventHandler::SE_CYCLE_END);
 }
 
 /**
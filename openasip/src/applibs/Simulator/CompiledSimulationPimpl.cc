@@ -42,7 +42,7 @@
  * 
  */
 CompiledSimulationPimpl::CompiledSimulationPimpl() : 
-    pluginTools_(true, false) {
+    executedInstruction_(1, 0), pluginTools_(true, false) {
 }
 
 /**
@@ -77,6 +77,8 @@ private:
     
     /// Program exit points in a set
     std::set<InstructionAddress> exitPoints_;
+    /// The one-instruction batch passed to the batch listeners each cycle
+    std::vector<InstructionAddress> executedInstruction_;
     
     /// The Compiled Simulation compiler
     CompiledSimCompiler compiler_;
@@ -35,12 +35,17 @@
 #include "ExecutableMove.hh"
 #include "LongImmUpdateAction.hh"
 #include "SequenceTools.hh"
+#include "RegisterState.hh"
+#include "InputPortState.hh"
+#include "OutputPortState.hh"
+
+#include <typeinfo>
 
 /**
  * Constructor.
  */
 ExecutableInstruction::ExecutableInstruction() :
-    exitPoint_(false) {
+    exitPoint_(false), predecoded_(false) {
     resetExecutionCounts();
 }
 
@@ -63,6 +68,7 @@ ExecutableInstruction::~ExecutableInstruction() {
 void
 ExecutableInstruction::addExecutableMove(ExecutableMove* move) {
     moves_.push_back(move);
+    predecoded_ = false;
 }
 
 /**
@@ -110,3 +116,59 @@ ClockCycleCount
 ExecutableInstruction::moveExecutionCount(std::size_t moveIndex) const {
     return moves_[moveIndex]->executionCount();
 }
+
+/**
+ * Predecodes the moves of the instruction for executeFast().
+ *
+ * Moves of the plain ExecutableMove type are specialized by their
+ * source, destination and guard. Register and FU result port sources are
+ * read directly from their storage, and plain register and operand port
+ * destinations are written without the virtual call. Moves of other
+ * types are executed through their own interface.
+ */
+void
+ExecutableInstruction::predecode() {
+
+    fastMoves_.clear();
+    fastMoves_.reserve(moves_.size());
+    for (std::size_t i = 0; i < moves_.size(); ++i) {
+        ExecutableMove* move = moves_[i];
+
+        FastMove fastMove;
+        fastMove.kind = FM_GENERIC;
+        fastMove.move = move;
+        fastMove.srcValue = NULL;
+        fastMove.dstRegister = NULL;
+
+        if (typeid(*move) != typeid(ExecutableMove)) {
+            fastMoves_.push_back(fastMove);
+            continue;
+        }
+        if (move->guarded_) {
+            fastMove.kind = FM_GUARDED;
+            fastMoves_.push_back(fastMove);
+            continue;
+        }
+
+        const std::type_info& srcType = typeid(*move->src_);
+        if (srcType == typeid(RegisterState) ||
+            srcType == typeid(OutputPortState)) {
+            fastMove.srcValue = &move->src_->value();
+        }
+        const std::type_info& dstType = typeid(*move->dst_);
+        if (dstType == typeid(RegisterState) ||
+            dstType == typeid(InputPortState)) {
+            fastMove.dstRegister = dynamic_cast<RegisterState*>(move->dst_);
+        }
+
+        if (fastMove.srcValue == NULL) {
+            fastMove.kind = FM_STATE_TO_STATE;
+        } else if (fastMove.dstRegister == NULL) {
+            fastMove.kind = FM_VALUE_TO_STATE;
+        } else {
+            fastMove.kind = FM_VALUE_TO_REGISTER;
+        }
+        fastMoves_.push_back(fastMove);
+    }
+    predecoded_ = true;
+}
@@ -39,6 +39,8 @@
 
 class ExecutableMove;
 class LongImmUpdateAction;
+class RegisterState;
+class SimValue;
 
 /**
  * Represents an interpreted TTA instruction.
@@ -55,6 +57,7 @@ public:
     void addLongImmediateUpdateAction(LongImmUpdateAction* action);
 
     void execute();
+    void executeFast();
 
     ClockCycleCount executionCount() const;
     ClockCycleCount moveExecutionCount(std::size_t moveIndex) const;
@@ -70,6 +73,30 @@ private:
     ExecutableInstruction(const ExecutableInstruction&);
     /// Assignment not allowed.
     ExecutableInstruction& operator=(const ExecutableInstruction&);
+
+    /// Specialized kinds of moves executed by executeFast().
+    enum FastMoveKind {
+        FM_VALUE_TO_REGISTER, ///< Stable source value to a plain register.
+        FM_VALUE_TO_STATE,    ///< Stable source value to any destination.
+        FM_STATE_TO_STATE,    ///< Unguarded move between any states.
+        FM_GUARDED,           ///< Guard evaluation fused with the move.
+        FM_GENERIC            ///< Move with customized execution.
+    };
+
+    /// A move predecoded for executeFast().
+    struct FastMove {
+        /// The specialized kind of the move.
+        FastMoveKind kind;
+        /// The decoded move.
+        ExecutableMove* move;
+        /// The source value, if it stays at a fixed address.
+        const SimValue* srcValue;
+        /// The destination, if it is a plain register without side effects.
+        RegisterState* dstRegister;
+    };
+
+    void predecode();
+
     /// Contains ExecutableMoves.
     typedef std::vector<ExecutableMove*> MoveContainer;
     /// Contains long immediate update actions.
@@ -82,6 +109,10 @@ private:
     ClockCycleCount executionCount_;
     /// True in case the instruction is considered a program exit point.
     bool exitPoint_;
+    /// The moves predecoded for executeFast().
+    std::vector<FastMove> fastMoves_;
+    /// True after the moves have been predecoded.
+    bool predecoded_;
 };
 
 #include "ExecutableInstruction.icc"
@@ -86,6 +86,10 @@ public:
     void resetExecutionCount();
 
 protected:
+    /// The fast interpreter of the instruction accesses the resolved
+    /// move directly.
+    friend class ExecutableInstruction;
+
     ExecutableMove();
     
     /// Source of the move.
@@ -49,17 +49,15 @@
 ExecutionTracker::ExecutionTracker(
     TTASimulationController& subject,
     ExecutionTrace& traceDB) :
-    Listener(), subject_(subject), traceDB_(traceDB) {
-    subject.frontend().eventHandler().registerListener(
-        SimulationEventHandler::SE_CYCLE_END, this);
+    subject_(subject), traceDB_(traceDB) {
+    subject.frontend().eventHandler().registerBatchListener(this);
 }
 
 /**
  * Destructor.
  */
 ExecutionTracker::~ExecutionTracker() {
-    subject_.frontend().eventHandler().unregisterListener(
-        SimulationEventHandler::SE_CYCLE_END, this);
+    subject_.frontend().eventHandler().unregisterBatchListener(this);
 }
 
 /**
@@ -67,13 +65,19 @@ ExecutionTracker::~ExecutionTracker() {
  *
  * If any error happens while writing the data, aborts program with
  * an error message.
+ *
+ * @param firstCycle The cycle of the first executed instruction.
+ * @param executedInstructions The instruction address per cycle.
  */
 void 
-ExecutionTracker::handleEvent() {
+ExecutionTracker::handleInstructionBatch(
+    ClockCycleCount firstCycle,
+    const std::vector<InstructionAddress>& executedInstructions) {
     try {
-        traceDB_.addInstructionExecution(
-            subject_.clockCount(), 
-            subject_.lastExecutedInstruction());
+        for (std::size_t i = 0; i < executedInstructions.size(); ++i) {
+            traceDB_.addInstructionExecution(
+                firstCycle + i, executedInstructions[i]);
+        }
     } catch (const Exception& e) {
         debugLog("Error while writing TraceDB: " + e.errorMessage());
     }
@@ -33,7 +33,9 @@
 #ifndef TTA_EXECUTION_TRACKER_HH
 #define TTA_EXECUTION_TRACKER_HH
 
-#include "Listener.hh"
+#include <vector>
+
+#include "SimulationEventHandler.hh"
 
 class TTASimulationController;
 class ExecutionTrace;
@@ -41,16 +43,19 @@ class ExecutionTrace;
 /**
  * Tracks the simulation execution.
  *
- * Stores execution data in execution trace.
+ * Stores execution data in execution trace. Receives the executed
+ * instructions in batches so it does not slow down the simulation loop.
  */
-class ExecutionTracker : public Listener {
+class ExecutionTracker : public SimulationBatchListener {
 public:
     ExecutionTracker(
         TTASimulationController& subject, 
         ExecutionTrace& traceDB);
     virtual ~ExecutionTracker();
 
-    virtual void handleEvent();
+    virtual void handleInstructionBatch(
+        ClockCycleCount firstCycle,
+        const std::vector<InstructionAddress>& executedInstructions);
     
 private:
     /// the tracked SimulationController instance
@@ -763,6 +763,12 @@ public:
                 (boost::format("%.0f") %
                  parent().simulatorFrontend().cycleCount()).str());
             return true;
+        } else if (command == "stalls") {
+            parent().interpreter()->setResult(
+                (boost::format("%.0f") %
+                 parent().simulatorFrontend().decompressorStallCycles()).
+                str());
+            return true;
         } else if (command == "stats") {
             std::stringstream result;
 
@@ -1230,6 +1236,81 @@ public:
 };
 
 
+/**
+ * Implementation of "info perf".
+ */
+class InfoPerfCommand : public SimControlLanguageSubCommand {
+public:
+    /**
+     * Constructor.
+     */
+    InfoPerfCommand(SimControlLanguageCommand& parentCommand) :
+        SimControlLanguageSubCommand(parentCommand) {
+    }
+
+    /**
+     * Destructor.
+     */
+    virtual ~InfoPerfCommand() {
+    }
+
+    /**
+     * Executes the "info perf" command.
+     *
+     * Without arguments prints all the performance counters of the
+     * simulator, with a counter name returns the value of the counter.
+     *
+     * @param arguments Arguments to the command, including the command.
+     * @return true in case execution was successful.
+     */
+    virtual bool execute(const std::vector<DataObject>& arguments) {
+        const int argumentCount = arguments.size() - 2;
+
+        if (!parent().checkArgumentCount(argumentCount, 0, 1)) {
+            return false;
+        }
+
+        const SimulatorFrontend& simFront = parent().simulatorFrontend();
+
+        if (argumentCount == 0) {
+            std::stringstream result;
+            simFront.writePerformanceCounters(result);
+            parent().interpreter()->setResult(result.str());
+            return true;
+        }
+
+        const std::string counter =
+            StringTools::stringToLower(arguments[2].stringValue());
+
+        double value = 0.0;
+        if (counter == "cycles_per_second") {
+            value = simFront.simulatedCyclesPerSecond();
+        } else if (counter == "host_instructions_per_cycle") {
+            value = simFront.hostInstructionsPerCycle();
+        } else if (counter == "simulated_cycles") {
+            value = static_cast<double>(simFront.totalRunCycleCount());
+        } else if (counter == "run_seconds") {
+            value = simFront.totalRunTime();
+        } else if (counter == "initialization_seconds") {
+            value = simFront.initializationTime();
+        } else if (counter == "machine_load_seconds") {
+            value = simFront.machineLoadTime();
+        } else if (counter == "program_load_seconds") {
+            value = simFront.programLoadTime();
+        } else if (counter == "peak_rss_kb") {
+            value = static_cast<double>(simFront.peakMemoryUsage());
+        } else {
+            parent().interpreter()->setError(
+                SimulatorToolbox::textGenerator().text(
+                    Texts::TXT_UNKNOWN_SUBCOMMAND).str());
+            return false;
+        }
+        parent().interpreter()->setResult(value);
+        return true;
+    }
+};
+
+
 /**
  * Implementation of "info program".
  */
@@ -1423,6 +1504,7 @@ InfoCommand::InfoCommand(bool isCompiledSimulation) :
     }
     
     subCommands_["stats"] = new InfoStatsCommand(*this);
+    subCommands_["perf"] = new InfoPerfCommand(*this);
     subCommands_["registers"] = new InfoRegistersCommand(*this);
     subCommands_["proc"] = new InfoProcCommand(*this);
     subCommands_["program"] = new InfoProgramCommand(*this);
@@ -0,0 +1,110 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+/**
+ * @file InstructionLookupTable.cc
+ *
+ * Definition of InstructionLookupTable class.
+ *
+ * @note rating: red
+ */
+
+#include "InstructionLookupTable.hh"
+#include "ExecutableInstruction.hh"
+
+/**
+ * Constructor.
+ *
+ * @param memory The instruction memory to look up the instructions from.
+ * @param endAddress The first address after the addresses to store.
+ */
+InstructionLookupTable::InstructionLookupTable(
+    InstructionMemory& memory, InstructionAddress endAddress) :
+    memory_(memory), endAddress_(endAddress),
+    addressStep_(memory.addressStep()),
+    modificationCount_(memory.modificationCount()) {
+}
+
+/**
+ * Destructor.
+ */
+InstructionLookupTable::~InstructionLookupTable() {
+}
+
+/**
+ * Returns the instruction memory lookups of the given address.
+ *
+ * The addresses between the start address of the memory and the end
+ * address that are a multiple of the address step from the start are
+ * looked up only at the first call and then read from the table. Other
+ * addresses are looked up from the memory at each call.
+ *
+ * @param address The instruction address.
+ * @return The lookups. Valid until the next call.
+ */
+const InstructionLookupTable::Entry&
+InstructionLookupTable::lookup(InstructionAddress address) {
+
+    if (memory_.modificationCount() != modificationCount_) {
+        entries_.clear();
+        addressStep_ = memory_.addressStep();
+        modificationCount_ = memory_.modificationCount();
+    }
+
+    const InstructionAddress start = memory_.startAddress();
+    if (address < start || address >= endAddress_ || addressStep_ == 0 ||
+        (address - start) % addressStep_ != 0) {
+        lookupFromMemory(address, uncached_);
+        return uncached_;
+    }
+
+    const std::size_t index = (address - start) / addressStep_;
+    if (index >= entries_.size()) {
+        entries_.resize(index + 1);
+    }
+    Entry& entry = entries_[index];
+    if (!entry.looked) {
+        lookupFromMemory(address, entry);
+    }
+    return entry;
+}
+
+/**
+ * Looks up the instructions at the given address from the memory.
+ *
+ * @param address The instruction address.
+ * @param entry The entry to store the lookups to.
+ */
+void
+InstructionLookupTable::lookupFromMemory(
+    InstructionAddress address, Entry& entry) {
+
+    entry.instruction = NULL;
+    entry.implicitInstructions = NULL;
+    if (memory_.hasInstructionAt(address)) {
+        entry.instruction = &memory_.instructionAt(address);
+    }
+    if (memory_.hasImplicitInstructionsAt(address)) {
+        entry.implicitInstructions = &memory_.implicitInstructionsAt(address);
+    }
+    entry.looked = true;
+}
@@ -0,0 +1,90 @@
+/*
+    Copyright (c) 2002-2026 Tampere University.
+
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+/**
+ * @file InstructionLookupTable.hh
+ *
+ * Declaration of InstructionLookupTable class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_INSTRUCTION_LOOKUP_TABLE_HH
+#define TTA_INSTRUCTION_LOOKUP_TABLE_HH
+
+#include <vector>
+
+#include "InstructionMemory.hh"
+#include "SimulatorConstants.hh"
+
+class ExecutableInstruction;
+
+/**
+ * Memoizes the instruction memory lookups of the executed addresses.
+ *
+ * The instructionAt() and implicitInstructionsAt() results of an address
+ * are looked up from the instruction memory at the first visit and stored
+ * in a table indexed by the position of the address, so that the later
+ * visits need no hash map lookups. Nothing is decoded: the entries only
+ * point to the ExecutableInstructions owned by the memory.
+ *
+ * The table is indexed with the address step of the memory, and is
+ * flushed when the modification count of the memory changes.
+ */
+class InstructionLookupTable {
+public:
+    /// The instruction memory lookups of an address.
+    struct Entry {
+        Entry() :
+            instruction(NULL), implicitInstructions(NULL), looked(false) {}
+        /// The explicit instruction, NULL if there is none.
+        ExecutableInstruction* instruction;
+        /// The implicit instructions executed after it, NULL if none.
+        const InstructionMemory::InstructionContainer* implicitInstructions;
+        /// True in case the lookups have been done.
+        bool looked;
+    };
+
+    InstructionLookupTable(
+        InstructionMemory& memory, InstructionAddress endAddress);
+    virtual ~InstructionLookupTable();
+
+    const Entry& lookup(InstructionAddress address);
+
+private:
+    void lookupFromMemory(InstructionAddress address, Entry& entry);
+
+    /// The memory whose lookups are stored.
+    InstructionMemory& memory_;
+    /// The first address after the stored address range.
+    InstructionAddress endAddress_;
+    /// The stored lookups indexed by the position of the address.
+    std::vector<Entry> entries_;
+    /// Used for the addresses that are not stored in the table.
+    Entry uncached_;
+    /// Address step of the memory when the table was last flushed.
+    InstructionAddress addressStep_;
+    /// Modification count of the memory when the table was last flushed.
+    unsigned int modificationCount_;
+};
+
+#endif
@@ -46,7 +46,7 @@
  */
 InstructionMemory::InstructionMemory(
     InstructionAddress startAddress) : 
-    startAddress_(startAddress) {
+    startAddress_(startAddress), modificationCount_(0), addressStep_(0) {
 }
 
 /**
@@ -78,6 +78,17 @@ InstructionMemory::addExecutableInstruction(
 
     instructions_.push_back(instruction);
     instructionMap_[addr] = instruction;
+    ++modificationCount_;
+
+    // the greatest common divisor of the distances from the start address
+    if (addr > startAddress_) {
+        InstructionAddress distance = addr - startAddress_;
+        while (distance != 0) {
+            const InstructionAddress remainder = addressStep_ % distance;
+            addressStep_ = distance;
+            distance = remainder;
+        }
+    }
 }
 
 /**
@@ -95,6 +106,7 @@ InstructionMemory::addImplicitExecutableInstruction(
         implicitInstructions_[addr] = new InstructionContainer;
     }
     implicitInstructions_[addr]->push_back(instruction);
+    ++modificationCount_;
 }
 
 /**
@@ -75,6 +75,10 @@ public:
     const InstructionContainer& implicitInstructionsAt(
         InstructionAddress addr) const;
 
+    InstructionAddress startAddress() const;
+    InstructionAddress addressStep() const;
+    unsigned int modificationCount() const;
+
 private:
     /// Copying not allowed.
     InstructionMemory(const InstructionMemory&);
@@ -89,6 +93,12 @@ private:
 
     InstructionContainer emptyInstructions_;
 
+    /// Number of instructions added, used to invalidate cached lookups.
+    unsigned int modificationCount_;
+    /// Greatest common divisor of the instruction address distances from
+    /// the start address.
+    InstructionAddress addressStep_;
+
 
 #if __cplusplus < 201103L
     /// Stores the explicit instruction addresses.
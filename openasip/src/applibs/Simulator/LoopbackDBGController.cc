@@ -0,0 +1,196 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file LoopbackDBGController.cc
+ *
+ * Definition of LoopbackDBGController class.
+ *
+ * @note rating: red
+ */
+
+#include "LoopbackDBGController.hh"
+#include "SimulationController.hh"
+#include "IdealSRAM.hh"
+#include "SimValue.hh"
+#include "Machine.hh"
+#include "MapTools.hh"
+
+typedef MinimumAddressableUnit MAU;
+
+/**
+ * Constructor.
+ *
+ * @param frontend The simulator frontend.
+ * @param machine The simulated machine.
+ * @param program The simulated program.
+ */
+LoopbackDBGController::LoopbackDBGController( 
+    SimulatorFrontend& frontend,
+    const TTAMachine::Machine& machine, 
+    const TTAProgram::Program& program) : 
+    RemoteController(frontend, machine, program), 
+    engine_(new SimulationController(frontend, machine, program)) {
+}
+
+/**
+ * Destructor.
+ */
+LoopbackDBGController::~LoopbackDBGController() {
+    delete engine_;
+    engine_ = NULL;
+    MapTools::deleteAllValues(memories_);
+}
+
+/**
+ * Returns the local memory emulating the physical memory of the given
+ * address space.
+ *
+ * The memories are created lazily at their first access.
+ *
+ * @param space The address space.
+ * @return The memory model.
+ */
+Memory&
+LoopbackDBGController::targetMemory(const AddressSpace& space) {
+    MemoryMap::iterator i = memories_.find(&space);
+    if (i != memories_.end()) {
+        return *i->second;
+    }
+    Memory* memory = 
+        new IdealSRAM(
+            space.start(), space.end(), space.width(), 
+            sourceMachine_.isLittleEndian());
+    memories_[&space] = memory;
+    return *memory;
+}
+
+void
+LoopbackDBGController::writeMem(
+    Word address, MAU data, const AddressSpace& space) {
+    targetMemory(space).write(address, data);
+}
+
+MAU
+LoopbackDBGController::readMem(Word address, const AddressSpace& space) {
+    return targetMemory(space).read(address);
+}
+
+void
+LoopbackDBGController::writeMemBlock(
+    Word address, const MAU* data, ULongWord count,
+    const AddressSpace& space) {
+    targetMemory(space).writeBlock(address, data, count);
+}
+
+void
+LoopbackDBGController::readMemBlock(
+    Word address, MAU* data, ULongWord count, const AddressSpace& space) {
+    targetMemory(space).readBlock(address, data, count);
+}
+
+/**
+ * The program is executed directly from the program object model, so
+ * the instruction memory image is ignored.
+ */
+void
+LoopbackDBGController::writeIMem(const char* /*data*/, int /*size*/) {
+}
+
+void
+LoopbackDBGController::step(double count) {
+    engine_->step(count);
+}
+
+void
+LoopbackDBGController::next(int count) {
+    engine_->next(count);
+}
+
+void
+LoopbackDBGController::run() {
+    engine_->run();
+}
+
+void
+LoopbackDBGController::runUntil(UIntWord address) {
+    engine_->runUntil(address);
+}
+
+void
+LoopbackDBGController::reset() {
+    engine_->reset();
+}
+
+std::string
+LoopbackDBGController::registerFileValue(
+    const std::string& rfName, int registerIndex) {
+    return engine_->registerFileValue(rfName, registerIndex);
+}
+
+SimValue
+LoopbackDBGController::immediateUnitRegisterValue(
+    const std::string& iuName, int index) {
+    return engine_->immediateUnitRegisterValue(iuName, index);
+}
+
+SimValue
+LoopbackDBGController::FUPortValue(
+    const std::string& fuName, const std::string& portName) {
+    return engine_->FUPortValue(fuName, portName);
+}
+
+InstructionAddress
+LoopbackDBGController::programCounter() const {
+    return engine_->programCounter();
+}
+
+void
+LoopbackDBGController::prepareToStop(StopReason reason) {
+    engine_->prepareToStop(reason);
+}
+
+unsigned int
+LoopbackDBGController::stopReasonCount() const {
+    return engine_->stopReasonCount();
+}
+
+StopReason
+LoopbackDBGController::stopReason(unsigned int index) const {
+    return engine_->stopReason(index);
+}
+
+TTASimulationController::SimulationStatus
+LoopbackDBGController::state() const {
+    return engine_->state();
+}
+
+InstructionAddress
+LoopbackDBGController::lastExecutedInstruction(int coreId) const {
+    return engine_->lastExecutedInstruction(coreId);
+}
+
+ClockCycleCount
+LoopbackDBGController::clockCount() const {
+    return engine_->clockCount();
+}
@@ -0,0 +1,114 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file LoopbackDBGController.hh
+ *
+ * Declaration of LoopbackDBGController class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_LOOPBACK_DBG_CONTROLLER
+#define TTA_LOOPBACK_DBG_CONTROLLER
+
+#include <map>
+
+#include "RemoteController.hh"
+
+class SimulationController;
+class Memory;
+
+/**
+ * A remote debugger target that loops back to the interpretive simulator.
+ *
+ * The controller implements the RemoteController interface without any
+ * hardware: the program is executed by an embedded SimulationController
+ * and the "physical" memories are local memory models. All data memory
+ * accesses of the simulated program go through the RemoteMemory proxies
+ * and this controller, thus the remote debugging code paths (including
+ * the block transfer API) can be exercised and measured without an FPGA.
+ */
+class LoopbackDBGController : public RemoteController {
+public:
+    typedef MinimumAddressableUnit MAU;
+
+    LoopbackDBGController(
+        SimulatorFrontend& frontend,
+        const TTAMachine::Machine& machine, 
+        const TTAProgram::Program& program);
+    virtual ~LoopbackDBGController();
+
+    virtual void writeMem(Word address, MAU data, const AddressSpace&);
+    virtual MAU readMem(Word address, const AddressSpace&);
+    virtual void writeMemBlock(
+        Word address, const MAU* data, ULongWord count,
+        const AddressSpace& space);
+    virtual void readMemBlock(
+        Word address, MAU* data, ULongWord count,
+        const AddressSpace& space);
+    virtual void writeIMem(const char *data, int size);
+
+    virtual void step(double count = 1);
+
+    virtual void next(int count = 1);
+
+    virtual void run();
+
+    virtual void runUntil(UIntWord address);
+
+    virtual void reset();
+    
+    virtual std::string registerFileValue(
+        const std::string& rfName, 
+        int registerIndex = -1);
+    
+    virtual SimValue immediateUnitRegisterValue(
+    const std::string& iuName, int index = -1);
+    
+    virtual SimValue FUPortValue(
+        const std::string& fuName, 
+        const std::string& portName);
+    
+    virtual InstructionAddress programCounter() const;
+
+    virtual void prepareToStop(StopReason reason);
+    virtual unsigned int stopReasonCount() const;
+    virtual StopReason stopReason(unsigned int index) const;
+    virtual SimulationStatus state() const;
+    virtual InstructionAddress lastExecutedInstruction(int coreId=-1) const;
+    virtual ClockCycleCount clockCount() const;
+
+private:
+    Memory& targetMemory(const AddressSpace& space);
+
+    /// The local memories emulating the physical ones, per address space.
+    typedef std::map<const AddressSpace*, Memory*> MemoryMap;
+
+    /// The simulation engine executing the program.
+    SimulationController* engine_;
+    /// The emulated physical memories.
+    MemoryMap memories_;
+};
+
+#endif
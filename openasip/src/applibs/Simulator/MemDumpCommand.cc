@@ -43,6 +43,7 @@
 #include "Conversion.hh"
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 /**
  * Constructor.
@@ -194,22 +195,36 @@ MemDumpCommand::execute(const std::vector<DataObject>& arguments) {
     }
 
     MAUsToDisplay = newMAUCount;
+
+    // fetch the whole dumped range with a single block read, which is
+    // considerably faster on remote targets than MAU-sized reads
+    std::vector<Memory::MAU> MAUs(newDisplayedCount * MAUsToDisplay);
+    try {
+        memory->readBlock(newDisplayedAddress, MAUs.data(), MAUs.size());
+    } catch (const OutOfRange&) {
+        interpreter()->setResult(
+            SimulatorToolbox::textGenerator().text(
+                Texts::TXT_ADDRESS_OUT_OF_RANGE).str());
+        interpreter()->setError(true);
+        delete out;
+        return false;        
+    }
+
     DataObject* result = new DataObject("");
     // read the wanted number (given with /n) of chunks of data to the result 
-    while (newDisplayedCount > 0) {
+    for (size_t chunk = 0; newDisplayedCount > 0; ++chunk) {
 
+        // pack the chunk to an integer honoring the memory endianness
         ULongWord data = 0;
-        try {
-            memory->read(newDisplayedAddress, MAUsToDisplay, data);
-        } catch (const OutOfRange&) {
-            interpreter()->setResult(
-                SimulatorToolbox::textGenerator().text(
-                    Texts::TXT_ADDRESS_OUT_OF_RANGE).str());
-            interpreter()->setError(true);
-            return false;        
+        for (size_t m = 0; m < MAUsToDisplay; ++m) {
+            const size_t index =
+                memory->isLittleEndian() ?
+                chunk * MAUsToDisplay + (MAUsToDisplay - 1 - m) :
+                chunk * MAUsToDisplay + m;
+            data =
+                (m == 0) ? MAUs[index] : (data << MAUSize) | MAUs[index];
         }
 
-        
         newDisplayedCount--;
         newDisplayedAddress += MAUsToDisplay;
 
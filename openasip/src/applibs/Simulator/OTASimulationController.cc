@@ -37,11 +37,16 @@
 #include "MemorySystem.hh"
 #include "SimulationEventHandler.hh"
 
+/// The program counter increment of an operation-triggered instruction.
+const unsigned INSTRUCTION_ADDRESS_STEP = 4;
+
 OTASimulationController::OTASimulationController(
     SimulatorFrontend& frontend,
     const TTAMachine::Machine& machine,
     const TTAProgram::Program& program) :
-    SimulationController (frontend, machine, program, false, false) {
+    SimulationController (frontend, machine, program, false, false),
+    instructionTable_(
+        *instructionMemories_[0], firstIllegalInstructionIndex_) {
 }
 
 OTASimulationController::~OTASimulationController() {
@@ -80,33 +85,33 @@ OTASimulationController::advanceMachineCycle(unsigned pcAdd) {
 bool
 OTASimulationController::simulateCycle() {
 
-    std::vector<InstructionAddress> lastExecutedInstructions =
-        lastExecutedInstruction_;
-
     bool finished = false;
 
     int finishedCoreCount = 0;
 
     const unsigned int core = 0;
     MachineState& machineState = *machineStates_[core];
-    InstructionMemory& imem = *instructionMemories_[core];
     GCUState& gcu = machineState.gcuState();
     const InstructionAddress pc = gcu.programCounter();
+    InstructionAddress lastExecutedInstruction =
+        lastExecutedInstruction_[core];
 
     try {
         machineState.clearBuses();
 
         bool exitPoint = false;
-        if (imem.hasInstructionAt(pc)) {
-            ExecutableInstruction& instruction = imem.instructionAt(pc);
+        const InstructionLookupTable::Entry& entry =
+            instructionTable_.lookup(pc);
+        if (entry.instruction != NULL) {
+            ExecutableInstruction& instruction = *entry.instruction;
             instruction.execute();
 
-            lastExecutedInstructions[core] = pc;
+            lastExecutedInstruction = pc;
 
-            advanceMachineCycle(4);
+            advanceMachineCycle(INSTRUCTION_ADDRESS_STEP);
 
-            if (imem.hasImplicitInstructionsAt(pc)) {
-                const auto& implInstructions = imem.implicitInstructionsAt(pc);
+            if (entry.implicitInstructions != NULL) {
+                const auto& implInstructions = *entry.implicitInstructions;
                 for (size_t i = 0; i < implInstructions.size(); ++i) {
                     ExecutableInstruction& implInstruction =
                         *implInstructions.at(i);
@@ -138,9 +143,12 @@ OTASimulationController::simulateCycle() {
     if (finishedCoreCount > 0)
         finished = true;
 
+    if (frontend_.eventHandler().hasBatchListeners()) {
+        recordExecutedInstruction(lastExecutedInstruction);
+    }
     frontend_.eventHandler().handleEvent(SimulationEventHandler::SE_CYCLE_END);
 
-    lastExecutedInstruction_ = lastExecutedInstructions;
+    lastExecutedInstruction_[core] = lastExecutedInstruction;
 
     // this is the instruction count in case of OTA
     ++clockCount_;
@@ -155,3 +163,12 @@ OTASimulationController::simulateCycle() {
         SimulationEventHandler::SE_NEW_INSTRUCTION);
     return true;
 }
+
+/**
+ * The fast loop of the base class does not simulate the implicit
+ * instructions, thus every cycle is simulated with simulateCycle().
+ */
+bool
+OTASimulationController::fastSimulationPossible() const {
+    return false;
+}
@@ -36,6 +36,7 @@
 #define OTA_SIMULATION_CONTROLLER_HH
 
 #include "SimulationController.hh"
+#include "InstructionLookupTable.hh"
 
 class OTASimulationController : public SimulationController {
 public:
@@ -50,6 +51,11 @@ public:
 protected:
     void advanceMachineCycle(unsigned pcAdd);
     virtual bool simulateCycle();
+    virtual bool fastSimulationPossible() const;
+
+private:
+    /// The instruction memory lookups of the executed addresses.
+    InstructionLookupTable instructionTable_;
 };
 
 #endif
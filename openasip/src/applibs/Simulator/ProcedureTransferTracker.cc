@@ -59,10 +59,9 @@
 ProcedureTransferTracker::ProcedureTransferTracker(
     SimulatorFrontend& subject,
     ExecutionTrace& traceDB) : 
-    Listener(), subject_(subject), traceDB_(&traceDB), 
+    subject_(subject), traceDB_(&traceDB), 
     previousInstruction_(NULL) {
-    subject.eventHandler().registerListener(
-        SimulationEventHandler::SE_CYCLE_END, this);
+    subject.eventHandler().registerBatchListener(this);
 }
 
 /**
@@ -73,18 +72,31 @@ ProcedureTransferTracker::ProcedureTransferTracker(
  */
 ProcedureTransferTracker::ProcedureTransferTracker(
     SimulatorFrontend& subject) : 
-    Listener(), subject_(subject), traceDB_(NULL),
+    subject_(subject), traceDB_(NULL),
     previousInstruction_(NULL) {
-    subject.eventHandler().registerListener(
-        SimulationEventHandler::SE_CYCLE_END, this);
+    subject.eventHandler().registerBatchListener(this);
 }
 
 /**
  * Destructor.
  */
 ProcedureTransferTracker::~ProcedureTransferTracker() {
-    subject_.eventHandler().unregisterListener(
-        SimulationEventHandler::SE_CYCLE_END, this);
+    subject_.eventHandler().unregisterBatchListener(this);
+}
+
+/**
+ * Checks a batch of executed instructions for procedure transfers.
+ *
+ * @param firstCycle The cycle of the first executed instruction.
+ * @param executedInstructions The instruction address per cycle.
+ */
+void
+ProcedureTransferTracker::handleInstructionBatch(
+    ClockCycleCount firstCycle,
+    const std::vector<InstructionAddress>& executedInstructions) {
+    for (std::size_t i = 0; i < executedInstructions.size(); ++i) {
+        handleExecutedInstruction(firstCycle + i, executedInstructions[i]);
+    }
 }
 
 /**
@@ -93,12 +105,14 @@ ProcedureTransferTracker::~ProcedureTransferTracker() {
  * Last executed instruction is saved and its procedure is compared to the
  * procedure of the current instruction. If they differ, a procedure transfer
  * has happened and data of it is stored in trace database.
+ *
+ * @param cycle The cycle in which the instruction was executed.
+ * @param lastExecutedInstrAddr The address of the executed instruction.
  */
 void 
-ProcedureTransferTracker::handleEvent() {
+ProcedureTransferTracker::handleExecutedInstruction(
+    ClockCycleCount cycle, InstructionAddress lastExecutedInstrAddr) {
 
-    InstructionAddress lastExecutedInstrAddr = 
-        subject_.lastExecutedInstruction();
     // the instruction that WAS executed in the current cycle (this handles
     // clock cycle *end* events)
     const TTAProgram::Instruction& currentInstruction =
@@ -148,7 +162,7 @@ ProcedureTransferTracker::handleEvent() {
     }  
     previousInstruction_ = &currentInstruction;
     addProcedureTransfer(
-        subject_.cycleCount(), lastExecutedInstrAddr, 
+        cycle, lastExecutedInstrAddr, 
         lastControlFlowInstructionAddress, entry);
 }
 
@@ -33,7 +33,9 @@
 #ifndef TTA_PROCEDURE_TRANSFER_TRACKER_HH
 #define TTA_PROCEDURE_TRANSFER_TRACKER_HH
 
-#include "Listener.hh"
+#include <vector>
+
+#include "SimulationEventHandler.hh"
 #include "SimulatorConstants.hh"
 
 class SimulatorFrontend;
@@ -48,7 +50,7 @@ namespace TTAProgram {
  *
  * Stores data of the transfer in trace database.
  */
-class ProcedureTransferTracker : public Listener {
+class ProcedureTransferTracker : public SimulationBatchListener {
 public:
     ProcedureTransferTracker(
         SimulatorFrontend& subject, 
@@ -58,7 +60,9 @@ public:
         SimulatorFrontend& subject);
     virtual ~ProcedureTransferTracker();
 
-    virtual void handleEvent();
+    virtual void handleInstructionBatch(
+        ClockCycleCount firstCycle,
+        const std::vector<InstructionAddress>& executedInstructions);
 
     virtual void addProcedureTransfer(
         ClockCycleCount cycle,
@@ -67,6 +71,9 @@ public:
         bool isEntry);
     
 private:
+    void handleExecutedInstruction(
+        ClockCycleCount cycle, InstructionAddress address);
+
     /// the tracked SimulatorFrontend instance
     SimulatorFrontend& subject_;
     /// the trace database to store the trace to
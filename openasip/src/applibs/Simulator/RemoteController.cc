@@ -54,6 +54,25 @@ RemoteController::RemoteController(
     exitPoints = findProgramExitPoints(program, machine);
 }
 
+void
+RemoteController::writeMemBlock(
+    Word address, const MAU* data, ULongWord count,
+    const AddressSpace& space) {
+
+    for (ULongWord i = 0; i < count; ++i) {
+        writeMem(address + i, data[i], space);
+    }
+}
+
+void
+RemoteController::readMemBlock(
+    Word address, MAU* data, ULongWord count, const AddressSpace& space) {
+
+    for (ULongWord i = 0; i < count; ++i) {
+        data[i] = readMem(address + i, space);
+    }
+}
+
 void
 RemoteController::loadIMemImage() {
 
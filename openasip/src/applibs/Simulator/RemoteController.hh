@@ -72,6 +72,36 @@ public:
      * @return one MAU of data to write. (TODO: is return value masked or not?)
      */
     virtual MAU readMem(Word address, const AddressSpace&) = 0;
+
+    /**
+     * Write a contiguous block of data to physical memory.
+     *
+     * The default implementation issues one writeMem() per MAU. Debug
+     * interfaces that support burst or pipelined transfers should
+     * override this to move the whole block in one transaction.
+     *
+     * @param address TTA's view of the first memory address to write
+     * @param data the MAUs to write
+     * @param count the number of MAUs to write
+     * @param space the address space in which to write the data.
+     */
+    virtual void writeMemBlock(
+        Word address, const MAU* data, ULongWord count,
+        const AddressSpace& space);
+
+    /**
+     * Read a contiguous block of data from physical memory.
+     *
+     * The default implementation issues one readMem() per MAU.
+     *
+     * @param address TTA's view of the first memory address to read
+     * @param data buffer for the read MAUs, must hold count MAUs
+     * @param count the number of MAUs to read
+     * @param space the address space from which to read the data.
+     */
+    virtual void readMemBlock(
+        Word address, MAU* data, ULongWord count,
+        const AddressSpace& space);
     
     /**
      * Create and load instruction memory image from current program.
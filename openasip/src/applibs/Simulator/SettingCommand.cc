@@ -663,6 +663,59 @@ public:
         return false;
     }
 };
+/**
+ * Setting action that loads the instruction decompressor stall cycles.
+ */
+class SetDecompressorStalls {
+public:
+
+    /**
+     * Loads the decompressor stall cycles from the given file.
+     *
+     * @param interpreter Interpreter to print the errors to.
+     * @param simFront SimulatorFrontend to load the stalls to.
+     * @param newValue The stall file, empty to remove the stalls.
+     * @return True if setting was successful.
+     */
+    static bool execute(
+        SimulatorInterpreter& interpreter,
+        SimulatorFrontend& simFront,
+        const std::string& newValue) {
+        if (newValue != "" && !simFront.simulatesDecompressorStalls()) {
+            interpreter.setError(
+                "Decompressor stalls are simulated only by the "
+                "interpretive simulation engine.");
+            return false;
+        }
+        try {
+            simFront.loadDecompressorStalls(newValue);
+        } catch (const Exception& e) {
+            interpreter.setError(e.errorMessage());
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Returns the default value of this setting.
+     *
+     * @return The default value.
+     */
+    static const DataObject& defaultValue() {
+        static const DataObject defaultValue_("");
+        return defaultValue_;
+    }
+
+    /**
+     * Should the action warn if program & machine exist and value was changed
+     *
+     * @return boolean value on whether or not to warn
+     */
+    static bool warnOnExistingProgramAndMachine() {
+        return false;
+    }
+};
+
 SettingCommand::SettingCommand() : 
     SimControlLanguageCommand("setting") {
 
@@ -761,6 +814,12 @@ SettingCommand::SettingCommand() :
             PositiveIntegerSetting, SetCallHistoryLength>(
                 "Sets the length of last procedure transfers to save in\n"
                 "memory for call trace printing.");
+
+    settings_["decompressor_stalls"] =
+        new TemplatedSimulatorSetting<
+            StringSetting, SetDecompressorStalls>(
+                "File of instruction decompressor stall cycles written by\n"
+                "a code compressor, empty for no stalls.");
 }
 
 /**
@@ -213,6 +213,60 @@ SimpleSimulatorFrontend::cycleCount() const {
     return simFront_->cycleCount();
 }
 
+/**
+ * Returns the simulation speed in simulated cycles per host second.
+ *
+ * Covers the run() and step() calls since the program was loaded.
+ */
+double
+SimpleSimulatorFrontend::simulatedCyclesPerSecond() const {
+    return simFront_->simulatedCyclesPerSecond();
+}
+
+/**
+ * Enables counting of the host instructions executed by the simulation.
+ *
+ * Counting adds overhead to each step() call, so it is disabled by default.
+ */
+void
+SimpleSimulatorFrontend::setHostInstructionCounting(bool value) {
+    simFront_->setHostInstructionCounting(value);
+}
+
+/**
+ * Returns the average count of host instructions per simulated cycle, -1
+ * if they were not counted.
+ */
+double
+SimpleSimulatorFrontend::hostInstructionsPerCycle() const {
+    return simFront_->hostInstructionsPerCycle();
+}
+
+/**
+ * Returns the time spent initializing the simulation engine in seconds.
+ */
+double
+SimpleSimulatorFrontend::initializationTime() const {
+    return simFront_->initializationTime();
+}
+
+/**
+ * Returns the peak resident memory usage of the process in KiB.
+ */
+long
+SimpleSimulatorFrontend::peakMemoryUsage() const {
+    return simFront_->peakMemoryUsage();
+}
+
+/**
+ * Writes all the simulator performance counters as a JSON object.
+ */
+void
+SimpleSimulatorFrontend::writePerformanceCounters(
+    std::ostream& stream) const {
+    simFront_->writePerformanceCounters(stream);
+}
+
 void
 SimpleSimulatorFrontend::initializeDataMemories(
     const TTAMachine::AddressSpace* onlyOne) {
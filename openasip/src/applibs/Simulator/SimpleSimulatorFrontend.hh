@@ -34,6 +34,7 @@
 #define TTA_SIMPLE_SIMULATOR_FRONTEND
 
 #include <stdint.h>
+#include <ostream>
 
 #include "TCEString.hh"
 
@@ -74,6 +75,13 @@ public:
 
     uint64_t cycleCount() const;
 
+    double simulatedCyclesPerSecond() const;
+    void setHostInstructionCounting(bool value);
+    double hostInstructionsPerCycle() const;
+    double initializationTime() const;
+    long peakMemoryUsage() const;
+    void writePerformanceCounters(std::ostream& stream) const;
+
     bool isInitialized() const;
     bool isStopped() const;
     bool isRunning() const;
@@ -71,6 +71,8 @@
 #include "RegisterFileState.hh"
 #include "MathTools.hh"
 
+#include <limits>
+
 using namespace TTAMachine;
 using namespace TTAProgram;
 
@@ -91,7 +93,7 @@ SimulationController::SimulationController(
     bool fuResourceConflictDetection,
     bool detailedSimulation) :
     TTASimulationController(frontend, machine, program),
-    tmpExecutedInstructions_(1) {
+    tmpExecutedInstructions_(1), instructionBatchStart_(0) {
 
     if (fuResourceConflictDetection)
         buildFUResourceConflictDetectors(machine);
@@ -164,6 +166,8 @@ SimulationController::simulateCycle() {
     // called it.
     unsigned finishedCoreCount = 0;
     bool finished = false;
+    const std::vector<unsigned int>& stalls = frontend_.decompressorStalls();
+    unsigned int stallCycles = 0;
     for (int core = 0; core < 1; ++core) {
         MachineState* machineState = machineStates_[core];
 
@@ -185,6 +189,9 @@ SimulationController::simulateCycle() {
             instruction->execute();
 
             tmpExecutedInstructions_[core] = pc;
+            if (pc < stalls.size()) {
+                stallCycles = stalls[pc];
+            }
         
             machineState->endClockOfAllFUStates();
 
@@ -237,11 +244,17 @@ SimulationController::simulateCycle() {
             detector.advanceClock();
     }
 
+    if (frontend_.eventHandler().hasBatchListeners()) {
+        recordExecutedInstruction(tmpExecutedInstructions_[0]);
+    }
     frontend_.eventHandler().handleEvent(SimulationEventHandler::SE_CYCLE_END);
 
     lastExecutedInstruction_ = tmpExecutedInstructions_;
 
     ++clockCount_;
+    if (stallCycles > 0) {
+        addDecompressorStall(stallCycles);
+    }
 
     if (finished) {
         state_ = STA_FINISHED;
@@ -254,6 +267,166 @@ SimulationController::simulateCycle() {
     return true;
 }
 
+/**
+ * Tells whether the cycles can be simulated with simulateFast().
+ *
+ * The fast loop does not generate the per-cycle simulation events, thus it
+ * is used only when no stop points, watches or trackers listen to them.
+ *
+ * @return True if the fast loop can be used.
+ */
+bool
+SimulationController::fastSimulationPossible() const {
+    const SimulationEventHandler& eventHandler = frontend_.eventHandler();
+    return 
+        !eventHandler.hasListeners(
+            SimulationEventHandler::SE_NEW_INSTRUCTION) &&
+        !eventHandler.hasListeners(SimulationEventHandler::SE_CYCLE_END);
+}
+
+/**
+ * Simulates cycles in a tight loop without generating simulation events.
+ *
+ * Does the same as repeated calls to simulateCycle(), but executes the
+ * instructions through their predecoded moves and skips the per-cycle
+ * event dispatch. Stops after the given count of cycles,
+ * when the program finishes or when a stop is requested otherwise.
+ *
+ * @param count The maximum number of cycles to simulate.
+ * @return The number of simulated cycles.
+ */
+double
+SimulationController::simulateFast(double count) {
+
+    MachineState& machineState = *machineStates_[0];
+    InstructionMemory& instructionMemory = *instructionMemories_[0];
+    MemorySystem& memorySystem = frontend_.memorySystem(0);
+    GCUState& gcu = machineState.gcuState();
+    const std::size_t conflictDetectorCount = conflictDetectorVector_.size();
+    const bool recordInstructions = 
+        frontend_.eventHandler().hasBatchListeners();
+    const std::vector<unsigned int>& stalls = frontend_.decompressorStalls();
+
+    double counter = 0;
+    while (counter < count && !stopRequested_) {
+        if (machineState.isFinished()) {
+            state_ = STA_FINISHED;
+            stopRequested_ = true;
+            break;
+        }
+
+        const InstructionAddress pc = gcu.programCounter();
+        bool finished = false;
+        try {
+            machineState.clearBuses();
+
+            ExecutableInstruction& instruction = 
+                instructionMemory.instructionAt(pc);
+
+            instruction.executeFast();
+
+            machineState.endClockOfAllFUStates();
+            if (!gcu.isIdle()) {
+                gcu.endClock();
+            }
+            memorySystem.advanceClockOfLocalMemories();
+            machineState.advanceClockOfAllFUStates();
+
+            ++gcu.programCounter();
+            if (!gcu.isIdle()) {
+                gcu.advanceClock();
+            }
+            machineState.advanceClockOfAllGuardStates();
+            machineState.advanceClockOfAllLongImmediateUnitStates();
+
+            if (instruction.isExitPoint() || 
+                gcu.programCounter() == firstIllegalInstructionIndex_) {
+                machineState.setFinished();
+                finished = true;
+            }
+        } catch (const Exception& e) {
+            frontend_.selectCore(0);
+            frontend_.reportSimulatedProgramError(
+                SimulatorFrontend::RES_FATAL,
+                e.errorMessage());
+            prepareToStop(SRE_RUNTIME_ERROR);
+            return counter + 1;
+        }
+
+        memorySystem.advanceClockOfSharedMemories();
+        for (std::size_t i = 0; i < conflictDetectorCount; ++i) {
+            FUResourceConflictDetector& detector = *conflictDetectorVector_[i];
+            if (!detector.isIdle()) {
+                detector.advanceClock();
+            }
+        }
+
+        lastExecutedInstruction_[0] = pc;
+        if (recordInstructions) {
+            recordExecutedInstruction(pc);
+        }
+        ++clockCount_;
+        ++counter;
+        if (pc < stalls.size() && stalls[pc] > 0) {
+            addDecompressorStall(stalls[pc]);
+        }
+
+        if (finished) {
+            state_ = STA_FINISHED;
+            stopRequested_ = true;
+        }
+    }
+    return counter;
+}
+
+/**
+ * Records the instruction executed in the current cycle for the batch
+ * listeners.
+ *
+ * The batch is delivered when it gets full or the simulation stops.
+ *
+ * @param address The address of the executed instruction.
+ */
+void
+SimulationController::recordExecutedInstruction(InstructionAddress address) {
+    if (instructionBatch_.empty()) {
+        instructionBatchStart_ = clockCount_;
+    }
+    instructionBatch_.push_back(address);
+    if (instructionBatch_.size() >= INSTRUCTION_BATCH_SIZE) {
+        flushInstructionBatch();
+    }
+}
+
+/**
+ * Delivers the recorded executed instructions to the batch listeners.
+ */
+void
+SimulationController::flushInstructionBatch() {
+    if (instructionBatch_.empty()) {
+        return;
+    }
+    frontend_.eventHandler().handleInstructionBatch(
+        instructionBatchStart_, instructionBatch_);
+    instructionBatch_.clear();
+}
+
+/**
+ * Accounts for the cycles the instruction decompressor locks the core.
+ *
+ * The whole core is locked, so the stall only advances the clock. The
+ * recorded instructions are delivered first because the batches assume
+ * consecutive cycles.
+ *
+ * @param cycles The number of stall cycles.
+ */
+void
+SimulationController::addDecompressorStall(unsigned int cycles) {
+    flushInstructionBatch();
+    clockCount_ += cycles;
+    frontend_.addDecompressorStallCycles(cycles);
+}
+
 /**
  * Advance simulation by a given amout of cycles.
  *
@@ -269,9 +442,13 @@ SimulationController::step(double count) {
     stopRequested_ = false;
 
     double counter = 0;
-    while (counter < count && !stopRequested_) {
-        simulateCycle();
-        ++counter;
+    if (fastSimulationPossible()) {
+        counter = simulateFast(count);
+    } else {
+        while (counter < count && !stopRequested_) {
+            simulateCycle();
+            ++counter;
+        }
     }
 
     if (counter == count) {
@@ -281,6 +458,7 @@ SimulationController::step(double count) {
     if (state_ != STA_FINISHED)
         state_ = STA_STOPPED;
 
+    flushInstructionBatch();
     frontend_.eventHandler().handleEvent(
         SimulationEventHandler::SE_SIMULATION_STOPPED);
 }
@@ -332,6 +510,7 @@ SimulationController::next(int count) {
     if (state_ != STA_FINISHED)
         state_ = STA_STOPPED;
 
+    flushInstructionBatch();
     frontend_.eventHandler().handleEvent(
         SimulationEventHandler::SE_SIMULATION_STOPPED);
 }
@@ -348,12 +527,17 @@ SimulationController::run() {
     stopReasons_.clear();
     state_ = STA_RUNNING;
 
-    while (!stopRequested_) {
-        simulateCycle();
+    if (fastSimulationPossible()) {
+        simulateFast(std::numeric_limits<double>::infinity());
+    } else {
+        while (!stopRequested_) {
+            simulateCycle();
+        }
     }
     if (state_ != STA_FINISHED)
         state_ = STA_STOPPED;
 
+    flushInstructionBatch();
     frontend_.eventHandler().handleEvent(
         SimulationEventHandler::SE_SIMULATION_STOPPED);
 }
@@ -380,6 +564,7 @@ SimulationController::runUntil(UIntWord address) {
         if (selectedMachineState().gcuState().programCounter() == address) {
             prepareToStop(SRE_AFTER_UNTIL);
             state_ = STA_STOPPED;
+            flushInstructionBatch();
             frontend_.eventHandler().handleEvent(
                 SimulationEventHandler::SE_SIMULATION_STOPPED);
             return;
@@ -390,6 +575,7 @@ SimulationController::runUntil(UIntWord address) {
         state_ = STA_STOPPED;
     }
     
+    flushInstructionBatch();
     frontend_.eventHandler().handleEvent(
         SimulationEventHandler::SE_SIMULATION_STOPPED);
 }
@@ -423,6 +609,7 @@ SimulationController::reset() {
     state_ = STA_INITIALIZING;
     stopRequested_ = false;
     clockCount_ = 0;
+    instructionBatch_.clear();
     state_ = STA_INITIALIZED;
 
     for (int core = 0; core < 1; ++core) {
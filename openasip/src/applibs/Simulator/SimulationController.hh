@@ -83,6 +83,11 @@ public:
 
 protected:
     virtual bool simulateCycle();
+    virtual bool fastSimulationPossible() const;
+    double simulateFast(double count);
+    void recordExecutedInstruction(InstructionAddress address);
+    void flushInstructionBatch();
+    void addDecompressorStall(unsigned int cycles);
 
     typedef std::vector<MachineState*> MachineStateContainer;
 
@@ -112,6 +117,12 @@ private:
     std::vector<FUResourceConflictDetector*> conflictDetectorVector_;
     /// Temporary place for lastExecuted Instruction.
     std::vector<InstructionAddress> tmpExecutedInstructions_;
+    /// Executed instructions not yet delivered to the batch listeners.
+    std::vector<InstructionAddress> instructionBatch_;
+    /// The cycle of the first instruction in instructionBatch_.
+    ClockCycleCount instructionBatchStart_;
+    /// The count of executed instructions delivered in one batch.
+    static const std::size_t INSTRUCTION_BATCH_SIZE = 4096;
 
 };
 
@@ -43,3 +43,56 @@ SimulationEventHandler::SimulationEventHandler() {
  */
 SimulationEventHandler::~SimulationEventHandler() {
 }
+
+/**
+ * Registers a listener for the executed instruction batches.
+ *
+ * Registering the same listener again has no effect.
+ *
+ * @param listener The listener.
+ */
+void
+SimulationEventHandler::registerBatchListener(
+    SimulationBatchListener* listener) {
+    for (std::size_t i = 0; i < batchListeners_.size(); ++i) {
+        if (batchListeners_[i] == listener) {
+            return;
+        }
+    }
+    batchListeners_.push_back(listener);
+}
+
+/**
+ * Unregisters a listener of the executed instruction batches.
+ *
+ * @param listener The listener.
+ */
+void
+SimulationEventHandler::unregisterBatchListener(
+    SimulationBatchListener* listener) {
+    for (std::size_t i = 0; i < batchListeners_.size(); ++i) {
+        if (batchListeners_[i] == listener) {
+            batchListeners_.erase(batchListeners_.begin() + i);
+            return;
+        }
+    }
+}
+
+/**
+ * Delivers a batch of executed instructions to the batch listeners.
+ *
+ * @param firstCycle The cycle in which the first instruction was executed.
+ * @param executedInstructions The instruction address per cycle.
+ */
+void
+SimulationEventHandler::handleInstructionBatch(
+    ClockCycleCount firstCycle,
+    const std::vector<InstructionAddress>& executedInstructions) {
+    if (executedInstructions.empty()) {
+        return;
+    }
+    for (std::size_t i = 0; i < batchListeners_.size(); ++i) {
+        batchListeners_[i]->handleInstructionBatch(
+            firstCycle, executedInstructions);
+    }
+}
@@ -33,7 +33,33 @@
 #ifndef TTA_SIMULATION_EVENT_HANDLER_HH
 #define TTA_SIMULATION_EVENT_HANDLER_HH
 
+#include <vector>
+
 #include "Informer.hh"
+#include "SimulatorConstants.hh"
+
+/**
+ * Interface for receiving the executed instructions in batches.
+ *
+ * Unlike the per-cycle SE_CYCLE_END listeners, batch listeners do not
+ * prevent the simulation controller from running cycles in its fast loop.
+ */
+class SimulationBatchListener {
+public:
+    virtual ~SimulationBatchListener() {}
+
+    /**
+     * Receives the addresses of the instructions executed in consecutive
+     * cycles.
+     *
+     * @param firstCycle The cycle in which the first instruction was
+     *                   executed.
+     * @param executedInstructions The instruction address per cycle.
+     */
+    virtual void handleInstructionBatch(
+        ClockCycleCount firstCycle,
+        const std::vector<InstructionAddress>& executedInstructions) = 0;
+};
 
 /**
  * The informer of the simulation specific events.
@@ -58,7 +84,25 @@ public:
                             ///< initiated.
         
     } SimulationEvent;
+
+    void registerBatchListener(SimulationBatchListener* listener);
+    void unregisterBatchListener(SimulationBatchListener* listener);
+    bool hasBatchListeners() const;
+    void handleInstructionBatch(
+        ClockCycleCount firstCycle,
+        const std::vector<InstructionAddress>& executedInstructions);
+
 private:
+    /// The registered batch listeners.
+    std::vector<SimulationBatchListener*> batchListeners_;
 };
 
+/**
+ * Tells whether any batch listeners are registered.
+ */
+inline bool
+SimulationEventHandler::hasBatchListeners() const {
+    return !batchListeners_.empty();
+}
+
 #endif
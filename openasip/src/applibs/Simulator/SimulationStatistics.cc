@@ -31,12 +31,19 @@
  * @note rating: red
  */
 
+#include <cassert>
+#include <exception>
+
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
 #include "SimulationStatistics.hh"
 #include "SimulationStatisticsCalculator.hh"
 #include "Program.hh"
 #include "NullInstruction.hh"
 #include "InstructionMemory.hh"
 #include "ExecutableInstruction.hh"
+#include "SequenceTools.hh"
 
 /**
  * Constructs a new simulation statistics calculation loop.
@@ -73,6 +80,14 @@ SimulationStatistics::addStatistics(
 /**
  * Calculates simulation statistics by going through the program and
  * invoking calculate() for all statistics types.
+ *
+ * If all statistics types support partial calculation, the executed
+ * instructions are split into ranges that are processed in parallel and
+ * the partial results are merged in program order. The worker threads
+ * share the program, its machine and the execution counts, which are only
+ * read and must not be modified until calculate() returns.
+ *
+ * @exception Exception Any exception thrown by a statistics type.
  */
 void 
 SimulationStatistics::calculate() {
@@ -80,6 +95,97 @@ SimulationStatistics::calculate() {
     if (statisticsTypes_.size() == 0)
         return;
 
+    InstructionList instructions;
+    collectExecutedInstructions(instructions);
+
+    unsigned int threads = boost::thread::hardware_concurrency();
+    if (threads > instructions.size() / MIN_INSTRUCTIONS_PER_THREAD) {
+        threads = instructions.size() / MIN_INSTRUCTIONS_PER_THREAD;
+    }
+
+    // one set of partial calculators for each range but the first one,
+    // which uses the registered calculators directly
+    std::vector<std::vector<SimulationStatisticsCalculator*> > partials;
+    for (unsigned int t = 1; t < threads; ++t) {
+        std::vector<SimulationStatisticsCalculator*> calculators;
+        for (std::size_t i = 0; i < statisticsTypes_.size(); ++i) {
+            SimulationStatisticsCalculator* partial =
+                statisticsTypes_[i]->createPartial();
+            if (partial == NULL) {
+                break;
+            }
+            calculators.push_back(partial);
+        }
+        if (calculators.size() != statisticsTypes_.size()) {
+            SequenceTools::deleteAllItems(calculators);
+            break;
+        }
+        partials.push_back(calculators);
+    }
+
+    if (partials.empty() || partials.size() + 1 < threads) {
+        for (std::size_t i = 0; i < partials.size(); ++i) {
+            SequenceTools::deleteAllItems(partials[i]);
+        }
+        calculateRange(
+            instructions, 0, instructions.size(), statisticsTypes_);
+        return;
+    }
+
+    const unsigned int memoryModifications =
+        executionCounts_.modificationCount();
+    const InstructionAddress programSize = program_.instructionCount();
+
+    // errors[0] is for the range of this thread
+    std::vector<std::exception_ptr> errors(threads);
+    const std::size_t rangeSize = instructions.size() / threads;
+    boost::thread_group workers;
+    for (std::size_t t = 0; t < partials.size(); ++t) {
+        std::size_t begin = (t + 1) * rangeSize;
+        std::size_t end = 
+            (t + 2 == threads) ? instructions.size() : begin + rangeSize;
+        workers.create_thread(
+            boost::bind(
+                &SimulationStatistics::calculateRangeSafely,
+                boost::cref(instructions), begin, end,
+                boost::ref(partials[t]), boost::ref(errors[t + 1])));
+    }
+    calculateRangeSafely(
+        instructions, 0, rangeSize, statisticsTypes_, errors[0]);
+    workers.join_all();
+
+    assert(
+        executionCounts_.modificationCount() == memoryModifications &&
+        program_.instructionCount() == programSize &&
+        "Program was modified while its statistics were calculated.");
+
+    std::exception_ptr error;
+    for (std::size_t t = 0; t < errors.size() && !error; ++t) {
+        error = errors[t];
+    }
+    for (std::size_t t = 0; t < partials.size(); ++t) {
+        if (!error) {
+            for (std::size_t i = 0; i < statisticsTypes_.size(); ++i) {
+                statisticsTypes_[i]->mergePartial(*partials[t][i]);
+            }
+        }
+        SequenceTools::deleteAllItems(partials[t]);
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * Collects the executed instructions and their execution counts in program
+ * order.
+ *
+ * @param instructions The instructions are appended here.
+ */
+void
+SimulationStatistics::collectExecutedInstructions(
+    InstructionList& instructions) const {
+
     const TTAProgram::Instruction* currentInstruction = 
         &program_.instructionAt(program_.startAddress().location());
     while (currentInstruction != &TTAProgram::NullInstruction::instance()) {
@@ -100,10 +206,8 @@ SimulationStatistics::calculate() {
         }
 
         // First process explicit instruction ...
-        for (std::size_t i = 0; i < statisticsTypes_.size(); ++i) {
-            statisticsTypes_[i]->calculateForInstruction(
-                *currentInstruction, execInstr);
-        }
+        instructions.push_back(
+            std::make_pair(currentInstruction, &execInstr));
 
         // ... and then the following implicit instructions.
         // FIXME: Potential breakage. Can not know if the executable instruction
@@ -116,12 +220,58 @@ SimulationStatistics::calculate() {
             instrAddr)) {
             if (implInstr->size() != 0)
                 break;
-            for (std::size_t i = 0; i < statisticsTypes_.size(); ++i) {
-                statisticsTypes_[i]->calculateForInstruction(
-                    *implInstr, *implExecInstr);
-            }
+            instructions.push_back(std::make_pair(implInstr, implExecInstr));
             implInstr = &program_.nextInstruction(*implInstr);
         }
         currentInstruction = &program_.nextInstruction(*currentInstruction);
     }
 }
+
+/**
+ * Invokes the given calculators for a range of instructions and catches
+ * the exceptions they throw.
+ *
+ * Used to run a range in a thread of its own, the caller rethrows the
+ * exception after all the threads have finished.
+ *
+ * @param instructions The executed instructions.
+ * @param begin Index of the first instruction of the range.
+ * @param end Index after the last instruction of the range.
+ * @param calculators The calculators to invoke.
+ * @param error The exception thrown by a calculator is stored here.
+ */
+void
+SimulationStatistics::calculateRangeSafely(
+    const InstructionList& instructions,
+    std::size_t begin, std::size_t end,
+    std::vector<SimulationStatisticsCalculator*>& calculators,
+    std::exception_ptr& error) {
+
+    try {
+        calculateRange(instructions, begin, end, calculators);
+    } catch (...) {
+        error = std::current_exception();
+    }
+}
+
+/**
+ * Invokes the given calculators for a range of instructions.
+ *
+ * @param instructions The executed instructions.
+ * @param begin Index of the first instruction of the range.
+ * @param end Index after the last instruction of the range.
+ * @param calculators The calculators to invoke.
+ */
+void
+SimulationStatistics::calculateRange(
+    const InstructionList& instructions,
+    std::size_t begin, std::size_t end,
+    std::vector<SimulationStatisticsCalculator*>& calculators) {
+
+    for (std::size_t n = begin; n < end; ++n) {
+        for (std::size_t i = 0; i < calculators.size(); ++i) {
+            calculators[i]->calculateForInstruction(
+                *instructions[n].first, *instructions[n].second);
+        }
+    }
+}
@@ -34,13 +34,18 @@
 #define TTA_SIMULATION_STATISTICS_HH
 
 #include <vector>
+#include <utility>
+#include <cstddef>
+#include <exception>
 
 namespace TTAProgram {
     class Program;
+    class Instruction;
 }
 
 class SimulationStatisticsCalculator;
 class InstructionMemory;
+class ExecutableInstruction;
 
 /**
  * Calculates simulation statistics using user-given calculation classes.
@@ -56,6 +61,25 @@ public:
     void calculate();
 
 private:
+    /// Executed instructions and their execution counts in program order.
+    typedef std::vector<
+        std::pair<const TTAProgram::Instruction*,
+                  const ExecutableInstruction*> > InstructionList;
+
+    void collectExecutedInstructions(InstructionList& instructions) const;
+    static void calculateRange(
+        const InstructionList& instructions,
+        std::size_t begin, std::size_t end,
+        std::vector<SimulationStatisticsCalculator*>& calculators);
+    static void calculateRangeSafely(
+        const InstructionList& instructions,
+        std::size_t begin, std::size_t end,
+        std::vector<SimulationStatisticsCalculator*>& calculators,
+        std::exception_ptr& error);
+
+    /// Smallest number of instructions worth a thread of its own.
+    static const std::size_t MIN_INSTRUCTIONS_PER_THREAD = 16384;
+
     /// All registered statistics types are stored in this container.
     std::vector<SimulationStatisticsCalculator*> statisticsTypes_;
     /// The program used in calculating the statistics.
@@ -29,6 +29,8 @@
  * @author Pekka Jääskeläinen 2005 (pjaaskel-no.spam-cs.tut.fi)
  * @note rating: red
  */
+#include <cstddef>
+
 #include "SimulationStatisticsCalculator.hh"
 
 /**
@@ -46,3 +48,32 @@ SimulationStatisticsCalculator::SimulationStatisticsCalculator() {
  */
 SimulationStatisticsCalculator::~SimulationStatisticsCalculator() {
 }
+
+/**
+ * Creates an empty calculator whose results can be merged to this one.
+ *
+ * Calculators that support this can be run on separate instruction
+ * ranges in parallel. calculateForInstruction() of such a calculator is
+ * then called from several threads at once, each with its own calculator
+ * object, and it must only read the shared program and machine through
+ * accessors that do not update cached state. The default implementation
+ * returns NULL, which means the statistics are calculated sequentially.
+ *
+ * @return The new calculator, owned by the caller, or NULL.
+ */
+SimulationStatisticsCalculator*
+SimulationStatisticsCalculator::createPartial() const {
+    return NULL;
+}
+
+/**
+ * Adds the results of a calculator created with createPartial() to this.
+ *
+ * The default implementation does nothing.
+ *
+ * @param partial The calculator to merge.
+ */
+void
+SimulationStatisticsCalculator::mergePartial(
+    const SimulationStatisticsCalculator&) {
+}
@@ -52,6 +52,9 @@ public:
         const TTAProgram::Instruction& instructionData, 
         const ExecutableInstruction& executionCounts) = 0;
 
+    virtual SimulationStatisticsCalculator* createPartial() const;
+    virtual void mergePartial(const SimulationStatisticsCalculator& partial);
+
     SimulationStatisticsCalculator();
     virtual ~SimulationStatisticsCalculator();
 };
@@ -74,6 +74,19 @@ const std::string SWL_REMOTE_DBG = "remote";
 /// Short switch string for the TCE builtin remote debugger target
 const std::string SWS_REMOTE_DBG = "r"; 
 
+/// Long switch string for the remote debugger target looped back to the
+/// interpretive simulator
+const std::string SWL_LOOPBACK_DBG = "loopback"; 
+
+/// Long switch string for the operation-triggered simulation engine
+const std::string SWL_OTA_SIM = "ota";
+
+/// Long switch string for writing the simulator performance counters
+const std::string SWL_BENCHMARK = "benchmark";
+
+/// Long switch string for writing the execution profile
+const std::string SWL_EXECUTION_PROFILE = "execution-profile";
+
 /**
  * Constructor.
  *
@@ -116,6 +129,27 @@ SimulatorCmdLineOptions::SimulatorCmdLineOptions() : CmdLineOptions("") {
         new BoolCmdLineOptionParser(
             SWL_CUSTOM_DBG, "connect to a custom remote debugger (if implemented).",
             SWS_CUSTOM_DBG));
+
+     addOption(
+        new BoolCmdLineOptionParser(
+            SWL_LOOPBACK_DBG, "use the remote debugger interface looped back "
+            "to the interpretive simulator."));
+
+     addOption(
+        new BoolCmdLineOptionParser(
+            SWL_OTA_SIM, "uses the operation-triggered simulation engine."));
+
+     addOption(
+        new StringCmdLineOptionParser(
+            SWL_BENCHMARK, "counts the host instructions of the simulation "
+            "and writes the simulator performance counters to the given "
+            "file as JSON when the simulator exits, - writes to stdout."));
+
+     addOption(
+        new StringCmdLineOptionParser(
+            SWL_EXECUTION_PROFILE, "writes the execution counts of the "
+            "simulated program to the given file when the simulator exits. "
+            "The profile can be given to tcecc with --execution-profile."));
 }
 
 /**
@@ -211,6 +245,8 @@ SimulatorCmdLineOptions::backendType() {
     bool wantCompiled = false;
     bool wantRemote = false;
     bool wantCustom = false;
+    bool wantLoopback = false;
+    bool wantOTA = false;
 
     wantCompiled |= optionGiven(SWL_FAST_SIM);
     wantCompiled &= findOption(SWL_FAST_SIM)->isFlagOn();
@@ -221,12 +257,53 @@ SimulatorCmdLineOptions::backendType() {
     wantCustom |= optionGiven(SWL_CUSTOM_DBG);
     wantCustom &= findOption(SWL_CUSTOM_DBG)->isFlagOn();
 
+    wantLoopback |= optionGiven(SWL_LOOPBACK_DBG);
+    wantLoopback &= findOption(SWL_LOOPBACK_DBG)->isFlagOn();
+
+    wantOTA |= optionGiven(SWL_OTA_SIM);
+    wantOTA &= findOption(SWL_OTA_SIM)->isFlagOn();
+
     // TODO: no check for if user requests simultaneously several 
     // versions of TTA backend. Start with the most picky one, 
     // user probably notices it erroring out.
     if (wantCustom) return SimulatorFrontend::SIM_CUSTOM;
     if (wantRemote) return SimulatorFrontend::SIM_REMOTE;
+    if (wantLoopback) return SimulatorFrontend::SIM_LOOPBACK;
+    if (wantOTA) return SimulatorFrontend::SIM_OTA;
     if (wantCompiled) return SimulatorFrontend::SIM_COMPILED;
     return SimulatorFrontend::SIM_NORMAL;
 }
 
+/**
+ * Returns true if the simulator performance counters should be written.
+ */
+bool
+SimulatorCmdLineOptions::isBenchmarkFileDefined() {
+    return optionGiven(SWL_BENCHMARK);
+}
+
+/**
+ * Returns the file to write the simulator performance counters to.
+ *
+ * @return The file name, "-" for the standard output.
+ */
+std::string
+SimulatorCmdLineOptions::benchmarkFile() {
+    return findOption(SWL_BENCHMARK)->String();
+}
+
+/**
+ * Returns true if the execution profile should be written.
+ */
+bool
+SimulatorCmdLineOptions::isExecutionProfileFileDefined() {
+    return optionGiven(SWL_EXECUTION_PROFILE);
+}
+
+/**
+ * Returns the file to write the execution profile to.
+ */
+std::string
+SimulatorCmdLineOptions::executionProfileFile() {
+    return findOption(SWL_EXECUTION_PROFILE)->String();
+}
@@ -56,6 +56,10 @@ public:
     std::string machineFile();
     std::string programFile();
     SimulatorFrontend::SimulationType backendType();
+    bool isBenchmarkFileDefined();
+    std::string benchmarkFile();
+    bool isExecutionProfileFileDefined();
+    std::string executionProfileFile();
     
 private:
     /// Copying not allowed.
@@ -36,7 +36,9 @@
 #include <sstream>
 #include <iomanip>
 #include <ctime>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 #include "CompilerWarnings.hh"
 IGNORE_CLANG_WARNING("-Wkeyword-macro")
@@ -46,6 +48,12 @@ POP_CLANG_DIAGS
 #include <boost/bind.hpp>
 #include <boost/version.hpp>
 
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "Binary.hh"
 #include "BinaryReader.hh"
 #include "BinaryStream.hh"
@@ -88,6 +96,7 @@ POP_CLANG_DIAGS
 #include "UtilizationStats.hh"
 #include "SimulationStatistics.hh"
 #include "RFAccessTracker.hh"
+#include "SimulationActivityCounters.hh"
 #include "BusTracker.hh"
 #include "InstructionMemory.hh"
 #include "ExecutableInstruction.hh"
@@ -98,8 +107,10 @@ POP_CLANG_DIAGS
 #include "DataMemory.hh"
 #include "DataDefinition.hh"
 #include "CompiledSimController.hh"
+#include "CompiledSimulation.hh"
 #include "TCEDBGController.hh"
 #include "CustomDBGController.hh"
+#include "LoopbackDBGController.hh"
 #include "CompiledSimUtilizationStats.hh"
 #include "SimulationEventHandler.hh"
 #include "MachineInfo.hh"
@@ -107,7 +118,11 @@ POP_CLANG_DIAGS
 #include "IdealSRAM.hh"
 #include "RemoteMemory.hh"
 #include "MemoryProxy.hh"
+#include "Memory.hh"
 #include "DisassemblyFUPort.hh"
+#include "PhaseTimes.hh"
+#include "ExecutionProfile.hh"
+#include "Procedure.hh"
 
 using namespace TTAMachine;
 using namespace TTAProgram;
@@ -126,13 +141,21 @@ SimulatorFrontend::SimulatorFrontend(SimulationType backendType) :
     busTracing_(false), 
     rfAccessTracing_(false), procedureTransferTracing_(false), 
     saveProfileData_(false), saveUtilizationData_(false),
+    activityCounting_(false),
     stopPointManager_(NULL), tpef_(NULL),
     fuResourceConflictDetection_(true),
     printNextInstruction_(true), printSimulationTimeStatistics_(false),
     staticCompilation_(true), traceFileNameSetByUser_(false), outputStream_(0),
     memoryAccessTracking_(false), eventHandler_(NULL), lastRunCycleCount_(0),
-    lastRunTime_(0.0), simulationTimeout_(0), leaveCompiledDirty_(false),
-    callHistoryLength_(0), zeroFillMemoriesOnReset_(true) {
+    lastRunTime_(0.0), startCycleCount_(0), machineLoadTime_(0.0),
+    programLoadTime_(0.0), initializationTime_(0.0), totalRunTime_(0.0),
+    totalRunCycleCount_(0), hostInstructionCounting_(false),
+    hostInstructionCounter_(-1), startHostInstructions_(-1),
+    totalHostInstructions_(0), hostCountedCycles_(0),
+    simulationTimeout_(0), leaveCompiledDirty_(false),
+    callHistoryLength_(0), decompressorStallsBound_(false),
+    decompressorStallCycles_(0),
+    zeroFillMemoriesOnReset_(true) {
 
     if (backendType == SIM_COMPILED) {
         setCompiledSimulation(true);
@@ -176,7 +199,12 @@ SimulatorFrontend::~SimulatorFrontend() {
     SequenceTools::deleteAllItems(memorySystems_);
 
     clearProgramErrorReports();
-    
+
+#ifdef __linux__
+    if (hostInstructionCounter_ != -1) {
+        close(hostInstructionCounter_);
+    }
+#endif
 }
 
 /**
@@ -210,6 +238,7 @@ SimulatorFrontend::loadProgram(const Program& program) {
     currentProgram_ = &program;
     programOwnedByFrontend_ = false;
 
+    resetDecompressorStalls();
     initializeSimulation();
     initializeDataMemories();
     initializeTracing();
@@ -298,6 +327,9 @@ SimulatorFrontend::program() const {
 void 
 SimulatorFrontend::loadProgram(const std::string& fileName) {
 
+    const std::chrono::steady_clock::time_point loadStart =
+        std::chrono::steady_clock::now();
+
     if (currentMachine_ == NULL)
         throw Exception(
             __FILE__, __LINE__, __func__,
@@ -410,6 +442,7 @@ SimulatorFrontend::loadProgram(const std::string& fileName) {
 
     programOwnedByFrontend_ = true;
 
+    resetDecompressorStalls();
     initializeSimulation();
     initializeDataMemories();
 
@@ -427,6 +460,9 @@ SimulatorFrontend::loadProgram(const std::string& fileName) {
     // tracing can't be enabled before loading program so try to initialize
     // the tracing after program is loaded
     initializeTracing();
+
+    programLoadTime_ = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - loadStart).count();
 }
 
 /**
@@ -495,10 +531,8 @@ SimulatorFrontend::initializeDataMemories(
                             addressSpace.name() +
                             " is out of address space bounds.");
                     } 
-                    for (int m = 0; m < def.size(); m++) {
-                        dataMemory->write(
-                            startAddress.location() + m, def.MAU(m));
-                    }
+                    writeDataDefinition(
+                        *dataMemory, startAddress.location(), def);
                 }
 
             } catch (const InstanceNotFound& inf) {
@@ -534,6 +568,9 @@ void
 SimulatorFrontend::loadMachine(const std::string& fileName) {
     SimulatorTextGenerator& textGen = SimulatorToolbox::textGenerator();
 
+    const std::chrono::steady_clock::time_point loadStart =
+        std::chrono::steady_clock::now();
+
     if (!FileSystem::fileExists(fileName)) {
         throw FileNotFound(
             __FILE__, __LINE__, __func__, 
@@ -582,6 +619,9 @@ SimulatorFrontend::loadMachine(const std::string& fileName) {
     }
     SequenceTools::deleteAllItems(memorySystems_);
     initializeMemorySystem();
+
+    machineLoadTime_ = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - loadStart).count();
 }
 
 /**
@@ -626,6 +666,59 @@ SimulatorFrontend::loadProcessorConfiguration(const std::string& fileName) {
     loadMachine(adfName);
 }
 
+/**
+ * Uploads the initialization data of one data definition to a memory.
+ *
+ * The data is transferred with block writes. In case the memories were
+ * zero filled at reset, long runs of zero MAUs are skipped altogether,
+ * which saves a lot of transfers on remote targets with mostly zero
+ * initialized data sections.
+ *
+ * @param memory The memory to write to.
+ * @param address The start address of the data.
+ * @param def The data definition to upload.
+ */
+void
+SimulatorFrontend::writeDataDefinition(
+    Memory& memory, ULongWord address, const DataDefinition& def) {
+
+    /// Zero runs shorter than this are written, as splitting the burst
+    /// would cost more than transferring the zeros.
+    const int MIN_SKIPPED_ZERO_RUN = 64;
+
+    const int size = def.size();
+    std::vector<Memory::MAU> data(size);
+    for (int m = 0; m < size; ++m) {
+        data[m] = def.MAU(m);
+    }
+
+    if (!zeroFillMemoriesOnReset_) {
+        memory.writeBlock(address, data.data(), size);
+        return;
+    }
+
+    int blockStart = 0;
+    int m = 0;
+    while (m < size) {
+        if (data[m] != 0) {
+            ++m;
+            continue;
+        }
+        int runEnd = m;
+        while (runEnd < size && data[runEnd] == 0) {
+            ++runEnd;
+        }
+        if (runEnd - m >= MIN_SKIPPED_ZERO_RUN) {
+            memory.writeBlock(
+                address + blockStart, &data[blockStart], m - blockStart);
+            blockStart = runEnd;
+        }
+        m = runEnd;
+    }
+    memory.writeBlock(
+        address + blockStart, &data[blockStart], size - blockStart);
+}
+
 /* Because memory models are initialized before the controller,
  * and RemoteMemory accesses its physical memory via the controller, 
  * RemoteMemories must be further initialized here.
@@ -656,6 +749,9 @@ SimulatorFrontend::setControllerForMemories(RemoteController* con) {
 void 
 SimulatorFrontend::initializeSimulation() {
 
+    const std::chrono::steady_clock::time_point initStart =
+        std::chrono::steady_clock::now();
+
     delete simCon_;
     simCon_ = NULL;
     switch(currentBackend_) {
@@ -671,6 +767,12 @@ SimulatorFrontend::initializeSimulation() {
                 *this, *currentMachine_, *currentProgram_);
         setControllerForMemories(dynamic_cast<RemoteController*>(simCon_));
         break;
+    case SIM_LOOPBACK:
+        simCon_ =
+            new LoopbackDBGController(
+                *this, *currentMachine_, *currentProgram_);
+        setControllerForMemories(dynamic_cast<RemoteController*>(simCon_));
+        break;
     case SIM_COMPILED:
         simCon_ =
             new CompiledSimController(
@@ -692,6 +794,21 @@ SimulatorFrontend::initializeSimulation() {
         
     delete stopPointManager_;
     stopPointManager_ = new StopPointManager(*simCon_, eventHandler());
+
+    if (!decompressorStalls_.empty() && !simulatesDecompressorStalls()) {
+        outputStream()
+            << "Warning! The decompressor stalls are ignored. They are "
+            << "simulated only by the interpretive simulation engine."
+            << std::endl;
+    }
+
+    totalRunTime_ = 0.0;
+    totalRunCycleCount_ = 0;
+    totalHostInstructions_ = 0;
+    hostCountedCycles_ = 0;
+    decompressorStallCycles_ = 0;
+    initializationTime_ = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - initStart).count();
 }
 
 /**
@@ -921,25 +1038,90 @@ SimulatorFrontend::state(std::string searchString) {
         std::string(searchString) + "'.");
 }
 
+/**
+ * Opens a counter of the instructions the calling thread executes on the
+ * host.
+ *
+ * @return File descriptor of the counter, -1 if counting is not supported.
+ */
+static int
+openHostInstructionCounter() {
+#ifdef __linux__
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(
+        syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+    return -1;
+#endif
+}
+
+/**
+ * Reads the host instruction counter.
+ *
+ * @param counter File descriptor of the counter.
+ * @return The instruction count, -1 if it could not be read.
+ */
+static long long
+readHostInstructionCounter(int counter) {
+#ifdef __linux__
+    uint64_t value = 0;
+    if (counter != -1 &&
+        read(counter, &value, sizeof(value)) == sizeof(value)) {
+        return static_cast<long long>(value);
+    }
+#endif
+    return -1;
+}
+
 /**
  * Starts the wall-clock timer.
+ *
+ * Also starts counting the host instructions if it is enabled.
  */
 void
 SimulatorFrontend::startTimer() {
     startCycleCount_ = cycleCount();
-    startTime_ = time(NULL);
+    startHostInstructions_ = -1;
+    if (hostInstructionCounting_) {
+        if (hostInstructionCounter_ == -1) {
+            hostInstructionCounter_ = openHostInstructionCounter();
+        }
+        startHostInstructions_ =
+            readHostInstructionCounter(hostInstructionCounter_);
+    }
+    startTime_ = std::chrono::steady_clock::now();
 }
 
 /**
- * Saves the value of the wall-clock timer initialized with startTimer() to lastRunTime_ and
- * the count of simulated cycles after startTimer() to lastRunCycleCount_.
+ * Saves the value of the wall-clock timer initialized with startTimer() to
+ * lastRunTime_ and the count of simulated cycles after startTimer() to
+ * lastRunCycleCount_.
+ *
+ * The values are also added to the totals of the simulation.
  */
 void
 SimulatorFrontend::stopTimer() {
-    std::time_t now = time(NULL);
-    lastRunTime_ = now - startTime_;
+    lastRunTime_ = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - startTime_).count();
     CycleCount cycles = cycleCount();
     lastRunCycleCount_ = cycles - startCycleCount_;
+
+    totalRunTime_ += lastRunTime_;
+    totalRunCycleCount_ += lastRunCycleCount_;
+    if (startHostInstructions_ != -1) {
+        long long instructions =
+            readHostInstructionCounter(hostInstructionCounter_);
+        if (instructions != -1) {
+            totalHostInstructions_ += instructions - startHostInstructions_;
+            hostCountedCycles_ += lastRunCycleCount_;
+        }
+    }
 }
 
 /**
@@ -1034,7 +1216,9 @@ void
 SimulatorFrontend::step(double count) {
     assert(simCon_ != NULL);
 
+    startTimer();
     simCon_->step(count);
+    stopTimer();
     // invalidate utilization statistics (they are not fresh anymore)
     SequenceTools::deleteAllItems(utilizationStats_);
 }
@@ -1524,6 +1708,18 @@ SimulatorFrontend::initializeTracing() {
             }
         }
     }
+
+    if (activityCounting_ && !rfAccessTracing_ && !isCompiledSimulation()) {
+        // concurrent RF accesses are needed in energy estimation also
+        // when no trace database is written
+        SimulationController* simCon =
+            dynamic_cast<SimulationController*>(simCon_);
+        rfAccessTrackers_.resize(1, NULL);
+        if (simCon != NULL && rfAccessTrackers_[0] == NULL) {
+            rfAccessTrackers_[0] = 
+                new RFAccessTracker(*this, simCon->instructionMemory(0));
+        }
+    }
     setupCallHistoryTracking();
 }
 
@@ -1541,8 +1737,10 @@ SimulatorFrontend::finishSimulation() {
         return;
 
     SequenceTools::deleteAllItems(executionTrackers_);
-    if (traceDBs_.size() == 0)
+    if (traceDBs_.size() == 0) {
+        SequenceTools::deleteAllItems(rfAccessTrackers_);
         return;
+    }
 
     for (int core = 0; core < 1; ++core) {
             // flush the concurrent RF access trace data
@@ -1747,6 +1945,7 @@ SimulatorFrontend::initializeMemorySystem() {
                     break;
                 case SIM_REMOTE:
                 case SIM_CUSTOM:
+                case SIM_LOOPBACK:
                     mem = MemorySystem::MemoryPtr(
                         new RemoteMemory( space, machine.isLittleEndian()));
                     
@@ -1848,6 +2047,16 @@ SimulatorFrontend::utilizationDataSaving() const {
     return saveUtilizationData_;
 }
 
+/**
+ * Returns true in case collecting of the component activity is enabled.
+ *
+ * @return True in case activity counting is enabled.
+ */
+bool
+SimulatorFrontend::activityCounting() const {
+    return activityCounting_;
+}
+
 /**
  * Returns true if the compiled simulation uses static compilation
  * 
@@ -1885,6 +2094,7 @@ SimulatorFrontend::setCompiledSimulation(bool value) {
     // remote target.
     if (currentBackend_ == SIM_REMOTE) return;
     if (currentBackend_ == SIM_CUSTOM) return;
+    if (currentBackend_ == SIM_LOOPBACK) return;
     if (value)
         currentBackend_ = SIM_COMPILED;
     else 
@@ -2009,6 +2219,20 @@ SimulatorFrontend::setUtilizationDataSaving(bool value) {
     saveUtilizationData_ = value;
 }
 
+/**
+ * Sets the collecting of the component activity on or off.
+ *
+ * When enabled, the concurrent register file accesses are tracked in the
+ * interpretive simulation without writing a trace database. The counts
+ * can be fetched with activityCounters() for energy estimation.
+ *
+ * @param value Is activity counting on or off.
+ */
+void
+SimulatorFrontend::setActivityCounting(bool value) {
+    activityCounting_ = value;
+}
+
 /**
  * Sets the FU resource conflict detection on or off.
  *
@@ -2249,6 +2473,86 @@ SimulatorFrontend::lastTraceDB(int core) {
     return last;
 }
 
+/**
+ * Returns the activity of the machine components in the simulation so far.
+ *
+ * The bus, socket and operation counts are taken from the utilization
+ * statistics and the concurrent register file accesses from the RF access
+ * tracker, if one is active. The counts are indexed by the components of
+ * the loaded machine. Should not be called in case simulation is not
+ * initialized.
+ *
+ * @param core The core of which activity to return, -1 for the selected.
+ * @return The activity counters. Becomes property of the client.
+ */
+SimulationActivityCounters*
+SimulatorFrontend::activityCounters(int core) {
+    if (core == -1) 
+        core = selectedCore();
+
+    SimulationActivityCounters* counters = new SimulationActivityCounters();
+    counters->setSimulatedCycleCount(cycleCount());
+
+    const UtilizationStats& stats = utilizationStatistics(core);
+    const TTAMachine::Machine::FunctionUnitNavigator& fuNav = 
+        machine().functionUnitNavigator();
+    for (int i = 0; i <= fuNav.count(); ++i) {
+        TTAMachine::FunctionUnit* fu = NULL;
+        if (i < fuNav.count())
+            fu = fuNav.item(i);
+        else
+            fu = machine().controlUnit();
+        if (fu == NULL || stats.triggerCount(fu->name()) == 0)
+            continue;
+
+        for (int j = 0; j < fu->operationCount(); ++j) {
+            const std::string operationUpper = 
+                StringTools::stringToUpper(fu->operation(j)->name());
+            const ClockCycleCount executions = 
+                stats.operationExecutions(fu->name(), operationUpper);
+            if (executions == 0) 
+                continue;
+
+            counters->addFunctionUnitOperationTriggerCount(
+                *fu, operationUpper, executions);
+        }
+    }
+
+    const TTAMachine::Machine::SocketNavigator& socketNav = 
+        machine().socketNavigator();
+    for (int i = 0; i < socketNav.count(); ++i) {
+        TTAMachine::Socket* socket = socketNav.item(i);
+        counters->addSocketWriteCount(
+            *socket, stats.socketWrites(socket->name()));
+    }
+
+    const TTAMachine::Machine::BusNavigator& busNav = 
+        machine().busNavigator();
+    for (int i = 0; i < busNav.count(); ++i) {
+        TTAMachine::Bus* bus = busNav.item(i);
+        counters->addBusWriteCount(*bus, stats.busWrites(bus->name()));
+    }
+
+    if (static_cast<int>(rfAccessTrackers_.size()) > core &&
+        rfAccessTrackers_.at(core) != NULL) {
+        const TTAMachine::Machine::RegisterFileNavigator& rfNav = 
+            machine().registerFileNavigator();
+        const RFAccessTracker::ConcurrentRFAccessIndex& accesses =
+            rfAccessTrackers_.at(core)->accessDataBase();
+        for (RFAccessTracker::ConcurrentRFAccessIndex::const_iterator i = 
+                 accesses.begin(); i != accesses.end(); ++i) {
+            const RFAccessTracker::ConcurrentRFAccess& access = (*i).first;
+            const std::string& rfName = access.get<0>();
+            if (!rfNav.hasItem(rfName))
+                continue;
+            counters->addConcurrentRegisterFileAccessCount(
+                *rfNav.item(rfName), access.get<2>(), access.get<1>(),
+                (*i).second);
+        }
+    }
+    return counters;
+}
+
 /**
  * Returns the instance of SimulationEventHandler.
  *
@@ -2290,6 +2594,229 @@ SimulatorFrontend::lastRunTime() const {
     return lastRunTime_;
 }
 
+/**
+ * Returns the wall clock time of loading the current machine in seconds.
+ */
+double
+SimulatorFrontend::machineLoadTime() const {
+    return machineLoadTime_;
+}
+
+/**
+ * Returns the wall clock time of loading the current program in seconds.
+ *
+ * The time includes the initialization of the simulation engine.
+ */
+double
+SimulatorFrontend::programLoadTime() const {
+    return programLoadTime_;
+}
+
+/**
+ * Returns the wall clock time of the last initialization of the simulation
+ * engine in seconds.
+ *
+ * For the statically compiled simulation this includes the compilation of
+ * the simulation code.
+ */
+double
+SimulatorFrontend::initializationTime() const {
+    return initializationTime_;
+}
+
+/**
+ * Returns the total wall clock time of the simulation phases since the
+ * simulation was initialized, in seconds.
+ */
+double
+SimulatorFrontend::totalRunTime() const {
+    return totalRunTime_;
+}
+
+/**
+ * Returns the count of cycles simulated in the simulation phases since the
+ * simulation was initialized.
+ */
+ClockCycleCount
+SimulatorFrontend::totalRunCycleCount() const {
+    return totalRunCycleCount_;
+}
+
+/**
+ * Returns the simulation speed in simulated cycles per host second.
+ *
+ * @return The speed over all simulation phases since the initialization,
+ *         0 if nothing has been simulated.
+ */
+double
+SimulatorFrontend::simulatedCyclesPerSecond() const {
+    if (totalRunTime_ <= 0.0) {
+        return 0.0;
+    }
+    return static_cast<double>(totalRunCycleCount_) / totalRunTime_;
+}
+
+/**
+ * Enables or disables counting the host instructions executed by the
+ * simulation.
+ *
+ * Counting uses the hardware performance counters of the host and is not
+ * available on all systems.
+ *
+ * @param value True to count the host instructions.
+ */
+void
+SimulatorFrontend::setHostInstructionCounting(bool value) {
+    hostInstructionCounting_ = value;
+}
+
+/**
+ * Returns true if the host instructions of the simulation are counted.
+ */
+bool
+SimulatorFrontend::hostInstructionCounting() const {
+    return hostInstructionCounting_;
+}
+
+/**
+ * Returns the average count of host instructions per simulated cycle.
+ *
+ * @return The ratio, -1 if the instructions were not counted.
+ */
+double
+SimulatorFrontend::hostInstructionsPerCycle() const {
+    if (hostCountedCycles_ == 0) {
+        return -1.0;
+    }
+    return static_cast<double>(totalHostInstructions_) /
+        static_cast<double>(hostCountedCycles_);
+}
+
+/**
+ * Returns the peak resident memory usage of the simulator process in KiB.
+ */
+long
+SimulatorFrontend::peakMemoryUsage() const {
+    return PhaseTimes::peakRSS();
+}
+
+/**
+ * Returns a short name of the simulation engine in use.
+ */
+std::string
+SimulatorFrontend::engineName() const {
+    switch (currentBackend_) {
+    case SIM_COMPILED:
+        return staticCompilation_ ? "compiled_static" : "compiled_dynamic";
+    case SIM_OTA:
+        return "ota";
+    case SIM_REMOTE:
+        return "remote";
+    case SIM_CUSTOM:
+        return "custom";
+    case SIM_LOOPBACK:
+        return "loopback";
+    case SIM_NORMAL:
+    default:
+        return "interpretive";
+    }
+}
+
+/**
+ * Writes the simulation performance counters as a JSON object.
+ *
+ * The host instruction values are null if they were not counted.
+ *
+ * @param stream The stream to write to.
+ */
+void
+SimulatorFrontend::writePerformanceCounters(std::ostream& stream) const {
+    std::ios::fmtflags flags = stream.flags();
+    stream << std::fixed << std::setprecision(6)
+           << "{" << std::endl
+           << "  \"engine\": \"" << engineName() << "\"," << std::endl
+           << "  \"machine_load_seconds\": " << machineLoadTime_ << ","
+           << std::endl
+           << "  \"program_load_seconds\": " << programLoadTime_ << ","
+           << std::endl
+           << "  \"initialization_seconds\": " << initializationTime_ << ","
+           << std::endl
+           << "  \"run_seconds\": " << totalRunTime_ << "," << std::endl
+           << "  \"simulated_cycles\": " << totalRunCycleCount_ << ","
+           << std::endl
+           << "  \"cycles_per_second\": " << simulatedCyclesPerSecond()
+           << "," << std::endl;
+    if (hostCountedCycles_ > 0) {
+        stream << "  \"host_instructions\": " << totalHostInstructions_
+               << "," << std::endl
+               << "  \"host_instructions_per_cycle\": "
+               << hostInstructionsPerCycle() << "," << std::endl;
+    } else {
+        stream << "  \"host_instructions\": null," << std::endl
+               << "  \"host_instructions_per_cycle\": null," << std::endl;
+    }
+    stream << "  \"peak_rss_kb\": " << peakMemoryUsage() << std::endl
+           << "}" << std::endl;
+    stream.flags(flags);
+}
+
+/**
+ * Writes the execution counts of the simulated program as an execution
+ * profile.
+ *
+ * The counts are keyed with the procedure names and, for programs compiled
+ * with debug information, with the source code lines of the moves so the
+ * compiler can use the profile when recompiling the program.
+ *
+ * @param fileName Name of the profile file.
+ * @exception IOException If the profile cannot be written.
+ */
+void
+SimulatorFrontend::writeExecutionProfile(const std::string& fileName) {
+    if (simCon_ == NULL || currentProgram_ == NULL) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "No simulated program to write the execution profile of.");
+    }
+
+    const CompiledSimulation* compiledSim = NULL;
+    const InstructionMemory* memory = NULL;
+    if (isCompiledSimulation()) {
+        compiledSim = dynamic_cast<CompiledSimController&>(
+            *simCon_).compiledSimulation().get();
+    } else {
+        SimulationController* simCon =
+            dynamic_cast<SimulationController*>(simCon_);
+        if (simCon == NULL) {
+            throw IOException(
+                __FILE__, __LINE__, __func__,
+                "The " + engineName() + " simulation engine does not "
+                "count the executed instructions.");
+        }
+        memory = &simCon->instructionMemory();
+    }
+
+    ExecutionProfile profile;
+    // the compiled simulator indexes the moves in program order
+    int moveNumber = 0;
+    for (int p = 0; p < currentProgram_->procedureCount(); ++p) {
+        const TTAProgram::Procedure& procedure =
+            currentProgram_->procedure(p);
+        for (int i = 0; i < procedure.instructionCount(); ++i) {
+            const Instruction& instruction = procedure.instructionAtIndex(i);
+            InstructionAddress address = instruction.address().location();
+            for (int m = 0; m < instruction.moveCount(); ++m, ++moveNumber) {
+                ClockCycleCount count = compiledSim != NULL ?
+                    compiledSim->moveExecutionCount(moveNumber, address) :
+                    memory->instructionAtConst(address).moveExecutionCount(m);
+                profile.addMoveCount(
+                    instruction.move(m), procedure.name(), count);
+            }
+        }
+    }
+    profile.writeToFile(fileName);
+}
+
 /**
  * This method is used to report a runtime error detected in 
  * the simulated program.
@@ -2389,6 +2916,94 @@ SimulatorFrontend::setupCallHistoryTracking() {
     }    
 }
 
+/**
+ * Loads the instruction decompressor stall cycles of the program.
+ *
+ * The file lists an instruction address and the number of cycles the
+ * decompressor locks the core when fetching the instruction on each
+ * line. Lines starting with '#' are comments. Such files are written by
+ * code compressors that model a multicycle decompressor. The stalls are
+ * modeled only by the interpretive simulation engine.
+ *
+ * The stalls apply to the loaded program. If no program is loaded, they
+ * apply to the next program loaded. Loading another program after that
+ * removes them.
+ *
+ * @param fileName The file to load, empty string to remove the stalls.
+ * @exception IOException If the file cannot be read.
+ * @exception InvalidData If the file is malformed.
+ */
+void
+SimulatorFrontend::loadDecompressorStalls(const std::string& fileName) {
+    std::vector<unsigned int> stalls;
+    if (fileName == "") {
+        decompressorStalls_.swap(stalls);
+        decompressorStallsBound_ = false;
+        return;
+    }
+
+    std::ifstream stallFile(fileName.c_str());
+    if (!stallFile.is_open()) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Cannot open the decompressor stall file " + fileName);
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(stallFile, line)) {
+        lineNumber++;
+        line = StringTools::trim(line);
+        if (line == "" || line.at(0) == '#') {
+            continue;
+        }
+        std::istringstream fields(line);
+        unsigned long address = 0;
+        unsigned int cycles = 0;
+        if (!(fields >> address >> cycles)) {
+            throw InvalidData(
+                __FILE__, __LINE__, __func__,
+                fileName + ":" + Conversion::toString(lineNumber) +
+                ": expected an instruction address and stall cycles.");
+        }
+        if (address >= stalls.size()) {
+            stalls.resize(address + 1, 0);
+        }
+        stalls.at(address) = cycles;
+    }
+    decompressorStalls_.swap(stalls);
+    decompressorStallsBound_ = currentProgram_ != NULL;
+}
+
+/**
+ * Tells whether the current simulation engine adds the decompressor
+ * stalls to the cycle count.
+ *
+ * @return True for the interpretive simulation engine.
+ */
+bool
+SimulatorFrontend::simulatesDecompressorStalls() const {
+    return currentBackend_ == SIM_NORMAL;
+}
+
+/**
+ * Removes the decompressor stalls of the previous program.
+ *
+ * Called when a program is loaded. The stalls are per instruction
+ * address, so the stalls loaded for another program do not apply to it.
+ * Stalls loaded while no program was loaded apply to the new program.
+ */
+void
+SimulatorFrontend::resetDecompressorStalls() {
+    if (decompressorStallsBound_) {
+        decompressorStalls_.clear();
+        outputStream()
+            << "Decompressor stalls of the previous program removed."
+            << std::endl;
+    }
+    decompressorStallsBound_ = !decompressorStalls_.empty();
+}
+
 const CallPathTracker&
 SimulatorFrontend::callPathTracker(int core) const { 
     assert(callPathTrackers_.size() > 0);
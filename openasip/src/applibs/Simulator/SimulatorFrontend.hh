@@ -38,6 +38,7 @@
 #include <iostream>
 #include <ostream>
 #include <ctime>
+#include <chrono>
 
 #include <set>
 
@@ -54,6 +55,7 @@ class MachineState;
 class POMDisassembler;
 class ExecutionTracker;
 class ExecutionTrace;
+class SimulationActivityCounters;
 class StopPointManager;
 class MemorySystem;
 class UtilizationStats;
@@ -62,6 +64,7 @@ class BusTracker;
 class ExecutableInstruction;
 class ProcedureTransferTracker;
 class SimulationEventHandler;
+class Memory;
 namespace TPEF {
     class Binary;
 }
@@ -69,6 +72,7 @@ namespace TPEF {
 namespace TTAProgram {
     class Program;
     class Procedure;
+    class DataDefinition;
 }
 
 namespace TTAMachine {
@@ -102,8 +106,10 @@ public:
         SIM_COMPILED, ///< Compiled, faster simulation.
         SIM_REMOTE,   ///< Remote debugger, not a simulator at all
         SIM_CUSTOM,   ///< User-implemented remote HW debugger
-        SIM_OTA       ///< Simulation with operation-triggered implicit data
+        SIM_OTA,      ///< Simulation with operation-triggered implicit data
                       ///  transports.
+        SIM_LOOPBACK  ///< Remote debugger interface looped back to the
+                      ///  interpretive simulator.
     } SimulationType;
 
     SimulatorFrontend(SimulationType backend = SIM_NORMAL);
@@ -163,6 +169,7 @@ public:
     bool procedureTransferTracing() const;
     bool profileDataSaving() const;
     bool utilizationDataSaving() const;
+    bool activityCounting() const;
     bool staticCompilation() const;
 
     const RFAccessTracker& rfAccessTracker() const;
@@ -174,6 +181,7 @@ public:
     void setProcedureTransferTracing(bool value);
     void setProfileDataSaving(bool value);
     void setUtilizationDataSaving(bool value);
+    void setActivityCounting(bool value);
     void forceTraceDBFileName(const std::string& fileName) {
         forcedTraceDBFileName_ = fileName;
     }
@@ -226,6 +234,7 @@ public:
     bool simulationTimeStatistics() const;
 
     ExecutionTrace* lastTraceDB(int core=-1);
+    SimulationActivityCounters* activityCounters(int core=-1);
  
     void setMemoryAccessTracking(bool value);
     bool memoryAccessTracking() const;
@@ -243,6 +252,20 @@ public:
 
     double lastRunTime() const;
 
+    double machineLoadTime() const;
+    double programLoadTime() const;
+    double initializationTime() const;
+    double totalRunTime() const;
+    ClockCycleCount totalRunCycleCount() const;
+    double simulatedCyclesPerSecond() const;
+    void setHostInstructionCounting(bool value);
+    bool hostInstructionCounting() const;
+    double hostInstructionsPerCycle() const;
+    long peakMemoryUsage() const;
+    std::string engineName() const;
+    void writePerformanceCounters(std::ostream& stream) const;
+    void writeExecutionProfile(const std::string& fileName);
+
     void reportSimulatedProgramError(
         RuntimeErrorSeverity severity, const std::string& description);
     std::string programErrorReport(
@@ -268,6 +291,21 @@ public:
     const CallPathTracker& callPathTracker(int core=-1) const;
     void initializeDataMemories(const TTAMachine::AddressSpace* onlyOne=NULL);
 
+    void loadDecompressorStalls(const std::string& fileName);
+    bool simulatesDecompressorStalls() const;
+    /// Returns the decompressor stall cycles indexed by instruction address.
+    const std::vector<unsigned int>& decompressorStalls() const {
+        return decompressorStalls_;
+    }
+    /// Records cycles the core was locked by the instruction decompressor.
+    void addDecompressorStallCycles(ClockCycleCount cycles) {
+        decompressorStallCycles_ += cycles;
+    }
+    /// Returns the cycles the core was locked by the decompressor.
+    ClockCycleCount decompressorStallCycles() const {
+        return decompressorStallCycles_;
+    }
+
 protected:
     virtual void initializeSimulation();
 
@@ -275,12 +313,16 @@ protected:
     void initializeDisassembler() const;
     void initializeMemorySystem();
     void setControllerForMemories(RemoteController* con);
+    void writeDataDefinition(
+        Memory& memory, ULongWord address,
+        const TTAProgram::DataDefinition& def);
     bool hasStopReason(StopReason reason) const;
 
     void startTimer();
     void stopTimer();
 
     void setupCallHistoryTracking();
+    void resetDecompressorStalls();
 
     /// A type for storing a program error description.
     typedef std::pair<RuntimeErrorSeverity, std::string>
@@ -321,6 +363,9 @@ protected:
     bool saveProfileData_;
     /// Is saving of utilization data to TraceDB enabled.
     bool saveUtilizationData_;
+    /// Is collecting of the component activity for energy estimation
+    /// enabled.
+    bool activityCounting_;
     /// The database to use for execution trace data.
     std::vector<ExecutionTrace*> traceDBs_;
     /// Whether traceDB at index is owned by simulator
@@ -374,10 +419,31 @@ protected:
     /// seconds.
     double lastRunTime_;
     /// The time of the last simulation start. Used to compute simulation speed.
-    std::time_t startTime_;
+    std::chrono::steady_clock::time_point startTime_;
     /// The cycle count when the latest simulation was started. Used to 
     /// compute simulation speed.
     CycleCount startCycleCount_;
+    /// Wall clock time of loading the current machine in seconds.
+    double machineLoadTime_;
+    /// Wall clock time of loading the current program in seconds, including
+    /// the initialization of the simulation.
+    double programLoadTime_;
+    /// Wall clock time of the last simulation engine initialization.
+    double initializationTime_;
+    /// Wall clock time of all simulation phases since the initialization.
+    double totalRunTime_;
+    /// Cycles simulated in all simulation phases since the initialization.
+    ClockCycleCount totalRunCycleCount_;
+    /// True if the host instructions of the simulation phases are counted.
+    bool hostInstructionCounting_;
+    /// The host instruction counter, -1 if it is not open.
+    int hostInstructionCounter_;
+    /// Counter value at the start of the current phase, -1 if not counted.
+    long long startHostInstructions_;
+    /// Host instructions executed in the counted simulation phases.
+    long long totalHostInstructions_;
+    /// Cycles simulated in the phases with counted host instructions.
+    ClockCycleCount hostCountedCycles_;
     /// Simulation timeout in seconds
     unsigned int simulationTimeout_;
     /// Runtime error reports.
@@ -395,6 +461,14 @@ protected:
     /// The simulation models of the memories in the currently loaded machine
     /// for each core.
     std::vector<MemorySystem*> memorySystems_;
+    /// Decompressor stall cycles of the instructions, indexed by address.
+    std::vector<unsigned int> decompressorStalls_;
+    /// True if the decompressor stalls were loaded for the current program
+    /// and are removed when another program is loaded.
+    bool decompressorStallsBound_;
+    /// Cycles the core has been locked by the decompressor in the
+    /// current simulation.
+    ClockCycleCount decompressorStallCycles_;
     /// Set to true in case the memories should be set to zero at reset.
     bool zeroFillMemoriesOnReset_;
     /// Set to true in case should build a detailed model which simulates
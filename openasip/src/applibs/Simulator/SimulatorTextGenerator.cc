@@ -279,6 +279,16 @@ SimulatorTextGenerator::SimulatorTextGenerator() {
         "Prints the names of all of the immediate units in the loaded "
         "machine.\n\n"
 
+        "\tperf [counter]\n\n"
+
+        "Prints the simulator performance counters: load and initialization "
+        "times, simulated cycles per second, host instructions per simulated "
+        "cycle and peak memory usage. If a counter name is given, "
+        "returns only its value. Counters: cycles_per_second, "
+        "host_instructions_per_cycle, simulated_cycles, run_seconds, "
+        "initialization_seconds, machine_load_seconds, "
+        "program_load_seconds, peak_rss_kb.\n\n"
+
         "\tports funit [portname]\n\n"
 
         "Prints values of all ports in the given function unit. If "
@@ -302,6 +312,12 @@ SimulatorTextGenerator::SimulatorTextGenerator() {
 
         "Displays processor utilization data.\n\n"
 
+        "\tproc stalls\n\n"
+
+        "Displays the cycles the core was locked by the instruction "
+        "decompressor, as set with the decompressor_stalls setting. These "
+        "cycles are included in the total execution cycle count.\n\n"
+
         "\tprogram\n\n"
 
         "Displays information about the status of the program: whether it "
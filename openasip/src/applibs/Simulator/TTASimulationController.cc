@@ -220,20 +220,13 @@ TTASimulationController::findProgramExitPoints(
     // find the entry procedure
     Address entryAddr = program.entryAddress();
     Procedure* entryProc = NULL;
-    for(int i = 0; i < program.procedureCount(); i++) {
-        Procedure& currProc = program.procedure(i);
-
-        if (currProc.startAddress().location() <= entryAddr.location() &&
-            currProc.endAddress().location() > entryAddr.location()) {
-            entryProc = &currProc;
-            break;
-        }
-    }
-
-    if (entryProc == NULL)
+    try {
+        entryProc = &program.procedureAt(entryAddr.location());
+    } catch (const KeyNotFound&) {
         throw IllegalProgram(
             __FILE__, __LINE__, __func__,
             "The entry point of the program does not point to a procedure.");
+    }
 
     // If __exit procedure exists, the first instruction in it is set
     // as an exit point.
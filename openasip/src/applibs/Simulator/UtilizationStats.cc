@@ -30,7 +30,6 @@
  * @note rating: red
  */
 #include "UtilizationStats.hh"
-#include "MapTools.hh"
 #include "Instruction.hh"
 #include "Move.hh"
 #include "ExecutableInstruction.hh"
@@ -44,14 +43,21 @@
 #include "FUPort.hh"
 #include "Guard.hh"
 #include "MoveGuard.hh"
-#include "hash_set.hh"
+#include "TerminalFUPort.hh"
+#include "Machine.hh"
+#include "ControlUnit.hh"
+#include "HWOperation.hh"
+#include "BaseRegisterFile.hh"
+#include "RegisterFile.hh"
+#include "ImmediateUnit.hh"
 #include "Application.hh"
 #include "TCEString.hh"
 
 /**
  * Constructor.
  */
-UtilizationStats::UtilizationStats() : highestRegister_(-1) {
+UtilizationStats::UtilizationStats() :
+    machine_(NULL), currentStamp_(0), highestRegister_(-1) {
 }
 
 /**
@@ -78,54 +84,85 @@ UtilizationStats::calculateForInstruction(
     // used to make sure output socket utilizations are computed only
     // maximum once per instruction, even though the socket is read by
     // multiple buses
-    hash_set<const char*> alreadyRegisteredOutputSockets;
+    ++currentStamp_;
 
     for (int i = 0; i < instructionData.moveCount(); ++i) {
         const TTAProgram::Move& move = instructionData.move(i);
         const ClockCycleCount execCount = 
             executionCounts.moveExecutionCount(i);
 
+        if (machine_ == NULL && move.bus().machine() != NULL) {
+            indexMachine(*move.bus().machine());
+        }
+
         // it depends on GCU implementation whether immediate jumps are
         // redirected through bus and sockets or not, let's assume they 
         // are, as they are in current CU implementations, according to Teemu
-        buses_[move.bus().name()] += execCount;
+        int busIndex = buses_.find(&move.bus());
+        if (busIndex < 0) {
+            busIndex = buses_.add(&move.bus(), move.bus().name(), -1);
+        }
+        buses_.counts[busIndex] += execCount;
 
         // socket utilizations
+        const TTAMachine::Socket& destinationSocket =
+            move.destinationSocket();
         if (!move.source().isImmediate() && 
-            move.sourceSocket().name() != move.destinationSocket().name() &&
-            alreadyRegisteredOutputSockets.find(
-                move.sourceSocket().name().c_str()) ==
-            alreadyRegisteredOutputSockets.end()) {
-
-            sockets_[move.sourceSocket().name()] += execCount;
-            alreadyRegisteredOutputSockets.insert(
-                move.sourceSocket().name().c_str());
+            &move.sourceSocket() != &destinationSocket) {
+            const TTAMachine::Socket& sourceSocket = move.sourceSocket();
+            int socketIndex = sockets_.find(&sourceSocket);
+            if (socketIndex < 0) {
+                socketIndex = sockets_.add(
+                    &sourceSocket, sourceSocket.name(), -1);
+            }
+            if (socketReadStamps_.size() <= (size_t)socketIndex) {
+                socketReadStamps_.resize(socketIndex + 1, 0);
+            }
+            if (socketReadStamps_[socketIndex] != currentStamp_) {
+                sockets_.counts[socketIndex] += execCount;
+                socketReadStamps_[socketIndex] = currentStamp_;
+            }
         }
-        sockets_[move.destinationSocket().name()] += execCount;
+        int socketIndex = sockets_.find(&destinationSocket);
+        if (socketIndex < 0) {
+            socketIndex = sockets_.add(
+                &destinationSocket, destinationSocket.name(), -1);
+        }
+        sockets_.counts[socketIndex] += execCount;
 
         // operation utilizations
         if (move.destination().isFUPort() &&
             dynamic_cast<const TTAMachine::BaseFUPort&>(
                 move.destination().port()).isTriggering()) {
-            const std::string operationUpper =
-                StringTools::stringToUpper(
-                    move.destination().operation().name());
-            const std::string fuName =
-                move.destination().functionUnit().name();
-            fus_[fuName] += execCount;
-            operations_[operationUpper] += execCount;
-            fuOperations_[fuName][operationUpper] += execCount;
+            const int fu = fuIndex(move.destination().functionUnit());
+            fus_.counts[fu] += execCount;
+
+            const TTAProgram::TerminalFUPort* fuTerminal =
+                dynamic_cast<const TTAProgram::TerminalFUPort*>(
+                    &move.destination());
+            const void* operation = 
+                (fuTerminal != NULL && fuTerminal->hwOperation() != NULL) ?
+                static_cast<const void*>(fuTerminal->hwOperation()) :
+                static_cast<const void*>(&move.destination().operation());
+            int operationIndex = operations_.find(operation);
+            if (operationIndex < 0) {
+                operationIndex = operations_.add(
+                    operation,
+                    StringTools::stringToUpper(
+                        move.destination().operation().name()), fu);
+            }
+            operations_.counts[operationIndex] += execCount;
         }
 
         // register reads 
         if (move.source().isGPR()) {
-            const std::string rfName = move.source().registerFile().name();
+            const int rf = rfIndex(move.source().registerFile());
             const int regIndex = move.source().index();
             if (regIndex > highestRegister_) {
                 highestRegister_ = regIndex;
             }
-            rfAccesses_[rfName][regIndex].first = 
-                registerReads(rfName, regIndex) + execCount;
+            RegisterCounts::addTo(
+                registers_.reads[rf], regIndex, execCount);
         }
         
         // guarded moves
@@ -137,13 +174,13 @@ UtilizationStats::calculateForInstruction(
                     dynamic_cast<const TTAMachine::RegisterGuard&>(
                         move.guard().guard());
             
-                const std::string rfName = moveGuard.registerFile()->name();
+                const int rf = rfIndex(*moveGuard.registerFile());
                 const int regIndex = moveGuard.registerIndex();
                 if (regIndex > highestRegister_)
                     highestRegister_ = regIndex;
             
-                guardRfAccesses_[rfName][regIndex].first =
-                    guardRegisterReads(rfName, regIndex) + execCount;
+                RegisterCounts::addTo(
+                    registers_.guardReads[rf], regIndex, execCount);
             } else { // FU Port reads
                 if (dynamic_cast<const TTAMachine::PortGuard*>(
                         &move.guard().guard())) {
@@ -152,34 +189,139 @@ UtilizationStats::calculateForInstruction(
                         move.guard().guard());
                     
                     const TTAMachine::FUPort& port = *moveGuard.port();
-                    const std::string fuName = port.parentUnit()->name();
-                    guardFUAccesses_[fuName][port.name()] += execCount;
+                    int portIndex = guardPorts_.find(&port);
+                    if (portIndex < 0) {
+                        portIndex = guardPorts_.add(
+                            &port, port.name(),
+                            fuIndex(*port.parentUnit()));
+                    }
+                    guardPorts_.counts[portIndex] += execCount;
                 }
             }
         }
         
         // immediate register reads
         if (move.source().isImmediateRegister()) {
-            const std::string iuName = move.source().immediateUnit().name();
+            const int iu = rfIndex(move.source().immediateUnit());
             const int regIndex = move.source().index();
-            rfAccesses_[iuName][regIndex].first = 
-                registerReads(iuName, regIndex) + execCount;
+            RegisterCounts::addTo(
+                registers_.reads[iu], regIndex, execCount);
             if (regIndex > highestRegister_)
                 highestRegister_ = regIndex;
         } 
 
         // register writes
         if (move.destination().isGPR()) {
-            const std::string rfName = 
-                move.destination().registerFile().name();
+            const int rf = rfIndex(move.destination().registerFile());
             const int regIndex = move.destination().index();
             if (regIndex > highestRegister_) {
                 highestRegister_ = regIndex;
             }
-            rfAccesses_[rfName][regIndex].second =
-                registerWrites(rfName, regIndex) + execCount;
+            RegisterCounts::addTo(
+                registers_.writes[rf], regIndex, execCount);
+        }
+    }
+}
+
+/**
+ * Returns a new, empty calculator with the same component indices.
+ *
+ * SimulationStatistics uses this to calculate the statistics of separate
+ * instruction ranges in parallel.
+ *
+ * @return The new calculator, owned by the caller.
+ */
+SimulationStatisticsCalculator*
+UtilizationStats::createPartial() const {
+
+    UtilizationStats* partial = new UtilizationStats();
+    partial->machine_ = machine_;
+    partial->buses_ = buses_;
+    partial->sockets_ = sockets_;
+    partial->fus_ = fus_;
+    partial->operations_ = operations_;
+    partial->guardPorts_ = guardPorts_;
+    partial->registers_ = registers_;
+    partial->buses_.counts.assign(buses_.counts.size(), 0);
+    partial->sockets_.counts.assign(sockets_.counts.size(), 0);
+    partial->fus_.counts.assign(fus_.counts.size(), 0);
+    partial->operations_.counts.assign(operations_.counts.size(), 0);
+    partial->guardPorts_.counts.assign(guardPorts_.counts.size(), 0);
+    for (size_t i = 0; i < registers_.components.size(); ++i) {
+        partial->registers_.reads[i].assign(
+            registers_.reads[i].size(), 0);
+        partial->registers_.writes[i].assign(
+            registers_.writes[i].size(), 0);
+        partial->registers_.guardReads[i].assign(
+            registers_.guardReads[i].size(), 0);
+    }
+    return partial;
+}
+
+/**
+ * Adds the counts of a calculator created with createPartial() to this.
+ *
+ * Components that only the partial calculator has seen are added to the
+ * indices of this calculator.
+ *
+ * @param partial The calculator to merge.
+ */
+void
+UtilizationStats::mergePartial(
+    const SimulationStatisticsCalculator& partial) {
+
+    const UtilizationStats& other =
+        dynamic_cast<const UtilizationStats&>(partial);
+
+    if (machine_ == NULL) {
+        machine_ = other.machine_;
+    }
+
+    ComponentCounts* const mine[] = {
+        &buses_, &sockets_, &fus_, &operations_, &guardPorts_};
+    const ComponentCounts* const theirs[] = {
+        &other.buses_, &other.sockets_, &other.fus_, &other.operations_,
+        &other.guardPorts_};
+    for (size_t kind = 0; kind < sizeof(mine) / sizeof(mine[0]); ++kind) {
+        ComponentCounts& to = *mine[kind];
+        const ComponentCounts& from = *theirs[kind];
+        for (size_t i = 0; i < from.components.size(); ++i) {
+            int index = to.find(from.components[i]);
+            if (index < 0) {
+                // parents are FU indices, which are merged before
+                int parent = from.parents[i];
+                if (parent >= 0) {
+                    parent = fus_.find(other.fus_.components[parent]);
+                }
+                index = to.add(from.components[i], from.names[i], parent);
+            }
+            to.counts[index] += from.counts[i];
+        }
+    }
+
+    for (size_t i = 0; i < other.registers_.components.size(); ++i) {
+        int index = registers_.find(other.registers_.components[i]);
+        if (index < 0) {
+            index = registers_.add(
+                other.registers_.components[i], other.registers_.names[i],
+                0);
+        }
+        const std::vector<ClockCycleCount>* const from[] = {
+            &other.registers_.reads[i], &other.registers_.writes[i],
+            &other.registers_.guardReads[i]};
+        std::vector<ClockCycleCount>* const to[] = {
+            &registers_.reads[index], &registers_.writes[index],
+            &registers_.guardReads[index]};
+        for (int kind = 0; kind < 3; ++kind) {
+            for (size_t reg = 0; reg < from[kind]->size(); ++reg) {
+                RegisterCounts::addTo(*to[kind], reg, (*from[kind])[reg]);
+            }
         }
     }
+
+    if (other.highestRegister_ > highestRegister_) {
+        highestRegister_ = other.highestRegister_;
+    }
 }
 
 /**
@@ -190,10 +332,7 @@ UtilizationStats::calculateForInstruction(
  */
 ClockCycleCount 
 UtilizationStats::busWrites(const std::string& busName) const {
-    if (MapTools::containsKey(buses_, busName)) 
-        return MapTools::valueForKey<ClockCycleCount>(buses_, busName);
-    else 
-        return 0;
+    return countOf(buses_, busName);
 }
 
 /**
@@ -204,10 +343,7 @@ UtilizationStats::busWrites(const std::string& busName) const {
  */
 ClockCycleCount 
 UtilizationStats::socketWrites(const std::string& socketName) const {
-    if (MapTools::containsKey(sockets_, socketName)) 
-        return MapTools::valueForKey<ClockCycleCount>(sockets_, socketName);
-    else 
-        return 0;
+    return countOf(sockets_, socketName);
 }
 
 /**
@@ -218,10 +354,7 @@ UtilizationStats::socketWrites(const std::string& socketName) const {
  */
 ClockCycleCount 
 UtilizationStats::triggerCount(const std::string& fuName) const {
-    if (MapTools::containsKey(fus_, fuName)) 
-        return MapTools::valueForKey<ClockCycleCount>(fus_, fuName);
-    else 
-        return 0;
+    return countOf(fus_, fuName);
 }
 
 /**
@@ -233,11 +366,7 @@ UtilizationStats::triggerCount(const std::string& fuName) const {
 ClockCycleCount 
 UtilizationStats::operationExecutions(
     const std::string& operationName) const {    
-    if (MapTools::containsKey(operations_, operationName)) 
-        return MapTools::valueForKey<ClockCycleCount>(
-            operations_, operationName);
-    else 
-        return 0;
+    return countOf(operations_, operationName);
 }
 
 /**
@@ -250,13 +379,14 @@ UtilizationStats::operationExecutions(
 ClockCycleCount 
 UtilizationStats::operationExecutions(
     const std::string& fuName, const std::string& operationName) const {
-    try {
-        return MapTools::valueForKey<ClockCycleCount>(
-            MapTools::valueForKey<ComponentUtilizationIndex>(
-                fuOperations_, fuName), operationName);
-    } catch (const KeyNotFound&) {
-        return 0;
+    ClockCycleCount count = 0;
+    for (size_t i = 0; i < operations_.components.size(); ++i) {
+        if (operations_.names[i] == operationName &&
+            fus_.names[operations_.parents[i]] == fuName) {
+            count += operations_.counts[i];
+        }
     }
+    return count;
 }
 
 /**
@@ -270,15 +400,7 @@ ClockCycleCount
 UtilizationStats::registerReads(
     const std::string& rfName, 
     int registerIndex) const {
-    try {
-        return 
-            MapTools::valueForKey<
-            std::pair<ClockCycleCount, ClockCycleCount> >(
-                MapTools::valueForKey<RegisterUtilizationIndex>(
-                    rfAccesses_, rfName), registerIndex).first;
-    } catch (const KeyNotFound&) {
-        return 0;
-    }
+    return registerCount(registers_.reads, rfName, registerIndex);
 }
 
 /**
@@ -292,15 +414,7 @@ ClockCycleCount
 UtilizationStats::guardRegisterReads(
     const std::string& rfName, 
     int registerIndex) const {
-    try {
-        return 
-            MapTools::valueForKey<
-            std::pair<ClockCycleCount, ClockCycleCount> >(
-                MapTools::valueForKey<RegisterUtilizationIndex>(
-                    guardRfAccesses_, rfName), registerIndex).first;
-    } catch (const KeyNotFound&) {
-        return 0;
-    }
+    return registerCount(registers_.guardReads, rfName, registerIndex);
 }
 
 /**
@@ -314,15 +428,7 @@ ClockCycleCount
 UtilizationStats::registerWrites(
     const std::string& rfName, 
     int registerIndex) const {
-    try {
-        return 
-            MapTools::valueForKey<
-            std::pair<ClockCycleCount, ClockCycleCount> >(
-                MapTools::valueForKey<RegisterUtilizationIndex>(
-                    rfAccesses_, rfName), registerIndex).second;
-    } catch (const KeyNotFound&) {
-        return 0;
-    }
+    return registerCount(registers_.writes, rfName, registerIndex);
 }
 
 /**
@@ -337,13 +443,14 @@ UtilizationStats::FUGuardAccesses(
     const std::string& fuName,
     const std::string& fuPort) const {
         
-    try {
-        return MapTools::valueForKey<ClockCycleCount>(
-            MapTools::valueForKey<ComponentUtilizationIndex>(
-                guardFUAccesses_, fuName), fuPort);
-    } catch (const KeyNotFound&) {
-        return 0;
+    ClockCycleCount count = 0;
+    for (size_t i = 0; i < guardPorts_.components.size(); ++i) {
+        if (guardPorts_.names[i] == fuPort &&
+            fus_.names[guardPorts_.parents[i]] == fuName) {
+            count += guardPorts_.counts[i];
+        }
     }
+    return count;
 }
 
 /**
@@ -353,7 +460,15 @@ UtilizationStats::FUGuardAccesses(
  */
 UtilizationStats::FUOperationUtilizationIndex
 UtilizationStats::FUGuardAccesses() const {
-    return guardFUAccesses_;    
+    FUOperationUtilizationIndex accesses;
+    for (size_t i = 0; i < guardPorts_.components.size(); ++i) {
+        if (guardPorts_.counts[i] == 0) {
+            continue;
+        }
+        accesses[fus_.names[guardPorts_.parents[i]]][guardPorts_.names[i]]
+            += guardPorts_.counts[i];
+    }
+    return accesses;
 }
 
 /**
@@ -367,3 +482,209 @@ int
 UtilizationStats::highestUsedRegisterIndex() const {
     return highestRegister_;
 }
+
+/**
+ * Assigns the dense component indices from the machine navigators.
+ *
+ * @param machine The machine the program is scheduled for.
+ */
+void
+UtilizationStats::indexMachine(const TTAMachine::Machine& machine) {
+
+    machine_ = &machine;
+
+    const TTAMachine::Machine::BusNavigator busNav = machine.busNavigator();
+    for (int i = 0; i < busNav.count(); ++i) {
+        if (buses_.find(busNav.item(i)) < 0) {
+            buses_.add(busNav.item(i), busNav.item(i)->name(), -1);
+        }
+    }
+    const TTAMachine::Machine::SocketNavigator socketNav =
+        machine.socketNavigator();
+    for (int i = 0; i < socketNav.count(); ++i) {
+        if (sockets_.find(socketNav.item(i)) < 0) {
+            sockets_.add(socketNav.item(i), socketNav.item(i)->name(), -1);
+        }
+    }
+    socketReadStamps_.resize(sockets_.components.size(), 0);
+
+    const TTAMachine::Machine::FunctionUnitNavigator fuNav =
+        machine.functionUnitNavigator();
+    std::vector<const TTAMachine::FunctionUnit*> units;
+    for (int i = 0; i < fuNav.count(); ++i) {
+        units.push_back(fuNav.item(i));
+    }
+    if (machine.controlUnit() != NULL) {
+        units.push_back(machine.controlUnit());
+    }
+    for (size_t i = 0; i < units.size(); ++i) {
+        const TTAMachine::FunctionUnit& fu = *units[i];
+        const int fuIdx = fuIndex(fu);
+        for (int op = 0; op < fu.operationCount(); ++op) {
+            const TTAMachine::HWOperation* hwOp = fu.operation(op);
+            if (operations_.find(hwOp) < 0) {
+                operations_.add(
+                    hwOp, StringTools::stringToUpper(hwOp->name()), fuIdx);
+            }
+        }
+    }
+
+    const TTAMachine::Machine::RegisterFileNavigator rfNav =
+        machine.registerFileNavigator();
+    for (int i = 0; i < rfNav.count(); ++i) {
+        rfIndex(*rfNav.item(i));
+    }
+    const TTAMachine::Machine::ImmediateUnitNavigator iuNav =
+        machine.immediateUnitNavigator();
+    for (int i = 0; i < iuNav.count(); ++i) {
+        rfIndex(*iuNav.item(i));
+    }
+}
+
+/**
+ * Returns the dense index of the function unit, adding it if needed.
+ */
+int
+UtilizationStats::fuIndex(const TTAMachine::FunctionUnit& fu) {
+    int index = fus_.find(&fu);
+    if (index < 0) {
+        index = fus_.add(&fu, fu.name(), -1);
+    }
+    return index;
+}
+
+/**
+ * Returns the dense index of the register file or immediate unit, adding
+ * it if needed.
+ */
+int
+UtilizationStats::rfIndex(const TTAMachine::BaseRegisterFile& rf) {
+    int index = registers_.find(&rf);
+    if (index < 0) {
+        index = registers_.add(&rf, rf.name(), rf.numberOfRegisters());
+    }
+    return index;
+}
+
+/**
+ * Returns the sum of the counts of the register in register files with the
+ * given name.
+ */
+ClockCycleCount
+UtilizationStats::registerCount(
+    const std::vector<std::vector<ClockCycleCount> >& counts,
+    const std::string& rfName, int registerIndex) const {
+
+    ClockCycleCount count = 0;
+    for (size_t i = 0; i < registers_.components.size(); ++i) {
+        if (registers_.names[i] == rfName) {
+            count += RegisterCounts::countOf(counts[i], registerIndex);
+        }
+    }
+    return count;
+}
+
+/**
+ * Returns the sum of the counts of the components with the given name.
+ */
+ClockCycleCount
+UtilizationStats::countOf(
+    const ComponentCounts& components, const std::string& name) {
+
+    ClockCycleCount count = 0;
+    for (size_t i = 0; i < components.components.size(); ++i) {
+        if (components.names[i] == name) {
+            count += components.counts[i];
+        }
+    }
+    return count;
+}
+
+/**
+ * Returns the index of the component, or -1 if it has no index yet.
+ */
+int
+UtilizationStats::ComponentCounts::find(const void* component) const {
+    std::unordered_map<const void*, int>::const_iterator i =
+        indices.find(component);
+    return i == indices.end() ? -1 : i->second;
+}
+
+/**
+ * Assigns the next free index to the component.
+ *
+ * @param component The component.
+ * @param name Name the component is reported with.
+ * @param parent Index of the parent function unit, -1 if none.
+ * @return The index of the component.
+ */
+int
+UtilizationStats::ComponentCounts::add(
+    const void* component, const std::string& name, int parent) {
+    const int index = components.size();
+    indices[component] = index;
+    components.push_back(component);
+    names.push_back(name);
+    parents.push_back(parent);
+    counts.push_back(0);
+    return index;
+}
+
+/**
+ * Returns the index of the register file, or -1 if it has no index yet.
+ */
+int
+UtilizationStats::RegisterCounts::find(const void* component) const {
+    std::unordered_map<const void*, int>::const_iterator i =
+        indices.find(component);
+    return i == indices.end() ? -1 : i->second;
+}
+
+/**
+ * Assigns the next free index to the register file.
+ *
+ * @param component The register file or immediate unit.
+ * @param name Name the register file is reported with.
+ * @param size Number of registers in the register file.
+ * @return The index of the register file.
+ */
+int
+UtilizationStats::RegisterCounts::add(
+    const void* component, const std::string& name, int size) {
+    const int index = components.size();
+    indices[component] = index;
+    components.push_back(component);
+    names.push_back(name);
+    reads.push_back(std::vector<ClockCycleCount>(size, 0));
+    writes.push_back(std::vector<ClockCycleCount>(size, 0));
+    guardReads.push_back(std::vector<ClockCycleCount>(size, 0));
+    return index;
+}
+
+/**
+ * Adds to the count of the register, growing the vector if needed.
+ */
+void
+UtilizationStats::RegisterCounts::addTo(
+    std::vector<ClockCycleCount>& counts, int registerIndex,
+    ClockCycleCount count) {
+    if (registerIndex < 0) {
+        return;
+    }
+    if (counts.size() <= (size_t)registerIndex) {
+        counts.resize(registerIndex + 1, 0);
+    }
+    counts[registerIndex] += count;
+}
+
+/**
+ * Returns the count of the register, 0 if it has not been accessed.
+ */
+ClockCycleCount
+UtilizationStats::RegisterCounts::countOf(
+    const std::vector<ClockCycleCount>& counts, int registerIndex) {
+    if (registerIndex < 0 || counts.size() <= (size_t)registerIndex) {
+        return 0;
+    }
+    return counts[registerIndex];
+}
@@ -35,17 +35,26 @@
 
 #include <map>
 #include <string>
+#include <vector>
+#include <unordered_map>
 
 #include "SimulationStatisticsCalculator.hh"
 #include "SimulatorConstants.hh"
 
 namespace TTAMachine {
     class Guard;
+    class Machine;
+    class FunctionUnit;
+    class BaseRegisterFile;
 }
 
 /**
  * Calculates processor utilization data from instructions and their
  * execution counts.
+ *
+ * The counts are kept in vectors indexed by dense component indices that
+ * are assigned from the machine navigators when the first instruction is
+ * seen. Component names are looked up only when the counts are queried.
  */
 class UtilizationStats : public SimulationStatisticsCalculator {
 public:
@@ -72,6 +81,9 @@ public:
         const TTAProgram::Instruction& instructionData, 
         const ExecutableInstruction& executionCounts);
 
+    virtual SimulationStatisticsCalculator* createPartial() const;
+    virtual void mergePartial(const SimulationStatisticsCalculator& partial);
+
     ClockCycleCount busWrites(const std::string& busName) const;
     ClockCycleCount socketWrites(const std::string& socketName) const;
     ClockCycleCount triggerCount(const std::string& fuName) const;
@@ -97,24 +109,76 @@ public:
     int highestUsedRegisterIndex() const;
 
 private:
-    /// Socket write counts.
-    ComponentUtilizationIndex sockets_;
+    /// Dense indices and counts of one kind of machine components.
+    struct ComponentCounts {
+        /// Index of each component.
+        std::unordered_map<const void*, int> indices;
+        /// The components in index order.
+        std::vector<const void*> components;
+        /// Names of the components.
+        std::vector<std::string> names;
+        /// Index of the parent function unit, for operations and ports.
+        std::vector<int> parents;
+        /// The utilization count of each component.
+        std::vector<ClockCycleCount> counts;
+
+        int find(const void* component) const;
+        int add(
+            const void* component, const std::string& name, int parent);
+    };
+
+    /// Dense indices and access counts of register files.
+    struct RegisterCounts {
+        /// Index of each register file or immediate unit.
+        std::unordered_map<const void*, int> indices;
+        /// The register files in index order.
+        std::vector<const void*> components;
+        /// Names of the register files.
+        std::vector<std::string> names;
+        /// Read counts of each register in each register file.
+        std::vector<std::vector<ClockCycleCount> > reads;
+        /// Write counts of each register in each register file.
+        std::vector<std::vector<ClockCycleCount> > writes;
+        /// Guard read counts of each register in each register file.
+        std::vector<std::vector<ClockCycleCount> > guardReads;
+
+        int find(const void* component) const;
+        int add(const void* component, const std::string& name, int size);
+        static void addTo(
+            std::vector<ClockCycleCount>& counts, int registerIndex,
+            ClockCycleCount count);
+        static ClockCycleCount countOf(
+            const std::vector<ClockCycleCount>& counts, int registerIndex);
+    };
+
+    void indexMachine(const TTAMachine::Machine& machine);
+    int fuIndex(const TTAMachine::FunctionUnit& fu);
+    int rfIndex(const TTAMachine::BaseRegisterFile& rf);
+    ClockCycleCount registerCount(
+        const std::vector<std::vector<ClockCycleCount> >& counts,
+        const std::string& rfName, int registerIndex) const;
+    static ClockCycleCount countOf(
+        const ComponentCounts& components, const std::string& name);
+
+    /// The machine the component indices were assigned from.
+    const TTAMachine::Machine* machine_;
     /// Bus write counts.
-    ComponentUtilizationIndex buses_;
+    ComponentCounts buses_;
+    /// Socket write counts.
+    ComponentCounts sockets_;
     /// Function unit utilizations, i.e., total operation triggerings.
-    ComponentUtilizationIndex fus_;
-    /// Operation utilizations (started operations).
-    ComponentUtilizationIndex operations_;
-    /// Index for operation utilizations for each function unit.
-    FUOperationUtilizationIndex fuOperations_;
-    /// Register read and write data for each register in each register file.
-    RFRegisterUtilizationIndex rfAccesses_;
-    
-    /// Guard register accesses for each register in a RF.
-    RFRegisterUtilizationIndex guardRfAccesses_;
-    /// Guard FU port accesses
-    FUOperationUtilizationIndex guardFUAccesses_;
-    
+    ComponentCounts fus_;
+    /// Started operations of each HW operation of each function unit.
+    ComponentCounts operations_;
+    /// Reads of FU port guards.
+    ComponentCounts guardPorts_;
+    /// Register reads and writes of register files and immediate units.
+    RegisterCounts registers_;
+    /// Used to count each output socket at most once per instruction.
+    std::vector<unsigned int> socketReadStamps_;
+    /// The stamp of the instruction being processed.
+    unsigned int currentStamp_;
+
     /// The highest register index used. This is an uglish way to fetch
     /// register access info for sequential simulation.
     int highestRegister_;
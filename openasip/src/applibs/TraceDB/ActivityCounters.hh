@@ -0,0 +1,131 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file ActivityCounters.hh
+ *
+ * Declaration of ActivityCounters class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_ACTIVITY_COUNTERS_HH
+#define TTA_ACTIVITY_COUNTERS_HH
+
+#include <string>
+#include <list>
+
+#include "boost/tuple/tuple.hpp"
+
+#include "SimulatorConstants.hh"
+
+namespace TTAMachine {
+    class Bus;
+    class Socket;
+    class FunctionUnit;
+    class BaseRegisterFile;
+}
+
+/**
+ * Interface for querying the activity of the machine components during
+ * a simulation run.
+ *
+ * The activity counts are used in energy estimation. They can be read
+ * from an execution trace database or collected directly from the
+ * simulator without writing a trace at all.
+ */
+class ActivityCounters {
+public:
+    /// a type for storing operation identifiers
+    typedef std::string OperationID;
+
+    /// a type for register access counts 
+    typedef std::size_t RegisterAccessCount;
+
+    /// a type for operation trigger counts 
+    typedef ClockCycleCount OperationTriggerCount;
+
+    /// type to be used as a key for storing concurrent RF access info
+    typedef boost::tuple<
+        RegisterAccessCount, /* concurrent reads */
+        RegisterAccessCount, /* concurrent writes */ 
+        ClockCycleCount> ConcurrentRFAccessCount;
+
+    /// type to be used for a list of concurrent RF accesses
+    typedef std::list<ConcurrentRFAccessCount> ConcurrentRFAccessCountList;
+
+    /// type to be used as a key for storing function unit operation execution
+    /// counts
+    typedef boost::tuple<OperationID, OperationTriggerCount> 
+    FUOperationTriggerCount;
+
+    /// type to be used for lists of function operation execution counts
+    typedef std::list<FUOperationTriggerCount> FUOperationTriggerCountList;
+
+    virtual ~ActivityCounters();
+
+    /**
+     * Returns the total count of simulated clock cycles.
+     *
+     * @return The count of cycles.
+     */
+    virtual ClockCycleCount simulatedCycleCount() const = 0;
+
+    /**
+     * Returns the count of clock cycles in which a bus was written to.
+     *
+     * @param bus The bus.
+     * @return The count of writes.
+     */
+    virtual ClockCycleCount busWriteCount(
+        const TTAMachine::Bus& bus) const = 0;
+
+    /**
+     * Returns the count of clock cycles in which a socket was written to.
+     *
+     * @param socket The socket.
+     * @return The count of writes.
+     */
+    virtual ClockCycleCount socketWriteCount(
+        const TTAMachine::Socket& socket) const = 0;
+
+    /**
+     * Returns the operation trigger counts of a function unit.
+     *
+     * @param functionUnit The function unit.
+     * @return A list of trigger counts. Must be deleted by the client
+     *         after use.
+     */
+    virtual FUOperationTriggerCountList* functionUnitOperationTriggerCounts(
+        const TTAMachine::FunctionUnit& functionUnit) const = 0;
+
+    /**
+     * Returns the concurrent access counts of a register file.
+     *
+     * @param registerFile The register file.
+     * @return A list of accesses. Must be deleted by the client after use.
+     */
+    virtual ConcurrentRFAccessCountList* registerFileAccessCounts(
+        const TTAMachine::BaseRegisterFile& registerFile) const = 0;
+};
+
+#endif
@@ -42,6 +42,10 @@
 #include "SimValue.hh"
 #include "RelationalDBQueryResult.hh"
 #include "DataObject.hh"
+#include "Bus.hh"
+#include "Socket.hh"
+#include "FunctionUnit.hh"
+#include "BaseRegisterFile.hh"
 
 /// database table creation queries (CQ)
 
@@ -531,6 +535,20 @@ ExecutionTrace::registerFileAccessCounts(RegisterFileID registerFile) const {
     return accesses;
 }
 
+/**
+ * Returns the list of different concurrent RF access combinations and
+ * counts of their occurrence.
+ *
+ * @param registerFile The register file for which the stats are needed.
+ * @return A list of accesses. Must be deleted by the client after use.
+ * @exception IOException If an I/O error occurs.
+ */
+ExecutionTrace::ConcurrentRFAccessCountList*
+ExecutionTrace::registerFileAccessCounts(
+    const TTAMachine::BaseRegisterFile& registerFile) const {
+    return registerFileAccessCounts(registerFile.name());
+}
+
 /**
  * Adds a function unit operation execution statistics to the database.
  *
@@ -617,6 +635,19 @@ ExecutionTrace::functionUnitOperationTriggerCounts(
     return accesses;
 }
 
+/**
+ * Returns the list of operation access counts for wanted function unit.
+ *
+ * @param functionUnit The function unit for which the stats are needed.
+ * @return A list of access counts. Must be deleted by the client after use.
+ * @exception IOException If an I/O error occurs.
+ */
+ExecutionTrace::FUOperationTriggerCountList*
+ExecutionTrace::functionUnitOperationTriggerCounts(
+    const TTAMachine::FunctionUnit& functionUnit) const {
+    return functionUnitOperationTriggerCounts(functionUnit.name());
+}
+
 /**
  * Adds a socket write count statistics to the database.
  *
@@ -674,6 +705,17 @@ ExecutionTrace::socketWriteCount(SocketID socket) const {
     return count;
 }
 
+/**
+ * Returns the count of clock cycles in which a socket was written to.
+ *
+ * @param socket The socket.
+ * @return The count of writes/accesses.
+ */
+ClockCycleCount
+ExecutionTrace::socketWriteCount(const TTAMachine::Socket& socket) const {
+    return socketWriteCount(socket.name());
+}
+
 /**
  * Adds a bus write count statistics to the database.
  *
@@ -731,6 +773,17 @@ ExecutionTrace::busWriteCount(BusID bus) const {
     return count;
 }
 
+/**
+ * Returns the count of clock cycles in which a bus was written to.
+ *
+ * @param bus The bus.
+ * @return The count of writes/accesses.
+ */
+ClockCycleCount
+ExecutionTrace::busWriteCount(const TTAMachine::Bus& bus) const {
+    return busWriteCount(bus.name());
+}
+
 /**
  * Sets the total count of simulated clock cycles.
  *
@@ -43,6 +43,7 @@
 #include "FileSystem.hh"
 #include "RelationalDB.hh"
 #include "SimulatorConstants.hh"
+#include "ActivityCounters.hh"
 
 
 class InstructionExecution;
@@ -53,7 +54,7 @@ class InstructionExecution;
  * Access to the execution trace database happens through the interface of 
  * this class.
  */
-class ExecutionTrace {
+class ExecutionTrace : public ActivityCounters {
 public:
 
     /// a type for storing address space identifiers
@@ -71,9 +72,6 @@ public:
     /// a type for storing function unit identifiers
     typedef std::string FunctionUnitID;
 
-    /// a type for storing operation identifiers
-    typedef std::string OperationID;
-
     /// a type for storing register file identifiers
     typedef std::string RegisterFileID;
 
@@ -86,35 +84,12 @@ public:
     /// a type for storing data of size of the minimum addressable unit
     typedef SimValue MAU;
 
-    /// a type for register access counts 
-    typedef std::size_t RegisterAccessCount;
-
-    /// a type for operation trigger counts 
-    typedef ClockCycleCount OperationTriggerCount;
-
     /// a type for storing procedure entry type (entry/exit)
     enum ProcedureEntryType {
         PT_ENTRY = 0, ///< procedure entry
         PT_EXIT = 1  ///< procedure exit
     };
 
-    /// type to be used as a key for storing concurrent RF access info
-    typedef boost::tuple<
-        RegisterAccessCount, /* concurrent reads */
-        RegisterAccessCount, /* concurrent writes */ 
-        ClockCycleCount> ConcurrentRFAccessCount;
-
-    /// type to be used for a list of concurrent RF accesses
-    typedef std::list<ConcurrentRFAccessCount> ConcurrentRFAccessCountList;
-
-    /// type to be used as a key for storing function unit operation execution
-    /// counts
-    typedef boost::tuple<OperationID, OperationTriggerCount> 
-    FUOperationTriggerCount;
-
-    /// type to be used for lists of function operation execution counts
-    typedef std::list<FUOperationTriggerCount> FUOperationTriggerCountList;
-
     void addInstructionExecution(
         ClockCycleCount cycle, InstructionAddress address);
 
@@ -156,6 +131,9 @@ public:
     ConcurrentRFAccessCountList* registerFileAccessCounts(
         RegisterFileID registerFile) const;
 
+    virtual ConcurrentRFAccessCountList* registerFileAccessCounts(
+        const TTAMachine::BaseRegisterFile& registerFile) const;
+
     void addFunctionUnitOperationTriggerCount(
         FunctionUnitID functionUnit, OperationID operation,
         OperationTriggerCount count);
@@ -167,17 +145,25 @@ public:
     FUOperationTriggerCountList* functionUnitOperationTriggerCounts(
         FunctionUnitID functionUnit) const;
 
+    virtual FUOperationTriggerCountList* functionUnitOperationTriggerCounts(
+        const TTAMachine::FunctionUnit& functionUnit) const;
+
     void addSocketWriteCount(SocketID socket, ClockCycleCount);
 
     ClockCycleCount socketWriteCount(SocketID socket) const;
 
+    virtual ClockCycleCount socketWriteCount(
+        const TTAMachine::Socket& socket) const;
+
     void addBusWriteCount(BusID socket, ClockCycleCount count);
 
     ClockCycleCount busWriteCount(BusID bus) const;
 
+    virtual ClockCycleCount busWriteCount(const TTAMachine::Bus& bus) const;
+
     void setSimulatedCycleCount(ClockCycleCount count);
 
-    ClockCycleCount simulatedCycleCount() const;
+    virtual ClockCycleCount simulatedCycleCount() const;
 
     InstructionExecution& instructionExecutions();
 
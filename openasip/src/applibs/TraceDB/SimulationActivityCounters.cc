@@ -0,0 +1,182 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file SimulationActivityCounters.cc
+ *
+ * Definition of SimulationActivityCounters class.
+ *
+ * @note rating: red
+ */
+
+#include "SimulationActivityCounters.hh"
+#include "Bus.hh"
+#include "Socket.hh"
+#include "FunctionUnit.hh"
+#include "BaseRegisterFile.hh"
+
+/**
+ * Constructor.
+ */
+SimulationActivityCounters::SimulationActivityCounters() : cycleCount_(0) {
+}
+
+/**
+ * Destructor.
+ */
+SimulationActivityCounters::~SimulationActivityCounters() {
+}
+
+/**
+ * Sets the total count of simulated clock cycles.
+ *
+ * @param count The count of cycles.
+ */
+void
+SimulationActivityCounters::setSimulatedCycleCount(ClockCycleCount count) {
+    cycleCount_ = count;
+}
+
+/**
+ * Adds clock cycles in which a bus was written to.
+ *
+ * @param bus The bus.
+ * @param count The count of writes.
+ */
+void
+SimulationActivityCounters::addBusWriteCount(
+    const TTAMachine::Bus& bus, ClockCycleCount count) {
+    busWrites_[bus.name()] += count;
+}
+
+/**
+ * Adds clock cycles in which a socket was written to.
+ *
+ * @param socket The socket.
+ * @param count The count of writes.
+ */
+void
+SimulationActivityCounters::addSocketWriteCount(
+    const TTAMachine::Socket& socket, ClockCycleCount count) {
+    socketWrites_[socket.name()] += count;
+}
+
+/**
+ * Adds the execution count of an operation in a function unit.
+ *
+ * @param functionUnit The function unit.
+ * @param operation The name of the operation.
+ * @param count The count of executions.
+ */
+void
+SimulationActivityCounters::addFunctionUnitOperationTriggerCount(
+    const TTAMachine::FunctionUnit& functionUnit,
+    const OperationID& operation, OperationTriggerCount count) {
+    operationTriggers_[functionUnit.name()].push_back(
+        boost::make_tuple(operation, count));
+}
+
+/**
+ * Adds the count of clock cycles in which the given count of concurrent
+ * reads and writes were made to a register file.
+ *
+ * @param registerFile The register file.
+ * @param reads The count of concurrent reads.
+ * @param writes The count of concurrent writes.
+ * @param count The count of clock cycles with the accesses.
+ */
+void
+SimulationActivityCounters::addConcurrentRegisterFileAccessCount(
+    const TTAMachine::BaseRegisterFile& registerFile,
+    RegisterAccessCount reads, RegisterAccessCount writes,
+    ClockCycleCount count) {
+    rfAccesses_[registerFile.name()].push_back(
+        boost::make_tuple(reads, writes, count));
+}
+
+/**
+ * Returns the total count of simulated clock cycles.
+ *
+ * @return The count of cycles.
+ */
+ClockCycleCount
+SimulationActivityCounters::simulatedCycleCount() const {
+    return cycleCount_;
+}
+
+/**
+ * Returns the count of clock cycles in which a bus was written to.
+ *
+ * @param bus The bus.
+ * @return The count of writes, 0 if none was added for the bus.
+ */
+ClockCycleCount
+SimulationActivityCounters::busWriteCount(const TTAMachine::Bus& bus) const {
+    BusWriteIndex::const_iterator i = busWrites_.find(bus.name());
+    return i != busWrites_.end() ? i->second : 0;
+}
+
+/**
+ * Returns the count of clock cycles in which a socket was written to.
+ *
+ * @param socket The socket.
+ * @return The count of writes, 0 if none was added for the socket.
+ */
+ClockCycleCount
+SimulationActivityCounters::socketWriteCount(
+    const TTAMachine::Socket& socket) const {
+    SocketWriteIndex::const_iterator i = socketWrites_.find(socket.name());
+    return i != socketWrites_.end() ? i->second : 0;
+}
+
+/**
+ * Returns the operation trigger counts of a function unit.
+ *
+ * @param functionUnit The function unit.
+ * @return A list of trigger counts. Must be deleted by the client after use.
+ */
+ActivityCounters::FUOperationTriggerCountList*
+SimulationActivityCounters::functionUnitOperationTriggerCounts(
+    const TTAMachine::FunctionUnit& functionUnit) const {
+    OperationTriggerIndex::const_iterator i =
+        operationTriggers_.find(functionUnit.name());
+    if (i == operationTriggers_.end()) {
+        return new FUOperationTriggerCountList();
+    }
+    return new FUOperationTriggerCountList(i->second);
+}
+
+/**
+ * Returns the concurrent access counts of a register file.
+ *
+ * @param registerFile The register file.
+ * @return A list of accesses. Must be deleted by the client after use.
+ */
+ActivityCounters::ConcurrentRFAccessCountList*
+SimulationActivityCounters::registerFileAccessCounts(
+    const TTAMachine::BaseRegisterFile& registerFile) const {
+    RFAccessIndex::const_iterator i = rfAccesses_.find(registerFile.name());
+    if (i == rfAccesses_.end()) {
+        return new ConcurrentRFAccessCountList();
+    }
+    return new ConcurrentRFAccessCountList(i->second);
+}
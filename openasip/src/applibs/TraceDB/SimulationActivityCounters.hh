@@ -0,0 +1,108 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file SimulationActivityCounters.hh
+ *
+ * Declaration of SimulationActivityCounters class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_SIMULATION_ACTIVITY_COUNTERS_HH
+#define TTA_SIMULATION_ACTIVITY_COUNTERS_HH
+
+#include <string>
+#include <unordered_map>
+
+#include "ActivityCounters.hh"
+
+/**
+ * Activity counters kept in memory.
+ *
+ * The simulator fills the counters at the end of a simulation run. The
+ * counts are indexed by the names of the machine components, like in
+ * ExecutionTrace, thus they can be queried with the components of any
+ * copy of the simulated machine, such as one the estimator loaded from
+ * the ADF. A query is a hash lookup instead of a trace database query.
+ */
+class SimulationActivityCounters : public ActivityCounters {
+public:
+    SimulationActivityCounters();
+    virtual ~SimulationActivityCounters();
+
+    void setSimulatedCycleCount(ClockCycleCount count);
+
+    void addBusWriteCount(
+        const TTAMachine::Bus& bus, ClockCycleCount count);
+
+    void addSocketWriteCount(
+        const TTAMachine::Socket& socket, ClockCycleCount count);
+
+    void addFunctionUnitOperationTriggerCount(
+        const TTAMachine::FunctionUnit& functionUnit,
+        const OperationID& operation, OperationTriggerCount count);
+
+    void addConcurrentRegisterFileAccessCount(
+        const TTAMachine::BaseRegisterFile& registerFile,
+        RegisterAccessCount reads, RegisterAccessCount writes,
+        ClockCycleCount count);
+
+    virtual ClockCycleCount simulatedCycleCount() const;
+
+    virtual ClockCycleCount busWriteCount(const TTAMachine::Bus& bus) const;
+
+    virtual ClockCycleCount socketWriteCount(
+        const TTAMachine::Socket& socket) const;
+
+    virtual FUOperationTriggerCountList* functionUnitOperationTriggerCounts(
+        const TTAMachine::FunctionUnit& functionUnit) const;
+
+    virtual ConcurrentRFAccessCountList* registerFileAccessCounts(
+        const TTAMachine::BaseRegisterFile& registerFile) const;
+
+private:
+    /// Write counts of buses by name.
+    typedef std::unordered_map<std::string, ClockCycleCount> BusWriteIndex;
+    /// Write counts of sockets by name.
+    typedef std::unordered_map<std::string, ClockCycleCount>
+    SocketWriteIndex;
+    /// Operation trigger counts of function units by name.
+    typedef std::unordered_map<std::string, FUOperationTriggerCountList>
+    OperationTriggerIndex;
+    /// Concurrent access counts of register files by name.
+    typedef std::unordered_map<std::string, ConcurrentRFAccessCountList>
+    RFAccessIndex;
+
+    /// The total count of simulated clock cycles.
+    ClockCycleCount cycleCount_;
+    /// Write counts of buses.
+    BusWriteIndex busWrites_;
+    /// Write counts of sockets.
+    SocketWriteIndex socketWrites_;
+    /// Operation trigger counts of function units.
+    OperationTriggerIndex operationTriggers_;
+    /// Concurrent access counts of register files.
+    RFAccessIndex rfAccesses_;
+};
+
+#endif
@@ -204,6 +204,18 @@ CostDBEntry::isEqualKey(const CostDBEntry& entry) const {
     return entryKey_->isEqual(*entry.entryKey_);
 }
 
+/**
+ * Returns a hash of the key of the entry.
+ *
+ * Entries with equal keys have equal hashes.
+ *
+ * @return Hash of the key.
+ */
+std::size_t
+CostDBEntry::keyHashValue() const {
+    return entryKey_->hashValue();
+}
+
 /**
  * Add new statistics into this entry.
  *
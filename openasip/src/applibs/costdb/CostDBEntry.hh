@@ -67,6 +67,7 @@ public:
     int fieldCount() const;
     const EntryKeyField& field(int index) const;
     bool isEqualKey(const CostDBEntry& entry) const;
+    std::size_t keyHashValue() const;
 
     void addStatistics(CostDBEntryStats* newStats);
     int statisticsCount() const;
@@ -34,6 +34,7 @@
 #include "CostDBEntryKey.hh"
 #include "Application.hh"
 #include <iostream>
+#include <functional>
 
 /**
  * Constructor.
@@ -168,6 +169,25 @@ CostDBEntryKey::isEqual(const CostDBEntryKey& entryKey) const {
     return false;
 }
 
+/**
+ * Returns a hash of the entry key.
+ *
+ * Entry keys that are equal according to isEqual() have equal hashes
+ * regardless of the order of their fields.
+ *
+ * @return Hash of the entry key.
+ */
+std::size_t
+CostDBEntryKey::hashValue() const {
+
+    std::size_t hash = std::hash<const void*>()(type_);
+    for (FieldTable::const_iterator f = fields_.begin();
+         f != fields_.end(); f++) {
+        hash += (*f)->hashValue();
+    }
+    return hash;
+}
+
 /**
  * Returns the field found on the given index.
  *
@@ -37,6 +37,7 @@
 
 #include <string>
 #include <vector>
+#include <cstddef>
 
 #include "CostDBTypes.hh"
 #include "EntryKeyField.hh"
@@ -59,6 +60,7 @@ public:
     EntryKeyField keyFieldOfType(const EntryKeyFieldProperty& fieldType) const;
     EntryKeyField keyFieldOfType(std::string fieldType) const;
     bool isEqual(const CostDBEntryKey& entryKey) const;
+    std::size_t hashValue() const;
 
     void addField(EntryKeyField* field);
     void replaceField(EntryKeyField* newField);
@@ -875,10 +875,38 @@ CostDatabase::buildSockets(const std::string& socketEstimatorPluginName) {
     socketsBuilt_ = true;
 }
 
+/**
+ * Computes a hash of the given fields of an entry or an entry key.
+ *
+ * @param key Entry or entry key.
+ * @param fields The fields to hash.
+ * @param found Set to the number of the fields the key has.
+ * @return Hash of the fields.
+ */
+template <typename KeyType>
+static std::size_t
+fieldsHash(const KeyType& key, const std::set<const EntryKeyFieldProperty*>&
+           fields, std::size_t& found) {
+
+    std::size_t hash = 0;
+    found = 0;
+    for (int f = 0; f < key.fieldCount(); f++) {
+        const EntryKeyField& field = key.field(f);
+        if (fields.find(field.type()) != fields.end()) {
+            hash += field.hashValue();
+            found++;
+        }
+    }
+    return hash;
+}
+
 /**
  * Searches entries from the database matching certain search key with
  * specific type of matches.
  *
+ * Only the entries whose exactly matched fields have the values of the
+ * search key are handed to the search strategy.
+ *
  * @param searchKey Search key.
  * @param match Type of matches.
  * @return Entries matching the search.
@@ -894,8 +922,71 @@ CostDatabase::search(
     if (i == entries_.end()) {
         throw KeyNotFound(__FILE__, __LINE__, "CostDatabase::search");
     }
-    
-    return searchStrategy_->search(searchKey, i->second, match);
+
+    FieldSet exactFields;
+    for (CostDBTypes::MatchTypeTable::const_iterator m = match.begin();
+         m != match.end(); m++) {
+        if ((*m)->matchingType() == CostDBTypes::MATCH_EXACT) {
+            exactFields.insert((*m)->fieldType());
+        }
+    }
+    if (exactFields.empty()) {
+        return searchStrategy_->search(searchKey, i->second, match);
+    }
+
+    const ExactMatchIndex& index =
+        exactMatchIndex(searchKey.type(), exactFields);
+    std::size_t found = 0;
+    std::size_t hash = fieldsHash(searchKey, exactFields, found);
+    if (!index.usable || found != exactFields.size()) {
+        // let the strategy report the missing fields
+        return searchStrategy_->search(searchKey, i->second, match);
+    }
+    std::unordered_map<std::size_t, CostDBTypes::EntryTable>::const_iterator
+        group = index.groups.find(hash);
+    if (group == index.groups.end()) {
+        return CostDBTypes::EntryTable();
+    }
+    return searchStrategy_->search(searchKey, group->second, match);
+}
+
+/**
+ * Returns the index for queries that match the given fields exactly.
+ *
+ * The index is built on the first request.
+ *
+ * @param type Type of the entries.
+ * @param fields The exactly matched fields.
+ * @return The index.
+ */
+const CostDatabase::ExactMatchIndex&
+CostDatabase::exactMatchIndex(
+    const EntryKeyProperty* type, const FieldSet& fields) const {
+
+    std::pair<const EntryKeyProperty*, FieldSet> indexKey(type, fields);
+    ExactMatchIndexMap::iterator i = exactMatchIndices_.find(indexKey);
+    if (i != exactMatchIndices_.end()) {
+        return i->second;
+    }
+
+    ExactMatchIndex& index = exactMatchIndices_[indexKey];
+    index.usable = true;
+    EntryMap::const_iterator entries = entries_.find(type);
+    if (entries == entries_.end()) {
+        return index;
+    }
+    for (CostDBTypes::EntryTable::const_iterator e =
+             entries->second.begin(); e != entries->second.end(); e++) {
+        std::size_t found = 0;
+        std::size_t hash = fieldsHash(*(*e), fields, found);
+        if (found != fields.size()) {
+            index.usable = false;
+            index.groups.clear();
+            break;
+        }
+        index.groups[hash].push_back(*e);
+    }
+    return index;
 }
 
 /**
@@ -906,33 +997,39 @@ CostDatabase::search(
  */
 void
 CostDatabase::insertEntry(CostDBEntry* entry) {
-    EntryMap::iterator i = entries_.find(entry->type());
 
-    if (i == entries_.end()) {
-        CostDBTypes::EntryTable newEntries;
-        newEntries.push_back(entry);
-        entries_.insert(pair<const EntryKeyProperty*, CostDBTypes::EntryTable>(
-                            entry->type(), newEntries));
-    } else {
-        // if the database already contains an entry with same search
-        // key, the statistics of the new entry will be added into the
-        // existing entry
-        for (CostDBTypes::EntryTable::iterator j = i->second.begin();
-             j != i->second.end(); j++) {
-
-            if ((*j)->isEqualKey(*entry)) {
-		if (*j == entry) {
-		    throw ObjectAlreadyExists(__FILE__, __LINE__,
-					      "CostDatabase::insertEntry");
-		}
-                for (int k = 0; k < entry->statisticsCount(); k++) {
-                    CostDBEntryStats* newStats = entry->statistics(k).copy();
-                    (*j)->addStatistics(newStats);
-                }
-                return;
+    KeyIndex& keyIndex = keyIndex_[entry->type()];
+    const std::size_t hash = entry->keyHashValue();
+
+    // if the database already contains an entry with same search
+    // key, the statistics of the new entry will be added into the
+    // existing entry
+    std::pair<KeyIndex::iterator, KeyIndex::iterator> sameHash =
+        keyIndex.equal_range(hash);
+    for (KeyIndex::iterator j = sameHash.first; j != sameHash.second; j++) {
+        if (j->second->isEqualKey(*entry)) {
+            if (j->second == entry) {
+                throw ObjectAlreadyExists(__FILE__, __LINE__,
+                                          "CostDatabase::insertEntry");
             }
+            for (int k = 0; k < entry->statisticsCount(); k++) {
+                CostDBEntryStats* newStats = entry->statistics(k).copy();
+                j->second->addStatistics(newStats);
+            }
+            return;
+        }
+    }
+    keyIndex.insert(std::make_pair(hash, entry));
+    entries_[entry->type()].push_back(entry);
+
+    // the exact match indices of the type are rebuilt on demand
+    ExactMatchIndexMap::iterator i = exactMatchIndices_.begin();
+    while (i != exactMatchIndices_.end()) {
+        if (i->first.first == entry->type()) {
+            exactMatchIndices_.erase(i++);
+        } else {
+            i++;
         }
-        i->second.push_back(entry);
     }
 }
 
@@ -989,6 +1086,16 @@ CostDatabase::setSearchStrategy(SearchStrategy* strategy) {
     searchStrategy_ = strategy->copy();
 }
 
+/**
+ * Returns true if a search strategy has been set.
+ *
+ * @return True if a search strategy has been set.
+ */
+bool
+CostDatabase::hasSearchStrategy() const {
+    return searchStrategy_ != NULL;
+}
+
 /**
  * Returns the matching strings out of the text using regexp.
  * 
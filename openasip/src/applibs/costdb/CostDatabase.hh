@@ -37,7 +37,10 @@
 
 #include <vector>
 #include <map>
+#include <set>
 #include <string>
+#include <cstddef>
+#include <unordered_map>
 #include "CompilerWarnings.hh"
 IGNORE_CLANG_WARNING("-Wkeyword-macro")
 #include <boost/regex.hpp>
@@ -78,6 +81,7 @@ public:
 
     void insertEntry(CostDBEntry* entry);
     void setSearchStrategy(SearchStrategy* strategy);
+    bool hasSearchStrategy() const;
     CostDBTypes::EntryTable search(
         const CostDBEntryKey& searchKey,
         const CostDBTypes::MatchTypeTable& match) const;
@@ -98,11 +102,41 @@ private:
     /// Search type for each entry type.
     typedef std::map<
         const EntryKeyProperty*,CostDBTypes::MatchTypeTable> MatchTypeMap;
+    /// Entries of one type by the hash of their keys.
+    typedef std::unordered_multimap<std::size_t, CostDBEntry*> KeyIndex;
+    /// Key index of each entry type.
+    typedef std::map<const EntryKeyProperty*, KeyIndex> KeyIndexMap;
+    /// Fields that a query requires to match exactly.
+    typedef std::set<const EntryKeyFieldProperty*> FieldSet;
+
+    /**
+     * Entries of one type grouped by the values of a set of fields.
+     *
+     * Queries that require those fields to match exactly only need to
+     * look at one group. Groups keep the entries in insertion order.
+     */
+    struct ExactMatchIndex {
+        /// False if some entry lacks one of the fields.
+        bool usable;
+        /// Entries by the hash of the indexed fields.
+        std::unordered_map<std::size_t, CostDBTypes::EntryTable> groups;
+    };
+    /// Exact match indices by entry type and indexed fields.
+    typedef std::map<
+        std::pair<const EntryKeyProperty*, FieldSet>, ExactMatchIndex>
+    ExactMatchIndexMap;
+
+    const ExactMatchIndex& exactMatchIndex(
+        const EntryKeyProperty* type, const FieldSet& fields) const;
     
     /// Search strategy used for queries.
     SearchStrategy* searchStrategy_;
     /// Database entries.
     EntryMap entries_;
+    /// Hash index of the database entries for finding equal keys.
+    KeyIndexMap keyIndex_;
+    /// Indices for queries with exactly matched fields, built on demand.
+    mutable ExactMatchIndexMap exactMatchIndices_;
     /// HDB used for creating cost database.
     const HDB::HDBManager& hdb_;
     /// Flag to note is register files built
@@ -77,11 +77,11 @@ CostDatabaseRegistry::instance() {
  */
 CostDatabase&
 CostDatabaseRegistry::costDatabase(const HDB::HDBManager& hdb) {
-    if (AssocTools::containsKey(registry_, &hdb)) {
-        return *registry_[&hdb];
+    if (AssocTools::containsKey(registry_, hdb.fileName())) {
+        return *registry_[hdb.fileName()];
     }
     CostDatabase* costDatabase = &CostDatabase::instance(hdb);
-    registry_[&hdb] = costDatabase;
+    registry_[hdb.fileName()] = costDatabase;
     return *costDatabase;
 }
 
@@ -95,12 +95,12 @@ void
 CostDatabaseRegistry::addCostDatabase(
     CostDatabase* costDatabase, const HDB::HDBManager& hdb) {
     
-    if (AssocTools::containsKey(registry_, &hdb)) {
+    if (AssocTools::containsKey(registry_, hdb.fileName())) {
         delete costDatabase;
         costDatabase = NULL;
         return;
     }
-    registry_[&hdb] = costDatabase;
+    registry_[hdb.fileName()] = costDatabase;
 }
 
 /**
@@ -114,7 +114,7 @@ CostDatabaseRegistry::addCostDatabase(
 bool
 CostDatabaseRegistry::hasCostDatabase(const HDB::HDBManager& hdb) {
 
-    if (AssocTools::containsKey(registry_, &hdb)) {
+    if (AssocTools::containsKey(registry_, hdb.fileName())) {
         return true;
     } else {
         return false;
@@ -145,7 +145,7 @@ CostDatabaseRegistry::costDatabase(unsigned int index) {
         throw OutOfRange(__FILE__, __LINE__,
                          "CostDatabaseRegistry::costDatavase(unsigned int)");
     }
-    std::map<const HDB::HDBManager*, CostDatabase*>::const_iterator iter =
+    std::map<std::string, CostDatabase*>::const_iterator iter =
         registry_.begin();
     for (unsigned int counter = 0; iter != registry_.end(); iter++) {
         if (counter == index) {
@@ -169,11 +169,11 @@ CostDatabaseRegistry::hdbPath(unsigned index) {
         throw OutOfRange(__FILE__, __LINE__,
                          "CostDatabaseRegistry::hdbPath(unsigned int)");
     }
-    std::map<const HDB::HDBManager*, CostDatabase*>::const_iterator iter = 
+    std::map<std::string, CostDatabase*>::const_iterator iter = 
         registry_.begin();
 
     for (unsigned c = 0; iter != registry_.end(); iter++) {
-        if (c == index) return (*iter).first->fileName();
+        if (c == index) return (*iter).first;
         c++;
     }
     assert(false);
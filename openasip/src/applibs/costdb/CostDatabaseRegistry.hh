@@ -59,8 +59,8 @@ public:
 private:
     /// CostDatabase registry must be created with instance() method.
     CostDatabaseRegistry();
-    /// All created CostDatabasess are stored in this map.
-    std::map<const HDB::HDBManager*, CostDatabase*> registry_;
+    /// All created CostDatabasess by the file name of their HDB.
+    std::map<std::string, CostDatabase*> registry_;
     /// Unique instance of the class.
     static CostDatabaseRegistry* instance_;
     
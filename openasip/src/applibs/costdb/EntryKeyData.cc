@@ -36,6 +36,7 @@
 #include <string>
 #include <sstream>
 #include <typeinfo>
+#include <functional>
 #include "EntryKeyData.hh"
 #include "Conversion.hh"
 #include "FunctionUnit.hh"
@@ -63,6 +64,19 @@ EntryKeyData::EntryKeyData() {
 EntryKeyData::~EntryKeyData() {
 }
 
+/**
+ * Returns a hash of the data.
+ *
+ * Data that are equal according to isEqual() must have equal hashes. The
+ * default implementation hashes the string form of the data.
+ *
+ * @return Hash of the data.
+ */
+std::size_t
+EntryKeyData::hashValue() const {
+    return std::hash<std::string>()(toString());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // EntryKeyDataInt
 ///////////////////////////////////////////////////////////////////////////////
@@ -205,6 +219,16 @@ EntryKeyDataInt::toString() const {
     return Conversion::toString(data_);
 }
 
+/**
+ * Returns a hash of the integer.
+ *
+ * @return Hash of the integer.
+ */
+std::size_t
+EntryKeyDataInt::hashValue() const {
+    return std::hash<int>()(data_);
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // EntryKeyDataDouble
@@ -347,6 +371,16 @@ EntryKeyDataDouble::toString() const {
     return Conversion::toString(data_);
 }
 
+/**
+ * Returns a hash of the double.
+ *
+ * @return Hash of the double.
+ */
+std::size_t
+EntryKeyDataDouble::hashValue() const {
+    return std::hash<double>()(data_);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // EntryKeyDataOperationSet
 ///////////////////////////////////////////////////////////////////////////////
@@ -591,6 +625,16 @@ EntryKeyDataBool::toString() const {
     }
 }
 
+/**
+ * Returns a hash of the boolean.
+ *
+ * @return Hash of the boolean.
+ */
+std::size_t
+EntryKeyDataBool::hashValue() const {
+    return std::hash<bool>()(data_);
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////
 // EntryKeyDataFunctioUnit
@@ -719,3 +763,17 @@ EntryKeyDataFunctionUnit::toString() const {
     }
     return result;
 }
+
+/**
+ * Returns a hash of the FunctionUnit.
+ *
+ * Only the properties compared by the architecture equality are hashed, so
+ * equal units with different names get the same hash.
+ *
+ * @return Hash of the operation and port counts of the FunctionUnit.
+ */
+std::size_t
+EntryKeyDataFunctionUnit::hashValue() const {
+    return std::hash<int>()(
+        data_->operationCount() * 1021 + data_->operationPortCount());
+}
@@ -38,6 +38,7 @@
 
 
 #include <string>
+#include <cstddef>
 #include <set>
 #include <vector>
 
@@ -68,6 +69,7 @@ public:
         const EntryKeyData*, const EntryKeyData*) const = 0;
     /// Converts the data into a string.
     virtual std::string toString() const = 0;
+    virtual std::size_t hashValue() const;
     
 private:
     /// Copying not allowed.
@@ -93,6 +95,7 @@ public:
     double coefficient(
         const EntryKeyData* data1, const EntryKeyData* data2) const;
     std::string toString() const;
+    std::size_t hashValue() const;
 
 private:
     /// Integer data.
@@ -121,6 +124,7 @@ public:
     double coefficient(
         const EntryKeyData* data1, const EntryKeyData* data2) const;
     std::string toString() const;
+    std::size_t hashValue() const;
 
 private:
     /// Double data.
@@ -176,6 +180,7 @@ public:
     double coefficient(
         const EntryKeyData* data1, const EntryKeyData* data2) const;
     std::string toString() const;
+    std::size_t hashValue() const;
 
 private:
     /// Boolean data.
@@ -203,6 +208,7 @@ public:
     double coefficient(
         const EntryKeyData* data1, const EntryKeyData* data2) const;
     std::string toString() const;
+    std::size_t hashValue() const;
 
 private:
     /// FunctionUnit* data.
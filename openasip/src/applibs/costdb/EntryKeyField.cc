@@ -31,6 +31,7 @@
  * @note rating: red
  */
 
+#include <functional>
 #include "EntryKeyField.hh"
 #include "Application.hh"
 
@@ -143,3 +144,17 @@ std::string
 EntryKeyField::toString() const {
     return data_->toString();
 }
+
+/**
+ * Returns a hash of the field.
+ *
+ * Fields that are equal and of the same type have equal hashes.
+ *
+ * @return Hash of the value and the type of the field.
+ */
+std::size_t
+EntryKeyField::hashValue() const {
+    std::size_t typeHash = std::hash<const void*>()(properties_);
+    return data_->hashValue() ^
+        (typeHash + 0x9e3779b9 + (typeHash << 6) + (typeHash >> 2));
+}
@@ -35,6 +35,8 @@
 #define TTA_ENTRY_KEY_FIELD_HH
 
 
+#include <cstddef>
+
 #include "EntryKeyData.hh"
 #include "EntryKeyFieldProperty.hh"
 
@@ -55,6 +57,7 @@ public:
     double coefficient(const EntryKeyField& field1,
                        const EntryKeyField& field2) const;
     std::string toString() const;
+    std::size_t hashValue() const;
     const EntryKeyFieldProperty* type() const;
 
 private:
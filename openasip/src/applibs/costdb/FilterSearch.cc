@@ -86,7 +86,10 @@ FilterSearch::copy() const {
         newEntryCache.push_back((*i)->copy());
     }
     FilterSearch* newSearch = new FilterSearch();
-    newSearch->entryCache_ = newEntryCache;
+    for (CacheTable::iterator i = newEntryCache.begin();
+         i != newEntryCache.end(); i++) {
+        newSearch->addToCache(*i);
+    }
     return newSearch;
 }
 
@@ -139,7 +142,7 @@ FilterSearch::search(
     }
     
     // insert found entries into cache
-    entryCache_.push_back(new Cache(match, searchKey.copy(), components));
+    addToCache(new Cache(match, searchKey.copy(), components));
     
     return components;
 }
@@ -157,8 +160,13 @@ FilterSearch::findFromCache(
     const CostDBTypes::MatchTypeTable& match) {
     
     CostDBTypes::EntryTable cacheEntries;
-    for (CacheTable::iterator i = entryCache_.begin();
-         i != entryCache_.end(); i++) {
+    CacheIndex::const_iterator sameKey =
+        cacheIndex_.find(searchKey.hashValue());
+    if (sameKey == cacheIndex_.end()) {
+        return cacheEntries;
+    }
+    for (CacheTable::const_iterator i = sameKey->second.begin();
+         i != sameKey->second.end(); i++) {
         
         if ((*i)->isEqual(match, &searchKey)) {
             cacheEntries = (*i)->entries();
@@ -168,6 +176,17 @@ FilterSearch::findFromCache(
     return cacheEntries;
 }
 
+/**
+ * Adds results of a query to the cache.
+ *
+ * @param cache The results, owned by this search strategy after the call.
+ */
+void
+FilterSearch::addToCache(Cache* cache) {
+    entryCache_.push_back(cache);
+    cacheIndex_[cache->searchKey().hashValue()].push_back(cache);
+}
+
 /**
  * Creates sub components of this search strategy.
  *
@@ -325,3 +344,13 @@ CostDBTypes::EntryTable
 FilterSearch::Cache::entries() const {
     return entries_;
 }
+
+/**
+ * Returns the search key of the query.
+ *
+ * @return The search key.
+ */
+const CostDBEntryKey&
+FilterSearch::Cache::searchKey() const {
+    return *searchKey_;
+}
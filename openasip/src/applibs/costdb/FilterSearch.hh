@@ -36,6 +36,8 @@
 
 
 #include <vector>
+#include <cstddef>
+#include <unordered_map>
 
 #include "CostDBTypes.hh"
 #include "SearchStrategy.hh"
@@ -57,8 +59,9 @@
  * algorithms.
  *
  * Cache and quick filtering is used for optimisation. Cache contains
- * all the results from the previous queries. Quick filtering removes
- * unneccessary entries in linear time in the beginning of the search.
+ * all the results from the previous queries and is looked up through a
+ * hash of the search key. Quick filtering removes unneccessary entries
+ * in linear time in the beginning of the search.
  */
 class FilterSearch: public SearchStrategy {
 public:
@@ -88,6 +91,7 @@ private:
             CostDBTypes::MatchTypeTable matchingType,
             const CostDBEntryKey* key) const;
 	CostDBTypes::EntryTable entries() const;
+        const CostDBEntryKey& searchKey() const;
     private:
         /// Type of match used for these results.
 	CostDBTypes::MatchTypeTable matchType_;
@@ -106,14 +110,19 @@ private:
     typedef std::vector<Cache*> CacheTable;
     /// Table of matcher types.
     typedef std::vector<Matcher*> MatcherTable;
+    /// Cache entries by the hash of their search keys.
+    typedef std::unordered_map<std::size_t, CacheTable> CacheIndex;
 
     CostDBTypes::EntryTable findFromCache(
         const CostDBEntryKey& searchKey,
         const CostDBTypes::MatchTypeTable& match);
     MatcherTable createMatchers(const CostDBTypes::MatchTypeTable& match);
+    void addToCache(Cache* cache);
 
     /// Results of the previous queries.
     CacheTable entryCache_;
+    /// The results of the previous queries by search key.
+    CacheIndex cacheIndex_;
     /// Storage for all matchers. They cannot be deleted before search
     /// strategy itself is deleted. Thus, this storage exists to
     /// deallocate the memory reserved by matchers.
@@ -32,6 +32,8 @@
  */
 
 #include <vector>
+#include <cstddef>
+#include <unordered_map>
 
 #include "Interpolation.hh"
 #include "Application.hh"
@@ -80,6 +82,9 @@ Interpolation::quickFilter(const CostDBEntryKey&, CostDBTypes::EntryTable&) {
  * field to which search is applied different, the closer one to the
  * search key is chosen for interpolation.
  *
+ * Entries are paired through a hash of their other fields, so the search
+ * takes linear time in the number of entries.
+ *
  * @param searchKey Search key.
  * @param components Entries from which to find. Updated to contain
  *                   entries that matched the search request.
@@ -92,14 +97,26 @@ void
 Interpolation::filter(
     const CostDBEntryKey& searchKey, CostDBTypes::EntryTable& components) {
     vector<Pair> entries;
+    // pairs by the hash of the other fields of their entries, only the
+    // pairs with the same hash need to be compared
+    std::unordered_map<std::size_t, vector<std::size_t> > pairsByOthers;
     EntryKeyField searchField = searchKey.keyFieldOfType(*fieldType());
     for (CostDBTypes::EntryTable::iterator i = components.begin();
          i != components.end(); i++) {
 
         EntryKeyField field = (*i)->keyFieldOfType(*fieldType());
+        std::size_t othersHash = 0;
+        for (int f = 0; f < (*i)->fieldCount(); f++) {
+            if ((*i)->field(f).type() != fieldType()) {
+                othersHash += (*i)->field(f).hashValue();
+            }
+        }
+        vector<std::size_t>& candidates = pairsByOthers[othersHash];
         bool newPair = true;
-        for (vector<Pair>::iterator p = entries.begin();
-             p != entries.end(); p++) {
+        for (vector<std::size_t>::iterator c = candidates.begin();
+             c != candidates.end(); c++) {
+
+            vector<Pair>::iterator p = entries.begin() + *c;
 
             if ((p->smaller != 0 && 
                  !onlyThisFieldDiffers(fieldType(), *(p->smaller), *(*i))) ||
@@ -151,6 +168,7 @@ Interpolation::filter(
                 pair.greater = *i;
                 pair.smaller = 0;
             }
+            candidates.push_back(entries.size());
             entries.push_back(pair);
         }
     }
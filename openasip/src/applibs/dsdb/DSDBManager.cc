@@ -47,6 +47,7 @@
 #include "FileSystem.hh"
 #include "MachineConnectivityCheck.hh"
 #include "ObjectState.hh"
+#include "BinarySerializer.hh"
 
 using std::pair;
 using std::map;
@@ -56,12 +57,87 @@ using std::make_pair;
 using std::string;
 using namespace CostEstimator;
 
+const unsigned int DSDBManager::MAX_CACHED_ARCHITECTURES = 64;
+
+/// Version 1 adds the binary ADF column adf_binary to the architecture
+/// table. Version 0 databases store the architectures only as XML.
+const int DSDBManager::DSDB_VERSION = 1;
+
 const string CREATE_ARCH_TABLE =
     "CREATE TABLE architecture ("
     "       id INTEGER PRIMARY KEY,"
     "       connection_count INTEGER DEFAULT NULL, "
     "       adf_hash VARCHAR,"
-    "       adf_xml VARCHAR)";
+    "       adf_xml VARCHAR,"
+    "       adf_binary VARCHAR)";
+
+const string ADD_ARCH_BINARY_COLUMN =
+    "ALTER TABLE architecture ADD COLUMN adf_binary VARCHAR";
+
+namespace {
+    const char HEX_DIGITS[] = "0123456789abcdef";
+
+    /**
+     * Encodes the given bytes as a string of hexadecimal digits.
+     *
+     * The SQL interface handles only text, so the binary ADF is stored
+     * in this form.
+     *
+     * @param data The bytes to encode.
+     * @return The hexadecimal string.
+     */
+    string
+    hexEncode(const string& data) {
+        string hex;
+        hex.reserve(data.size() * 2);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            unsigned char byte = static_cast<unsigned char>(data[i]);
+            hex += HEX_DIGITS[byte >> 4];
+            hex += HEX_DIGITS[byte & 0xf];
+        }
+        return hex;
+    }
+
+    /**
+     * Returns the value of the given hexadecimal digit, -1 if invalid.
+     */
+    int
+    hexValue(char digit) {
+        if (digit >= '0' && digit <= '9') {
+            return digit - '0';
+        } else if (digit >= 'a' && digit <= 'f') {
+            return digit - 'a' + 10;
+        } else if (digit >= 'A' && digit <= 'F') {
+            return digit - 'A' + 10;
+        }
+        return -1;
+    }
+
+    /**
+     * Decodes a string of hexadecimal digits created with hexEncode().
+     *
+     * @param hex The hexadecimal string.
+     * @param data The decoded bytes are stored here.
+     * @return False if the string is not valid hexadecimal data.
+     */
+    bool
+    hexDecode(const string& hex, string& data) {
+        if (hex.size() % 2 != 0) {
+            return false;
+        }
+        data.clear();
+        data.reserve(hex.size() / 2);
+        for (std::size_t i = 0; i < hex.size(); i += 2) {
+            int high = hexValue(hex[i]);
+            int low = hexValue(hex[i + 1]);
+            if (high < 0 || low < 0) {
+                return false;
+            }
+            data += static_cast<char>((high << 4) | low);
+        }
+        return true;
+    }
+}
 
 const string CREATE_IMPL_TABLE =
     "CREATE TABLE implementation ("
@@ -100,7 +176,8 @@ const string CREATE_ENERGY_ESTIMATE_TABLE =
 /**
  * The Constructor.
  *
- * Loads a DSDB from the given file.
+ * Loads a DSDB from the given file. Databases created by older versions
+ * are updated to the current schema.
  *
  * @param file DSDB file to load.
  * @throw IOException if the DSDB file couldn't be succesfully loaded.
@@ -118,6 +195,22 @@ DSDBManager::DSDBManager(const std::string& file)
         throw IOException(
             __FILE__, __LINE__, __func__, exception.errorMessage());
     }
+
+    // Update outdated DSDB.
+    // Version 0 indicates db without version number also.
+    int dbVersion = dbConnection_->version();
+
+    // Version 0 -> 1
+    if (dbVersion < 1) {
+        // binary ADF next to the XML, old rows keep only the XML
+        try {
+            dbConnection_->DDLQuery(ADD_ARCH_BINARY_COLUMN);
+        } catch (const RelationalDBException& exception) {
+            throw IOException(
+                __FILE__, __LINE__, __func__, exception.errorMessage());
+        }
+        dbConnection_->updateVersion(1);
+    }
 }
 
 /**
@@ -155,6 +248,7 @@ DSDBManager::createNew(const std::string& file) {
         connection.DDLQuery(CREATE_APPLICATION_TABLE);
         connection.DDLQuery(CREATE_CYCLE_COUNT_TABLE);
         connection.DDLQuery(CREATE_ENERGY_ESTIMATE_TABLE);
+        connection.updateVersion(DSDB_VERSION);
 
         db.close(connection);
     } catch (const Exception& e) {
@@ -184,19 +278,17 @@ DSDBManager::dsdbFile() const {
  * In case an existing equal architecture is found in the DB,
  * does not add a new one, but returns the ID of the old one.
  *
+ * A copy of the added machine is kept in the in-memory architecture
+ * cache so that explorer plugins reading it back in the same process
+ * do not need to parse the ADF XML again.
+ *
  * @param mom Machine architecture to add.
  * @return RowID of the added architecture.
  */
 RowID
 DSDBManager::addArchitecture(const TTAMachine::Machine& mom) {
-    RowID existing = architectureId(mom);
-    if (existing != ILLEGAL_ROW_ID) {
-        return existing;
-    }    
-
     string adf = "";
     try {
-        dbConnection_->beginTransaction();
         ADFSerializer serializer;
         serializer.setDestinationString(adf);
         ObjectState* os = mom.saveState();
@@ -216,14 +308,26 @@ DSDBManager::addArchitecture(const TTAMachine::Machine& mom) {
         assert(false);
     }
 
+    // the hash is computed from the ADF written above instead of
+    // calling Machine::hash(), which would serialize the machine again
+    const TCEString hash = TTAMachine::Machine::hash(adf);
+    RowID existing = architectureIdByHash(hash);
+    if (existing != ILLEGAL_ROW_ID) {
+        return existing;
+    }    
+
+    const std::string binary = binaryADF(mom);
+
     RowID id = -1;
     try {
+        dbConnection_->beginTransaction();
         dbConnection_->updateQuery(
             (boost::format(
                 "INSERT INTO architecture(id, adf_hash, adf_xml, "
-                "connection_count) VALUES"
-                "(NULL, \'%s\', \'%s\', %d);") %
-             mom.hash() % adf % 
+                "adf_binary, connection_count) VALUES"
+                "(NULL, \'%s\', \'%s\', %s, %d);") %
+             hash % adf %
+             (binary.empty() ? string("NULL") : "'" + binary + "'") %
              MachineConnectivityCheck::totalConnectionCount(mom)).str());
         id = dbConnection_->lastInsertRowID();
         dbConnection_->commit();
@@ -237,6 +341,9 @@ DSDBManager::addArchitecture(const TTAMachine::Machine& mom) {
         assert(false);
     }
 
+    cacheArchitecture(
+        id, std::shared_ptr<const TTAMachine::Machine>(
+            new TTAMachine::Machine(mom)));
     return id;
 }
 
@@ -693,22 +800,114 @@ DSDBManager::architectureString(RowID id) const {
     return arch;
 }
 
+/**
+ * Loads the machine architecture of the given id from its binary ADF.
+ *
+ * The binary ADF is loaded without XML parsing. Architectures added by
+ * older versions have no binary ADF, and binary ADFs written in a newer
+ * binary format version cannot be read; NULL is returned for both so
+ * that the caller falls back to the XML.
+ *
+ * @param id RowID of the machine architecture.
+ * @return The machine or NULL if there is no readable binary ADF.
+ */
+TTAMachine::Machine*
+DSDBManager::binaryArchitecture(RowID id) const {
+    RelationalDBQueryResult* result = NULL;
+    try {
+        result = dbConnection_->query(
+            "SELECT adf_binary FROM architecture WHERE id=" +
+            Conversion::toString(id) + ";");
+    } catch (const Exception& e) {
+        delete result;
+        abortWithError(e.errorMessage());
+    }
+
+    if (!result->hasNext()) {
+        delete result;
+        return NULL;
+    }
+
+    result->next();
+    const DataObject& binaryData = result->data(0);
+    std::string binary;
+    bool valid =
+        !binaryData.isNull() && hexDecode(binaryData.stringValue(), binary);
+    delete result;
+    if (!valid) {
+        return NULL;
+    }
+
+    TTAMachine::Machine* mach = NULL;
+    ObjectState* state = NULL;
+    try {
+        ADFSerializer serializer;
+        serializer.setSourceString(binary);
+        state = serializer.readState();
+        mach = new TTAMachine::Machine();
+        mach->loadState(state);
+    } catch (const Exception& e) {
+        debugLog(
+            "Binary ADF of architecture " + Conversion::toString(id) +
+            " could not be read, using the XML: " + e.errorMessage());
+        delete mach;
+        mach = NULL;
+    }
+    delete state;
+    return mach;
+}
+
+/**
+ * Encodes the given machine as a binary ADF stored in the database.
+ *
+ * @param mom The machine to encode.
+ * @return The hex encoded binary ADF, empty string if encoding failed.
+ */
+std::string
+DSDBManager::binaryADF(const TTAMachine::Machine& mom) {
+    std::string binary;
+    ObjectState* state = mom.saveState();
+    try {
+        ADFSerializer serializer;
+        serializer.setBinaryOutput(true);
+        serializer.setDestinationString(binary);
+        serializer.writeState(state);
+    } catch (const SerializerException& e) {
+        // the XML is always stored, so the binary ADF is optional
+        debugLog(e.errorMessage());
+        binary.clear();
+    }
+    delete state;
+    return hexEncode(binary);
+}
+
 /**
  * Returns the row ID of the given architecture.
  *
  * Searches for the architecture using its Machine::hash() string.
- *e
- * @param id RowID of the machine architecture. ILLEGAL_ROW_ID, if not found.
- * @return The architecture ID.
+ *
+ * @param mach The machine architecture to search for.
+ * @return The architecture ID, ILLEGAL_ROW_ID if not found.
  */
 RowID
 DSDBManager::architectureId(const TTAMachine::Machine& mach) const {
+    return architectureIdByHash(mach.hash());
+}
+
+/**
+ * Returns the row ID of the architecture with the given hash string.
+ *
+ * @param hash The Machine::hash() string of the architecture.
+ * @return The architecture ID, ILLEGAL_ROW_ID if not found.
+ */
+RowID
+DSDBManager::architectureIdByHash(const std::string& hash) const {
 
     RelationalDBQueryResult* result = NULL;
     try {
         result = dbConnection_->query(
             TCEString("SELECT id FROM architecture WHERE adf_hash = \'") +
-            mach.hash() + "\';");
+            hash + "\';");
     } catch (const Exception& e) {
         delete result;
         abortWithError(e.errorMessage());
@@ -800,20 +999,71 @@ DSDBManager::configurationId(const MachineConfiguration& conf) const {
 /**
  * Returns machine architecture with the given id.
  *
+ * The returned machine is a private copy owned by the caller, who may
+ * freely modify it. Callers that only read the machine should use
+ * sharedArchitecture() instead to avoid the copy.
+ *
  * @param id RowID of the machine architecture.
  * @return Machine object model of the architecture.
  */
 TTAMachine::Machine*
 DSDBManager::architecture(RowID id) const {
-    const std::string adf = architectureString(id);
-    ADFSerializer serializer;
-    serializer.setSourceString(adf);
-    ObjectState* state = serializer.readState();
-    TTAMachine::Machine* mach = new TTAMachine::Machine();
-    mach->loadState(state);
-    delete state;
+    return new TTAMachine::Machine(*sharedArchitecture(id));
+}
 
-    return mach;
+/**
+ * Returns a read-only machine architecture with the given id.
+ *
+ * The machine is shared with the in-memory architecture cache of the
+ * manager and is loaded from the database only on the first request.
+ * The binary ADF is used when the database has one, the XML otherwise.
+ * The returned handle stays valid even if the entry is later dropped
+ * from the cache. A modifiable copy can be obtained with architecture().
+ *
+ * @param id RowID of the machine architecture.
+ * @return Machine object model of the architecture.
+ * @exception KeyNotFound If the architecture was not found.
+ */
+std::shared_ptr<const TTAMachine::Machine>
+DSDBManager::sharedArchitecture(RowID id) const {
+    ArchitectureCache::const_iterator cached = architectureCache_.find(id);
+    if (cached != architectureCache_.end()) {
+        return cached->second;
+    }
+
+    TTAMachine::Machine* mach = binaryArchitecture(id);
+    if (mach == NULL) {
+        const std::string adf = architectureString(id);
+        ADFSerializer serializer;
+        serializer.setSourceString(adf);
+        ObjectState* state = serializer.readState();
+        mach = new TTAMachine::Machine();
+        mach->loadState(state);
+        delete state;
+    }
+
+    std::shared_ptr<const TTAMachine::Machine> shared(mach);
+    cacheArchitecture(id, shared);
+    return shared;
+}
+
+/**
+ * Stores an architecture to the in-memory architecture cache.
+ *
+ * The cache is emptied when it grows over MAX_CACHED_ARCHITECTURES
+ * entries to bound the memory use of long exploration runs.
+ *
+ * @param id RowID of the machine architecture.
+ * @param mach The machine, must not be modified after caching.
+ */
+void
+DSDBManager::cacheArchitecture(
+    RowID id, std::shared_ptr<const TTAMachine::Machine> mach) const {
+
+    if (architectureCache_.size() >= MAX_CACHED_ARCHITECTURES) {
+        architectureCache_.clear();
+    }
+    architectureCache_[id] = mach;
 }
 
 /**
@@ -35,6 +35,8 @@
 
 #include <string>
 #include <set>
+#include <map>
+#include <memory>
 #include <vector>
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_comparison.hpp>
@@ -198,6 +200,8 @@ public:
 
     bool hasArchitecture(RowID id) const;
     TTAMachine::Machine* architecture(RowID id) const;
+    std::shared_ptr<const TTAMachine::Machine> sharedArchitecture(
+        RowID id) const;
 
     RowID architectureId(const TTAMachine::Machine& mach) const;
 
@@ -244,7 +248,21 @@ public:
     int applicationCount() const;
 private:
     std::string architectureString(RowID id) const;
+    TTAMachine::Machine* binaryArchitecture(RowID id) const;
+    static std::string binaryADF(const TTAMachine::Machine& mom);
     std::string implementationString(RowID id) const;
+    RowID architectureIdByHash(const std::string& hash) const;
+    void cacheArchitecture(
+        RowID id, std::shared_ptr<const TTAMachine::Machine> mach) const;
+
+    /// Type for the in-memory architecture cache.
+    typedef std::map<RowID, std::shared_ptr<const TTAMachine::Machine> >
+    ArchitectureCache;
+
+    /// Maximum number of architectures kept in the in-memory cache.
+    static const unsigned int MAX_CACHED_ARCHITECTURES;
+    /// Current version of the DSDB schema.
+    static const int DSDB_VERSION;
 
     /// Handle to the database.
     SQLite* db_;
@@ -252,6 +270,8 @@ private:
     RelationalDBConnection* dbConnection_;
     /// The DSDB file containing the current database.
     std::string file_;
+    /// Already loaded or added architectures, indexed by their RowID.
+    mutable ArchitectureCache architectureCache_;
 };
 
 #endif
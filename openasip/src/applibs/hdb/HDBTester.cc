@@ -30,18 +30,29 @@
  * @note rating: red
  */
 #include <iostream>
+#include <fstream>
 #include <string>
 #include <vector>
 #include <set>
+#include <map>
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 #include "HDBTester.hh"
 #include "ImplementationTester.hh"
 #include "HDBRegistry.hh"
+#include "FileSystem.hh"
+#include "Conversion.hh"
 using std::string;
 using std::vector;
 using std::set;
 
 HDBTester::HDBTester(): infoStream_(NULL), errorStream_(NULL), sim_(SIM_GHDL),
-                        verbose_(false), leaveDirty_(false) {
+                        verbose_(false), leaveDirty_(false), jobCount_(1),
+                        resultCache_("") {
 }
 
 HDBTester::HDBTester(
@@ -49,7 +60,8 @@ HDBTester::HDBTester(
     std::ostream& errorStream,
     VhdlSim simulator, bool verbose, bool leaveDirty):
     infoStream_(&infoStream), errorStream_(&errorStream), sim_(simulator),
-    verbose_(verbose), leaveDirty_(leaveDirty) {
+    verbose_(verbose), leaveDirty_(leaveDirty), jobCount_(1),
+    resultCache_("") {
 }
 
 HDBTester::~HDBTester() {
@@ -66,25 +78,78 @@ HDBTester::testAllEntries(std::string hdbFile) {
         return false;
     }
 
-    bool noFailures = true;
+    vector<EntryTest> entries;
     set<int> fus = implTester->fuEntryIDs();
     for (set<int>::iterator iter = fus.begin(); iter != fus.end(); iter++) {
-        if (!testFU(*iter, implTester)) {
-            noFailures = false;
-            std::cerr << "FU Entry " << *iter << " from " << hdbFile
-                      << " failed." << std::endl;
-        }
+        EntryTest entry = {true, *iter, "", false, false};
+        entries.push_back(entry);
     }
-
     set<int> rfs = implTester->rfEntryIDs();
     for (set<int>::iterator iter = rfs.begin(); iter != rfs.end(); iter++) {
-        if (!testRF(*iter, implTester)) {
+        EntryTest entry = {false, *iter, "", false, false};
+        entries.push_back(entry);
+    }
+
+    ResultCache cache;
+    if (!resultCache_.empty()) {
+        readResultCache(cache);
+    }
+
+    vector<unsigned int> toRun;
+    for (unsigned int i = 0; i < entries.size(); i++) {
+        EntryTest& entry = entries.at(i);
+        if (!resultCache_.empty()) {
+            try {
+                entry.digest = entry.isFU ?
+                    implTester->fuTestDigest(entry.id) :
+                    implTester->rfTestDigest(entry.id);
+            } catch (const Exception&) {
+                // let the actual test report the problem
+                entry.digest = "";
+            }
+            ResultCache::const_iterator cached = cache.find(cacheKey(entry));
+            if (!entry.digest.empty() && cached != cache.end() &&
+                cached->second == entry.digest) {
+                entry.skipped = true;
+                entry.passed = true;
+                if (infoStream_ != NULL) {
+                    *infoStream_ << cacheKey(entry) << " is unchanged "
+                                 << "since it last passed, skipping."
+                                 << std::endl;
+                }
+                continue;
+            }
+        }
+        toRun.push_back(i);
+    }
+
+    if (effectiveJobCount() > 1 && toRun.size() > 1) {
+        delete implTester;
+        implTester = NULL;
+        runEntriesInParallel(hdbFile, entries, toRun);
+    } else {
+        for (unsigned int i = 0; i < toRun.size(); i++) {
+            EntryTest& entry = entries.at(toRun.at(i));
+            entry.passed = runEntry(entry, implTester);
+            if (!entry.passed) {
+                std::cerr << (entry.isFU ? "FU" : "RF") << " Entry "
+                          << entry.id << " from " << hdbFile << " failed."
+                          << std::endl;
+            }
+        }
+        delete implTester;
+    }
+
+    bool noFailures = true;
+    for (unsigned int i = 0; i < entries.size(); i++) {
+        if (!entries.at(i).passed) {
             noFailures = false;
-            std::cerr << "RF Entry " << *iter << " from " << hdbFile
-                      << " failed." << std::endl;
         }
     }
-    delete implTester;
+
+    if (!resultCache_.empty()) {
+        writeResultCache(entries);
+    }
     return noFailures;
 }
 
@@ -208,3 +273,256 @@ HDBTester::testRF(int id, ImplementationTester* tester) {
     }
     return success;
 }
+
+/**
+ * Sets the number of entries testAllEntries() tests simultaneously.
+ *
+ * Each entry is then tested in a process of its own, with its own
+ * temporary directory. The output of the entries is printed in entry
+ * order once all of them have finished.
+ *
+ * @param jobs Number of simultaneous tests, 0 for one per processor core.
+ */
+void
+HDBTester::setJobCount(int jobs) {
+
+    jobCount_ = jobs;
+}
+
+/**
+ * Enables skipping of entries that have passed before and are unchanged.
+ *
+ * The digests of the passed entries are kept in the given file. An entry
+ * is skipped if its digest equals the one stored from the earlier run.
+ * The digest covers the architecture, implementation and HDL files of the
+ * entry, the OSAL modules of its operations and the testbench generator.
+ *
+ * @see ImplementationTester::fuTestDigest
+ *
+ * @param cacheFile File to read and store the passed entries in.
+ */
+void
+HDBTester::setResultCache(const std::string& cacheFile) {
+
+    resultCache_ = cacheFile;
+}
+
+/**
+ * Tests one FU or RF entry.
+ *
+ * @param entry The entry to test.
+ * @param tester Implementation tester with the HDB of the entry open.
+ * @return True if the entry passed.
+ */
+bool
+HDBTester::runEntry(const EntryTest& entry, ImplementationTester* tester) {
+
+    return entry.isFU ?
+        testFU(entry.id, tester) : testRF(entry.id, tester);
+}
+
+/**
+ * Tests the given entries in at most effectiveJobCount() child processes.
+ *
+ * Processes are used instead of threads because the HDL simulators change
+ * the working directory of the process. The children only read the HDB.
+ * Output of each child is captured to files and copied to the streams in
+ * entry order, so the output does not depend on the scheduling.
+ *
+ * @param hdbFile The HDB the entries are from.
+ * @param entries All entries, the results are stored here.
+ * @param toRun Indices of the entries to test.
+ */
+void
+HDBTester::runEntriesInParallel(
+    const std::string& hdbFile,
+    std::vector<EntryTest>& entries,
+    const std::vector<unsigned int>& toRun) {
+
+    string logDir = FileSystem::createTempDirectory();
+    const string DS = FileSystem::DIRECTORY_SEPARATOR;
+    vector<string> logBases;
+    for (unsigned int i = 0; i < toRun.size(); i++) {
+        logBases.push_back(
+            logDir + DS + "entry" + Conversion::toString(i));
+    }
+
+    // flush so that the children do not inherit pending output
+    std::cout.flush();
+    std::cerr.flush();
+    if (infoStream_ != NULL) {
+        infoStream_->flush();
+    }
+    if (errorStream_ != NULL) {
+        errorStream_->flush();
+    }
+
+    std::map<pid_t, unsigned int> running;
+    unsigned int next = 0;
+    unsigned int maxRunning = effectiveJobCount();
+    while (next < toRun.size() || !running.empty()) {
+        while (next < toRun.size() && running.size() < maxRunning) {
+            EntryTest& entry = entries.at(toRun.at(next));
+            pid_t pid = fork();
+            if (pid == 0) {
+                // everything the entry prints, also directly to the
+                // standard streams and from the HDL simulators, goes to
+                // the files of the entry
+                redirectOutput(
+                    STDOUT_FILENO, logBases.at(next) + ".info");
+                redirectOutput(
+                    STDERR_FILENO, logBases.at(next) + ".error");
+                if (infoStream_ != NULL) {
+                    infoStream_ = &std::cout;
+                }
+                if (errorStream_ != NULL) {
+                    errorStream_ = &std::cerr;
+                }
+                ImplementationTester* tester = initializeTester(hdbFile);
+                bool success = tester != NULL && runEntry(entry, tester);
+                delete tester;
+                std::cout.flush();
+                std::cerr.flush();
+                fflush(NULL);
+                _exit(success ? 0 : 1);
+            } else if (pid < 0) {
+                // could not fork, test the entry in this process instead
+                ImplementationTester* tester = initializeTester(hdbFile);
+                entry.passed = tester != NULL && runEntry(entry, tester);
+                delete tester;
+                next++;
+                continue;
+            }
+            running[pid] = next;
+            next++;
+        }
+        if (running.empty()) {
+            continue;
+        }
+        int status = 0;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        std::map<pid_t, unsigned int>::iterator child = running.find(pid);
+        if (child == running.end()) {
+            continue;
+        }
+        entries.at(toRun.at(child->second)).passed =
+            WIFEXITED(status) && WEXITSTATUS(status) == 0;
+        running.erase(child);
+    }
+
+    for (unsigned int i = 0; i < toRun.size(); i++) {
+        const EntryTest& entry = entries.at(toRun.at(i));
+        std::ostream& infoOut =
+            infoStream_ != NULL ? *infoStream_ : std::cout;
+        std::ifstream info((logBases.at(i) + ".info").c_str());
+        if (info.is_open() &&
+            info.peek() != std::ifstream::traits_type::eof()) {
+            infoOut << info.rdbuf();
+        }
+        std::ostream& errorOut =
+            errorStream_ != NULL ? *errorStream_ : std::cerr;
+        std::ifstream error((logBases.at(i) + ".error").c_str());
+        if (error.is_open() &&
+            error.peek() != std::ifstream::traits_type::eof()) {
+            errorOut << error.rdbuf();
+        }
+        if (!entry.passed) {
+            std::cerr << (entry.isFU ? "FU" : "RF") << " Entry "
+                      << entry.id << " from " << hdbFile << " failed."
+                      << std::endl;
+        }
+    }
+    FileSystem::removeFileOrDirectory(logDir);
+}
+
+/**
+ * Makes the given file descriptor write to the given file.
+ *
+ * Used in the child processes of runEntriesInParallel(). If the file
+ * cannot be created, the descriptor is left as it is.
+ *
+ * @param fd The file descriptor to redirect.
+ * @param fileName The file to write to, truncated first.
+ */
+void
+HDBTester::redirectOutput(int fd, const std::string& fileName) {
+
+    int file = open(fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (file < 0) {
+        return;
+    }
+    dup2(file, fd);
+    close(file);
+}
+
+/**
+ * Returns the number of entries to test simultaneously.
+ */
+int
+HDBTester::effectiveJobCount() const {
+
+    if (jobCount_ > 0) {
+        return jobCount_;
+    }
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores > 0 ? static_cast<int>(cores) : 1;
+}
+
+/**
+ * Returns the key of the entry in the result cache.
+ */
+std::string
+HDBTester::cacheKey(const EntryTest& entry) {
+
+    return string(entry.isFU ? "FU" : "RF") + " " +
+        Conversion::toString(entry.id);
+}
+
+/**
+ * Reads the digests of the previously passed entries.
+ *
+ * A missing cache file is the same as an empty one.
+ *
+ * @param cache The digests are stored here.
+ */
+void
+HDBTester::readResultCache(ResultCache& cache) const {
+
+    std::ifstream cacheFile(resultCache_.c_str());
+    string kind;
+    int id = 0;
+    string digest;
+    while (cacheFile >> kind >> id >> digest) {
+        cache[kind + " " + Conversion::toString(id)] = digest;
+    }
+}
+
+/**
+ * Stores the digests of the passed entries to the result cache file.
+ *
+ * @param entries The tested entries.
+ */
+void
+HDBTester::writeResultCache(const std::vector<EntryTest>& entries) const {
+
+    std::ofstream cacheFile(resultCache_.c_str());
+    if (!cacheFile.is_open()) {
+        if (errorStream_ != NULL) {
+            *errorStream_ << "Could not write the result cache "
+                          << resultCache_ << std::endl;
+        }
+        return;
+    }
+    for (unsigned int i = 0; i < entries.size(); i++) {
+        const EntryTest& entry = entries.at(i);
+        if (entry.passed && !entry.digest.empty()) {
+            cacheFile << cacheKey(entry) << " " << entry.digest << std::endl;
+        }
+    }
+}
@@ -34,6 +34,8 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
+#include <map>
 #include "ImplementationTester.hh"
 
 class HDBTester {
@@ -52,8 +54,45 @@ public:
     bool testOneRF(std::string hdbFile, int entryId);
 
     bool testOneFU(std::string hdbFile, int entryId);
+
+    void setJobCount(int jobs);
+
+    void setResultCache(const std::string& cacheFile);
     
 private:
+    /// One FU or RF entry to be tested by testAllEntries().
+    struct EntryTest {
+        /// True for an FU entry, false for an RF entry.
+        bool isFU;
+        /// Entry ID in the HDB.
+        int id;
+        /// Digest of the entry, empty if not computed.
+        std::string digest;
+        /// Result from an earlier run was reused.
+        bool skipped;
+        /// The entry passed its test.
+        bool passed;
+    };
+
+    /// Passed entry digests, keyed by "FU <id>" or "RF <id>".
+    typedef std::map<std::string, std::string> ResultCache;
+
+    bool runEntry(const EntryTest& entry, ImplementationTester* tester);
+
+    void runEntriesInParallel(
+        const std::string& hdbFile,
+        std::vector<EntryTest>& entries,
+        const std::vector<unsigned int>& toRun);
+
+    static void redirectOutput(int fd, const std::string& fileName);
+
+    int effectiveJobCount() const;
+
+    static std::string cacheKey(const EntryTest& entry);
+
+    void readResultCache(ResultCache& cache) const;
+
+    void writeResultCache(const std::vector<EntryTest>& entries) const;
 
     ImplementationTester* initializeTester(std::string hdbFile);
 
@@ -66,6 +105,10 @@ private:
     VhdlSim sim_;
     bool verbose_;
     bool leaveDirty_;
+    /// Number of entries tested simultaneously, 0 for one per core.
+    int jobCount_;
+    /// File where digests of passed entries are kept, empty if none.
+    std::string resultCache_;
 };
 
 #endif
@@ -34,6 +34,7 @@
 #include <set>
 
 #include "MachineConnectivityCheck.hh"
+#include "MachineConnectivityMatrix.hh"
 #include "MachineInfo.hh"
 #include "Application.hh"
 #include "Bus.hh"
@@ -130,14 +131,25 @@ MachineConnectivityCheck::isConnected(
     const TTAMachine::Port& destinationPort,
     const Guard* guard) {
 
-    // TODO: replace this cache's second value(bool) with set of buses.
-    PortPortBoolMap::const_iterator
-        i = portPortCache_.find(PortPortPair(&sourcePort, &destinationPort));
-    if (i != portPortCache_.end()) {
-        if (i->second == false || guard == NULL) {
-            return i->second;
+    MachineConnectivityMatrix::Handle matrix =
+        connectivityMatrix(sourcePort.parentUnit()->machine());
+    if (matrix != NULL && matrix->hasPort(sourcePort) &&
+        matrix->hasPort(destinationPort)) {
+        if (!matrix->isConnected(sourcePort, destinationPort)) {
+            return false;
+        }
+        if (guard == NULL) {
+            return true;
+        }
+        for (const TTAMachine::Bus* bus :
+                 matrix->sharedBuses(sourcePort, destinationPort)) {
+            if (bus->hasGuard(*guard)) {
+                return true;
+            }
         }
+        return false; // bus found but lacks the guards
     }
+
     std::set<const TTAMachine::Bus*> sourceBuses;
     MachineConnectivityCheck::appendConnectedDestinationBuses(
         sourcePort, sourceBuses);
@@ -149,8 +161,6 @@ MachineConnectivityCheck::isConnected(
     std::set<const TTAMachine::Bus*> sharedBuses;
     SetTools::intersection(sourceBuses, destinationBuses, sharedBuses);
     if (sharedBuses.size() > 0) {
-        portPortCache_[PortPortPair(&sourcePort,&destinationPort)] = true;
-
         if (guard == NULL) {
             return true;
         }
@@ -164,7 +174,6 @@ MachineConnectivityCheck::isConnected(
              
         return false; // bus found but lacks the guards
     } else {
-        portPortCache_[PortPortPair(&sourcePort,&destinationPort)] = false;
         return false;
     }
 }
@@ -293,11 +302,12 @@ MachineConnectivityCheck::isConnected(
     const TTAMachine::BaseRegisterFile& sourceRF,
     const TTAMachine::Port& destPort) {
 
-    RfPortBoolMap::const_iterator
-        i = rfPortCache_.find(RfPortPair(&sourceRF, &destPort));
-    if (i != rfPortCache_.end()) {
-        return i->second;
-    }    
+    MachineConnectivityMatrix::Handle matrix =
+        connectivityMatrix(sourceRF.machine());
+    if (matrix != NULL && matrix->hasRegisterFile(sourceRF) &&
+        matrix->hasPort(destPort)) {
+        return matrix->isConnected(sourceRF, destPort);
+    }
     std::set<const TTAMachine::Bus*> destBuses = connectedSourceBuses(destPort);
     std::set<const TTAMachine::Bus*> srcBuses;
 
@@ -311,13 +321,7 @@ MachineConnectivityCheck::isConnected(
     std::set<const TTAMachine::Bus*> sharedBuses;
     SetTools::intersection(
         srcBuses, destBuses, sharedBuses);
-    if (sharedBuses.size() > 0) {
-        rfPortCache_[RfPortPair(&sourceRF,&destPort)] = true;
-        return true;
-    } else {
-        rfPortCache_[RfPortPair(&sourceRF,&destPort)] = false;
-        return false;
-    }
+    return sharedBuses.size() > 0;
 }
 
 /**
@@ -336,13 +340,25 @@ MachineConnectivityCheck::isConnected(
     const TTAMachine::BaseRegisterFile& destRF,
     const TTAMachine::Guard* guard) {
     
-    RfRfBoolMap::const_iterator
-        i = rfRfCache_.find(RfRfPair(&sourceRF, &destRF));
-    if (i != rfRfCache_.end()) {
-        if (i->second == false || guard == NULL) {
-            return i->second;
+    MachineConnectivityMatrix::Handle matrix =
+        connectivityMatrix(sourceRF.machine());
+    if (matrix != NULL && matrix->hasRegisterFile(sourceRF) &&
+        matrix->hasRegisterFile(destRF)) {
+        if (!matrix->isConnected(sourceRF, destRF)) {
+            return false;
+        }
+        if (guard == NULL) {
+            return true;
+        }
+        for (const TTAMachine::Bus* bus :
+                 matrix->sharedBuses(sourceRF, destRF)) {
+            if (bus->hasGuard(*guard)) {
+                return true;
+            }
         }
+        return false; // bus found but lacks the guards
     }
+
     std::set<const TTAMachine::Bus*> srcBuses;
     appendConnectedDestinationBuses(sourceRF, srcBuses);
 
@@ -352,7 +368,6 @@ MachineConnectivityCheck::isConnected(
     std::set<const TTAMachine::Bus*> sharedBuses;
     SetTools::intersection(srcBuses, dstBuses, sharedBuses);
     if (sharedBuses.size() > 0) {
-        rfRfCache_[RfRfPair(&sourceRF,&destRF)] = true;
         if (guard == NULL) {
             return true;
         }
@@ -365,7 +380,6 @@ MachineConnectivityCheck::isConnected(
         }
         return false; // bus found but lacks the guards
     } else {
-        rfRfCache_[RfRfPair(&sourceRF,&destRF)] = false;
         return false;
     }
 }
@@ -411,10 +425,11 @@ MachineConnectivityCheck::isConnected(
     const TTAMachine::Port& sourcePort,
     const TTAMachine::RegisterFile& destRF) {
 
-    PortRfBoolMap::const_iterator
-        i = portRfCache_.find(PortRfPair(&sourcePort, &destRF));
-    if (i != portRfCache_.end()) {
-        return i->second;
+    MachineConnectivityMatrix::Handle matrix =
+        connectivityMatrix(sourcePort.parentUnit()->machine());
+    if (matrix != NULL && matrix->hasPort(sourcePort) &&
+        matrix->hasRegisterFile(destRF)) {
+        return matrix->isConnected(sourcePort, destRF);
     }
 
     std::set<const TTAMachine::Bus*> sourceBuses =
@@ -431,13 +446,7 @@ MachineConnectivityCheck::isConnected(
     std::set<const TTAMachine::Bus*> sharedBuses;
     SetTools::intersection(sourceBuses, destBuses, sharedBuses);
 
-    if (sharedBuses.size() > 0) {
-        portRfCache_[PortRfPair(&sourcePort,&destRF)] = true;
-        return true;
-    } else {
-        portRfCache_[PortRfPair(&sourcePort,&destRF)] = false;
-        return false;
-    }
+    return sharedBuses.size() > 0;
 }
 
 /**
@@ -1865,11 +1874,20 @@ MachineConnectivityCheck::addAnnotatedFUs(
     }
 }
 
-/* These are static */
-MachineConnectivityCheck::PortPortBoolMap MachineConnectivityCheck::portPortCache_;
-MachineConnectivityCheck::RfRfBoolMap MachineConnectivityCheck::rfRfCache_;
-MachineConnectivityCheck::RfPortBoolMap MachineConnectivityCheck::rfPortCache_;
-MachineConnectivityCheck::PortRfBoolMap MachineConnectivityCheck::portRfCache_;
+/**
+ * Returns the shared connectivity matrix of the given machine.
+ *
+ * @param machine The machine, can be NULL for unregistered components.
+ * @return The matrix or NULL if no machine was given.
+ */
+MachineConnectivityMatrix::Handle
+MachineConnectivityCheck::connectivityMatrix(
+    const TTAMachine::Machine* machine) {
+    if (machine == NULL) {
+        return MachineConnectivityMatrix::Handle();
+    }
+    return MachineConnectivityMatrix::matrixFor(*machine);
+}
 
 
 bool
@@ -1948,12 +1966,12 @@ MachineConnectivityCheck::isConnectedWithBothGuards(
     const TTAMachine::BaseRegisterFile& destRF,
     std::pair<const RegisterFile*,int> guardReg) {
     
-    RfRfBoolMap::const_iterator
-        i = rfRfCache_.find(RfRfPair(&sourceRF, &destRF));
-    if (i != rfRfCache_.end()) {
-        if (i->second == false) {
-            return false;
-        }
+    MachineConnectivityMatrix::Handle matrix =
+        connectivityMatrix(sourceRF.machine());
+    if (matrix != NULL && matrix->hasRegisterFile(sourceRF) &&
+        matrix->hasRegisterFile(destRF) &&
+        !matrix->isConnected(sourceRF, destRF)) {
+        return false;
     }
     std::set<const TTAMachine::Bus*> srcBuses;
     appendConnectedDestinationBuses(sourceRF, srcBuses);
@@ -1967,7 +1985,6 @@ MachineConnectivityCheck::isConnectedWithBothGuards(
     bool trueOK = false;
     bool falseOK = false;
     if (sharedBuses.size() > 0) {
-        rfRfCache_[RfRfPair(&sourceRF,&destRF)] = true;
         for (auto bus: sharedBuses) {
             std::pair<bool, bool> guardsOK = hasBothGuards(bus, guardReg);
             trueOK |= guardsOK.first;
@@ -0,0 +1,372 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file MachineConnectivityMatrix.cc
+ *
+ * Implementation of MachineConnectivityMatrix class.
+ *
+ * @note rating: red
+ */
+
+#include "MachineConnectivityMatrix.hh"
+#include "Machine.hh"
+#include "Bus.hh"
+#include "Segment.hh"
+#include "Socket.hh"
+#include "Port.hh"
+#include "Unit.hh"
+#include "BaseRegisterFile.hh"
+#include "RegisterFile.hh"
+#include "ImmediateUnit.hh"
+#include "FunctionUnit.hh"
+#include "ControlUnit.hh"
+
+using namespace TTAMachine;
+
+/// Maximum number of machines whose matrices are kept in the cache.
+static const unsigned MAX_CACHED_MACHINES = 32;
+
+MachineConnectivityMatrix::MatrixCache MachineConnectivityMatrix::cache_;
+boost::mutex MachineConnectivityMatrix::cacheMutex_;
+
+/**
+ * Collects all the units of the machine that have ports.
+ */
+static std::vector<const Unit*>
+machineUnits(const Machine& machine) {
+    std::vector<const Unit*> units;
+    for (const FunctionUnit* fu : machine.functionUnitNavigator()) {
+        units.push_back(fu);
+    }
+    if (machine.controlUnit() != NULL) {
+        units.push_back(machine.controlUnit());
+    }
+    for (const RegisterFile* rf : machine.registerFileNavigator()) {
+        units.push_back(rf);
+    }
+    for (const ImmediateUnit* iu : machine.immediateUnitNavigator()) {
+        units.push_back(iu);
+    }
+    return units;
+}
+
+static int
+machinePortCount(const Machine& machine) {
+    int count = 0;
+    for (const Unit* unit : machineUnits(machine)) {
+        count += unit->portCount();
+    }
+    return count;
+}
+
+static int
+machineRFCount(const Machine& machine) {
+    return machine.registerFileNavigator().count() +
+        machine.immediateUnitNavigator().count();
+}
+
+/**
+ * Marks the buses connected to the given socket into the row of the matrix.
+ */
+static void
+markSocketBuses(
+    const Socket* socket,
+    const std::unordered_map<const Bus*, int>& busIndices,
+    BitMatrix& matrix, int row) {
+
+    if (socket == NULL) {
+        return;
+    }
+    for (int i = 0; i < socket->segmentCount(); ++i) {
+        const Bus* bus = socket->segment(i)->parentBus();
+        matrix.setBit(busIndices.find(bus)->second, row, true);
+    }
+}
+
+/**
+ * Builds the connectivity matrix of the given machine.
+ *
+ * @param machine The machine to analyze.
+ */
+MachineConnectivityMatrix::MachineConnectivityMatrix(
+    const TTAMachine::Machine& machine) :
+    version_(machine.version()),
+    portWrites_(
+        machine.busNavigator().count(), machinePortCount(machine), false),
+    portReads_(
+        machine.busNavigator().count(), machinePortCount(machine), false),
+    rfWrites_(
+        machine.busNavigator().count(), machineRFCount(machine), false),
+    rfReads_(
+        machine.busNavigator().count(), machineRFCount(machine), false),
+    portPort_(
+        machinePortCount(machine), machinePortCount(machine), false),
+    rfRf_(machineRFCount(machine), machineRFCount(machine), false),
+    rfPort_(machineRFCount(machine), machinePortCount(machine), false),
+    portRf_(machinePortCount(machine), machineRFCount(machine), false) {
+
+    std::unordered_map<const Bus*, int> busIndices;
+    for (const Bus* bus : machine.busNavigator()) {
+        busIndices[bus] = buses_.size();
+        buses_.push_back(bus);
+    }
+
+    // the buses each port and register file can write to and read from
+    for (const Unit* unit : machineUnits(machine)) {
+        const BaseRegisterFile* rf =
+            dynamic_cast<const BaseRegisterFile*>(unit);
+        int rfRow = -1;
+        if (rf != NULL) {
+            rfRow = rfIndices_.size();
+            rfIndices_[rf] = rfRow;
+        }
+        for (int p = 0; p < unit->portCount(); ++p) {
+            const Port* port = unit->port(p);
+            int portRow = portIndices_.size();
+            portIndices_[port] = portRow;
+            markSocketBuses(
+                port->outputSocket(), busIndices, portWrites_, portRow);
+            markSocketBuses(
+                port->inputSocket(), busIndices, portReads_, portRow);
+            if (rf != NULL) {
+                markSocketBuses(
+                    port->outputSocket(), busIndices, rfWrites_, rfRow);
+                markSocketBuses(
+                    port->inputSocket(), busIndices, rfReads_, rfRow);
+            }
+        }
+    }
+
+    const int ports = portIndices_.size();
+    const int rfs = rfIndices_.size();
+    for (int src = 0; src < ports; ++src) {
+        for (int dst = 0; dst < ports; ++dst) {
+            if (rowsIntersect(portWrites_, src, portReads_, dst)) {
+                portPort_.setBit(src, dst, true);
+            }
+        }
+        for (int dst = 0; dst < rfs; ++dst) {
+            if (rowsIntersect(portWrites_, src, rfReads_, dst)) {
+                portRf_.setBit(src, dst, true);
+            }
+        }
+    }
+    for (int src = 0; src < rfs; ++src) {
+        for (int dst = 0; dst < rfs; ++dst) {
+            if (rowsIntersect(rfWrites_, src, rfReads_, dst)) {
+                rfRf_.setBit(src, dst, true);
+            }
+        }
+        for (int dst = 0; dst < ports; ++dst) {
+            if (rowsIntersect(rfWrites_, src, portReads_, dst)) {
+                rfPort_.setBit(src, dst, true);
+            }
+        }
+    }
+}
+
+MachineConnectivityMatrix::~MachineConnectivityMatrix() {
+}
+
+/**
+ * Returns the connectivity matrix of the given machine.
+ *
+ * The matrix is built on the first query and rebuilt when the version of
+ * the machine changes. The returned matrix stays valid as long as the
+ * handle is kept, even if the machine is modified or deleted.
+ *
+ * This method can be called concurrently from several threads.
+ *
+ * @param machine The machine.
+ * @return The connectivity matrix of the current version of the machine.
+ */
+MachineConnectivityMatrix::Handle
+MachineConnectivityMatrix::matrixFor(const TTAMachine::Machine& machine) {
+    // the same machine is queried repeatedly, avoid locking for it
+    thread_local const Machine* lastMachine = NULL;
+    thread_local Handle lastMatrix;
+    if (lastMachine == &machine &&
+        lastMatrix->version() == machine.version()) {
+        return lastMatrix;
+    }
+
+    Handle matrix;
+    {
+        boost::lock_guard<boost::mutex> lock(cacheMutex_);
+        MatrixCache::const_iterator i = cache_.find(&machine);
+        if (i != cache_.end() && i->second->version() == machine.version()) {
+            matrix = i->second;
+        }
+    }
+    if (matrix == NULL) {
+        // build outside the lock, a concurrent duplicate build is harmless
+        matrix = Handle(new MachineConnectivityMatrix(machine));
+        boost::lock_guard<boost::mutex> lock(cacheMutex_);
+        if (cache_.size() >= MAX_CACHED_MACHINES &&
+            cache_.find(&machine) == cache_.end()) {
+            cache_.clear();
+        }
+        cache_[&machine] = matrix;
+    }
+    lastMachine = &machine;
+    lastMatrix = matrix;
+    return matrix;
+}
+
+/**
+ * Drops all the cached matrices.
+ *
+ * Handles already given out stay valid.
+ */
+void
+MachineConnectivityMatrix::clearCache() {
+    boost::lock_guard<boost::mutex> lock(cacheMutex_);
+    cache_.clear();
+}
+
+/**
+ * Returns true if the port belongs to the analyzed machine.
+ */
+bool
+MachineConnectivityMatrix::hasPort(const TTAMachine::Port& port) const {
+    return portIndices_.find(&port) != portIndices_.end();
+}
+
+/**
+ * Returns true if the RF or IU belongs to the analyzed machine.
+ */
+bool
+MachineConnectivityMatrix::hasRegisterFile(
+    const TTAMachine::BaseRegisterFile& rf) const {
+    return rfIndices_.find(&rf) != rfIndices_.end();
+}
+
+/**
+ * Returns true if there is a bus the source port can write to and the
+ * destination port can read from.
+ */
+bool
+MachineConnectivityMatrix::isConnected(
+    const TTAMachine::Port& source,
+    const TTAMachine::Port& destination) const {
+    return portPort_.bitAt(portIndex(source), portIndex(destination));
+}
+
+/**
+ * Returns true if some output port of the source RF is connected to the
+ * destination port.
+ */
+bool
+MachineConnectivityMatrix::isConnected(
+    const TTAMachine::BaseRegisterFile& source,
+    const TTAMachine::Port& destination) const {
+    return rfPort_.bitAt(rfIndex(source), portIndex(destination));
+}
+
+/**
+ * Returns true if the source port is connected to some input port of the
+ * destination RF.
+ */
+bool
+MachineConnectivityMatrix::isConnected(
+    const TTAMachine::Port& source,
+    const TTAMachine::BaseRegisterFile& destination) const {
+    return portRf_.bitAt(portIndex(source), rfIndex(destination));
+}
+
+/**
+ * Returns true if some output port of the source RF is connected to some
+ * input port of the destination RF.
+ */
+bool
+MachineConnectivityMatrix::isConnected(
+    const TTAMachine::BaseRegisterFile& source,
+    const TTAMachine::BaseRegisterFile& destination) const {
+    return rfRf_.bitAt(rfIndex(source), rfIndex(destination));
+}
+
+/**
+ * Returns the buses that can transport data from the source port to the
+ * destination port.
+ */
+std::vector<const TTAMachine::Bus*>
+MachineConnectivityMatrix::sharedBuses(
+    const TTAMachine::Port& source,
+    const TTAMachine::Port& destination) const {
+    return sharedBuses(
+        portWrites_, portIndex(source), portReads_, portIndex(destination));
+}
+
+/**
+ * Returns the buses that can transport data from the source RF to the
+ * destination RF.
+ */
+std::vector<const TTAMachine::Bus*>
+MachineConnectivityMatrix::sharedBuses(
+    const TTAMachine::BaseRegisterFile& source,
+    const TTAMachine::BaseRegisterFile& destination) const {
+    return sharedBuses(
+        rfWrites_, rfIndex(source), rfReads_, rfIndex(destination));
+}
+
+int
+MachineConnectivityMatrix::portIndex(const TTAMachine::Port& port) const {
+    std::unordered_map<const Port*, int>::const_iterator i =
+        portIndices_.find(&port);
+    assert(i != portIndices_.end() && "Port not in the analyzed machine.");
+    return i->second;
+}
+
+int
+MachineConnectivityMatrix::rfIndex(
+    const TTAMachine::BaseRegisterFile& rf) const {
+    std::unordered_map<const BaseRegisterFile*, int>::const_iterator i =
+        rfIndices_.find(&rf);
+    assert(i != rfIndices_.end() && "RF not in the analyzed machine.");
+    return i->second;
+}
+
+std::vector<const TTAMachine::Bus*>
+MachineConnectivityMatrix::sharedBuses(
+    const BitMatrix& writes, int sourceRow,
+    const BitMatrix& reads, int destinationRow) const {
+
+    std::vector<const Bus*> shared;
+    for (unsigned b = 0; b < buses_.size(); ++b) {
+        if (writes.bitAt(b, sourceRow) && reads.bitAt(b, destinationRow)) {
+            shared.push_back(buses_[b]);
+        }
+    }
+    return shared;
+}
+
+/**
+ * Returns true if the two bus rows have a common bus.
+ */
+bool
+MachineConnectivityMatrix::rowsIntersect(
+    const BitMatrix& first, int firstRow,
+    const BitMatrix& second, int secondRow) {
+
+    for (int b = 0; b < first.columnCount(); ++b) {
+        if (first.bitAt(b, firstRow) && second.bitAt(b, secondRow)) {
+            return true;
+        }
+    }
+    return false;
+}
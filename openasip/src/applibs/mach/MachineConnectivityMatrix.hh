@@ -0,0 +1,141 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file MachineConnectivityMatrix.hh
+ *
+ * Declaration of MachineConnectivityMatrix class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_MACHINE_CONNECTIVITY_MATRIX_HH
+#define TTA_MACHINE_CONNECTIVITY_MATRIX_HH
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+
+#include "BitMatrix.hh"
+
+namespace TTAMachine {
+    class Machine;
+    class Port;
+    class Bus;
+    class BaseRegisterFile;
+}
+
+/**
+ * Precomputed transport reachability of a machine.
+ *
+ * Stores bit matrices of the port-to-port, RF-to-RF, RF-to-port and
+ * port-to-RF connections through a shared bus. The matrix is built once
+ * per machine version and is read-only afterwards, thus the same instance
+ * can be shared by several threads.
+ *
+ * Register files include the immediate units. Ports include the ports of
+ * all the units of the machine, also the special register ports of the
+ * control unit.
+ */
+class MachineConnectivityMatrix {
+public:
+    /// Shared handle to a built matrix.
+    typedef std::shared_ptr<const MachineConnectivityMatrix> Handle;
+
+    MachineConnectivityMatrix(const TTAMachine::Machine& machine);
+    ~MachineConnectivityMatrix();
+
+    static Handle matrixFor(const TTAMachine::Machine& machine);
+    static void clearCache();
+
+    unsigned long long version() const { return version_; }
+
+    bool hasPort(const TTAMachine::Port& port) const;
+    bool hasRegisterFile(const TTAMachine::BaseRegisterFile& rf) const;
+
+    bool isConnected(
+        const TTAMachine::Port& source,
+        const TTAMachine::Port& destination) const;
+    bool isConnected(
+        const TTAMachine::BaseRegisterFile& source,
+        const TTAMachine::Port& destination) const;
+    bool isConnected(
+        const TTAMachine::Port& source,
+        const TTAMachine::BaseRegisterFile& destination) const;
+    bool isConnected(
+        const TTAMachine::BaseRegisterFile& source,
+        const TTAMachine::BaseRegisterFile& destination) const;
+
+    std::vector<const TTAMachine::Bus*> sharedBuses(
+        const TTAMachine::Port& source,
+        const TTAMachine::Port& destination) const;
+    std::vector<const TTAMachine::Bus*> sharedBuses(
+        const TTAMachine::BaseRegisterFile& source,
+        const TTAMachine::BaseRegisterFile& destination) const;
+
+private:
+    /// Copying forbidden.
+    MachineConnectivityMatrix(const MachineConnectivityMatrix&);
+    /// Assignment forbidden.
+    MachineConnectivityMatrix& operator=(const MachineConnectivityMatrix&);
+
+    int portIndex(const TTAMachine::Port& port) const;
+    int rfIndex(const TTAMachine::BaseRegisterFile& rf) const;
+    std::vector<const TTAMachine::Bus*> sharedBuses(
+        const BitMatrix& writes, int sourceRow,
+        const BitMatrix& reads, int destinationRow) const;
+    static bool rowsIntersect(
+        const BitMatrix& first, int firstRow,
+        const BitMatrix& second, int secondRow);
+
+    /// The machine version the matrix was built for.
+    const unsigned long long version_;
+    /// The buses of the machine in navigator order.
+    std::vector<const TTAMachine::Bus*> buses_;
+    /// Indices of the ports.
+    std::unordered_map<const TTAMachine::Port*, int> portIndices_;
+    /// Indices of the register files and immediate units.
+    std::unordered_map<const TTAMachine::BaseRegisterFile*, int> rfIndices_;
+    /// Buses the ports can write to (columns buses, rows ports).
+    BitMatrix portWrites_;
+    /// Buses the ports can read from (columns buses, rows ports).
+    BitMatrix portReads_;
+    /// Buses the register files can write to.
+    BitMatrix rfWrites_;
+    /// Buses the register files can read from.
+    BitMatrix rfReads_;
+    /// Port to port connections (column source, row destination).
+    BitMatrix portPort_;
+    /// RF to RF connections (column source, row destination).
+    BitMatrix rfRf_;
+    /// RF to port connections (column source RF, row destination port).
+    BitMatrix rfPort_;
+    /// Port to RF connections (column source port, row destination RF).
+    BitMatrix portRf_;
+
+    typedef std::map<const TTAMachine::Machine*, Handle> MatrixCache;
+    /// The matrices built so far.
+    static MatrixCache cache_;
+    /// Guards cache_.
+    static boost::mutex cacheMutex_;
+};
+
+#endif
@@ -0,0 +1,338 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file ExecutionProfile.cc
+ *
+ * Implementation of ExecutionProfile class.
+ *
+ * The profile is stored in a text file with one count per line:
+ *
+ *   procedure <count> <procedure name>
+ *   line <count> <line number> <source file name>
+ *
+ * Empty lines and lines starting with '#' are ignored.
+ *
+ * @note rating: red
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#include "ExecutionProfile.hh"
+#include "BasicBlock.hh"
+#include "Instruction.hh"
+#include "Move.hh"
+#include "StringTools.hh"
+#include "Conversion.hh"
+
+const double ExecutionProfile::HOT_THRESHOLD = 0.01;
+
+/**
+ * Constructor.
+ */
+ExecutionProfile::ExecutionProfile() : maxCount_(0) {
+}
+
+/**
+ * Destructor.
+ */
+ExecutionProfile::~ExecutionProfile() {
+}
+
+/**
+ * Adds an execution count of a procedure.
+ *
+ * The highest of the counts added for the procedure is kept.
+ *
+ * @param procedure Name of the procedure.
+ * @param count Execution count.
+ */
+void
+ExecutionProfile::addProcedureCount(
+    const std::string& procedure, CycleCount count) {
+
+    CycleCount& old = procedureCounts_[procedure];
+    old = std::max(old, count);
+    maxCount_ = std::max(maxCount_, count);
+}
+
+/**
+ * Adds an execution count of a source code line.
+ *
+ * The highest of the counts added for the line is kept.
+ *
+ * @param fileName Source file of the line.
+ * @param line Line number.
+ * @param count Execution count.
+ */
+void
+ExecutionProfile::addSourceLineCount(
+    const std::string& fileName, int line, CycleCount count) {
+
+    CycleCount& old = lineCounts_[SourceLine(fileName, line)];
+    old = std::max(old, count);
+    maxCount_ = std::max(maxCount_, count);
+}
+
+/**
+ * Adds the execution count of a move to the counts of its procedure and
+ * source code line.
+ *
+ * @param move The executed move.
+ * @param procedure Name of the procedure the move belongs to.
+ * @param count Execution count of the move.
+ */
+void
+ExecutionProfile::addMoveCount(
+    const TTAProgram::Move& move, const std::string& procedure,
+    CycleCount count) {
+
+    addProcedureCount(procedure, count);
+    if (move.hasSourceLineNumber()) {
+        std::string fileName =
+            move.hasSourceFileName() ? move.sourceFileName() : "";
+        addSourceLineCount(fileName, move.sourceLineNumber(), count);
+    }
+}
+
+/**
+ * Returns the execution count of a procedure.
+ *
+ * @param procedure Name of the procedure.
+ * @return The count, 0 if the procedure is not in the profile.
+ */
+CycleCount
+ExecutionProfile::procedureCount(const std::string& procedure) const {
+    std::map<std::string, CycleCount>::const_iterator i =
+        procedureCounts_.find(procedure);
+    return i == procedureCounts_.end() ? 0 : i->second;
+}
+
+/**
+ * Returns the execution count of a source code line.
+ *
+ * @param fileName Source file of the line.
+ * @param line Line number.
+ * @return The count, 0 if the line is not in the profile.
+ */
+CycleCount
+ExecutionProfile::sourceLineCount(
+    const std::string& fileName, int line) const {
+
+    std::map<SourceLine, CycleCount>::const_iterator i =
+        lineCounts_.find(SourceLine(fileName, line));
+    return i == lineCounts_.end() ? 0 : i->second;
+}
+
+/**
+ * Returns the estimated execution count of a move.
+ *
+ * The count of the source line of the move is used if the move and the
+ * profile have source line information, otherwise the count of the
+ * procedure.
+ *
+ * @param move The move.
+ * @param procedure Name of the procedure the move belongs to.
+ * @return The estimated execution count.
+ */
+CycleCount
+ExecutionProfile::moveCount(
+    const TTAProgram::Move& move, const std::string& procedure) const {
+
+    if (!lineCounts_.empty() && move.hasSourceLineNumber()) {
+        std::string fileName =
+            move.hasSourceFileName() ? move.sourceFileName() : "";
+        return sourceLineCount(fileName, move.sourceLineNumber());
+    }
+    return procedureCount(procedure);
+}
+
+/**
+ * Returns the estimated execution count of a basic block.
+ *
+ * @param bb The basic block.
+ * @param procedure Name of the procedure the basic block belongs to.
+ * @return The highest estimated execution count of the moves in the
+ * basic block.
+ */
+CycleCount
+ExecutionProfile::basicBlockCount(
+    const TTAProgram::BasicBlock& bb, const std::string& procedure) const {
+
+    CycleCount count = 0;
+    bool hasMoves = false;
+    for (int i = 0; i < bb.instructionCount(); i++) {
+        const TTAProgram::Instruction& ins = bb.instructionAtIndex(i);
+        for (int m = 0; m < ins.moveCount(); m++) {
+            count = std::max(count, moveCount(ins.move(m), procedure));
+            hasMoves = true;
+        }
+    }
+    return hasMoves ? count : procedureCount(procedure);
+}
+
+/**
+ * Returns the highest count in the profile.
+ */
+CycleCount
+ExecutionProfile::maxCount() const {
+    return maxCount_;
+}
+
+/**
+ * Tells whether the given count is hot.
+ *
+ * A count is hot if it is at least the given fraction of the highest count
+ * of the profile.
+ *
+ * @param count The execution count.
+ * @param threshold The fraction, HOT_THRESHOLD by default.
+ * @return True if the count is hot.
+ */
+bool
+ExecutionProfile::isHot(CycleCount count, double threshold) const {
+    return count > 0 && count >= maxCount_ * threshold;
+}
+
+/**
+ * Tells whether the given basic block is hot.
+ *
+ * @param bb The basic block.
+ * @param procedure Name of the procedure the basic block belongs to.
+ * @param threshold The fraction of the highest count, HOT_THRESHOLD by
+ *        default.
+ * @return True if the estimated count of the basic block is hot.
+ */
+bool
+ExecutionProfile::isHot(
+    const TTAProgram::BasicBlock& bb, const std::string& procedure,
+    double threshold) const {
+    return isHot(basicBlockCount(bb, procedure), threshold);
+}
+
+/**
+ * Returns true if there are no counts in the profile.
+ */
+bool
+ExecutionProfile::isEmpty() const {
+    return procedureCounts_.empty() && lineCounts_.empty();
+}
+
+/**
+ * Reads the profile from a file.
+ *
+ * The counts are added to the counts already in the profile.
+ *
+ * @param fileName Name of the profile file.
+ * @exception IOException If the file cannot be read.
+ * @exception InvalidData If the file is not a valid profile.
+ */
+void
+ExecutionProfile::readFromFile(const std::string& fileName) {
+    std::ifstream input(fileName.c_str());
+    if (!input) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Cannot open execution profile '" + fileName + "'.");
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(input, line)) {
+        lineNumber++;
+        line = StringTools::trim(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        std::string kind;
+        CycleCount count = -1;
+        int sourceLine = -1;
+        fields >> kind >> count;
+        if (kind == "line") {
+            fields >> sourceLine;
+        }
+        // the name is the rest of the line and may be empty for source
+        // lines without a file name, so the numbers are checked here
+        bool numbersRead = !fields.fail();
+        std::string name;
+        std::getline(fields, name);
+        name = StringTools::trim(name);
+
+        if (!numbersRead || count < 0 ||
+            (kind == "line" && sourceLine < 0) ||
+            (kind == "procedure" && name.empty())) {
+            throw InvalidData(
+                __FILE__, __LINE__, __func__,
+                fileName + ":" + Conversion::toString(lineNumber) +
+                ": invalid execution profile entry '" + line + "'.");
+        }
+
+        if (kind == "procedure") {
+            addProcedureCount(name, count);
+        } else if (kind == "line") {
+            addSourceLineCount(name, sourceLine, count);
+        } else {
+            throw InvalidData(
+                __FILE__, __LINE__, __func__,
+                fileName + ":" + Conversion::toString(lineNumber) +
+                ": unknown execution profile entry '" + kind + "'.");
+        }
+    }
+}
+
+/**
+ * Writes the profile to a file.
+ *
+ * @param fileName Name of the profile file.
+ * @exception IOException If the file cannot be written.
+ */
+void
+ExecutionProfile::writeToFile(const std::string& fileName) const {
+    std::ofstream output(fileName.c_str());
+    if (!output) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Cannot write execution profile '" + fileName + "'.");
+    }
+
+    output << "# OpenASIP execution profile" << std::endl;
+    for (std::map<std::string, CycleCount>::const_iterator i =
+             procedureCounts_.begin(); i != procedureCounts_.end(); ++i) {
+        output << "procedure " << i->second << " " << i->first
+               << std::endl;
+    }
+    for (std::map<SourceLine, CycleCount>::const_iterator i =
+             lineCounts_.begin(); i != lineCounts_.end(); ++i) {
+        output << "line " << i->second << " " << i->first.second << " "
+               << i->first.first << std::endl;
+    }
+    if (!output) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Error while writing execution profile '" + fileName + "'.");
+    }
+}
@@ -0,0 +1,106 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/**
+ * @file ExecutionProfile.hh
+ *
+ * Declaration of ExecutionProfile class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_EXECUTION_PROFILE_HH
+#define TTA_EXECUTION_PROFILE_HH
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include "BaseType.hh"
+#include "Exception.hh"
+
+namespace TTAProgram {
+    class Move;
+    class BasicBlock;
+}
+
+/**
+ * Execution counts of a program collected with the simulator.
+ *
+ * The counts are keyed with the source code lines and the procedure
+ * names of the program instead of instruction addresses so the profile
+ * stays valid when the program is recompiled, possibly with different
+ * scheduling results. The source line counts are available only if the
+ * profiled program was compiled with debug information (-g), otherwise
+ * the procedure counts are used.
+ *
+ * The count of a source line or a procedure is the highest execution
+ * count of a move that originates from it.
+ */
+class ExecutionProfile {
+public:
+    ExecutionProfile();
+    virtual ~ExecutionProfile();
+
+    void addProcedureCount(const std::string& procedure, CycleCount count);
+    void addSourceLineCount(
+        const std::string& fileName, int line, CycleCount count);
+    void addMoveCount(
+        const TTAProgram::Move& move, const std::string& procedure,
+        CycleCount count);
+
+    CycleCount procedureCount(const std::string& procedure) const;
+    CycleCount sourceLineCount(const std::string& fileName, int line) const;
+    CycleCount moveCount(
+        const TTAProgram::Move& move, const std::string& procedure) const;
+    CycleCount basicBlockCount(
+        const TTAProgram::BasicBlock& bb,
+        const std::string& procedure) const;
+    CycleCount maxCount() const;
+
+    bool isHot(CycleCount count, double threshold = HOT_THRESHOLD) const;
+    bool isHot(
+        const TTAProgram::BasicBlock& bb,
+        const std::string& procedure,
+        double threshold = HOT_THRESHOLD) const;
+    bool isEmpty() const;
+
+    void readFromFile(const std::string& fileName);
+    void writeToFile(const std::string& fileName) const;
+
+    /// Fraction of the highest count a count has to reach to be hot.
+    static const double HOT_THRESHOLD;
+
+private:
+    /// A source code line: file name and line number.
+    typedef std::pair<std::string, int> SourceLine;
+
+    /// Execution counts of the procedures.
+    std::map<std::string, CycleCount> procedureCounts_;
+    /// Execution counts of the source code lines.
+    std::map<SourceLine, CycleCount> lineCounts_;
+    /// The highest count in the profile.
+    CycleCount maxCount_;
+};
+
+#endif
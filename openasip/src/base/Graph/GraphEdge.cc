@@ -93,5 +93,27 @@ GraphEdge::edgeID() const {
     return edgeID_;
 }
 
+/**
+ * Returns the ID the next created edge gets.
+ *
+ * The counter is thread local so graphs can be built in parallel threads.
+ *
+ * @return The next edge ID of the calling thread.
+ */
+int
+GraphEdge::nextID() {
+    return edgeCounter_;
+}
+
+/**
+ * Sets the ID the next edge created in the calling thread gets.
+ *
+ * @param id The next edge ID.
+ * @see GraphNode::setNextID()
+ */
+void
+GraphEdge::setNextID(int id) {
+    edgeCounter_ = id;
+}
 
-int GraphEdge::edgeCounter_ = 0;
+thread_local int GraphEdge::edgeCounter_ = 0;
@@ -64,6 +64,9 @@ public:
         return false;
     }
 
+    static int nextID();
+    static void setNextID(int id);
+
     struct Comparator {
         inline bool operator()(GraphEdge* e1, GraphEdge* e2) const {
             return e1->edgeID_ < e2->edgeID_;
@@ -75,7 +78,7 @@ public:
 private:
     int edgeID_;
     int weight_;
-    static int edgeCounter_;
+    static thread_local int edgeCounter_;
 };
 
 #endif
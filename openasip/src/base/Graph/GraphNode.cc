@@ -77,5 +77,30 @@ GraphNode::dotString() const {
     return std::string("label=\"") + toString() + "\"";
 }
 
+/**
+ * Returns the ID the next automatically numbered node gets.
+ *
+ * The counter is thread local so graphs can be built in parallel threads.
+ *
+ * @return The next node ID of the calling thread.
+ */
+int
+GraphNode::nextID() {
+    return idCounter_;
+}
+
+/**
+ * Sets the ID the next automatically numbered node of the calling thread
+ * gets.
+ *
+ * A thread that continues working on nodes created by another thread must
+ * continue from that thread's counter to keep the node IDs unique.
+ *
+ * @param id The next node ID.
+ */
+void
+GraphNode::setNextID(int id) {
+    idCounter_ = id;
+}
 
-int GraphNode::idCounter_ = 0;
+thread_local int GraphNode::idCounter_ = 0;
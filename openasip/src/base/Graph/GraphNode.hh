@@ -53,6 +53,9 @@ public:
     virtual std::string toString() const;
     virtual std::string dotString() const;
 
+    static int nextID();
+    static void setNextID(int id);
+
     class Comparator {
     public:
         inline bool operator()(
@@ -61,7 +64,7 @@ public:
     };
 private:
     int nodeID_;
-    static int idCounter_;
+    static thread_local int idCounter_;
 };
 
 #include "GraphNode.icc"
@@ -64,6 +64,9 @@ using std::vector;
 const string TRUE = "true";
 const string FALSE = "false";
 
+// format tag of binary BEM files
+const string BINARY_FORMAT_TAG = "bem";
+
 const string ADF_ENCODING = "adf-encoding";
 const string BEM_VERSION_STR = "version";
 const string REQUIRED_VERSION = "required-version";
@@ -164,6 +167,7 @@ const string BEM_SCHEMA_FILE = "bem/BEM_Schema.xsd";
 BEMSerializer::BEMSerializer() : XMLSerializer() {
     setSchemaFile(Environment::schemaDirPath(BEM_SCHEMA_FILE));
     setUseSchema(true);
+    setStreaming(true);
 }
 
 
@@ -184,6 +188,12 @@ BEMSerializer::~BEMSerializer() {
  */
 ObjectState*
 BEMSerializer::readState() {
+    if (hasBinarySource()) {
+        // binary files store the object model format of the current
+        // version, no conversions are needed
+        return readBinaryState(BINARY_FORMAT_TAG);
+    }
+
     ObjectState* fileState = XMLSerializer::readState();
 
     double version = fileState->doubleAttribute(BEM_VERSION_STR);
@@ -244,6 +254,10 @@ void BEMSerializer::convertZeroEncExtraBits(ObjectState* os) {
  */
 void
 BEMSerializer::writeState(const ObjectState* state) {
+    if (binaryOutput()) {
+        writeBinaryState(state, BINARY_FORMAT_TAG);
+        return;
+    }
     ObjectState* fileState = convertToFileFormat(state);
     XMLSerializer::writeState(fileState);
     delete fileState;
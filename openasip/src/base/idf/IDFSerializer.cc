@@ -42,6 +42,9 @@
 
 using std::string;
 
+// format tag of binary IDF files
+const string BINARY_FORMAT_TAG = "idf";
+
 const string ADF_IMPLEMENTATION = "adf-implementation";
 const string IC_DECODER_PLUGIN = "ic-decoder-plugin";
 const string IC_DECODER_PLUGIN_NAME = "name";
@@ -90,6 +93,7 @@ namespace IDF {
 IDFSerializer::IDFSerializer() : XMLSerializer() {
     setSchemaFile(Environment::schemaDirPath(IDF_SCHEMA_FILE));
     setUseSchema(true);
+    setStreaming(true);
 }
 
 
@@ -109,6 +113,13 @@ IDFSerializer::~IDFSerializer() {
  */
 ObjectState*
 IDFSerializer::readState() {
+    if (hasBinarySource()) {
+        ObjectState* omState = readBinaryState(BINARY_FORMAT_TAG);
+        omState->setAttribute(
+            MachineImplementation::OSKEY_SOURCE_IDF, sourceFile());
+        return omState;
+    }
+
     ObjectState* fileState = XMLSerializer::readState();
     ObjectState* omState = convertToOMFormat(fileState);
 
@@ -129,6 +140,10 @@ IDFSerializer::readState() {
  */
 void
 IDFSerializer::writeState(const ObjectState* state) {
+    if (binaryOutput()) {
+        writeBinaryState(state, BINARY_FORMAT_TAG);
+        return;
+    }
     ObjectState* fileState = convertToFileFormat(state);
     XMLSerializer::writeState(fileState);
     delete fileState;
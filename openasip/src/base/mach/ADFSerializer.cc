@@ -59,6 +59,9 @@ using std::string;
 using boost::format;
 using namespace TTAMachine;
 
+// format tag of binary ADF files
+const string BINARY_FORMAT_TAG = "adf";
+
 // declaration of constant strings used in MDF file
 const string MDF = "adf";
 const string MDF_VERSION = "version";
@@ -203,6 +206,7 @@ const string ADF_SCHEMA_FILE = "mach/ADF_Schema.xsd";
 ADFSerializer::ADFSerializer() : XMLSerializer() {
     setSchemaFile(Environment::schemaDirPath(ADF_SCHEMA_FILE));
     setUseSchema(true);
+    setStreaming(true);
 }
 
 
@@ -217,11 +221,18 @@ ADFSerializer::~ADFSerializer() {
  * Writes the given ObjectState tree created by Machine::saveState to the
  * destination file.
  *
+ * If binary output is set, the tree is written as such in the binary
+ * format instead of converting it to the MDF format.
+ *
  * @param machineState ObjectState tree created by Machine::saveState.
  * @exception SerializerException If an error occurs while serializing.
  */
 void
 ADFSerializer::writeState(const ObjectState* machineState) {
+    if (binaryOutput()) {
+        writeBinaryState(machineState, BINARY_FORMAT_TAG);
+        return;
+    }
     ObjectState* converted = convertToMDFFormat(machineState);
     XMLSerializer::writeState(converted);
     delete converted;
@@ -231,11 +242,17 @@ ADFSerializer::writeState(const ObjectState* machineState) {
  * Reads the current MDF file set and creates an ObjectState tree which can
  * be given to Machine::loadState to create a machine.
  *
+ * Binary ADF files are recognized by their magic bytes and loaded
+ * without XML parsing and format conversion.
+ *
  * @return The newly created ObjectState tree.
  * @exception SerializerException If an error occurs while reading.
  */
 ObjectState*
 ADFSerializer::readState() {
+    if (hasBinarySource()) {
+        return readBinaryState(BINARY_FORMAT_TAG);
+    }
     ObjectState* mdfState = XMLSerializer::readState();
     ObjectState* machineState;
     try {
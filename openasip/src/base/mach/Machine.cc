@@ -70,6 +70,8 @@ const string Machine::OSKEY_TRIGGER_INVALIDATES_OLD_RESULTS
 	= "trigger-invalidates";
 const string Machine::OSKEY_FUNCTION_UNITS_ORDERED = "fu-ordered";
 
+std::atomic<unsigned long long> Machine::versionCounter_(0);
+
 /**
  * Constructor.
  */
@@ -79,7 +81,7 @@ Machine::Machine() :
     dummyMachineTester_(new DummyMachineTester(*this)),
     EMPTY_ITEMP_NAME_("no_limm"), alwaysWriteResults_(false), 
     triggerInvalidatesResults_(false), fuOrdered_(false),
-    littleEndian_(true), bitness64_(false) {
+    littleEndian_(true), bitness64_(false), version_(++versionCounter_) {
 
     new InstructionTemplate(EMPTY_ITEMP_NAME_, *this);
 }
@@ -97,7 +99,7 @@ Machine::Machine(const Machine& old) :
     machineTester_(new MachineTester(*this)), 
     dummyMachineTester_(new DummyMachineTester(*this)),
     littleEndian_(old.littleEndian_),
-    bitness64_(old.bitness64_) {
+    bitness64_(old.bitness64_), version_(++versionCounter_) {
     
     ObjectState* state = old.saveState();
     loadState(state);
@@ -128,6 +130,17 @@ Machine::isUniversalMachine() const {
     return false;
 }
 
+/**
+ * Gives the machine a new version number.
+ *
+ * Called by the machine and its components whenever the component set or
+ * the interconnection of the machine changes.
+ */
+void
+Machine::markModified() {
+    version_ = ++versionCounter_;
+}
+
 /**
  * Adds a bus into the machine.
  *
@@ -327,6 +340,7 @@ Machine::setGlobalControl(ControlUnit& unit) {
         throw ComponentAlreadyExists(__FILE__, __LINE__, procName);
     }
 
+    markModified();
     if (unit.machine() == NULL) {
         unit.setMachine(*this);
     } else {
@@ -566,6 +580,7 @@ Machine::unsetGlobalControl() {
     if (controlUnit_ == NULL) {
         return;
     } else {
+        markModified();
         if (controlUnit_->machine() == NULL) {
             controlUnit_ = NULL;
         } else {
@@ -881,7 +896,7 @@ Machine::loadState(const ObjectState* state) {
  * 
  */
 void
-Machine::copyFromMachine(Machine& machine) {
+Machine::copyFromMachine(const Machine& machine) {
     ObjectState* state = machine.saveState();
     loadState(state);
     delete state;
@@ -929,6 +944,21 @@ Machine::hash() const {
     serializer.setDestinationString(buffer);
     serializer.writeMachine(*this);
 
+    return hash(buffer);
+}
+
+/**
+ * Returns the hash string of an already serialized ADF.
+ *
+ * Gives the same result as hash() called on the machine the ADF string
+ * was written from. Useful when the caller has to serialize the machine
+ * anyway and wants to avoid doing it twice.
+ *
+ * @param buffer The ADF XML data.
+ * @return The hash string.
+ */
+TCEString
+Machine::hash(const std::string& buffer) {
     boost::hash<std::string> string_hasher;
     size_t h = string_hasher(buffer);
 
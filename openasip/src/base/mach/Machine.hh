@@ -36,6 +36,7 @@
 
 #include <vector>
 #include <string>
+#include <atomic>
 
 #include "Exception.hh"
 #include "Serializable.hh"
@@ -135,17 +136,31 @@ public:
     virtual void loadState(const ObjectState* state);
     virtual ObjectState* saveState() const;
     
-    virtual void copyFromMachine(Machine& machine);
+    virtual void copyFromMachine(const Machine& machine);
 
     static Machine* loadFromADF(const std::string& adfFileName);
 
     void writeToADF(const std::string& adfFileName) const;
 
     TCEString hash() const;
+    static TCEString hash(const std::string& buffer);
 
     bool hasOperation(const TCEString& opName) const;
     bool isRISCVMachine() const;
 
+    /**
+     * Returns the current version of the machine.
+     *
+     * The version changes whenever components are added or removed or the
+     * interconnection is modified. The values are unique among all machine
+     * instances of the process, thus caches keyed by the machine can detect
+     * both modified machines and new machines allocated at the address of
+     * a deleted one. The version can be read from any thread, but the
+     * machine must not be modified while other threads use it.
+     */
+    unsigned long long version() const { return version_; }
+    void markModified();
+
     /**
      * A template class which contains machine components.
      */
@@ -328,6 +343,10 @@ private:
     bool littleEndian_;
     // True in case the machine is 64-bit. Also has to be little-endian.
     bool bitness64_;
+    /// The current version of the machine, see version().
+    std::atomic<unsigned long long> version_;
+    /// Source of the process-wide unique machine versions.
+    static std::atomic<unsigned long long> versionCounter_;
 };
 }
 
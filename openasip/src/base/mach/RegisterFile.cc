@@ -121,8 +121,9 @@ RegisterFile::~RegisterFile() {
  */
 int
 RegisterFile::maxReads() const {
-    updateMaxReadsAndWrites();
-    return maxReads_;
+    int reads = 0;
+    int writes = 0;
+    return connectedPortCounts(reads, writes) ? reads : maxReads_;
 }
 
 
@@ -133,8 +134,9 @@ RegisterFile::maxReads() const {
  */
 int
 RegisterFile::maxWrites() const {
-    updateMaxReadsAndWrites();
-    return maxWrites_;
+    int reads = 0;
+    int writes = 0;
+    return connectedPortCounts(reads, writes) ? writes : maxWrites_;
 }
 
 
@@ -253,46 +255,35 @@ RegisterFile::setMaxWrites(int maxWrites) {
 }
 
 /**
- * Updates RFs max reads/writes according in/output ports.
+ * Counts the read and write ports of the register file.
  *
  * Port that is not assigned to a socket is considered to be a dead port, 
- * thus not counted towards the maximum number of reads or writes.
+ * thus not counted towards the maximum number of reads or writes. The
+ * getters derive the maximum reads and writes from the counts without
+ * storing them, so they can be called concurrently.
  *
- * @return True if max reads/writes changed
- * @exception OutOfRange If setMaxReads/setMaxWrites throws outOfRange
- *            exception.
+ * @param reads Set to the number of connected output ports.
+ * @param writes Set to the number of connected input ports.
+ * @return True if any port is connected, false if the stored maximums
+ *         apply.
  */
 bool
-RegisterFile::updateMaxReadsAndWrites() const {
-    int reads = 0;
-    int writes = 0;
-    bool changed = false;
+RegisterFile::connectedPortCounts(int& reads, int& writes) const {
+    reads = 0;
+    writes = 0;
+    bool connected = false;
 
     for (int p = 0; p < portCount(); ++p) {
-        if (!port(p)->isOutput() && !port(p)->isInput()) {
-
-            // do not count unconnected ports
-            //++reads;
-            //++writes;
-
-        } else {
-            if (port(p)->isOutput()) {
-                changed = true;
-                ++reads;
-            }
-            if (port(p)->isInput()) {
-                changed = true;
-                ++writes;
-            }
+        if (port(p)->isOutput()) {
+            connected = true;
+            ++reads;
+        }
+        if (port(p)->isInput()) {
+            connected = true;
+            ++writes;
         }
     }
-
-    if (changed)
-    {
-        maxReads_ = reads;
-        maxWrites_ = writes;
-    }
-    return changed;
+    return connected;
 }
 
 /**
@@ -404,10 +395,9 @@ RegisterFile::saveState() const {
     default: assert(false);
     }
 
-    // set max reads
+    // set max reads and writes, the stored values instead of the ones
+    // derived from the connected ports, to keep the written ADF unchanged
     regFile->setAttribute(OSKEY_MAX_READS, maxReads_);
-
-    // set max writes
     regFile->setAttribute(OSKEY_MAX_WRITES, maxWrites_);
     
     // set guard latency
@@ -537,10 +527,10 @@ RegisterFile::isArchitectureEqual(const RegisterFile& rf) const {
     if (width() != rf.width()) {
         return false;
     }
-    if (maxReads_ != rf.maxReads()) {
+    if (maxReads_ != rf.maxReads_) {
         return false;
     }
-    if (maxWrites_ != rf.maxWrites()) {
+    if (maxWrites_ != rf.maxWrites_) {
         return false;
     }
     if (type_ != rf.type()) {
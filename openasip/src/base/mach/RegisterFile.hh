@@ -116,7 +116,7 @@ public:
 protected:
 
 private:
-    bool updateMaxReadsAndWrites() const;
+    bool connectedPortCounts(int& reads, int& writes) const;
     /// Copying forbidden, use the copy() method.
     RegisterFile(const RegisterFile&);
     /// Assingment forbidden.
@@ -126,9 +126,9 @@ private:
     void deleteGuards(int registers) const;
 
     /// Max number of ports that can read a register all in the same cycle.
-    mutable int maxReads_;
+    int maxReads_;
     /// Max number of ports that can read a register all in the same cycle.
-    mutable int maxWrites_;
+    int maxWrites_;
     /// The guard latency of the register file.
     int guardLatency_;
 
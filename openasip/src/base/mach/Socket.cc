@@ -141,6 +141,7 @@ Socket::setDirection(Direction direction) {
     MachineTester& tester = machine()->machineTester();
     if (tester.canSetDirection(*this, direction)) {
         direction_ = direction;
+        machine()->markModified();
     } else {
         string errorMsg = MachineTestReporter::socketDirectionSettingError(
             *this, direction, tester);
@@ -178,6 +179,7 @@ Socket::attachBus(Segment& bus) {
         const Connection* conn = new Connection(*this, bus);
         busses_.push_back(conn);
         bus.attachSocket(*this);
+        machine()->markModified();
     } else {
         assert(false);
     }
@@ -218,6 +220,9 @@ Socket::detachBus(Segment& bus) {
 
     const Connection& conn = connection(bus);
     removeConnection(&conn);
+    if (isRegistered()) {
+        machine()->markModified();
+    }
 
     if (bus.isConnectedTo(*this)) {
         bus.detachSocket(*this);
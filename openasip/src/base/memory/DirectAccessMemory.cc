@@ -91,6 +91,18 @@ DirectAccessMemory::fillWithZeros() {
     data_->clear();
 }
 
+/**
+ * Returns a digest of the memory contents.
+ *
+ * Rehashes only the pages written since the previous call.
+ *
+ * @return The digest of the memory contents.
+ */
+std::size_t
+DirectAccessMemory::contentDigest() {
+    return data_->contentDigest();
+}
+
 /**
  * Writes a single MAU using the fastest possible method.
  *
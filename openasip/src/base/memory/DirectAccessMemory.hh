@@ -108,6 +108,7 @@ public:
     virtual void advanceClock() {}
     virtual void reset() {}
     virtual void fillWithZeros();
+    virtual std::size_t contentDigest();
 
     void writeBE(ULongWord address, int count, ULongWord data) override;
 
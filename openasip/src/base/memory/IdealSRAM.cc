@@ -108,4 +108,16 @@ IdealSRAM::fillWithZeros() {
     data_->clear();
 }
 
+/**
+ * Returns a digest of the memory contents.
+ *
+ * Rehashes only the pages written since the previous call.
+ *
+ * @return The digest of the memory contents.
+ */
+std::size_t
+IdealSRAM::contentDigest() {
+    return data_->contentDigest();
+}
+
 
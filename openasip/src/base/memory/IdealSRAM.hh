@@ -64,6 +64,7 @@ public:
     using Memory::read;
 
     virtual void fillWithZeros();
+    virtual std::size_t contentDigest();
 
 private:
     /// Copying not allowed.
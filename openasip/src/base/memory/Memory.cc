@@ -692,6 +692,55 @@ Memory::readLE(ULongWord address, int size, ULongWord& data) {
     }
 }
 
+/**
+ * Writes a contiguous block of MAUs directly to the memory.
+ *
+ * The write bypasses the request queue like writeDirectlyBE() does. The
+ * default implementation writes the block one MAU at a time; memories
+ * that can transfer bursts faster (for example the ones behind a remote
+ * debug interface) should override this.
+ *
+ * @param address The first target address.
+ * @param data The MAUs to write.
+ * @param count Number of MAUs to write.
+ * @exception OutOfRange If the block does not fit in the address space.
+ */
+void
+Memory::writeBlock(ULongWord address, const MAU* data, ULongWord count) {
+
+    if (count == 0) {
+        return;
+    }
+    checkRange(address, count);
+
+    for (ULongWord i = 0; i < count; ++i) {
+        write(address + i, data[i]);
+    }
+}
+
+/**
+ * Reads a contiguous block of MAUs from the memory.
+ *
+ * The default implementation reads the block one MAU at a time.
+ *
+ * @param address The first source address.
+ * @param data The buffer to read the MAUs to. Must hold count MAUs.
+ * @param count Number of MAUs to read.
+ * @exception OutOfRange If the block does not fit in the address space.
+ */
+void
+Memory::readBlock(ULongWord address, MAU* data, ULongWord count) {
+
+    if (count == 0) {
+        return;
+    }
+    checkRange(address, count);
+
+    for (ULongWord i = 0; i < count; ++i) {
+        data[i] = read(address + i);
+    }
+}
+
 /**
  * Fills the whole memory with zeros.
  *
@@ -707,6 +756,20 @@ Memory::fillWithZeros() {
     }
 }
 
+/**
+ * Returns a digest of the committed contents of the memory.
+ *
+ * Memories with equal contents have equal digests. The default
+ * implementation returns always zero, memory models that store their
+ * contents locally override this.
+ *
+ * @return The digest of the memory contents.
+ */
+std::size_t
+Memory::contentDigest() {
+    return 0;
+}
+
 /**
  * Resets the memory.
  *
@@ -841,12 +904,13 @@ Memory::advanceClock() {
  * @exception OutOfRange in case the range is illegal.
  */
 void
-Memory::checkRange(ULongWord startAddress, int numberOfMAUs) {
+Memory::checkRange(ULongWord startAddress, ULongWord numberOfMAUs) {
 
-    unsigned int low = start(); 
-    unsigned int high = end(); 
+    const ULongWord low = start(); 
+    const ULongWord high = end(); 
 
-    if ((startAddress < low) || (startAddress > high - numberOfMAUs + 1)) {
+    if (startAddress < low || startAddress > high ||
+        (numberOfMAUs > 0 && numberOfMAUs - 1 > high - startAddress)) {
         throw OutOfRange(
             __FILE__, __LINE__, __func__,
             (boost::format(
@@ -91,6 +91,10 @@ public:
     virtual void writeDirectlyBE(ULongWord address, int size, ULongWord data);
     virtual void writeDirectlyLE(ULongWord address, int size, ULongWord data);
 
+    virtual void writeBlock(
+        ULongWord address, const MAU* data, ULongWord count);
+    virtual void readBlock(ULongWord address, MAU* data, ULongWord count);
+
     void write(ULongWord address, FloatWord data);
     void write(ULongWord address, DoubleWord data);
     void read(ULongWord address, int size, ULongWord& data);
@@ -112,6 +116,7 @@ public:
 
     virtual void reset();
     virtual void fillWithZeros();
+    virtual std::size_t contentDigest();
 
     virtual ULongWord start() { return start_; }
     virtual ULongWord end() { return end_; }
@@ -124,6 +129,7 @@ protected:
     void unpackBE(const ULongWord& value, int size, Memory::MAUTable data);
     void packLE(const Memory::MAUTable data, int size, ULongWord& value);
     void unpackLE(const ULongWord& value, int size, Memory::MAUTable data);
+    void checkRange(ULongWord startAddress, ULongWord numberOfMAUs);
     
     bool littleEndian_;
 private:
@@ -132,8 +138,6 @@ private:
     /// Assignment not allowed.
     Memory& operator=(const Memory&);
 
-    void checkRange(ULongWord startAddress, int numberOfMAUs);
-
     /// Starting point of the address space.
     ULongWord start_;
     /// End point of the address space.
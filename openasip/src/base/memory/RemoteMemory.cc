@@ -29,6 +29,8 @@
  */
 
 #include <assert.h>
+#include <vector>
+#include <algorithm>
 #include "RemoteMemory.hh"
 
 typedef MinimumAddressableUnit MAU;
@@ -46,3 +48,64 @@ RemoteMemory::read(ULongWord address)
 	assert(controller_);
 	return controller_->readMem(address, addressspace_ );
 }
+
+/**
+ * Writes a block of MAUs as a single burst through the controller.
+ *
+ * @param address The first target address.
+ * @param data The MAUs to write.
+ * @param count Number of MAUs to write.
+ * @exception OutOfRange If the block does not fit in the address space.
+ */
+void
+RemoteMemory::writeBlock(ULongWord address, const MAU* data, ULongWord count)
+{
+	if (count == 0) {
+		return;
+	}
+	checkRange(address, count);
+	assert(controller_);
+	controller_->writeMemBlock(address, data, count, addressspace_);
+}
+
+/**
+ * Reads a block of MAUs as a single burst through the controller.
+ *
+ * @param address The first source address.
+ * @param data The buffer to read the MAUs to. Must hold count MAUs.
+ * @param count Number of MAUs to read.
+ * @exception OutOfRange If the block does not fit in the address space.
+ */
+void
+RemoteMemory::readBlock(ULongWord address, MAU* data, ULongWord count)
+{
+	if (count == 0) {
+		return;
+	}
+	checkRange(address, count);
+	assert(controller_);
+	controller_->readMemBlock(address, data, count, addressspace_);
+}
+
+/**
+ * Fills the whole memory with zeros using block writes.
+ */
+void
+RemoteMemory::fillWithZeros()
+{
+	/// Number of MAUs transferred in a single zeroing burst.
+	const ULongWord BURST_SIZE = 4096;
+
+	assert(controller_);
+	const std::vector<MAU> zeros(BURST_SIZE, 0);
+	for (ULongWord address = start(); address <= end();
+	     address += BURST_SIZE) {
+		const ULongWord count = 
+			std::min(BURST_SIZE, end() - address + 1);
+		controller_->writeMemBlock(
+			address, zeros.data(), count, addressspace_);
+		if (end() - address < BURST_SIZE) {
+			break;
+		}
+	}
+}
@@ -66,6 +66,12 @@ public:
 	// overload the pure viruals of Memory
 	virtual void write(ULongWord address, MAU data) override;
 	virtual Memory::MAU read(ULongWord address) override;
+
+	virtual void writeBlock(
+        ULongWord address, const MAU* data, ULongWord count) override;
+	virtual void readBlock(
+        ULongWord address, MAU* data, ULongWord count) override;
+	virtual void fillWithZeros() override;
 	
 private:
 	RemoteController* controller_;
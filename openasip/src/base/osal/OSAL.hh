@@ -351,7 +351,15 @@ bool simulateTrigger( \
 #define SET_SUBFLOAT32(OPERAND, ELEMENT, VALUE) \
     (io[(OPERAND) - 1]->setFloatElement(ELEMENT, VALUE))
 #define SET_SUBFLOAT64(OPERAND, ELEMENT, VALUE) \
-    (io[(OPERAND) - 1]->setDoubleWordElement(ELEMENT, VALUE))
+    (io[(OPERAND) - 1]->setDoubleFloatElement(ELEMENT, VALUE))
+
+/**
+ * Wide vector operations should not loop the subword accessors but
+ * compute all the lanes at once with the lane-wise helpers of SimValue,
+ * for example:
+ *
+ * SimValue::addLanes(IO(1), IO(2), 16, IO(3));
+ */
 
 /**
  * Operand accessor macro.
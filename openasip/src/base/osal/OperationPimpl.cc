@@ -55,6 +55,7 @@ using std::set;
 using std::vector;
 using std::string;
 
+boost::recursive_mutex OperationPimpl::dagMutex_;
 
 /**
  * Constructor.
@@ -184,6 +185,7 @@ OperationPimpl::dagCount() const {
  */
 OperationDAG& 
 OperationPimpl::dag(int index) const {       
+    boost::lock_guard<boost::recursive_mutex> lock(dagMutex_);
 
     // if dag is not up to date, try to compile it, if compilation failed and
     // dag code has not been changed don't try to compile again
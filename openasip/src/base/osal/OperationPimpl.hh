@@ -37,6 +37,8 @@
 #include <set>
 #include <vector>
 #include <map>
+#include <boost/thread/recursive_mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
 
 #include "TCEString.hh"
 
@@ -159,6 +161,9 @@ private:
     std::string description_;
     /// Table of DAGs and their source codes of an operation.
     mutable DAGContainer dags_;
+    /// Serializes the on-demand compilation of DAGs of all operations.
+    /// Recursive because compiling a DAG looks up other operations.
+    static boost::recursive_mutex dagMutex_;
    
     /// The number of inputs of the Operation.
     int inputs_;
@@ -68,11 +68,13 @@ using std::string;
 OperationPoolPimpl::OperationTable OperationPoolPimpl::operationCache_;
 OperationIndex* OperationPoolPimpl::index_(NULL);
 const llvm::MCInstrInfo* OperationPoolPimpl::llvmTargetInstrInfo_(NULL);
+boost::recursive_mutex OperationPoolPimpl::mutex_;
 
 /**
  * The constructor
  */
 OperationPoolPimpl::OperationPoolPimpl() {
+    boost::lock_guard<boost::recursive_mutex> lock(mutex_);
     // if this is a first created instance of OperationPool,
     // initialize the OperationIndex instance with the search paths
     if (index_ == NULL) {
@@ -98,6 +100,7 @@ OperationPoolPimpl::~OperationPoolPimpl() {
  */
 void
 OperationPoolPimpl::cleanupCache() {
+    boost::lock_guard<boost::recursive_mutex> lock(mutex_);
     AssocTools::deleteAllValues(operationCache_);
     delete index_;
     index_ = NULL;
@@ -114,6 +117,7 @@ OperationPoolPimpl::cleanupCache() {
  */
 Operation&
 OperationPoolPimpl::operation(const char* name) {
+    boost::lock_guard<boost::recursive_mutex> lock(mutex_);
 
     OperationTable::iterator it =
         operationCache_.find(StringTools::stringToLower(name));
@@ -217,6 +221,7 @@ OperationPoolPimpl::index() {
 
 bool
 OperationPoolPimpl::sharesState(const Operation& op) {
+    boost::lock_guard<boost::recursive_mutex> lock(mutex_);
     if (op.affectsCount() > 0 || op.affectedByCount() > 0)
         return true;
     for (const auto& entry : operationCache_) {
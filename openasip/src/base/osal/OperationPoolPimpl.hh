@@ -35,6 +35,8 @@
 
 #include <string>
 #include <map>
+#include <boost/thread/recursive_mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
 #include "tce_config.h"
 
 class OperationPool;
@@ -91,6 +93,10 @@ private:
     /// instead of .opp XML files. Used when calling the TCE scheduler from
     /// non-TTA LLVM targets.
     static const llvm::MCInstrInfo* llvmTargetInstrInfo_;
+    /// Guards the shared operation cache and index so that operations can
+    /// be looked up from parallel scheduler threads. Recursive because
+    /// loading an operation can look up other operations.
+    static boost::recursive_mutex mutex_;
 };
 
 #endif
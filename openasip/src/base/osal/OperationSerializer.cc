@@ -66,6 +66,7 @@ const string OPSER_VERSION = "version";
  */
 OperationSerializer::OperationSerializer() : Serializer() {
 
+    serializer_.setStreaming(true);
     string path = Environment::schemaDirPath(LIBRARY_NAME);
     if (path != "") {
         string schema = path + FileSystem::DIRECTORY_SEPARATOR + 
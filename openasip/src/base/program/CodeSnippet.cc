@@ -232,7 +232,7 @@ CodeSnippet::firstInstruction() const {
  * by having a size of 0.
  *
  * @param address The instruction address.
- * @note This is a slow method to traverse instructions, it's O(N).
+ * @note In finalized programs this is O(log N), otherwise O(1).
  * @exception KeyNotFound if given address is illegal.
  * @todo Rename to instruction() to match Program::procedure() and
  * Instruction::move().
@@ -241,14 +241,25 @@ Instruction&
 CodeSnippet::instructionAt(UIntWord address) const {
     if (isInProgram() && !parent().isInstructionPerAddress()) {
         // In the finalized program, there might not be one instruction
-        // per index, thus we have to find the instruction by an
-        // exhaustive search. @todo optimize this in case it's a
-        // bottleneck somewhere.
-
-        for (size_t i = 0; i < instructions_.size(); ++i) {
-            Instruction* ins = instructions_.at(i);
-            if (ins->address().location() == address &&
-                ins->size() > 0)
+        // per index. The instructions are in increasing address order,
+        // thus the instruction is found by a binary search. Implicit
+        // (zero sized) instructions share the address of the following
+        // explicit one.
+        size_t low = 0;
+        size_t high = instructions_.size();
+        while (low < high) {
+            const size_t middle = low + (high - low) / 2;
+            if (instructions_[middle]->address().location() < address) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        for (size_t i = low; i < instructions_.size(); ++i) {
+            Instruction* ins = instructions_[i];
+            if (ins->address().location() != address)
+                break;
+            if (ins->size() > 0)
                 return *ins;
         }
     } else {
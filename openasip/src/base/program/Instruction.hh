@@ -40,6 +40,7 @@
 #include "Exception.hh"
 #include "NullInstructionTemplate.hh"
 #include "AnnotatedInstructionElement.hh"
+#include "POMAllocator.hh"
 
 namespace TTAProgram {
 
@@ -77,6 +78,13 @@ public:
 #endif
     ~Instruction();
 
+    static void* operator new(std::size_t size) {
+        return POMAllocator::allocate(size);
+    }
+    static void operator delete(void* object, std::size_t size) {
+        POMAllocator::deallocate(object, size);
+    }
+
     CodeSnippet& parent() const;
     void setParent(CodeSnippet& proc);
     bool isInProcedure() const;
@@ -44,6 +44,9 @@
 
 #include "Application.hh"
 
+#include <boost/thread/recursive_mutex.hpp>
+#include <boost/thread/locks.hpp>
+
 
 namespace TTAProgram {
 class InstructionReference;
@@ -79,6 +82,7 @@ InstructionReferenceImpl::~InstructionReferenceImpl() {
  */
 void 
 InstructionReferenceImpl::nullify() {
+    boost::unique_lock<boost::recursive_mutex> guard = refMan_->lock();
     // the set is modified inside so cannot iterate normally.
     // get the first as long as there are some.
     while (!refs_.empty()) {
@@ -98,6 +102,7 @@ InstructionReferenceImpl::nullify() {
  */
 void 
 InstructionReferenceImpl::addRef(InstructionReference& ref) {
+    boost::unique_lock<boost::recursive_mutex> guard = refMan_->lock();
     refs_.insert(&ref);
 }
 
@@ -112,6 +117,7 @@ InstructionReferenceImpl::addRef(InstructionReference& ref) {
  */
 bool 
 InstructionReferenceImpl::removeRef(InstructionReference& ref) {
+    boost::unique_lock<boost::recursive_mutex> guard = refMan_->lock();
     assert(refs_.find(&ref) != refs_.end());
     refs_.erase(&ref);
     if (refs_.empty()) {
@@ -132,6 +138,7 @@ InstructionReferenceImpl::removeRef(InstructionReference& ref) {
  */
 void 
 InstructionReferenceImpl::merge(InstructionReferenceImpl& other) {
+    boost::unique_lock<boost::recursive_mutex> guard = refMan_->lock();
     // copy this in order to prevent it being deleted on last iteration
     std::set<InstructionReference*> otherRefs = other.refs_;
     for (std::set<InstructionReference*>::iterator iter = 
@@ -159,6 +166,7 @@ InstructionReferenceImpl::setInstruction(Instruction& ins) {
  */
 const InstructionReference& 
 InstructionReferenceImpl::ref() {
+    boost::unique_lock<boost::recursive_mutex> guard = refMan_->lock();
     return **refs_.begin();
 }
 
@@ -51,7 +51,8 @@ namespace TTAProgram {
  *
  * @note Should not be instantiated independent of a Program instance.
  */
-InstructionReferenceManager::InstructionReferenceManager() {
+InstructionReferenceManager::InstructionReferenceManager() :
+    threadSafe_(false) {
 }
 
 /**
@@ -71,6 +72,7 @@ InstructionReferenceManager::~InstructionReferenceManager() {
  */
 InstructionReference
 InstructionReferenceManager::createReference(Instruction& ins) {
+    boost::unique_lock<boost::recursive_mutex> guard = lock();
     RefMap::const_iterator iter = references_.find(&ins);
     if (iter == references_.end()) {
         InstructionReferenceImpl* newRef = 
@@ -94,6 +96,7 @@ InstructionReferenceManager::createReference(Instruction& ins) {
  */
 void
 InstructionReferenceManager::replace(Instruction& insA, Instruction& insB) {
+    boost::unique_lock<boost::recursive_mutex> guard = lock();
     RefMap::iterator itera = references_.find(&insA);
     if (itera == references_.end()) {
         throw InstanceNotFound(
@@ -123,6 +126,7 @@ InstructionReferenceManager::replace(Instruction& insA, Instruction& insB) {
  */ 
 void
 InstructionReferenceManager::clearReferences() {
+    boost::unique_lock<boost::recursive_mutex> guard = lock();
     // nullify modifies so take new iter every round.
     for (RefMap::iterator iter = references_.begin(); 
          iter != references_.end(); iter = references_.begin()) {
@@ -141,6 +145,7 @@ InstructionReferenceManager::clearReferences() {
  */
 bool
 InstructionReferenceManager::hasReference(Instruction& ins) const {
+    boost::unique_lock<boost::recursive_mutex> guard = lock();
     return references_.find(&ins) != references_.end();
 }
 
@@ -149,6 +154,7 @@ InstructionReferenceManager::hasReference(Instruction& ins) const {
  */
 unsigned int
 InstructionReferenceManager::referenceCount(Instruction& ins) const {
+    boost::unique_lock<boost::recursive_mutex> guard = lock();
     RefMap::const_iterator iter = references_.find(&ins);
     if (iter == references_.end()) {
         return 0;
@@ -163,6 +169,7 @@ InstructionReferenceManager::referenceCount(Instruction& ins) const {
  */
 void 
 InstructionReferenceManager::referenceDied(Instruction* ins) {
+    boost::unique_lock<boost::recursive_mutex> guard = lock();
     RefMap::iterator iter = references_.find(ins);
     assert (iter != references_.end());
     assert (iter->second->count() == 0);
@@ -179,6 +186,7 @@ InstructionReferenceManager::referenceDied(Instruction* ins) {
  */
 void
 InstructionReferenceManager::validate()  {
+    boost::unique_lock<boost::recursive_mutex> guard = lock();
 
     for (InstructionReferenceManager::Iterator i = begin();
          i != end(); ++i) {
@@ -206,4 +214,37 @@ InstructionReferenceManager::validate()  {
     }    
 }
 
+/**
+ * Sets whether the references are used from several threads.
+ *
+ * Must be set before the threads that use the references are started and
+ * unset only after they have finished.
+ *
+ * @param threadSafe True to guard the references with a lock.
+ */
+void
+InstructionReferenceManager::setThreadSafe(bool threadSafe) {
+    threadSafe_ = threadSafe;
+}
+
+/**
+ * Locks the references in case they are used from several threads.
+ *
+ * Iterating the references with begin() and end() while the procedures of
+ * the program are scheduled in parallel threads must be done holding the
+ * returned lock. Without setThreadSafe() the lock is not taken, so that
+ * the serial code does not pay for it.
+ *
+ * @return The lock, released when destroyed.
+ */
+boost::unique_lock<boost::recursive_mutex>
+InstructionReferenceManager::lock() const {
+    boost::unique_lock<boost::recursive_mutex> guard(
+        mutex_, boost::defer_lock);
+    if (threadSafe_) {
+        guard.lock();
+    }
+    return guard;
+}
+
 } // namespace TTAProgram
@@ -63,6 +63,8 @@
 #define TTA_INSTRUCTION_REFERENCE_MANAGER_HH
 
 #include <map>
+#include <boost/thread/recursive_mutex.hpp>
+#include <boost/thread/locks.hpp>
 #include "Exception.hh"
 #include "InstructionReferenceImpl.hh"
 
@@ -96,6 +98,9 @@ public:
 
     void validate();
 
+    void setThreadSafe(bool threadSafe);
+    boost::unique_lock<boost::recursive_mutex> lock() const;
+
     class Iterator {
     public:
         inline Iterator& operator++(); // ++i
@@ -118,6 +123,14 @@ private:
 
     /// Instruction references to maintain.
     RefMap references_;
+    /// Guards references_. The procedures of a program can be scheduled
+    /// in parallel threads that share the program's reference manager.
+    /// Recursive because dropping a reference calls back referenceDied().
+    /// Also guards the reference sets of the InstructionReferenceImpls.
+    /// Iterating clients must hold it, see lock().
+    mutable boost::recursive_mutex mutex_;
+    /// True in case the references are used from several threads.
+    bool threadSafe_;
 
 };
 
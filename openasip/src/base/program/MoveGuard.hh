@@ -33,6 +33,8 @@
 #ifndef TTA_MOVE_GUARD_HH
 #define TTA_MOVE_GUARD_HH
 
+#include "POMAllocator.hh"
+
 namespace TTAMachine {
     class Guard;
 }
@@ -49,6 +51,13 @@ public:
     MoveGuard(const TTAMachine::Guard& guard);
     ~MoveGuard();
 
+    static void* operator new(std::size_t size) {
+        return POMAllocator::allocate(size);
+    }
+    static void operator delete(void* object, std::size_t size) {
+        POMAllocator::deallocate(object, size);
+    }
+
     bool isUnconditional() const;
     bool isInverted() const;
     const TTAMachine::Guard& guard() const;
@@ -0,0 +1,353 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file POMAllocator.cc
+ *
+ * Implementation of POMAllocator class.
+ *
+ * @note rating: red
+ */
+
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <boost/pool/pool.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include "POMAllocator.hh"
+
+namespace TTAProgram {
+
+namespace {
+
+/// Number of size classes.
+const std::size_t SIZE_CLASSES = 
+    POMAllocator::MAX_POOLED_SIZE / POMAllocator::GRANULARITY;
+/// Number of blocks moved at once between a thread and the shared pool.
+const std::size_t BATCH_SIZE = 64;
+/// A thread returns blocks to the shared pool when it has more than this
+/// many free blocks of a size class.
+const std::size_t MAX_CACHED_BLOCKS = 4 * BATCH_SIZE;
+/// Pools that have had fewer blocks than this handed out are not purged
+/// when they become empty to avoid thrashing with short lived temporaries.
+const std::size_t MIN_PURGED_PEAK = 4096;
+
+/**
+ * A free block in the free list of a thread.
+ *
+ * The smallest pooled block, GRANULARITY bytes, holds the link.
+ */
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+/**
+ * The shared pool of one size class.
+ */
+struct SizeClass {
+    SizeClass() : pool(NULL), handedOut(0), peak(0) {}
+
+    /// The pool, created at the first allocation of the size class.
+    boost::pool<>* pool;
+    /// Number of blocks given to the threads, including the blocks in
+    /// their free lists. Written only while holding the lock.
+    std::atomic<std::size_t> handedOut;
+    /// The highest handed out count since the pool was last purged.
+    /// Written only while holding the lock.
+    std::atomic<std::size_t> peak;
+};
+
+/**
+ * The free lists of one thread.
+ *
+ * Only the owning thread modifies the lists. The block counts are read
+ * by liveObjectCount() from other threads.
+ */
+struct ThreadCache {
+    ThreadCache() {
+        for (std::size_t i = 0; i < SIZE_CLASSES; ++i) {
+            blocks[i] = NULL;
+            counts[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /// The free blocks per size class.
+    FreeBlock* blocks[SIZE_CLASSES];
+    /// The number of free blocks per size class.
+    std::atomic<std::size_t> counts[SIZE_CLASSES];
+};
+
+/**
+ * The shared state of the allocator.
+ *
+ * Deliberately never destroyed: POM objects owned by static singletons
+ * may be freed after the static destructors have run.
+ */
+struct PoolState {
+    SizeClass classes[SIZE_CLASSES];
+    /// The free lists of the running threads.
+    std::vector<ThreadCache*> caches;
+    boost::mutex lock;
+};
+
+PoolState&
+poolState() {
+    static PoolState* state = new PoolState();
+    return *state;
+}
+
+/**
+ * Returns the given number of blocks from a thread's free list to the
+ * shared pool and purges the pool in case all its blocks were returned.
+ *
+ * Must be called while holding the lock.
+ */
+void
+returnBlocks(ThreadCache& cache, std::size_t index, std::size_t count) {
+    SizeClass& sizeClass = poolState().classes[index];
+    for (std::size_t i = 0; i < count; ++i) {
+        FreeBlock* block = cache.blocks[index];
+        cache.blocks[index] = block->next;
+        sizeClass.pool->free(block);
+    }
+    cache.counts[index].store(
+        cache.counts[index].load(std::memory_order_relaxed) - count,
+        std::memory_order_relaxed);
+    const std::size_t handedOut = 
+        sizeClass.handedOut.load(std::memory_order_relaxed) - count;
+    sizeClass.handedOut.store(handedOut, std::memory_order_relaxed);
+
+    // the program owning the objects has been destroyed, release the
+    // chunks in bulk instead of keeping them for reuse
+    if (handedOut == 0 && 
+        sizeClass.peak.load(std::memory_order_relaxed) >= MIN_PURGED_PEAK) {
+        sizeClass.pool->purge_memory();
+        sizeClass.peak.store(0, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Returns all free blocks of a thread to the shared pools when the thread
+ * exits.
+ */
+struct CacheReleaser {
+    CacheReleaser() : cache(NULL), released(false) {}
+    ~CacheReleaser();
+
+    /// The free lists of the thread, NULL until the first allocation.
+    ThreadCache* cache;
+    /// True after the thread's free lists have been released.
+    bool released;
+};
+
+thread_local CacheReleaser threadCacheReleaser;
+
+CacheReleaser::~CacheReleaser() {
+    released = true;
+    if (cache == NULL) {
+        return;
+    }
+    PoolState& state = poolState();
+    boost::mutex::scoped_lock lock(state.lock);
+    for (std::size_t i = 0; i < SIZE_CLASSES; ++i) {
+        returnBlocks(*cache, i, cache->counts[i].load());
+    }
+    state.caches.erase(
+        std::find(state.caches.begin(), state.caches.end(), cache));
+    delete cache;
+    cache = NULL;
+}
+
+/**
+ * Returns the free lists of the calling thread.
+ *
+ * @return The free lists, or NULL in case the thread is exiting and has
+ * already released them.
+ */
+ThreadCache*
+threadCache() {
+    CacheReleaser& releaser = threadCacheReleaser;
+    if (releaser.cache == NULL && !releaser.released) {
+        ThreadCache* cache = new ThreadCache();
+        PoolState& state = poolState();
+        boost::mutex::scoped_lock lock(state.lock);
+        state.caches.push_back(cache);
+        releaser.cache = cache;
+    }
+    return releaser.cache;
+}
+
+/**
+ * Takes a batch of blocks from the shared pool to a thread's free list.
+ *
+ * Must be called while holding the lock.
+ *
+ * @exception std::bad_alloc If no blocks could be allocated.
+ */
+void
+takeBlocks(ThreadCache& cache, std::size_t index) {
+    SizeClass& sizeClass = poolState().classes[index];
+    if (sizeClass.pool == NULL) {
+        sizeClass.pool = 
+            new boost::pool<>((index + 1) * POMAllocator::GRANULARITY);
+    }
+    std::size_t count = 0;
+    for (; count < BATCH_SIZE; ++count) {
+        FreeBlock* block = static_cast<FreeBlock*>(sizeClass.pool->malloc());
+        if (block == NULL) {
+            break;
+        }
+        block->next = cache.blocks[index];
+        cache.blocks[index] = block;
+    }
+    if (count == 0) {
+        throw std::bad_alloc();
+    }
+    cache.counts[index].store(
+        cache.counts[index].load(std::memory_order_relaxed) + count,
+        std::memory_order_relaxed);
+    const std::size_t handedOut = 
+        sizeClass.handedOut.load(std::memory_order_relaxed) + count;
+    sizeClass.handedOut.store(handedOut, std::memory_order_relaxed);
+    if (handedOut > sizeClass.peak.load(std::memory_order_relaxed)) {
+        sizeClass.peak.store(handedOut, std::memory_order_relaxed);
+    }
+}
+
+}
+
+/**
+ * Allocates memory for an object of the given size.
+ *
+ * @param size Size of the object in bytes.
+ * @return The allocated memory.
+ * @exception std::bad_alloc If the memory could not be allocated.
+ */
+void*
+POMAllocator::allocate(std::size_t size) {
+    if (size == 0 || size > MAX_POOLED_SIZE) {
+        return ::operator new(size);
+    }
+    const std::size_t index = (size - 1) / GRANULARITY;
+
+    ThreadCache* cache = threadCache();
+    if (cache == NULL) {
+        // the thread is exiting and has released its free lists
+        PoolState& state = poolState();
+        boost::mutex::scoped_lock lock(state.lock);
+        SizeClass& sizeClass = state.classes[index];
+        if (sizeClass.pool == NULL) {
+            sizeClass.pool = new boost::pool<>((index + 1) * GRANULARITY);
+        }
+        void* object = sizeClass.pool->malloc();
+        if (object == NULL) {
+            throw std::bad_alloc();
+        }
+        sizeClass.handedOut.store(
+            sizeClass.handedOut.load(std::memory_order_relaxed) + 1,
+            std::memory_order_relaxed);
+        return object;
+    }
+    if (cache->blocks[index] == NULL) {
+        PoolState& state = poolState();
+        boost::mutex::scoped_lock lock(state.lock);
+        takeBlocks(*cache, index);
+    }
+    FreeBlock* block = cache->blocks[index];
+    cache->blocks[index] = block->next;
+    cache->counts[index].store(
+        cache->counts[index].load(std::memory_order_relaxed) - 1,
+        std::memory_order_relaxed);
+    return block;
+}
+
+/**
+ * Frees memory allocated with allocate().
+ *
+ * @param object The memory to free.
+ * @param size The size given to allocate().
+ */
+void
+POMAllocator::deallocate(void* object, std::size_t size) {
+    if (object == NULL) {
+        return;
+    }
+    if (size == 0 || size > MAX_POOLED_SIZE) {
+        ::operator delete(object);
+        return;
+    }
+    const std::size_t index = (size - 1) / GRANULARITY;
+    PoolState& state = poolState();
+    SizeClass& sizeClass = state.classes[index];
+
+    ThreadCache* cache = threadCache();
+    if (cache == NULL) {
+        boost::mutex::scoped_lock lock(state.lock);
+        sizeClass.pool->free(object);
+        sizeClass.handedOut.store(
+            sizeClass.handedOut.load(std::memory_order_relaxed) - 1,
+            std::memory_order_relaxed);
+        return;
+    }
+
+    FreeBlock* block = static_cast<FreeBlock*>(object);
+    block->next = cache->blocks[index];
+    cache->blocks[index] = block;
+    const std::size_t count = 
+        cache->counts[index].load(std::memory_order_relaxed) + 1;
+    cache->counts[index].store(count, std::memory_order_relaxed);
+
+    if (count > MAX_CACHED_BLOCKS) {
+        boost::mutex::scoped_lock lock(state.lock);
+        returnBlocks(*cache, index, BATCH_SIZE);
+    } else if (
+        count == sizeClass.handedOut.load(std::memory_order_relaxed) &&
+        sizeClass.peak.load(std::memory_order_relaxed) >= MIN_PURGED_PEAK) {
+        // all the blocks of a large pool are free in this thread, return
+        // them so the pool gets purged
+        boost::mutex::scoped_lock lock(state.lock);
+        if (count == sizeClass.handedOut.load(std::memory_order_relaxed)) {
+            returnBlocks(*cache, index, count);
+        }
+    }
+}
+
+/**
+ * Returns the number of objects currently allocated from the pools.
+ *
+ * The count is exact only when no other thread allocates or frees
+ * objects at the same time.
+ *
+ * @return The number of live pooled objects.
+ */
+std::size_t
+POMAllocator::liveObjectCount() {
+    PoolState& state = poolState();
+    boost::mutex::scoped_lock lock(state.lock);
+    std::size_t live = 0;
+    for (std::size_t i = 0; i < SIZE_CLASSES; ++i) {
+        live += state.classes[i].handedOut.load();
+        for (std::size_t c = 0; c < state.caches.size(); ++c) {
+            live -= state.caches[c]->counts[i].load();
+        }
+    }
+    return live;
+}
+
+}
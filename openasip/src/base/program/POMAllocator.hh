@@ -0,0 +1,99 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file POMAllocator.hh
+ *
+ * Declaration of POMAllocator class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_POM_ALLOCATOR_HH
+#define TTA_POM_ALLOCATOR_HH
+
+#include <cstddef>
+
+namespace TTAProgram {
+
+/**
+ * Pooled memory allocation for the small, numerous objects of the
+ * Program Object Model.
+ *
+ * A large program consists of millions of Instructions, Moves, Terminals
+ * and MoveGuards. Allocating each of them from the general purpose heap
+ * costs a per-object header and makes loading and destroying the program
+ * dominated by the allocator. This class hands out the objects from
+ * per-size-class pools that are carved from large contiguous chunks.
+ * When the last object of a size class is freed, the chunks are returned
+ * to the system in bulk.
+ *
+ * Each thread keeps a free list per size class and moves the blocks
+ * between it and the shared pools in batches, thus the threads scheduling
+ * procedures in parallel do not contend for a lock at every allocation.
+ * An object can be freed in a different thread than it was allocated in.
+ *
+ * The POM classes use this through class-specific operator new/delete.
+ * Objects owned by shared pointers can be allocated together with their
+ * reference count block by passing POMPoolAllocator to
+ * std::allocate_shared().
+ */
+class POMAllocator {
+public:
+    static void* allocate(std::size_t size);
+    static void deallocate(void* object, std::size_t size);
+
+    static std::size_t liveObjectCount();
+
+    /// Pooled sizes are rounded up to a multiple of this.
+    static const std::size_t GRANULARITY = 16;
+    /// Objects larger than this are allocated from the heap. Large enough
+    /// for the immediate terminals, which embed a SIMD wide SimValue.
+    static const std::size_t MAX_POOLED_SIZE = 1024;
+};
+
+/**
+ * A standard library allocator that allocates from POMAllocator.
+ *
+ * Intended for std::allocate_shared() so that the object and its shared
+ * pointer control block share a single pooled allocation.
+ */
+template <typename T>
+class POMPoolAllocator {
+public:
+    typedef T value_type;
+
+    POMPoolAllocator() {}
+    template <typename U>
+    POMPoolAllocator(const POMPoolAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        return static_cast<T*>(POMAllocator::allocate(n * sizeof(T)));
+    }
+    void deallocate(T* object, std::size_t n) {
+        POMAllocator::deallocate(object, n * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const POMPoolAllocator<U>&) const { return true; }
+    template <typename U>
+    bool operator!=(const POMPoolAllocator<U>&) const { return false; }
+};
+
+}
+
+#endif
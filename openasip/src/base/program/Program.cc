@@ -32,6 +32,7 @@
  */
 
 #include <string>
+#include <algorithm>
 
 #include "Program.hh"
 #include "NullInstruction.hh"
@@ -162,6 +163,7 @@ Program::cleanup() {
 
     SequenceTools::deleteAllItems(procedures_);
     SequenceTools::deleteAllItems(dataMems_);
+    procedureStarts_.clear();
 
     delete globalScope_;
     globalScope_ = NULL;
@@ -372,19 +374,66 @@ Program::firstInstruction() const {
  */
 Instruction&
 Program::instructionAt(InstructionAddress address) const {
-    for (ProcIter iter = procedures_.begin(); iter != procedures_.end();
-        iter++) {
+    return procedureAt(address).instructionAt(address);
+}
 
-        if ((*iter)->startAddress().location() <= address &&
-            (*iter)->endAddress().location() > address) {
-            return (*iter)->instructionAt(address);
-        }
+/**
+ * Returns the procedure that contains the given instruction address.
+ *
+ * @param address The instruction address.
+ * @return The procedure containing the address.
+ * @exception KeyNotFound If no procedure contains the address.
+ */
+Procedure&
+Program::procedureAt(InstructionAddress address) const {
+    int index = procedureIndexAt(address);
+    if (index < 0) {
+        throw KeyNotFound(
+            __FILE__, __LINE__, __func__, 
+            "No instruction at address: " +
+            Conversion::toString(address));
     }
+    return *procedures_[index];
+}
 
-    throw KeyNotFound(
-        __FILE__, __LINE__, __func__, 
-        "No instruction at address: " +
-        Conversion::toString(address));
+/**
+ * Returns the index of the procedure that contains the given address.
+ *
+ * The procedure is found with a binary search over the procedure start
+ * addresses. The lookup only reads the program, thus it can be done
+ * from several threads as long as the program is not modified.
+ *
+ * @param address The instruction address.
+ * @return The procedure index, or -1 if no procedure contains the address.
+ */
+int
+Program::procedureIndexAt(InstructionAddress address) const {
+    // the last procedure starting at or before the address; empty
+    // procedures share the start address of the following one
+    std::vector<InstructionAddress>::const_iterator i =
+        std::upper_bound(
+            procedureStarts_.begin(), procedureStarts_.end(), address);
+    if (i == procedureStarts_.begin()) {
+        return -1;
+    }
+    const int index = i - procedureStarts_.begin() - 1;
+    if (procedures_[index]->endAddress().location() > address) {
+        return index;
+    }
+    return -1;
+}
+
+/**
+ * Rebuilds the procedure start address index.
+ *
+ * Called after the procedure addresses have been changed directly.
+ */
+void
+Program::updateProcedureIndex() {
+    procedureStarts_.resize(procedures_.size());
+    for (std::size_t i = 0; i < procedures_.size(); ++i) {
+        procedureStarts_[i] = procedures_[i]->startAddress().location();
+    }
 }
 
 /**
@@ -417,39 +466,29 @@ Program::nextInstruction(const Instruction& ins) const {
     if (nextInstr != &NullInstruction::instance())
         return *nextInstr;
 
-    ProcIter iter = procedures_.begin();
-    while (iter != procedures_.end()) {
-
-        // if the current instruction address fits procedure's
-        // address space
-        if ((*iter)->startAddress().location() <= insAddress &&
-            (*iter)->endAddress().location() > insAddress) {
-
-            // return next instruction, if it's in the same procedure
-            if ((*iter)->hasNextInstruction(ins)) {
-                return (*iter)->nextInstruction(ins);
+    int index = procedureIndexAt(insAddress);
+    if (index < 0) {
+        // no procedure where current instruction fits was found
+        // (should throw exception?)
+        return NullInstruction::instance();
+    }
 
-                // otherwise find the next non-empty procedure and return
-                // its first instruction
-            } else {
-                iter++;
-                while (iter != procedures_.end()) {
-                    if ((*iter)->instructionCount() != 0) {
-                        return (*iter)->instructionAt(
-                            (*iter)->startAddress().location());
-                    }
-                    iter++;
-                }
+    // return next instruction, if it's in the same procedure
+    const Procedure& proc = *procedures_[index];
+    if (proc.hasNextInstruction(ins)) {
+        return proc.nextInstruction(ins);
+    }
 
-                // if no non-empty procedures found, return null instruction
-                return NullInstruction::instance();
-            }
+    // otherwise find the next non-empty procedure and return
+    // its first instruction
+    for (++index; index < static_cast<int>(procedures_.size()); ++index) {
+        const Procedure& next = *procedures_[index];
+        if (next.instructionCount() != 0) {
+            return next.instructionAt(next.startAddress().location());
         }
-        iter++;
     }
 
-    // no procedure where current instruction fits was found
-    // (should throw exception?)
+    // if no non-empty procedures found, return null instruction
     return NullInstruction::instance();
 }
 
@@ -536,6 +575,7 @@ Program::addProcedure(Procedure* proc) {
         }
 
         procedures_.push_back(proc);
+        procedureStarts_.push_back(proc->startAddress().location());
     }
 }
 
@@ -598,6 +638,7 @@ Program::moveProcedure(Procedure& proc, int howMuch) {
         Procedure* p2 = procedures_[index];
         UIntWord oldAddr = p2->startAddress().location();
         p2->setStartAddress(Address(oldAddr + howMuch, start_.space()));
+        procedureStarts_[index] = oldAddr + howMuch;
     }
 }
 
@@ -925,6 +966,8 @@ Program::removeProcedure(Procedure& proc) {
          iter != procedures_.end(); iter++) {
 
         if ((*iter) == &proc) {
+            procedureStarts_.erase(
+                procedureStarts_.begin() + (iter - procedures_.begin()));
             procedures_.erase(iter);
             break;
         }
@@ -1390,6 +1433,7 @@ Program::finalize() {
                     proc.lastInstruction().address().space()));
         ++iter;
     }
+    updateProcedureIndex();
 
     finalized_ = true;
     delete disasm;
@@ -149,6 +149,8 @@ public:
     bool isFinalized() const { return finalized_; }
 
     bool isInstructionPerAddress() const { return instructionPerAddress_; }
+
+    Procedure& procedureAt(InstructionAddress address) const;
 private:
     /// List for procedures.
     typedef std::vector<Procedure*> ProcList;
@@ -170,6 +172,9 @@ private:
 
     TerminalImmediate* convertSymbolRef(Terminal& tsr);
 
+    int procedureIndexAt(InstructionAddress address) const;
+    void updateProcedureIndex();
+
     /// Global scope of the program.
     GlobalScope* globalScope_;
 
@@ -182,6 +187,12 @@ private:
     /// List of all the moves of the program.
     MoveList moves_;
 
+    /// Start addresses of the procedures in procedures_ order, used for
+    /// binary searching the procedure of an instruction address. Kept up
+    /// to date by the methods that add, move and remove procedures, so
+    /// that the lookups do not modify the program.
+    std::vector<InstructionAddress> procedureStarts_;
+
     /// The start address of the program.
     Address start_;
     /// The entry address of the program.
@@ -766,6 +766,29 @@ unsigned int ProgramOperation::poId() const {
     return poId_;
 }
 
+/**
+ * Returns the id the next program operation created in the calling
+ * thread gets.
+ *
+ * The counter is thread local so that procedures can be scheduled in
+ * parallel threads.
+ */
+unsigned int
+ProgramOperation::nextID() {
+    return idCounter;
+}
+
+/**
+ * Sets the id the next program operation created in the calling thread
+ * gets.
+ *
+ * @param id The next program operation id.
+ */
+void
+ProgramOperation::setNextID(unsigned int id) {
+    idCounter = id;
+}
+
 /**
  * Comparison based on ID's for maps and sets.
  */
@@ -838,7 +861,7 @@ ProgramOperation::hasConstantOperand() const {
     return false;
 }
 
-unsigned int ProgramOperation::idCounter = 0;
+thread_local unsigned int ProgramOperation::idCounter = 0;
 
 const TTAMachine::FunctionUnit*
 ProgramOperation::fuFromOutMove(const MoveNode& outputNode) const {
@@ -140,6 +140,8 @@ public:
     std::string toString() const;
 
     unsigned int poId() const;
+    static unsigned int nextID();
+    static void setNextID(unsigned int id);
 
     bool hasConstantOperand() const;
     // Comparator for maps and sets
@@ -171,7 +173,7 @@ private:
     // all output moves
     MoveVector allOutputMoves_;
     unsigned int poId_;
-    static unsigned int idCounter;
+    static thread_local unsigned int idCounter;
     // Reference to original LLVM MachineInstruction
     const llvm::MachineInstr* mInstr_;
 };
@@ -84,6 +84,7 @@
 #include "GlobalScope.hh"
 #include "UniversalMachine.hh"
 #include "Program.hh"
+#include "POMAllocator.hh"
 
 using namespace TTAMachine;
 using namespace TPEF;
@@ -592,10 +593,14 @@ TPEFProgramFactory::createInstruction(
                 throw e;
             }
 
+            // allocate the move and its reference count from the POM pool
+            const POMPoolAllocator<TTAProgram::Move> allocator;
             if (guard != NULL) {
-                newMove = std::make_shared<TTAProgram::Move>(source, destination, bus, guard);
+                newMove = std::allocate_shared<TTAProgram::Move>(
+                    allocator, source, destination, bus, guard);
             } else {
-                newMove = std::make_shared<TTAProgram::Move>(source, destination, bus);
+                newMove = std::allocate_shared<TTAProgram::Move>(
+                    allocator, source, destination, bus);
             }
             assert(newMove != NULL);
 
@@ -724,7 +729,8 @@ TPEFProgramFactory::createInstruction(
             immTerm = new TerminalImmediate(simVal);
         }
 
-        auto newImmediate = std::make_shared<Immediate>(immTerm, destination);
+        auto newImmediate = std::allocate_shared<Immediate>(
+            POMPoolAllocator<Immediate>(), immTerm, destination);
 
         newInstruction->addImmediate(newImmediate);
 
@@ -39,6 +39,7 @@
 #include "Exception.hh"
 #include "TCEString.hh"
 #include "Application.hh"
+#include "POMAllocator.hh"
 
 class Operation;
 
@@ -62,6 +63,13 @@ public:
     Terminal();
     virtual ~Terminal();
 
+    static void* operator new(std::size_t size) {
+        return POMAllocator::allocate(size);
+    }
+    static void operator delete(void* object, std::size_t size) {
+        POMAllocator::deallocate(object, size);
+    }
+
     virtual bool isImmediate() const;
     virtual bool isAddress() const;
     virtual bool isInstructionAddress() const;
@@ -38,6 +38,14 @@
 #include <cassert>
 #include <boost/format.hpp>
 
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
 #include "BinaryStream.hh"
 #include "Swapper.hh"
 #include "BaseType.hh"
@@ -49,7 +57,8 @@ namespace TPEF {
 
 BinaryStream::BinaryStream(std::ostream& stream, bool littleEndian): 
     fileName_(""), extOStream_(&stream), littleEndianStorage_(littleEndian),
-    tpefVersion_(TPEFHeaders::TPEF_V2) {
+    tpefVersion_(TPEFHeaders::TPEF_V2), mappedData_(NULL), mappedSize_(0),
+    mappedPosition_(0), mappedEOF_(false) {
 }
 
 /**
@@ -63,7 +72,8 @@ BinaryStream::BinaryStream(std::ostream& stream, bool littleEndian):
  */
 BinaryStream::BinaryStream(std::string name, bool littleEndian): 
     fileName_(name), extOStream_(NULL), littleEndianStorage_(littleEndian),
-    tpefVersion_(TPEFHeaders::TPEF_V1) {
+    tpefVersion_(TPEFHeaders::TPEF_V1), mappedData_(NULL), mappedSize_(0),
+    mappedPosition_(0), mappedEOF_(false) {
 }
 
 /**
@@ -223,6 +233,14 @@ BinaryStream::readWord() {
  */
 void
 BinaryStream::readByteBlock(Byte* buffer, unsigned int howmany) {
+    if (mappedData_ != NULL && !mappedEOF_ &&
+        mappedPosition_ <= mappedSize_ &&
+        howmany <= mappedSize_ - mappedPosition_) {
+        std::memcpy(buffer, mappedData_ + mappedPosition_, howmany);
+        mappedPosition_ += howmany;
+        return;
+    }
+
     try {
         for (unsigned int i = 0; i < howmany; i++) {
             buffer[i] = getByte();
@@ -487,6 +505,12 @@ BinaryStream::openInput(std::string name) {
             __FILE__, __LINE__, __func__, "External stream is write-only.");
     }
 
+    // read-only access is served from a memory mapping of the file,
+    // which avoids the per-byte overhead of the stream
+    if (!oStream_.is_open() && mapInput(name)) {
+        return;
+    }
+
     iStream_.open(name.c_str());
 
     if (!iStream_.is_open()) {
@@ -518,6 +542,9 @@ BinaryStream::openOutput(std::string name) {
             "External stream should be always open.");
     }
 
+    // the mapping would not see the written data
+    unmapInput();
+
     oStream_.open(name.c_str(), fstream::out);
 
     // With some versions of STL a non-existing file is not
@@ -537,11 +564,79 @@ BinaryStream::openOutput(std::string name) {
     }
 }
 
+/**
+ * Maps the input file to memory.
+ *
+ * @param name Name of the input file.
+ * @return True if the file was mapped, false if it has to be read through
+ *         the input stream instead.
+ */
+bool
+BinaryStream::mapInput(const std::string& name) {
+    int fd = ::open(name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat fileStatus;
+    // positions are reported as unsigned int, and the 32-bit TPEF offsets
+    // cannot address a larger file anyway, so such files go through the
+    // stream and fail there as before
+    if (fstat(fd, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode) ||
+        fileStatus.st_size <= 0 ||
+        static_cast<std::uintmax_t>(fileStatus.st_size) >
+        std::numeric_limits<unsigned int>::max()) {
+        ::close(fd);
+        return false;
+    }
+    const std::size_t size = static_cast<std::size_t>(fileStatus.st_size);
+    void* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    mappedData_ = static_cast<const Byte*>(data);
+    mappedSize_ = size;
+    mappedPosition_ = 0;
+    mappedEOF_ = false;
+    return true;
+}
+
+/**
+ * Replaces the memory mapped input with the input stream.
+ *
+ * The read position and the end of file status are preserved. Does
+ * nothing if the input is not mapped.
+ */
+void
+BinaryStream::unmapInput() {
+    if (mappedData_ == NULL) {
+        return;
+    }
+    const std::size_t position = mappedPosition_;
+    const bool eof = mappedEOF_;
+    munmap(const_cast<Byte*>(mappedData_), mappedSize_);
+    mappedData_ = NULL;
+
+    iStream_.open(fileName_.c_str());
+    if (!iStream_.is_open()) {
+        throw UnreachableStream(__FILE__, __LINE__, __func__, fileName_);
+    }
+    iStream_.tie(&oStream_);
+    iStream_.seekg(position);
+    if (eof) {
+        iStream_.setstate(ios::eofbit);
+    }
+}
+
 /**
  * Closes the stream.
  */
 void
 BinaryStream::close() {
+    if (mappedData_ != NULL) {
+        munmap(const_cast<Byte*>(mappedData_), mappedSize_);
+        mappedData_ = NULL;
+    }
     if (iStream_.is_open()) {
         iStream_.close();
     }
@@ -564,7 +659,7 @@ BinaryStream::readPosition() {
             __FILE__, __LINE__, __func__, "External stream is write-only.");
     }
 
-    if (!iStream_.is_open()) {
+    if (!iStream_.is_open() && mappedData_ == NULL) {
         try {
             openInput(fileName_);
         } catch (const UnreachableStream& error) {
@@ -575,6 +670,10 @@ BinaryStream::readPosition() {
         }
     }
 
+    if (mappedData_ != NULL) {
+        return static_cast<unsigned int>(mappedPosition_);
+    }
+
     if (iStream_.bad()) {
         throw UnreachableStream(__FILE__, __LINE__,
                                 "BinaryStream::readPosition", fileName_);
@@ -632,7 +731,7 @@ BinaryStream::setReadPosition(unsigned int position) {
             __FILE__, __LINE__, __func__, "External stream is write-only.");
     }
 
-    if (!iStream_.is_open()) {
+    if (!iStream_.is_open() && mappedData_ == NULL) {
         try {
             openInput(fileName_);
 
@@ -643,6 +742,14 @@ BinaryStream::setReadPosition(unsigned int position) {
             throw newException;
         }
     }
+    if (mappedData_ != NULL) {
+        if (position <= mappedSize_) {
+            mappedEOF_ = false;
+        }
+        mappedPosition_ = position;
+        return;
+    }
+
     if (iStream_.bad()) {
         throw UnreachableStream(
             __FILE__, __LINE__, __func__, fileName_);
@@ -725,7 +832,7 @@ BinaryStream::endOfFile() {
             __FILE__, __LINE__, __func__, "External stream is write-only.");
     }
 
-    if (!iStream_.is_open()) {
+    if (!iStream_.is_open() && mappedData_ == NULL) {
         try {
             openInput(fileName_);
 
@@ -737,6 +844,10 @@ BinaryStream::endOfFile() {
         }
     }
 
+    if (mappedData_ != NULL) {
+        return mappedEOF_;
+    }
+
     if (iStream_.bad()) {
         throw UnreachableStream(
             __FILE__, __LINE__, __func__, fileName_);
@@ -777,7 +888,7 @@ BinaryStream::sizeOfFile() {
         setWritePosition(currentPos);
         return fileSize;
 
-    } else if (!iStream_.is_open()) {
+    } else if (!iStream_.is_open() && mappedData_ == NULL) {
         try {
             openInput(fileName_);
 
@@ -789,6 +900,10 @@ BinaryStream::sizeOfFile() {
         }
     }
 
+    if (mappedData_ != NULL) {
+        return static_cast<unsigned int>(mappedSize_);
+    }
+
     if (iStream_.bad()) {
         throw UnreachableStream(
             __FILE__, __LINE__, __func__, fileName_);
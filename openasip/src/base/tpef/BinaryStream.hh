@@ -35,6 +35,7 @@
 #ifndef TTA_BINARYSTREAM_HH
 #define TTA_BINARYSTREAM_HH
 
+#include <cstddef>
 #include <fstream>
 #include <string>
 #include "TPEFBaseType.hh"
@@ -106,12 +107,24 @@ private:
     /// Indicates TPEF format version used.
     TPEFHeaders::TPEFVersion tpefVersion_;
 
+    /// The input file mapped to memory, NULL if the input is read through
+    /// iStream_.
+    const Byte* mappedData_;
+    /// Size of the mapped input file.
+    std::size_t mappedSize_;
+    /// The read position in the mapped input file.
+    std::size_t mappedPosition_;
+    /// True if reading the mapped input has gone past the end of file.
+    bool mappedEOF_;
+
     /// Assignment not allowed.
     BinaryStream& operator=(BinaryStream& old);
     /// Copying not allowed.
     BinaryStream(BinaryStream& old);
 
     void openInput(std::string name);
+    bool mapInput(const std::string& name);
+    void unmapInput();
     void openOutput(std::string name);
     void close();
     Byte getByte();
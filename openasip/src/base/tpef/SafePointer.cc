@@ -281,11 +281,12 @@ SafePointer::isAlive(SafePointer* pointerToCheck) {
 bool
 SafePointer::isReferenced(const SafePointable* object) {
 
-    if (!MapTools::containsKey(*referenceMap_, object)) {
+    ReferenceMap::iterator listPos = referenceMap_->find(object);
+    if (listPos == referenceMap_->end()) {
         return false;
     }
 
-    SafePointerList* theList = (*referenceMap_)[object];
+    SafePointerList* theList = (*listPos).second;
     theList->cleanupDead();
 
     return (theList->length() > 0);
@@ -420,11 +421,12 @@ SafePointer::sectionKeyFor(const SafePointable* obj) {
 void
 SafePointer::notifyDeleted(const SafePointable* obj) {
 
-    if (!MapTools::containsKey(*referenceMap_, obj)) {
+    ReferenceMap::iterator listPos = referenceMap_->find(obj);
+    if (listPos == referenceMap_->end()) {
         return;
     }
 
-    SafePointerList *listOfObj = (*referenceMap_)[obj];
+    SafePointerList *listOfObj = (*listPos).second;
 
     assert(listOfObj != NULL);
     listOfObj->cleanup();
@@ -432,8 +434,8 @@ SafePointer::notifyDeleted(const SafePointable* obj) {
     // if the safe pointer list we just cleaned up is not referenced in any
     // map anymore, it can be deleted safely
 
-    // TODO: for hashmap implementation this will take *very* long time
-    //       so fix this before change typedefs in SafePointer.hh
+    // the key maps are normally cleaned up before the objects are deleted,
+    // so these scans are short
     if (!MapTools::containsValue(*sectionMap_,       listOfObj) &&
         !MapTools::containsValue(*sectionIndexMap_,  listOfObj) &&
         !MapTools::containsValue(*sectionOffsetMap_, listOfObj) &&
@@ -441,7 +443,7 @@ SafePointer::notifyDeleted(const SafePointable* obj) {
         delete listOfObj;
     }
 
-    referenceMap_->erase(obj);
+    referenceMap_->erase(listPos);
 }
 
 /**
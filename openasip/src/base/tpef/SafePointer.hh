@@ -38,12 +38,13 @@
 
 #include <cstddef> // NULL
 #include <set>
+#include <unordered_set>
 #include <map>
+#include <unordered_map>
 #include <list>
 #include <iterator>
 #include <sstream>
 
-//#include "hash_map.hh"
 #include "Application.hh"
 #include "ReferenceKey.hh"
 #include "Exception.hh" // IllegalParameters, UnresolvedReference
@@ -103,10 +104,7 @@ private:
 };
 
 /**
- * Class containing all the hash functions if hash_map is
- * used. However the use of hash_map will make program very slow
- * unless MapTools::containsValue() is not optimised for 
- * hash_tables or that function should be circumvented.
+ * Hash functions of the keys of the reference maps.
  */
 class HashFunctions {
 public:
@@ -137,38 +135,30 @@ public:
     }
 };
 
-// TODO: for hash map implementation check SafePointer.cc line 424 TODO
-//       MapTools::containsValue call takes very long time for hash maps..
-
 /// Unordered set of SafePointers.
-typedef std::set<SafePointer*> SafePointerSet;
+typedef std::unordered_set<SafePointer*> SafePointerSet;
 
 /// Map for SafePointers that are requested using SectionIndexKeys.
-typedef std::map<SectionIndexKey, SafePointerList*> SectionIndexMap;
-//typedef hash_map<SectionIndexKey, SafePointerList*,
-//                 HashFunctions> SectionIndexMap;
+typedef std::unordered_map<SectionIndexKey, SafePointerList*,
+                           HashFunctions> SectionIndexMap;
 
 /// Map for SafePointers that are requested using SectionOffsetKeys.
-typedef std::map<SectionOffsetKey, SafePointerList*> SectionOffsetMap;
-//typedef hash_map<SectionOffsetKey, SafePointerList*,
-//                 HashFunctions> SectionOffsetMap;
+typedef std::unordered_map<SectionOffsetKey, SafePointerList*,
+                           HashFunctions> SectionOffsetMap;
 
 /// Map for SafePointers that are requested using FileOffsetKeys.
-typedef std::map<FileOffsetKey, SafePointerList*> FileOffsetMap;
-//typedef hash_map<FileOffsetKey, SafePointerList*,
-//                 HashFunctions> FileOffsetMap;
+typedef std::unordered_map<FileOffsetKey, SafePointerList*,
+                           HashFunctions> FileOffsetMap;
 
 /// Map for SafePointers that are requested using SectionKeys.
-typedef std::map<SectionKey, SafePointerList*> SectionMap;
-//typedef hash_map<SectionKey, SafePointerList*,
-//                 HashFunctions> SectionMap;
+typedef std::unordered_map<SectionKey, SafePointerList*,
+                           HashFunctions> SectionMap;
 
 
 /// Map for resolved references, that is SafePointers that are pointing to
 /// the created object.
-typedef std::map<const SafePointable*, SafePointerList*> ReferenceMap;
-//typedef hash_map<const SafePointable*, SafePointerList*,
-//                 HashFunctions> ReferenceMap;
+typedef std::unordered_map<const SafePointable*, SafePointerList*,
+                           HashFunctions> ReferenceMap;
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@
 #include "FileSystem.hh"
 #include "InterPassData.hh"
 #include "Machine.hh"
+#include "PhaseTimes.hh"
 
 #include "CompilerWarnings.hh"
 IGNORE_COMPILER_WARNING("-Wunused-parameter")
@@ -167,6 +168,10 @@ main(int argc, char* argv[]) {
         emulationCode = options->standardEmulationLib();
     }
             
+    if (options->isPhaseTimesFileDefined()) {
+        PhaseTimes::setEnabled(true);
+    }
+
     // ---- Run compiler ----
     try {
         InterPassData* ipData = new InterPassData;
@@ -196,10 +201,17 @@ main(int argc, char* argv[]) {
             compiler.compile(
                 bytecodeFile, emulationCode, optLevel, debug, ipData);
 
-        TTAProgram::Program::writeToTPEF(*seqProg, outputFileName);
+        {
+            PhaseTimes::Scope phaseScope("pom_emission");
+            TTAProgram::Program::writeToTPEF(*seqProg, outputFileName);
+        }
         delete seqProg;
         seqProg = NULL;
 
+        if (options->isPhaseTimesFileDefined()) {
+            PhaseTimes::writeJSON(options->phaseTimesFile());
+        }
+
         delete ipData;
         ipData = NULL;
 
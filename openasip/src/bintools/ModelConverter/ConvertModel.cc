@@ -0,0 +1,157 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file ConvertModel.cc
+ *
+ * Implements the convertmodel application which converts ADF, IDF and BEM
+ * files between the XML and the binary format.
+ *
+ * @note rating: red
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+
+#include "ModelConverterCmdLineOptions.hh"
+#include "BinarySerializer.hh"
+#include "ADFSerializer.hh"
+#include "IDFSerializer.hh"
+#include "BEMSerializer.hh"
+#include "ObjectState.hh"
+#include "FileSystem.hh"
+#include "StringTools.hh"
+
+using std::cerr;
+using std::endl;
+using std::string;
+
+/**
+ * Returns the model type of the given file.
+ *
+ * Binary files store the type, for XML files it is deduced from the file
+ * name extension.
+ *
+ * @param fileName The file.
+ * @return "adf", "idf" or "bem", or an empty string if unknown.
+ */
+static string
+modelType(const string& fileName) {
+    if (BinarySerializer::isBinaryFile(fileName)) {
+        std::ifstream input(fileName.c_str(), std::ios::binary);
+        string header(64, '\0');
+        input.read(&header[0], header.size());
+        header.resize(input.gcount());
+        return BinarySerializer::formatTagOf(header);
+    }
+    string extension = StringTools::stringToLower(
+        FileSystem::fileExtension(fileName));
+    if (extension == ".adf" || extension == ".idf" || extension == ".bem") {
+        return extension.substr(1);
+    }
+    return "";
+}
+
+/**
+ * Creates a serializer for the given model type.
+ *
+ * @param type The model type.
+ * @return The serializer, NULL if the type is unknown.
+ */
+static XMLSerializer*
+serializerFor(const string& type) {
+    if (type == "adf") {
+        return new ADFSerializer();
+    } else if (type == "idf") {
+        return new IDF::IDFSerializer();
+    } else if (type == "bem") {
+        return new BEMSerializer();
+    }
+    return NULL;
+}
+
+/**
+ * The main function.
+ */
+int main(int argc, char* argv[]) {
+
+    ModelConverterCmdLineOptions options;
+    try {
+        options.parse(argv, argc);
+    } catch (ParserStopRequest const&) {
+        return EXIT_SUCCESS;
+    } catch (const IllegalCommandLine& e) {
+        cerr << e.errorMessage() << endl;
+        return EXIT_FAILURE;
+    }
+
+    const string inputFile = options.inputFile();
+    const string outputFile = options.outputFile();
+    if (inputFile == "" || outputFile == "") {
+        options.printHelp();
+        return EXIT_FAILURE;
+    }
+    if (options.forceBinary() && options.forceXML()) {
+        cerr << "Only one of the output formats can be given." << endl;
+        return EXIT_FAILURE;
+    }
+    if (!FileSystem::fileIsReadable(inputFile)) {
+        cerr << "Cannot read file '" << inputFile << "'." << endl;
+        return EXIT_FAILURE;
+    }
+
+    string type;
+    try {
+        type = modelType(inputFile);
+    } catch (const Exception& e) {
+        cerr << e.errorMessage() << endl;
+        return EXIT_FAILURE;
+    }
+    if (type == "") {
+        cerr << "Cannot determine the type of '" << inputFile
+             << "', expected an .adf, .idf or .bem file." << endl;
+        return EXIT_FAILURE;
+    }
+
+    bool binaryOutput = !BinarySerializer::isBinaryFile(inputFile);
+    if (options.forceBinary()) {
+        binaryOutput = true;
+    } else if (options.forceXML()) {
+        binaryOutput = false;
+    }
+
+    XMLSerializer* reader = serializerFor(type);
+    XMLSerializer* writer = serializerFor(type);
+    ObjectState* state = NULL;
+    int result = EXIT_SUCCESS;
+    try {
+        reader->setSourceFile(inputFile);
+        state = reader->readState();
+        writer->setBinaryOutput(binaryOutput);
+        writer->setDestinationFile(outputFile);
+        writer->writeState(state);
+    } catch (const Exception& e) {
+        cerr << e.errorMessage() << endl;
+        result = EXIT_FAILURE;
+    }
+
+    delete state;
+    delete reader;
+    delete writer;
+    return result;
+}
@@ -0,0 +1,132 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file ModelConverterCmdLineOptions.cc
+ *
+ * Implementation of ModelConverterCmdLineOptions class.
+ *
+ * @note rating: red
+ */
+
+#include <iostream>
+
+#include "ModelConverterCmdLineOptions.hh"
+#include "CmdLineOptionParser.hh"
+#include "Application.hh"
+
+const std::string ModelConverterCmdLineOptions::SWL_BINARY = "binary";
+const std::string ModelConverterCmdLineOptions::SWS_BINARY = "b";
+const std::string ModelConverterCmdLineOptions::SWL_XML = "xml";
+const std::string ModelConverterCmdLineOptions::SWS_XML = "x";
+
+/**
+ * The constructor.
+ */
+ModelConverterCmdLineOptions::ModelConverterCmdLineOptions() :
+    CmdLineOptions("", Application::TCEVersionString()) {
+
+    addOption(
+        new BoolCmdLineOptionParser(
+            SWL_BINARY, "Write the output in the binary format.",
+            SWS_BINARY));
+    addOption(
+        new BoolCmdLineOptionParser(
+            SWL_XML, "Write the output in the XML format.", SWS_XML));
+}
+
+/**
+ * The destructor.
+ */
+ModelConverterCmdLineOptions::~ModelConverterCmdLineOptions() {
+}
+
+/**
+ * Returns the name of the file to convert.
+ *
+ * @return The input file name, or an empty string if not given.
+ */
+std::string
+ModelConverterCmdLineOptions::inputFile() const {
+    if (numberOfArguments() < 1) {
+        return "";
+    } else {
+        return argument(1);
+    }
+}
+
+/**
+ * Returns the name of the file to write.
+ *
+ * @return The output file name, or an empty string if not given.
+ */
+std::string
+ModelConverterCmdLineOptions::outputFile() const {
+    if (numberOfArguments() < 2) {
+        return "";
+    } else {
+        return argument(2);
+    }
+}
+
+/**
+ * Tells whether the binary output format was requested.
+ *
+ * @return True if the output must be binary.
+ */
+bool
+ModelConverterCmdLineOptions::forceBinary() const {
+    return findOption(SWL_BINARY)->isDefined() &&
+        findOption(SWL_BINARY)->isFlagOn();
+}
+
+/**
+ * Tells whether the XML output format was requested.
+ *
+ * @return True if the output must be XML.
+ */
+bool
+ModelConverterCmdLineOptions::forceXML() const {
+    return findOption(SWL_XML)->isDefined() &&
+        findOption(SWL_XML)->isFlagOn();
+}
+
+/**
+ * Prints the version of the application.
+ */
+void
+ModelConverterCmdLineOptions::printVersion() const {
+    std::cout << "convertmodel - ADF, IDF and BEM format converter "
+              << Application::TCEVersionString() << std::endl;
+}
+
+/**
+ * Prints the help menu of the application.
+ */
+void
+ModelConverterCmdLineOptions::printHelp() const {
+    printVersion();
+    std::cout << std::endl
+              << "Usage: convertmodel [options] <input file> <output file>"
+              << std::endl << std::endl
+              << "Converts an ADF, IDF or BEM file between the XML and the "
+              << "binary format." << std::endl
+              << "The output is written in the other format than the input "
+              << "unless a format" << std::endl
+              << "is given explicitly." << std::endl << std::endl;
+    CmdLineOptions::printHelp();
+}
@@ -0,0 +1,60 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file ModelConverterCmdLineOptions.hh
+ *
+ * Declaration of ModelConverterCmdLineOptions class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_MODEL_CONVERTER_CMD_LINE_OPTIONS_HH
+#define TTA_MODEL_CONVERTER_CMD_LINE_OPTIONS_HH
+
+#include <string>
+
+#include "CmdLineOptions.hh"
+
+/**
+ * Command line options of the convertmodel application.
+ */
+class ModelConverterCmdLineOptions : public CmdLineOptions {
+public:
+    ModelConverterCmdLineOptions();
+    virtual ~ModelConverterCmdLineOptions();
+
+    std::string inputFile() const;
+    std::string outputFile() const;
+    bool forceBinary() const;
+    bool forceXML() const;
+
+    virtual void printVersion() const;
+    virtual void printHelp() const;
+
+private:
+    /// Long name of the binary output switch.
+    static const std::string SWL_BINARY;
+    /// Short name of the binary output switch.
+    static const std::string SWS_BINARY;
+    /// Long name of the XML output switch.
+    static const std::string SWL_XML;
+    /// Short name of the XML output switch.
+    static const std::string SWS_XML;
+};
+
+#endif
@@ -410,6 +410,8 @@ int main(int argc, char* argv[]) {
     ExplorerCmdLineOptions* options = new ExplorerCmdLineOptions();
     try {
         options->parse(argv, argc);
+        // reject unknown effort levels before any compilation is started
+        options->schedulerEffortLevel();
         Application::setCmdLineOptions(options);
     } catch (ParserStopRequest const&) {
         return EXIT_SUCCESS;
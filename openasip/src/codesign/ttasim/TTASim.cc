@@ -34,6 +34,7 @@
 
 #include <string>
 #include <iostream>
+#include <fstream>
 #include <boost/shared_ptr.hpp>
 
 #include "SimulatorCmdLineOptions.hh"
@@ -188,6 +189,9 @@ int main(int argc, char* argv[]) {
     }
     
     simFront.reset(new SimulatorFrontend(options->backendType()));
+    if (options->isBenchmarkFileDefined()) {
+        simFront->setHostInstructionCounting(true);
+    }
     
     SimulatorCLI* cli = new SimulatorCLI(*simFront);
 
@@ -260,6 +264,31 @@ int main(int argc, char* argv[]) {
             Application::restoreSignalHandler(SIGSEGV);
         }        
     }
+
+    if (options->isBenchmarkFileDefined()) {
+        const std::string benchmarkFile = options->benchmarkFile();
+        if (benchmarkFile == "-") {
+            simFront->writePerformanceCounters(std::cout);
+        } else {
+            std::ofstream output(benchmarkFile.c_str());
+            simFront->writePerformanceCounters(output);
+            if (output.fail()) {
+                std::cerr << "Cannot write file '" << benchmarkFile << "'."
+                          << std::endl;
+                delete cli;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    if (options->isExecutionProfileFileDefined()) {
+        try {
+            simFront->writeExecutionProfile(options->executionProfileFile());
+        } catch (const Exception& e) {
+            std::cerr << e.errorMessage() << std::endl;
+            delete cli;
+            return EXIT_FAILURE;
+        }
+    }
     delete cli;
     return EXIT_SUCCESS;
 }
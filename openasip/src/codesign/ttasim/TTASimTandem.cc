@@ -29,80 +29,387 @@
  * execution to detect differences in the simulations, which indicate there's
  * a missimulation bug in one or both of the engines.
  *
+ * The engines run in separate threads. The compiled engine produces a
+ * digest of the compared state after each simulated basic block and the
+ * interpretive engine checks its own state against the digests. The
+ * digest covers also the data memories, which are hashed incrementally
+ * by rehashing only the pages written during the block. The full state
+ * comparison is done only when the digests differ.
+ *
  * @author Pekka Jääskeläinen 2009 (pjaaskel-no.spam-cs.tut.fi)
  * @note rating: red
  */
 
 #include <iostream>
 #include <algorithm>
+#include <deque>
+#include <functional>
 #include <boost/format.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
 #include "Application.hh"
 #include "Machine.hh"
 #include "Program.hh"
 #include "SimulatorFrontend.hh"
+#include "MemorySystem.hh"
+#include "Memory.hh"
+#include "AddressSpace.hh"
 #include "RegisterFile.hh"
+#include "FunctionUnit.hh"
+#include "FUPort.hh"
 #include "SimValue.hh"
 #include "POMDisassembler.hh"
 #include "DisassemblyFUPort.hh"
 #include "Instruction.hh"
 #include "Procedure.hh"
 
+namespace {
+
+/// The maximum number of blocks the compiled engine may run ahead of the
+/// interpretive engine.
+const std::size_t MAX_QUEUED_BLOCKS = 4096;
+
 /**
- * Simulates the given program+machine in "tandem" with the two
- * simulation engines.
+ * The state of the compiled engine after simulating a basic block.
  */
-void 
-tandemSimulate(
+struct BlockDigest {
+    /// The cycle count after the block.
+    ClockCycleCount cycle;
+    /// The program counter after the block.
+    InstructionAddress pc;
+    /// Hash of the state compared by SimulatorFrontend::compareState().
+    std::size_t hash;
+    /// True in case the simulation ended after the block.
+    bool ended;
+    /// True in case the block could not be simulated.
+    bool error;
+    /// The error message in case of an error.
+    std::string errorMessage;
+};
+
+/**
+ * A bounded queue of block digests between the engine threads.
+ */
+class BlockDigestQueue {
+public:
+    BlockDigestQueue() : closed_(false) {}
+
+    /**
+     * Adds a digest to the queue, waits while the queue is full.
+     *
+     * @return False in case the queue was closed by the consumer.
+     */
+    bool push(const BlockDigest& digest) {
+        boost::unique_lock<boost::mutex> lock(mutex_);
+        while (queue_.size() >= MAX_QUEUED_BLOCKS && !closed_) {
+            notFull_.wait(lock);
+        }
+        if (closed_) {
+            return false;
+        }
+        queue_.push_back(digest);
+        notEmpty_.notify_one();
+        return true;
+    }
+
+    /**
+     * Takes the oldest digest from the queue, waits while it is empty.
+     */
+    BlockDigest pop() {
+        boost::unique_lock<boost::mutex> lock(mutex_);
+        while (queue_.empty()) {
+            notEmpty_.wait(lock);
+        }
+        BlockDigest digest = queue_.front();
+        queue_.pop_front();
+        notFull_.notify_one();
+        return digest;
+    }
+
+    /**
+     * Stops the producer from adding more digests.
+     */
+    void close() {
+        boost::unique_lock<boost::mutex> lock(mutex_);
+        closed_ = true;
+        notFull_.notify_all();
+    }
+
+private:
+    std::deque<BlockDigest> queue_;
+    boost::mutex mutex_;
+    boost::condition_variable notEmpty_;
+    boost::condition_variable notFull_;
+    bool closed_;
+};
+
+/**
+ * Combines the given value to a hash.
+ */
+inline void
+combineHash(std::size_t& hash, std::size_t value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+/**
+ * Computes a digest of the state compared by compareState().
+ *
+ * Covers the program counter, the register files, the FU input ports and
+ * the contents of the data memories.
+ */
+std::size_t
+stateDigest(SimulatorFrontend& simulator) {
+
+    std::hash<std::string> stringHash;
+    std::size_t hash = simulator.programCounter();
+
+    const TTAMachine::Machine::RegisterFileNavigator& rfNav = 
+        simulator.machine().registerFileNavigator();
+    for (int i = 0; i < rfNav.count(); ++i) {
+        TTAMachine::RegisterFile& rf = *rfNav.item(i);
+        for (int reg = 0; reg < rf.size(); ++reg) {
+            combineHash(
+                hash, stringHash(simulator.registerFileValue(rf.name(), reg)));
+        }
+    }
+
+    const TTAMachine::Machine::FunctionUnitNavigator& fuNav = 
+        simulator.machine().functionUnitNavigator();
+    for (int i = 0; i < fuNav.count(); ++i) {
+        TTAMachine::FunctionUnit& fu = *fuNav.item(i);
+        for (int port = 0; port < fu.portCount(); ++port) {
+            if (fu.port(port)->isOutput())
+                continue; 
+            combineHash(
+                hash, 
+                simulator.FUPortValue(
+                    fu.name(), fu.port(port)->name()).intValue());
+        }
+    }
+
+    MemorySystem& memorySystem = simulator.memorySystem();
+    for (unsigned int i = 0; i < memorySystem.memoryCount(); ++i) {
+        combineHash(hash, memorySystem.memory(i)->contentDigest());
+    }
+    return hash;
+}
+
+/**
+ * Prints the address spaces whose memory contents differ in the engines.
+ *
+ * @return True in case the memory contents are equal.
+ */
+bool
+compareMemories(
+    SimulatorFrontend& compiled, 
+    SimulatorFrontend& interp, 
+    std::ostream& differences) {
+
+    MemorySystem& compiledMemories = compiled.memorySystem();
+    MemorySystem& interpMemories = interp.memorySystem();
+    bool equal = true;
+    for (unsigned int i = 0; i < compiledMemories.memoryCount(); ++i) {
+        const std::string& name = compiledMemories.addressSpace(i).name();
+        if (compiledMemories.memory(i)->contentDigest() !=
+            interpMemories.memory(name)->contentDigest()) {
+            if (equal) {
+                differences
+                    << "DIFFERING MEMORY CONTENTS" << std::endl
+                    << "-------------------------" << std::endl
+                    << "      cycle: " << compiled.cycleCount() << std::endl
+                    << "         PC: " << compiled.programCounter() 
+                    << std::endl;
+            }
+            differences << "address space: " << name << std::endl;
+            equal = false;
+        }
+    }
+    return equal;
+}
+
+/**
+ * Loads the machine and the program to both simulation engines.
+ */
+void
+initializeEngines(
+    SimulatorFrontend& interp,
+    SimulatorFrontend& compiled,
     TTAMachine::Machine& machine, 
     TTAProgram::Program& program) {
 
-    // initialize both simulation engines
-    SimulatorFrontend interp(SimulatorFrontend::SIM_NORMAL);
     interp.loadMachine(machine);
     interp.loadProgram(program);
 
-    SimulatorFrontend compiled(SimulatorFrontend::SIM_COMPILED);
-
     // leave the compile simulation engine files at /tmp
     compiled.setCompiledSimulationLeaveDirty(true);
 
+    // The compiled engine runs in its own thread. Dynamic compilation would
+    // invoke the compiler and load the simulation functions from that
+    // thread while the interpretive engine uses the same process wide
+    // state, thus all the simulation code is compiled and loaded here,
+    // before the threads start.
+    compiled.setStaticCompilation(true);
     compiled.loadMachine(machine);
     compiled.loadProgram(program);
-    // reduce startup time by using dynamic compilation of the simulation
-    // engine
-    compiled.setStaticCompilation(false);
-
 
     assert(compiled.isSimulationInitialized());
     assert(interp.isSimulationInitialized());
+}
 
-    ClockCycleCount simulatedCycles = 0;
-    while (!compiled.hasSimulationEnded()) {
-        ClockCycleCount stepping;
+/**
+ * Runs the compiled engine a block at a time and queues the digests.
+ *
+ * Executed in its own thread.
+ */
+void
+simulateCompiled(SimulatorFrontend& compiled, BlockDigestQueue& queue) {
+    while (true) {
+        BlockDigest digest;
+        digest.cycle = 0;
+        digest.pc = 0;
+        digest.hash = 0;
+        digest.ended = false;
+        digest.error = false;
         try {
             compiled.step(1);
+            digest.cycle = compiled.cycleCount();
+            digest.pc = compiled.programCounter();
+            digest.hash = stateDigest(compiled);
+            digest.ended = compiled.hasSimulationEnded();
+        } catch (const Exception& e) {
+            digest.error = true;
+            digest.errorMessage = e.errorMessage();
+        } catch (const std::exception& e) {
+            digest.error = true;
+            digest.errorMessage = e.what();
+        } catch (...) {
+            digest.error = true;
+            digest.errorMessage = "unknown error in the compiled engine";
+        }
+        if (!queue.push(digest) || digest.ended || digest.error) {
+            return;
+        }
+    }
+}
+
+/**
+ * Simulates the program in lock-step with both engines up to the block
+ * ending at the given cycle and prints the differences in the state.
+ *
+ * Used to produce the full state diff after a digest mismatch. The state
+ * is compared after each block, as compareState() reports the PC of the
+ * previous comparison as the start of the block where the states
+ * diverged.
+ */
+void
+reportMismatch(
+    TTAMachine::Machine& machine, 
+    TTAProgram::Program& program,
+    ClockCycleCount mismatchCycle) {
+
+    SimulatorFrontend interp(SimulatorFrontend::SIM_NORMAL);
+    SimulatorFrontend compiled(SimulatorFrontend::SIM_COMPILED);
+    initializeEngines(interp, compiled, machine, program);
+
+    ClockCycleCount simulatedCycles = 0;
+    while (true) {
+        compiled.step(1);
+        ClockCycleCount stepping = compiled.cycleCount() - simulatedCycles;
+        interp.step(stepping);
+        simulatedCycles += stepping;
+        if (simulatedCycles >= mismatchCycle || 
+            compiled.hasSimulationEnded()) {
+            break;
+        }
+        // records the PC of the block start for the final comparison
+        compiled.compareState(interp, NULL);
+    }
+    bool statesEqual = compiled.compareState(interp, &std::cerr);
+    statesEqual = compareMemories(compiled, interp, std::cerr) && statesEqual;
+    if (statesEqual) {
+        std::cerr 
+            << "state digests differed at cycle " << mismatchCycle
+            << " but the states did not differ when resimulated" 
+            << std::endl;
+    }
+}
+
+}
+
+/**
+ * Simulates the given program+machine in "tandem" with the two
+ * simulation engines.
+ */
+void 
+tandemSimulate(
+    TTAMachine::Machine& machine, 
+    TTAProgram::Program& program) {
+
+    // initialize both simulation engines
+    SimulatorFrontend interp(SimulatorFrontend::SIM_NORMAL);
+    SimulatorFrontend compiled(SimulatorFrontend::SIM_COMPILED);
+    initializeEngines(interp, compiled, machine, program);
+
+    BlockDigestQueue queue;
+    boost::thread compiledThread(
+        boost::bind(
+            simulateCompiled, boost::ref(compiled), boost::ref(queue)));
+
+    ClockCycleCount simulatedCycles = 0;
+    bool finished = false;
+    bool mismatch = false;
+    while (true) {
+        BlockDigest digest = queue.pop();
+        if (digest.error) {
+            std::cerr 
+                << "Simulation error: " << digest.errorMessage << std::endl;
+            break;
+        }
 
-            // the compiled simulator compiled BB at a time so we need to
-            // ask it how many cycle to advance the cycle level interp. engine
-            // to get to the same position in the simulation
-            stepping = 
-                compiled.cycleCount() - simulatedCycles;
-        
+        // the compiled simulator compiled BB at a time so we need to
+        // advance the cycle level interp. engine by the same number of
+        // cycles to get to the same position in the simulation
+        ClockCycleCount stepping = digest.cycle - simulatedCycles;
+        try {
             interp.step(stepping);
             simulatedCycles += stepping;
         } catch (const Exception& e) {
             std::cerr << "Simulation error: " << e.errorMessage() << std::endl;
-            return;
-            
+            break;
+        } catch (const std::exception& e) {
+            std::cerr << "Simulation error: " << e.what() << std::endl;
+            break;
         }
 
-        if (!compiled.compareState(interp, &std::cerr))
-            return;
+        if (interp.programCounter() != digest.pc ||
+            stateDigest(interp) != digest.hash) {
+            mismatch = true;
+            break;
+        }
 
         // print out the cycle count after simulating at least 1M cycles
         if (simulatedCycles / 1000000 > (simulatedCycles - stepping) / 1000000)
             std::cout
                 << "simulated " << simulatedCycles << " cycles" << std::endl;
+
+        if (digest.ended) {
+            finished = true;
+            break;
+        }
+    }
+    queue.close();
+    compiledThread.join();
+
+    if (mismatch) {
+        try {
+            reportMismatch(machine, program, simulatedCycles);
+        } catch (const Exception& e) {
+            std::cerr << "Simulation error: " << e.errorMessage() << std::endl;
+        }
+        return;
+    }
+    if (!finished) {
+        return;
     }
 
     std::cout
@@ -79,7 +79,15 @@ int main(int argc, char* argv[]) {
     bool verbose = options.verbose();
     bool leaveDirty = options.leaveDirty();
 
+    if (options.jobCount() < 0) {
+        std::cerr << "Number of jobs cannot be negative" << std::endl;
+        options.printHelp();
+        return EXIT_FAILURE;
+    }
+
     HDBTester tester(std::cout, std::cerr, sim, verbose, leaveDirty);
+    tester.setJobCount(options.jobCount());
+    tester.setResultCache(options.resultCache());
     
     bool testAll = true;
     if (options.isFUEntryIDGiven()) {
@@ -41,6 +41,8 @@ const std::string TestHDBCmdLineOptions::RF_ID_PARAM_NAME = "rfid";
 const std::string TestHDBCmdLineOptions::VERBOSE_PARAM_NAME = "verbose";
 const std::string TestHDBCmdLineOptions::DIRTY_PARAM_NAME = "leave-dirty";
 const std::string TestHDBCmdLineOptions::SIM_PARAM_NAME = "simulator";
+const std::string TestHDBCmdLineOptions::JOBS_PARAM_NAME = "jobs";
+const std::string TestHDBCmdLineOptions::CACHE_PARAM_NAME = "result-cache";
 
 /**
  * The constructor.
@@ -70,6 +72,18 @@ TestHDBCmdLineOptions::TestHDBCmdLineOptions(): CmdLineOptions("") {
             "Accepted values are 'ghdl' and 'modelsim'. Default is ghdl",
             "s");
     addOption(simulator);
+    IntegerCmdLineOptionParser* jobs =
+        new IntegerCmdLineOptionParser(
+            JOBS_PARAM_NAME, "Number of HDB entries tested in parallel when "
+            "the whole HDB is tested. 0 uses one job per processor core. "
+            "Default is 1", "j");
+    addOption(jobs);
+    StringCmdLineOptionParser* cache =
+        new StringCmdLineOptionParser(
+            CACHE_PARAM_NAME, "File where the entries that passed are "
+            "recorded. Entries that passed before and have not changed "
+            "since are not tested again", "c");
+    addOption(cache);
 }
 
 /**
@@ -158,6 +172,29 @@ std::string TestHDBCmdLineOptions::vhdlSim() const {
     return option->String();
 }
 
+/**
+ * Returns the number of entries to test in parallel
+ *
+ * @return The number of parallel jobs, 0 for one per processor core
+ */
+int TestHDBCmdLineOptions::jobCount() const {
+    CmdLineOptionParser* option = findOption(JOBS_PARAM_NAME);
+    if (!option->isDefined()) {
+        return 1;
+    }
+    return option->integer();
+}
+
+/**
+ * Returns the result cache file
+ *
+ * @return The result cache file name, empty if not given
+ */
+std::string TestHDBCmdLineOptions::resultCache() const {
+    CmdLineOptionParser* option = findOption(CACHE_PARAM_NAME);
+    return option->String();
+}
+
 /**
  * Prints the version of the application.
  */
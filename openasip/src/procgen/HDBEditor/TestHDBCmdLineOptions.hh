@@ -57,6 +57,10 @@ public:
 
     std::string vhdlSim() const;
 
+    int jobCount() const;
+
+    std::string resultCache() const;
+
     virtual void printVersion() const;
     virtual void printHelp() const;
 
@@ -71,6 +75,10 @@ private:
     static const std::string DIRTY_PARAM_NAME;
     /// Long name of VHDL simulator parameter
     static const std::string SIM_PARAM_NAME;
+    /// Long name of parallel jobs parameter
+    static const std::string JOBS_PARAM_NAME;
+    /// Long name of result cache parameter
+    static const std::string CACHE_PARAM_NAME;
 };
 
 #endif
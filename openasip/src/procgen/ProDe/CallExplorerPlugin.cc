@@ -226,9 +226,9 @@ CallExplorerPluginWindow::onRun(wxCommandEvent&) {
         std::vector<RowID> result = selectedPlugin_->explore(confID, 0);
     
         // store the new machine
-        TTAMachine::Machine& machine = 
-            *dsdb->architecture(confID+result.size());
-        model_.getMachine()->copyFromMachine(machine);
+        std::shared_ptr<const TTAMachine::Machine> machine =
+            dsdb->sharedArchitecture(confID+result.size());
+        model_.getMachine()->copyFromMachine(*machine);
     } catch (KeyNotFound& e) { 
         // no new adf created by the plugin. just exit
         InformationDialog diag(
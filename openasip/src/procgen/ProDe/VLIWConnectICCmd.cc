@@ -92,9 +92,9 @@ VLIWConnectICCmd::Do() {
     try {
         std::vector<RowID> result = plugin->explore(confID, 0);
         // store the new machine
-        TTAMachine::Machine& newMachine = 
-            *dsdb->architecture(confID+result.size());
-        machine->copyFromMachine(newMachine);
+        std::shared_ptr<const TTAMachine::Machine> newMachine =
+            dsdb->sharedArchitecture(confID+result.size());
+        machine->copyFromMachine(*newMachine);
     } catch (Exception const& e) {
         std::cerr << "Could not create VLIW Connect IC" << std::endl;
         FileSystem::removeFileOrDirectory(dsdbFile);
@@ -0,0 +1,470 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file BinarySerializer.cc
+ *
+ * Implementation of BinarySerializer class.
+ *
+ * @note rating: red
+ */
+
+#include <fstream>
+#include <sstream>
+
+#include "BinarySerializer.hh"
+#include "ObjectState.hh"
+#include "Conversion.hh"
+
+using std::string;
+using std::vector;
+
+namespace {
+    /// Magic bytes at the beginning of every binary model file.
+    const char MAGIC[] = "\x89OAB\r\n\x1a\n";
+    /// Length of the magic byte sequence.
+    const std::size_t MAGIC_LENGTH = sizeof(MAGIC) - 1;
+    /// Maximum nesting of the stored trees, protects against corrupt data.
+    const unsigned int MAX_DEPTH = 256;
+}
+
+const unsigned int BinarySerializer::FORMAT_VERSION = 1;
+
+/**
+ * Constructor.
+ *
+ * @param formatTag Tag that identifies the kind of the stored model, for
+ *                  example "adf". Reading fails if the data has a
+ *                  different tag.
+ */
+BinarySerializer::BinarySerializer(const std::string& formatTag) :
+    Serializer(), formatTag_(formatTag), sourceFile_(""),
+    destinationFile_(""), sourceString_(NULL), destinationString_(NULL) {
+}
+
+/**
+ * Destructor.
+ */
+BinarySerializer::~BinarySerializer() {
+}
+
+/**
+ * Sets the source file used when readState is called.
+ *
+ * Previously set source string is unset.
+ *
+ * @param fileName Relative or absolute path of the source file.
+ */
+void
+BinarySerializer::setSourceFile(const std::string& fileName) {
+    sourceFile_ = fileName;
+    sourceString_ = NULL;
+}
+
+/**
+ * Sets the source string used when readState is called.
+ *
+ * Previously set source file is unset.
+ *
+ * @param source Source string to read.
+ */
+void
+BinarySerializer::setSourceString(const std::string& source) {
+    sourceString_ = &source;
+    sourceFile_ = "";
+}
+
+/**
+ * Sets the destination file used when writeState is called.
+ *
+ * Previously set destination string is unset.
+ *
+ * @param fileName Relative or absolute path of the destination file.
+ */
+void
+BinarySerializer::setDestinationFile(const std::string& fileName) {
+    destinationFile_ = fileName;
+    destinationString_ = NULL;
+}
+
+/**
+ * Sets the destination string used when writeState is called.
+ *
+ * Previously set destination file is unset.
+ *
+ * @param target Destination string to write.
+ */
+void
+BinarySerializer::setDestinationString(std::string& target) {
+    destinationString_ = &target;
+    destinationFile_ = "";
+}
+
+/**
+ * Reads the current source file or string and creates an ObjectState tree
+ * of it.
+ *
+ * @return Root node of the created ObjectState tree.
+ * @exception SerializerException If the source cannot be read or it is
+ *                                not valid binary data of the expected
+ *                                format.
+ */
+ObjectState*
+BinarySerializer::readState() {
+    if (sourceString_ != NULL) {
+        return readString(*sourceString_);
+    } else if (sourceFile_ == "") {
+        string errorMsg = "No source file or string set.";
+        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
+    }
+
+    std::ifstream input(sourceFile_.c_str(), std::ios::binary);
+    if (!input) {
+        string errorMsg = "Cannot open file '" + sourceFile_ + "'.";
+        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
+    }
+    std::ostringstream contents;
+    contents << input.rdbuf();
+    try {
+        return readString(contents.str());
+    } catch (const SerializerException& e) {
+        string errorMsg = sourceFile_ + ": " + e.errorMessage();
+        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
+    }
+}
+
+/**
+ * Writes the given ObjectState tree to the current destination file or
+ * string.
+ *
+ * @param rootState Root of the ObjectState tree.
+ * @exception SerializerException If the destination cannot be written.
+ */
+void
+BinarySerializer::writeState(const ObjectState* rootState) {
+    if (destinationString_ != NULL) {
+        writeString(*destinationString_, rootState);
+        return;
+    } else if (destinationFile_ == "") {
+        string errorMsg = "No destination file or string set.";
+        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
+    }
+
+    string data;
+    writeString(data, rootState);
+    std::ofstream output(
+        destinationFile_.c_str(), std::ios::binary | std::ios::trunc);
+    output.write(data.data(), data.size());
+    output.close();
+    if (!output) {
+        string errorMsg =
+            "Cannot write file '" + destinationFile_ + "'.";
+        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
+    }
+}
+
+/**
+ * Tells whether the given file starts with the binary format magic bytes.
+ *
+ * @param fileName The file to check.
+ * @return True if the file is in the binary format, false if it is not or
+ *         cannot be read.
+ */
+bool
+BinarySerializer::isBinaryFile(const std::string& fileName) {
+    std::ifstream input(fileName.c_str(), std::ios::binary);
+    char buffer[MAGIC_LENGTH];
+    if (!input.read(buffer, MAGIC_LENGTH)) {
+        return false;
+    }
+    return string(buffer, MAGIC_LENGTH) == string(MAGIC, MAGIC_LENGTH);
+}
+
+/**
+ * Tells whether the given string starts with the binary format magic
+ * bytes.
+ *
+ * @param source The string to check.
+ * @return True if the string contains binary format data.
+ */
+bool
+BinarySerializer::isBinaryString(const std::string& source) {
+    return source.compare(0, MAGIC_LENGTH, MAGIC, MAGIC_LENGTH) == 0;
+}
+
+/**
+ * Returns the format tag stored in the given binary data.
+ *
+ * @param source Binary format data.
+ * @return The format tag.
+ * @exception SerializerException If the data is not valid binary data.
+ */
+std::string
+BinarySerializer::formatTagOf(const std::string& source) {
+    if (!isBinaryString(source)) {
+        throw SerializerException(
+            __FILE__, __LINE__, __func__, "Not a binary model file.");
+    }
+    std::size_t pos = MAGIC_LENGTH;
+    readNumber(source, pos);
+    unsigned long long length = readNumber(source, pos);
+    if (length > source.size() - pos) {
+        throw SerializerException(
+            __FILE__, __LINE__, __func__, "Truncated binary data.");
+    }
+    return source.substr(pos, length);
+}
+
+/**
+ * Creates an ObjectState tree of the given binary data.
+ *
+ * @param source The binary data.
+ * @return Root of the created tree.
+ * @exception SerializerException If the data is not valid.
+ */
+ObjectState*
+BinarySerializer::readString(const std::string& source) const {
+    string tag = formatTagOf(source);
+    if (tag != formatTag_) {
+        string errorMsg =
+            "Expected binary " + formatTag_ + " data, found " + tag + ".";
+        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
+    }
+
+    std::size_t pos = MAGIC_LENGTH;
+    unsigned long long version = readNumber(source, pos);
+    if (version > FORMAT_VERSION) {
+        string errorMsg =
+            "Unsupported binary format version " +
+            Conversion::toString(version) + ".";
+        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
+    }
+    unsigned long long tagLength = readNumber(source, pos);
+    pos += tagLength;
+
+    unsigned long long stringCount = readNumber(source, pos);
+    if (stringCount > source.size() - pos) {
+        throw SerializerException(
+            __FILE__, __LINE__, __func__, "Corrupt string table.");
+    }
+    vector<string> strings;
+    strings.reserve(stringCount);
+    for (unsigned long long i = 0; i < stringCount; i++) {
+        unsigned long long length = readNumber(source, pos);
+        if (length > source.size() - pos) {
+            throw SerializerException(
+                __FILE__, __LINE__, __func__, "Truncated binary data.");
+        }
+        strings.push_back(source.substr(pos, length));
+        pos += length;
+    }
+
+    return readNode(source, pos, strings, 0);
+}
+
+/**
+ * Writes the given ObjectState tree as binary data.
+ *
+ * @param target The string to write to.
+ * @param rootState Root of the tree.
+ */
+void
+BinarySerializer::writeString(
+    std::string& target, const ObjectState* rootState) const {
+
+    StringIndexMap indices;
+    vector<string> strings;
+    collectStrings(rootState, indices, strings);
+
+    target.assign(MAGIC, MAGIC_LENGTH);
+    writeNumber(FORMAT_VERSION, target);
+    writeNumber(formatTag_.size(), target);
+    target += formatTag_;
+
+    writeNumber(strings.size(), target);
+    for (std::size_t i = 0; i < strings.size(); i++) {
+        writeNumber(strings[i].size(), target);
+        target += strings[i];
+    }
+    writeNode(rootState, indices, target);
+}
+
+/**
+ * Adds all names and values in the given tree to the string table.
+ *
+ * @param state Root of the tree.
+ * @param indices String table indices of the already added strings.
+ * @param strings The string table.
+ */
+void
+BinarySerializer::collectStrings(
+    const ObjectState* state, StringIndexMap& indices,
+    std::vector<std::string>& strings) {
+
+    const string texts[] = { state->name(), state->stringValue() };
+    for (std::size_t i = 0; i < 2; i++) {
+        if (indices.insert(
+                std::make_pair(texts[i], strings.size())).second) {
+            strings.push_back(texts[i]);
+        }
+    }
+    for (int i = 0; i < state->attributeCount(); i++) {
+        const ObjectState::Attribute* attr = state->attribute(i);
+        if (indices.insert(
+                std::make_pair(attr->name, strings.size())).second) {
+            strings.push_back(attr->name);
+        }
+        if (indices.insert(
+                std::make_pair(attr->value, strings.size())).second) {
+            strings.push_back(attr->value);
+        }
+    }
+    for (int i = 0; i < state->childCount(); i++) {
+        collectStrings(state->child(i), indices, strings);
+    }
+}
+
+/**
+ * Writes the given tree node and its children.
+ *
+ * @param state The node.
+ * @param indices String table indices of the names and values.
+ * @param target The string to append to.
+ */
+void
+BinarySerializer::writeNode(
+    const ObjectState* state, const StringIndexMap& indices,
+    std::string& target) {
+
+    writeNumber(indices.find(state->name())->second, target);
+    writeNumber(indices.find(state->stringValue())->second, target);
+    writeNumber(state->attributeCount(), target);
+    for (int i = 0; i < state->attributeCount(); i++) {
+        const ObjectState::Attribute* attr = state->attribute(i);
+        writeNumber(indices.find(attr->name)->second, target);
+        writeNumber(indices.find(attr->value)->second, target);
+    }
+    writeNumber(state->childCount(), target);
+    for (int i = 0; i < state->childCount(); i++) {
+        writeNode(state->child(i), indices, target);
+    }
+}
+
+/**
+ * Reads a tree node and its children.
+ *
+ * @param source The binary data.
+ * @param pos Read position, moved past the node.
+ * @param strings The string table.
+ * @param depth Nesting depth of the node.
+ * @return The created node.
+ * @exception SerializerException If the data is not valid.
+ */
+ObjectState*
+BinarySerializer::readNode(
+    const std::string& source, std::size_t& pos,
+    const std::vector<std::string>& strings, unsigned int depth) {
+
+    if (depth > MAX_DEPTH) {
+        throw SerializerException(
+            __FILE__, __LINE__, __func__, "Too deeply nested binary data.");
+    }
+
+    ObjectState* state =
+        new ObjectState(stringAt(strings, readNumber(source, pos)));
+    try {
+        state->setValue(stringAt(strings, readNumber(source, pos)));
+        unsigned long long attributes = readNumber(source, pos);
+        for (unsigned long long i = 0; i < attributes; i++) {
+            const string& name = stringAt(strings, readNumber(source, pos));
+            state->setAttribute(
+                name, stringAt(strings, readNumber(source, pos)));
+        }
+        unsigned long long children = readNumber(source, pos);
+        for (unsigned long long i = 0; i < children; i++) {
+            state->addChild(readNode(source, pos, strings, depth + 1));
+        }
+    } catch (const SerializerException&) {
+        delete state;
+        throw;
+    }
+    return state;
+}
+
+/**
+ * Appends the given number as a variable length quantity.
+ *
+ * Seven bits are stored per byte, the highest bit tells whether more
+ * bytes follow.
+ *
+ * @param value The number.
+ * @param target The string to append to.
+ */
+void
+BinarySerializer::writeNumber(unsigned long long value, std::string& target) {
+    while (value >= 0x80) {
+        target += static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    target += static_cast<char>(value);
+}
+
+/**
+ * Reads a number written with writeNumber().
+ *
+ * @param source The binary data.
+ * @param pos Read position, moved past the number.
+ * @return The number.
+ * @exception SerializerException If the data ends in the middle of the
+ *                                number.
+ */
+unsigned long long
+BinarySerializer::readNumber(const std::string& source, std::size_t& pos) {
+    unsigned long long value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7) {
+        if (pos >= source.size()) {
+            throw SerializerException(
+                __FILE__, __LINE__, __func__, "Truncated binary data.");
+        }
+        unsigned char byte = static_cast<unsigned char>(source[pos++]);
+        value |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw SerializerException(
+        __FILE__, __LINE__, __func__, "Corrupt number in binary data.");
+}
+
+/**
+ * Returns the string table entry with the given index.
+ *
+ * @param strings The string table.
+ * @param index Index of the entry.
+ * @return The string.
+ * @exception SerializerException If the index is out of range.
+ */
+const std::string&
+BinarySerializer::stringAt(
+    const std::vector<std::string>& strings, unsigned long long index) {
+
+    if (index >= strings.size()) {
+        throw SerializerException(
+            __FILE__, __LINE__, __func__, "Corrupt string index.");
+    }
+    return strings[index];
+}
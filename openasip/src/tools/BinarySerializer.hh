@@ -0,0 +1,113 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file BinarySerializer.hh
+ *
+ * Declaration of BinarySerializer class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_BINARY_SERIALIZER_HH
+#define TTA_BINARY_SERIALIZER_HH
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "Serializer.hh"
+#include "Exception.hh"
+
+class ObjectState;
+
+/**
+ * Reads and writes ObjectState trees in a compact binary format.
+ *
+ * The format is meant as a fast loading alternative for the XML files
+ * of the object models (ADF, IDF, BEM). The serializers of the models
+ * store the tree in the format their loadState() expects, so reading a
+ * binary file needs neither an XML parser nor the file format
+ * conversions done after XML parsing.
+ *
+ * The file starts with a magic byte sequence followed by the format
+ * version and a format tag telling what kind of model the file contains.
+ * All names and values are stored once in a string table and the tree
+ * nodes refer to it with variable length indices.
+ */
+class BinarySerializer : public TCETools::Serializer {
+public:
+    BinarySerializer(const std::string& formatTag);
+    virtual ~BinarySerializer();
+
+    void setSourceFile(const std::string& fileName);
+    void setSourceString(const std::string& source);
+
+    void setDestinationFile(const std::string& fileName);
+    void setDestinationString(std::string& destination);
+
+    virtual ObjectState* readState();
+    virtual void writeState(const ObjectState* rootState);
+
+    static bool isBinaryFile(const std::string& fileName);
+    static bool isBinaryString(const std::string& source);
+    static std::string formatTagOf(const std::string& source);
+
+    /// Version of the binary format written by this serializer.
+    static const unsigned int FORMAT_VERSION;
+
+private:
+    /// Table for mapping strings to their string table indices.
+    typedef std::map<std::string, unsigned int> StringIndexMap;
+
+    /// Copying forbidden.
+    BinarySerializer(const BinarySerializer&);
+    /// Assignment forbidden.
+    BinarySerializer& operator=(const BinarySerializer&);
+
+    ObjectState* readString(const std::string& source) const;
+    void writeString(std::string& target, const ObjectState* rootState) const;
+
+    static void collectStrings(
+        const ObjectState* state, StringIndexMap& indices,
+        std::vector<std::string>& strings);
+    static void writeNode(
+        const ObjectState* state, const StringIndexMap& indices,
+        std::string& target);
+    static ObjectState* readNode(
+        const std::string& source, std::size_t& pos,
+        const std::vector<std::string>& strings, unsigned int depth);
+
+    static void writeNumber(unsigned long long value, std::string& target);
+    static unsigned long long readNumber(
+        const std::string& source, std::size_t& pos);
+    static const std::string& stringAt(
+        const std::vector<std::string>& strings, unsigned long long index);
+
+    /// Format tag written to and expected from the binary data.
+    std::string formatTag_;
+    /// Source file path.
+    std::string sourceFile_;
+    /// Destination file path.
+    std::string destinationFile_;
+    /// Source string to read.
+    const std::string* sourceString_;
+    /// Destination string to write.
+    std::string* destinationString_;
+};
+
+#endif
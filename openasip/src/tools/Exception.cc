@@ -40,7 +40,7 @@ using std::string;
 
 const string Exception::unknownProcMsg_ = "(unknown)";
 
-std::string Exception::lastExceptionInfo_ = "";
+thread_local std::string Exception::lastExceptionInfo_ = "";
 
 ///////////////////////////////////////////////////////////////////////////////
 // Exception
@@ -97,7 +97,7 @@ Exception::cause() const {
 }
 
 /**
- * Returns information of the last exception thrown.
+ * Returns information of the last exception thrown in the calling thread.
  *
  * This is useful in debugging. It's used in Application.hh's unexpected
  * exception handler.
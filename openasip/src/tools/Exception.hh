@@ -77,8 +77,9 @@ public:
     const Exception& cause() const;
 
 private:
-    /// Information of the last thrown exception for easing the debugging.
-    static std::string lastExceptionInfo_;
+    /// Information of the last exception thrown in the calling thread for
+    /// easing the debugging.
+    static thread_local std::string lastExceptionInfo_;
     /// Name of the file where exception occurred.
     std::string file_;
     /// Line number in the file.
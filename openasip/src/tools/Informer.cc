@@ -70,9 +70,30 @@ Informer::findListenerSlot(int event, Listener* listener) {
         }
     }
     eventListeners_.push_back(std::make_pair(event, listener));
+    updateListenerCount(event, 1);
     return eventListeners_.size() - 1;
 }
 
+/**
+ * Updates the count of listeners of the given event.
+ *
+ * The counts are kept for non-negative events only, other events are
+ * looked up from the listener list.
+ *
+ * @param event The event.
+ * @param change The change to the count.
+ */
+void
+Informer::updateListenerCount(int event, int change) {
+    if (event < 0) {
+        return;
+    }
+    if (static_cast<std::size_t>(event) >= listenerCounts_.size()) {
+        listenerCounts_.resize(event + 1, 0);
+    }
+    listenerCounts_[event] += change;
+}
+
 /**
  * Adds the given Listener to the list of listeners of the given event.
  *
@@ -105,5 +126,6 @@ Informer::unregisterListener(int event, Listener* listener) {
     std::size_t index = findListenerSlot(event, listener);
     ListenerList::iterator i = eventListeners_.begin() + index;
     eventListeners_.erase(i);
+    updateListenerCount(event, -1);
     return true;
 }
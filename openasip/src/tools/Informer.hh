@@ -56,13 +56,17 @@ public:
     virtual ~Informer();
 
     void handleEvent(int event);
+    bool hasListeners(int event) const;
     virtual bool registerListener(int event, Listener* listener);
     virtual bool unregisterListener(int event, Listener* listener);
 
 private:
     std::size_t findListenerSlot(int event, Listener* listener);
+    void updateListenerCount(int event, int change);
     typedef std::vector<std::pair<int, Listener*> > ListenerList;
     ListenerList eventListeners_;
+    /// The count of registered listeners of each event.
+    std::vector<unsigned int> listenerCounts_;
 
 };
 
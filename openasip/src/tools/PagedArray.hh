@@ -86,9 +86,12 @@ public:
     void read(IndexType index, ValueTable data, size_t size);
     size_t allocatedMemory() const;
     void clear();
+    std::size_t contentDigest();
 
 private:
     void deletePages();
+    void deleteDigests();
+    std::size_t pageDigest(std::size_t pageIndex) const;
 
     /// Copying not allowed.
     PagedArray(const PagedArray&);
@@ -101,6 +104,15 @@ private:
     ValueType** pageTable_;
     /// Size of the page table.
     std::size_t pageTableSize_;
+    /// Tells which pages were written since the last contentDigest() call.
+    /// NULL until contentDigest() is called the first time.
+    bool* dirtyPages_;
+    /// Indices of the pages marked in dirtyPages_.
+    std::vector<std::size_t> dirtyPageList_;
+    /// The digests of the pages at the last contentDigest() call.
+    std::size_t* pageDigests_;
+    /// The digest of the whole array at the last contentDigest() call.
+    std::size_t digest_;
 };
 
 #include "PagedArray.icc"
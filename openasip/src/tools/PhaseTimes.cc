@@ -0,0 +1,272 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file PhaseTimes.cc
+ *
+ * Implementation of PhaseTimes class.
+ *
+ * @note rating: red
+ */
+
+#include "PhaseTimes.hh"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+bool PhaseTimes::enabled_ = false;
+std::map<std::string, PhaseTimes::Phase> PhaseTimes::phases_;
+std::chrono::steady_clock::time_point PhaseTimes::start_ =
+    std::chrono::steady_clock::now();
+boost::mutex PhaseTimes::mutex_;
+thread_local PhaseTimes::Scope* PhaseTimes::current_ = NULL;
+
+/**
+ * Starts measuring a run of the given phase.
+ *
+ * Only the outermost scope of a thread samples the RSS. Reading it is a
+ * file read, too slow for the scopes entered in the inner loops of the
+ * compiler. The sample is taken after the start time so that the time it
+ * takes is charged to the sampling scope itself.
+ *
+ * @param phase Name of the phase. Must stay valid for the lifetime of the
+ *        scope, normally a string literal.
+ */
+PhaseTimes::Scope::Scope(const char* phase) :
+    phase_(NULL), parent_(NULL),
+    children_(std::chrono::steady_clock::duration::zero()),
+    startRSS_(0) {
+
+    if (!PhaseTimes::enabled_) {
+        return;
+    }
+    phase_ = phase;
+    parent_ = PhaseTimes::current_;
+    PhaseTimes::current_ = this;
+    start_ = std::chrono::steady_clock::now();
+    if (parent_ == NULL) {
+        startRSS_ = PhaseTimes::currentRSS();
+    }
+}
+
+/**
+ * Records the run of the phase.
+ *
+ * The total time of the scope is added to the nested time of the
+ * enclosing scope so that it is not charged twice.
+ */
+PhaseTimes::Scope::~Scope() {
+    if (phase_ == NULL) {
+        return;
+    }
+    long endRSS = 0;
+    if (parent_ == NULL) {
+        endRSS = PhaseTimes::currentRSS();
+    }
+    std::chrono::steady_clock::duration total =
+        std::chrono::steady_clock::now() - start_;
+    PhaseTimes::record(
+        phase_, total - children_, endRSS - startRSS_,
+        std::max(startRSS_, endRSS));
+    if (parent_ != NULL) {
+        parent_->children_ += total;
+    }
+    PhaseTimes::current_ = parent_;
+}
+
+/**
+ * Enables or disables collecting the phase times.
+ *
+ * Enabling restarts the total wall time measurement.
+ *
+ * @param enabled True to collect the times.
+ */
+void
+PhaseTimes::setEnabled(bool enabled) {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    enabled_ = enabled;
+    if (enabled) {
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+/**
+ * Returns true if the phase times are collected.
+ */
+bool
+PhaseTimes::enabled() {
+    return enabled_;
+}
+
+/**
+ * Removes the collected measurements and restarts the wall time.
+ */
+void
+PhaseTimes::clear() {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    phases_.clear();
+    start_ = std::chrono::steady_clock::now();
+}
+
+/**
+ * Returns a copy of the collected measurements indexed by phase name.
+ */
+std::map<std::string, PhaseTimes::Phase>
+PhaseTimes::phases() {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    return phases_;
+}
+
+/**
+ * Returns the wall time since the collection was enabled, in seconds.
+ */
+double
+PhaseTimes::wallSeconds() {
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_).count();
+}
+
+/**
+ * Returns the peak resident set size of the process so far, in KiB.
+ *
+ * @return The peak RSS or 0 if it is not available.
+ */
+long
+PhaseTimes::peakRSS() {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    // Darwin reports the size in bytes.
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+/**
+ * Returns the current resident set size of the process, in KiB.
+ *
+ * Reads the resident page count from /proc/self/statm.
+ *
+ * @return The RSS or 0 if it is not available.
+ */
+long
+PhaseTimes::currentRSS() {
+    std::ifstream statm("/proc/self/statm");
+    long size = 0;
+    long resident = 0;
+    if (!(statm >> size >> resident)) {
+        return 0;
+    }
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+/**
+ * Writes the collected measurements as a JSON object.
+ *
+ * The object has the total wall time and peak RSS of the process and a
+ * "phases" object with the seconds and run count of each phase. The
+ * summed RSS change and largest sampled RSS are written for the phases
+ * whose RSS was sampled.
+ *
+ * @param stream The stream to write to.
+ */
+void
+PhaseTimes::writeJSON(std::ostream& stream) {
+    std::map<std::string, Phase> collected = phases();
+
+    std::ios::fmtflags flags = stream.flags();
+    stream << std::fixed << std::setprecision(6)
+           << "{" << std::endl
+           << "  \"wall_seconds\": " << wallSeconds() << "," << std::endl
+           << "  \"peak_rss_kb\": " << peakRSS() << "," << std::endl
+           << "  \"phases\": {";
+    bool first = true;
+    for (const auto& entry : collected) {
+        stream << (first ? "" : ",") << std::endl
+               << "    \"" << entry.first << "\": {"
+               << "\"seconds\": " << entry.second.seconds << ", "
+               << "\"count\": " << entry.second.count;
+        if (entry.second.maxRSS > 0) {
+            stream << ", \"rss_delta_kb\": " << entry.second.rssDelta
+                   << ", \"max_rss_kb\": " << entry.second.maxRSS;
+        }
+        stream << "}";
+        first = false;
+    }
+    stream << std::endl << "  }" << std::endl << "}" << std::endl;
+    stream.flags(flags);
+}
+
+/**
+ * Writes the collected measurements as JSON to the given file.
+ *
+ * @param fileName Name of the file to write.
+ * @exception IOException If the file cannot be written.
+ */
+void
+PhaseTimes::writeJSON(const std::string& fileName) {
+    std::ofstream output(fileName.c_str());
+    if (!output.good()) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Cannot open file '" + fileName + "' for writing.");
+    }
+    writeJSON(output);
+    output.close();
+    if (output.fail()) {
+        throw IOException(
+            __FILE__, __LINE__, __func__,
+            "Writing file '" + fileName + "' failed.");
+    }
+}
+
+/**
+ * Adds a run of a phase to the measurements.
+ *
+ * @param phase Name of the phase.
+ * @param time Exclusive time of the run.
+ * @param rssDelta RSS at the end of the run minus RSS at its start, KiB.
+ * @param maxRSS Largest RSS sampled during the run, KiB, 0 if the RSS
+ *        was not sampled.
+ */
+void
+PhaseTimes::record(
+    const char* phase, std::chrono::steady_clock::duration time,
+    long rssDelta, long maxRSS) {
+
+    boost::lock_guard<boost::mutex> lock(mutex_);
+    Phase& entry = phases_[phase];
+    entry.seconds += std::chrono::duration<double>(time).count();
+    entry.count++;
+    entry.rssDelta += rssDelta;
+    if (maxRSS > entry.maxRSS) {
+        entry.maxRSS = maxRSS;
+    }
+}
@@ -0,0 +1,125 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file PhaseTimes.hh
+ *
+ * Declaration of PhaseTimes class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_PHASE_TIMES_HH
+#define TTA_PHASE_TIMES_HH
+
+#include <chrono>
+#include <map>
+#include <ostream>
+#include <string>
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+
+#include "Exception.hh"
+
+/**
+ * Collects wall time and memory usage of named compiler phases.
+ *
+ * Phases are measured with PhaseTimes::Scope objects placed around the
+ * code of the phase. The time of a phase is exclusive: time spent in a
+ * nested scope is charged to the nested phase only. Phases run in
+ * parallel threads are summed. Nothing is recorded unless collection has
+ * been enabled with setEnabled().
+ *
+ * The resident set size is sampled when the outermost scope of a thread
+ * is entered and left, the nested phases have no memory figures. The RSS
+ * is a property of the process, so the memory of a phase run in parallel
+ * threads includes the allocations of the other threads.
+ */
+class PhaseTimes {
+public:
+    /// Accumulated measurements of one phase.
+    struct Phase {
+        /// Exclusive wall time spent in the phase in seconds.
+        double seconds = 0.0;
+        /// How many times the phase was entered.
+        unsigned count = 0;
+        /// Sum of the RSS changes from entering to leaving the phase, KiB.
+        long rssDelta = 0;
+        /// Largest RSS sampled during the phase, KiB. The samples are taken
+        /// when the phase is entered and left, 0 for nested phases.
+        long maxRSS = 0;
+    };
+
+    /**
+     * Measures the lifetime of the object as a run of the named phase.
+     */
+    class Scope {
+    public:
+        explicit Scope(const char* phase);
+        ~Scope();
+    private:
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /// Name of the measured phase, NULL if collection is disabled.
+        const char* phase_;
+        /// Enclosing scope of the same thread.
+        Scope* parent_;
+        /// Time the scope was entered.
+        std::chrono::steady_clock::time_point start_;
+        /// Time spent in nested scopes.
+        std::chrono::steady_clock::duration children_;
+        /// RSS when the scope was entered, KiB, 0 for nested scopes.
+        long startRSS_;
+    };
+
+    static void setEnabled(bool enabled);
+    static bool enabled();
+
+    static void clear();
+    static std::map<std::string, Phase> phases();
+    static double wallSeconds();
+    static long peakRSS();
+    static long currentRSS();
+
+    static void writeJSON(std::ostream& stream);
+    static void writeJSON(const std::string& fileName);
+
+private:
+    static void record(
+        const char* phase, std::chrono::steady_clock::duration time,
+        long rssDelta, long maxRSS);
+
+    /// True when the phases are measured.
+    static bool enabled_;
+    /// The measurements indexed by phase name.
+    static std::map<std::string, Phase> phases_;
+    /// Time the collection was enabled or last cleared.
+    static std::chrono::steady_clock::time_point start_;
+    /// Guards phases_ and start_.
+    static boost::mutex mutex_;
+    /// The innermost active scope of the thread.
+    static thread_local Scope* current_;
+};
+
+#endif
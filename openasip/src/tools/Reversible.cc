@@ -156,4 +156,4 @@ bool Reversible::runChild(Reversible* child, bool pre) {
     }
 }
 
-int Reversible::idCounter_ = 0;
+thread_local int Reversible::idCounter_ = 0;
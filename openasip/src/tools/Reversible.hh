@@ -59,7 +59,7 @@ protected:
 
 private:
     int id_;
-    static int idCounter_;
+    static thread_local int idCounter_;
 };
 
 #endif
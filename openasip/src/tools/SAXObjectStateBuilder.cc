@@ -0,0 +1,197 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file SAXObjectStateBuilder.cc
+ *
+ * Implementation of SAXObjectStateBuilder class.
+ *
+ * @note rating: red
+ */
+
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax/SAXParseException.hpp>
+
+#include "SAXObjectStateBuilder.hh"
+#include "ObjectState.hh"
+#include "Conversion.hh"
+
+/**
+ * Constructor.
+ */
+SAXObjectStateBuilder::SAXObjectStateBuilder() :
+    DefaultHandler(), root_(NULL), errorCount_(0), errorLog_("") {
+}
+
+/**
+ * Destructor.
+ *
+ * Deletes the built tree unless it has been released.
+ */
+SAXObjectStateBuilder::~SAXObjectStateBuilder() {
+    delete root_;
+}
+
+/**
+ * Creates an ObjectState for a starting element.
+ *
+ * @param qName Qualified name of the element.
+ * @param attributes Attributes of the element.
+ */
+void
+SAXObjectStateBuilder::startElement(
+    const XMLCh* const, const XMLCh* const, const XMLCh* const qName,
+    const Attributes& attributes) {
+
+    ObjectState* state = new ObjectState(Conversion::XMLChToString(qName));
+    for (CharCount i = 0; i < attributes.getLength(); i++) {
+        state->setAttribute(
+            Conversion::XMLChToString(attributes.getQName(i)),
+            Conversion::XMLChToString(attributes.getValue(i)));
+    }
+
+    if (openElements_.empty()) {
+        delete root_;
+        root_ = state;
+    } else {
+        openElements_.back()->addChild(state);
+    }
+    openElements_.push_back(state);
+    texts_.push_back(std::basic_string<XMLCh>());
+}
+
+/**
+ * Finishes the innermost open element.
+ *
+ * The collected text becomes the value of the element if it has no child
+ * elements.
+ */
+void
+SAXObjectStateBuilder::endElement(
+    const XMLCh* const, const XMLCh* const, const XMLCh* const) {
+
+    ObjectState* state = openElements_.back();
+    if (state->childCount() == 0 && !texts_.back().empty()) {
+        state->setValue(Conversion::XMLChToString(texts_.back().c_str()));
+    }
+    openElements_.pop_back();
+    texts_.pop_back();
+}
+
+/**
+ * Collects the text content of the innermost open element.
+ *
+ * Text of elements that have child elements is not needed and is not
+ * collected.
+ *
+ * @param chars The characters, not null terminated.
+ * @param length Number of characters.
+ */
+void
+SAXObjectStateBuilder::characters(
+    const XMLCh* const chars, const CharCount length) {
+
+    if (!openElements_.empty() && openElements_.back()->childCount() == 0) {
+        texts_.back().append(chars, length);
+    }
+}
+
+/**
+ * Records a parser warning.
+ *
+ * @param exception The warning.
+ */
+void
+SAXObjectStateBuilder::warning(const SAXParseException& exception) {
+    logError(exception);
+}
+
+/**
+ * Records a recoverable parser error.
+ *
+ * @param exception The error.
+ */
+void
+SAXObjectStateBuilder::error(const SAXParseException& exception) {
+    logError(exception);
+}
+
+/**
+ * Records a fatal parser error and stops parsing.
+ *
+ * @param exception The error.
+ * @exception SAXParseException Always rethrows the given exception.
+ */
+void
+SAXObjectStateBuilder::fatalError(const SAXParseException& exception) {
+    logError(exception);
+    throw exception;
+}
+
+/**
+ * Returns the built ObjectState tree and gives up its ownership.
+ *
+ * @return Root of the tree, NULL if no element was parsed.
+ */
+ObjectState*
+SAXObjectStateBuilder::releaseState() {
+    ObjectState* root = root_;
+    root_ = NULL;
+    return root;
+}
+
+/**
+ * Returns the number of errors and warnings reported by the parser.
+ *
+ * @return Number of errors handled.
+ */
+int
+SAXObjectStateBuilder::errorCount() const {
+    return errorCount_;
+}
+
+/**
+ * Returns the error log.
+ *
+ * @return The error log.
+ */
+std::string
+SAXObjectStateBuilder::errorLog() const {
+    return errorLog_;
+}
+
+/**
+ * Adds a parser error to the error log.
+ *
+ * Uses the same format as DOMBuilderErrorHandler.
+ *
+ * @param exception The error.
+ */
+void
+SAXObjectStateBuilder::logError(const SAXParseException& exception) {
+    errorCount_++;
+    errorLog_ += "Error at file ";
+    errorLog_ += exception.getSystemId() != NULL ?
+        Conversion::XMLChToString(exception.getSystemId()) : "";
+    errorLog_ += ", line ";
+    errorLog_ += Conversion::toString(exception.getLineNumber());
+    errorLog_ += ", column ";
+    errorLog_ += Conversion::toString(exception.getColumnNumber());
+    errorLog_ += "\n    Message: ";
+    errorLog_ += Conversion::XMLChToString(exception.getMessage());
+    errorLog_ += "\n";
+}
@@ -0,0 +1,100 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file SAXObjectStateBuilder.hh
+ *
+ * Declaration of SAXObjectStateBuilder class.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_SAX_OBJECT_STATE_BUILDER_HH
+#define TTA_SAX_OBJECT_STATE_BUILDER_HH
+
+#include <string>
+#include <vector>
+
+#include <xercesc/util/XercesVersion.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+
+#if _XERCES_VERSION >= 20200
+XERCES_CPP_NAMESPACE_USE
+#endif
+
+class ObjectState;
+
+/**
+ * SAX2 handler that builds an ObjectState tree of the parsed document.
+ *
+ * Used by the streaming mode of XMLSerializer. Produces the same tree as
+ * the DOM based reading without keeping the DOM of the whole document in
+ * memory: each element becomes an ObjectState with its attributes, and
+ * the text content of an element without child elements becomes its
+ * value. Errors and warnings reported by the parser are collected to an
+ * error log.
+ */
+class SAXObjectStateBuilder : public DefaultHandler {
+public:
+#if XERCES_VERSION_MAJOR >= 3
+    /// Type of the character count parameters of the SAX callbacks.
+    typedef XMLSize_t CharCount;
+#else
+    /// Type of the character count parameters of the SAX callbacks.
+    typedef unsigned int CharCount;
+#endif
+
+    SAXObjectStateBuilder();
+    virtual ~SAXObjectStateBuilder();
+
+    virtual void startElement(
+        const XMLCh* const uri, const XMLCh* const localName,
+        const XMLCh* const qName, const Attributes& attributes);
+    virtual void endElement(
+        const XMLCh* const uri, const XMLCh* const localName,
+        const XMLCh* const qName);
+    virtual void characters(const XMLCh* const chars, const CharCount length);
+
+    virtual void warning(const SAXParseException& exception);
+    virtual void error(const SAXParseException& exception);
+    virtual void fatalError(const SAXParseException& exception);
+
+    ObjectState* releaseState();
+    int errorCount() const;
+    std::string errorLog() const;
+
+private:
+    /// Copying forbidden.
+    SAXObjectStateBuilder(const SAXObjectStateBuilder&);
+    /// Assignment forbidden.
+    SAXObjectStateBuilder& operator=(const SAXObjectStateBuilder&);
+
+    void logError(const SAXParseException& exception);
+
+    /// Root of the tree built so far.
+    ObjectState* root_;
+    /// The elements currently open, innermost last.
+    std::vector<ObjectState*> openElements_;
+    /// Text content collected for each open element.
+    std::vector<std::basic_string<XMLCh> > texts_;
+    /// Number of errors handled.
+    int errorCount_;
+    /// Error log.
+    std::string errorLog_;
+};
+
+#endif
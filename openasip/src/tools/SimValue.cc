@@ -32,6 +32,10 @@
  * @note rating: red
  */
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+
 #include "SimValue.hh"
 #include "MathTools.hh"
 #include "Conversion.hh"
@@ -1446,6 +1450,519 @@ SimValue::setElement(size_t elementIndex, size_t elementWidth, Word data) {
     }
 }
 
+template <typename T>
+void
+SimValue::vectorElements(T* data, size_t count) const {
+    // Elements must not cross SimValue's bitwidth.
+    assert(count <= (SIMVALUE_MAX_BYTE_SIZE / sizeof(T)));
+
+#if HOST_BIGENDIAN == 1
+    for (size_t i = 0; i < count; ++i) {
+        swapByteOrder(
+            rawData_ + i * sizeof(T), sizeof(T), (Byte*)(data + i));
+    }
+#else
+    memcpy(data, rawData_, count * sizeof(T));
+#endif
+}
+
+template <typename T>
+void
+SimValue::setVectorElements(const T* data, size_t count) {
+    // Elements must not cross SimValue's bitwidth.
+    assert(count <= (SIMVALUE_MAX_BYTE_SIZE / sizeof(T)));
+
+#if HOST_BIGENDIAN == 1
+    for (size_t i = 0; i < count; ++i) {
+        swapByteOrder(
+            (const Byte*)(data + i), sizeof(T), rawData_ + i * sizeof(T));
+    }
+#else
+    memcpy(rawData_, data, count * sizeof(T));
+#endif
+}
+
+/**
+ * Copies the first 8-bit byte elements to the given array.
+ *
+ * Faster than reading the elements one by one with byteElement().
+ *
+ * @param data The array to copy the elements to.
+ * @param count Number of elements to copy.
+ */
+void
+SimValue::byteElements(Byte* data, size_t count) const {
+    vectorElements(data, count);
+}
+
+/**
+ * Copies the first 16-bit elements to the given array in host endianness.
+ *
+ * @param data The array to copy the elements to.
+ * @param count Number of elements to copy.
+ */
+void
+SimValue::halfWordElements(HalfWord* data, size_t count) const {
+    vectorElements(data, count);
+}
+
+/**
+ * Copies the first 32-bit elements to the given array in host endianness.
+ *
+ * @param data The array to copy the elements to.
+ * @param count Number of elements to copy.
+ */
+void
+SimValue::wordElements(Word* data, size_t count) const {
+    vectorElements(data, count);
+}
+
+/**
+ * Copies the first single precision float elements to the given array.
+ *
+ * @param data The array to copy the elements to.
+ * @param count Number of elements to copy.
+ */
+void
+SimValue::floatElements(FloatWord* data, size_t count) const {
+    vectorElements(data, count);
+}
+
+/**
+ * Sets the first 8-bit byte elements from the given array.
+ *
+ * @param data The element values.
+ * @param count Number of elements to set.
+ */
+void
+SimValue::setByteElements(const Byte* data, size_t count) {
+    setVectorElements(data, count);
+}
+
+/**
+ * Sets the first 16-bit elements from the given array.
+ *
+ * @param data The element values in host endianness.
+ * @param count Number of elements to set.
+ */
+void
+SimValue::setHalfWordElements(const HalfWord* data, size_t count) {
+    setVectorElements(data, count);
+}
+
+/**
+ * Sets the first 32-bit elements from the given array.
+ *
+ * @param data The element values in host endianness.
+ * @param count Number of elements to set.
+ */
+void
+SimValue::setWordElements(const Word* data, size_t count) {
+    setVectorElements(data, count);
+}
+
+/**
+ * Sets the first single precision float elements from the given array.
+ *
+ * @param data The element values.
+ * @param count Number of elements to set.
+ */
+void
+SimValue::setFloatElements(const FloatWord* data, size_t count) {
+    setVectorElements(data, count);
+}
+
+/**
+ * Applies a binary operation to each lane of the operands.
+ *
+ * The lanes are copied to host arrays and computed in a plain loop
+ * instead of calling the element accessors for each lane.
+ * The lane count is given by the width of the left hand operand.
+ */
+template <typename T, typename Operation>
+void
+SimValue::laneWise(
+    const SimValue& lhs, const SimValue& rhs, SimValue& result,
+    Operation op) {
+
+    const size_t MAX_LANES = SIMVALUE_MAX_BYTE_SIZE / sizeof(T);
+    const size_t count = lhs.width() / (sizeof(T) * BYTE_BITWIDTH);
+    T lhsLanes[MAX_LANES];
+    T rhsLanes[MAX_LANES];
+    T resultLanes[MAX_LANES];
+
+    lhs.vectorElements(lhsLanes, count);
+    rhs.vectorElements(rhsLanes, count);
+    for (size_t i = 0; i < count; ++i) {
+        resultLanes[i] = static_cast<T>(op(lhsLanes[i], rhsLanes[i]));
+    }
+    result.setVectorElements(resultLanes, count);
+}
+
+/**
+ * Applies a modulo arithmetic operation computed on 32-bit words to each
+ * integer lane of the operands.
+ */
+template <typename Operation>
+void
+SimValue::integerLaneWise(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    SimValue& result, Operation op) {
+
+    switch (elementWidth) {
+    case 8:
+        laneWise<Byte>(lhs, rhs, result, op);
+        break;
+    case 16:
+        laneWise<HalfWord>(lhs, rhs, result, op);
+        break;
+    case 32:
+        laneWise<Word>(lhs, rhs, result, op);
+        break;
+    default:
+        assert(false && "Unsupported lane width.");
+    }
+}
+
+namespace {
+
+/**
+ * Computes an operation in a wider type and clamps the result to the range
+ * of the lane type.
+ */
+template <typename T, typename WideOperation>
+class SaturatingOperation {
+public:
+    T operator()(T lhs, T rhs) const {
+        const SLongWord MIN = std::numeric_limits<T>::min();
+        const SLongWord MAX = std::numeric_limits<T>::max();
+        SLongWord value =
+            WideOperation()(SLongWord(lhs), SLongWord(rhs));
+        return static_cast<T>(std::min(std::max(value, MIN), MAX));
+    }
+};
+
+}
+
+/**
+ * Applies a saturating operation to each integer lane of the operands.
+ */
+template <typename WideOperation>
+void
+SimValue::saturatedLaneWise(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    bool isSigned, SimValue& result) {
+
+    switch (elementWidth) {
+    case 8:
+        if (isSigned) {
+            laneWise<signed char>(
+                lhs, rhs, result,
+                SaturatingOperation<signed char, WideOperation>());
+        } else {
+            laneWise<Byte>(
+                lhs, rhs, result,
+                SaturatingOperation<Byte, WideOperation>());
+        }
+        break;
+    case 16:
+        if (isSigned) {
+            laneWise<short>(
+                lhs, rhs, result,
+                SaturatingOperation<short, WideOperation>());
+        } else {
+            laneWise<HalfWord>(
+                lhs, rhs, result,
+                SaturatingOperation<HalfWord, WideOperation>());
+        }
+        break;
+    case 32:
+        if (isSigned) {
+            laneWise<SIntWord>(
+                lhs, rhs, result,
+                SaturatingOperation<SIntWord, WideOperation>());
+        } else {
+            laneWise<UIntWord>(
+                lhs, rhs, result,
+                SaturatingOperation<UIntWord, WideOperation>());
+        }
+        break;
+    default:
+        assert(false && "Unsupported lane width.");
+    }
+}
+
+/**
+ * Compares each lane of the operands and sets the corresponding bit
+ * element of the result to the outcome.
+ */
+template <typename T, typename Compare>
+void
+SimValue::compareLanes(
+    const SimValue& lhs, const SimValue& rhs, SimValue& result,
+    Compare compare) {
+
+    const size_t MAX_LANES = SIMVALUE_MAX_BYTE_SIZE / sizeof(T);
+    const size_t count = lhs.width() / (sizeof(T) * BYTE_BITWIDTH);
+    T lhsLanes[MAX_LANES];
+    T rhsLanes[MAX_LANES];
+    Byte flags[MAX_LANES];
+
+    lhs.vectorElements(lhsLanes, count);
+    rhs.vectorElements(rhsLanes, count);
+    for (size_t i = 0; i < count; ++i) {
+        flags[i] = compare(lhsLanes[i], rhsLanes[i]) ? 1 : 0;
+    }
+    memset(
+        result.rawData_, 0, (count + (BYTE_BITWIDTH - 1)) / BYTE_BITWIDTH);
+    for (size_t i = 0; i < count; ++i) {
+        result.rawData_[i / BYTE_BITWIDTH] |= flags[i] << (i % BYTE_BITWIDTH);
+    }
+}
+
+/**
+ * Picks lanes from the concatenation of two vectors by indices.
+ *
+ * The result is not touched if the first vector is narrower than a lane.
+ */
+template <typename T>
+void
+SimValue::shuffleVectorElements(
+    const SimValue& first, const SimValue& second,
+    const SimValue& indices, SimValue& result) {
+
+    const size_t MAX_LANES = SIMVALUE_MAX_BYTE_SIZE / sizeof(T);
+    const size_t count = first.width() / (sizeof(T) * BYTE_BITWIDTH);
+    if (count == 0) {
+        return;
+    }
+    T sourceLanes[2 * MAX_LANES];
+    T indexLanes[MAX_LANES];
+    T resultLanes[MAX_LANES];
+
+    first.vectorElements(sourceLanes, count);
+    second.vectorElements(sourceLanes + count, count);
+    indices.vectorElements(indexLanes, count);
+    for (size_t i = 0; i < count; ++i) {
+        resultLanes[i] = sourceLanes[indexLanes[i] % (2 * count)];
+    }
+    result.setVectorElements(resultLanes, count);
+}
+
+/**
+ * Adds the integer lanes of two vectors in modulo arithmetic.
+ *
+ * The lane-wise helpers compute all the lanes at once and are meant
+ * to be used in the OSAL behaviors of the vector operations instead of
+ * looping the element accessors. The lane count is given by the width of
+ * the left hand operand. The width of the result is not changed.
+ *
+ * @param lhs The left hand operand.
+ * @param rhs The right hand operand.
+ * @param elementWidth Width of the lanes, 8, 16 or 32 bits.
+ * @param result The value to write the result lanes to, can be one of
+ * the operands.
+ */
+void
+SimValue::addLanes(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    SimValue& result) {
+    integerLaneWise(lhs, rhs, elementWidth, result, std::plus<Word>());
+}
+
+/**
+ * Subtracts the integer lanes of two vectors in modulo arithmetic.
+ *
+ * @see addLanes()
+ */
+void
+SimValue::subLanes(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    SimValue& result) {
+    integerLaneWise(lhs, rhs, elementWidth, result, std::minus<Word>());
+}
+
+/**
+ * Multiplies the integer lanes of two vectors, keeping the low bits.
+ *
+ * @see addLanes()
+ */
+void
+SimValue::mulLanes(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    SimValue& result) {
+    integerLaneWise(
+        lhs, rhs, elementWidth, result, std::multiplies<Word>());
+}
+
+/**
+ * Adds the integer lanes of two vectors with saturation.
+ *
+ * @see addLanes()
+ * @param isSigned True if the lanes are signed integers.
+ */
+void
+SimValue::addSaturatedLanes(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    bool isSigned, SimValue& result) {
+    saturatedLaneWise<std::plus<SLongWord> >(
+        lhs, rhs, elementWidth, isSigned, result);
+}
+
+/**
+ * Subtracts the integer lanes of two vectors with saturation.
+ *
+ * @see addLanes()
+ * @param isSigned True if the lanes are signed integers.
+ */
+void
+SimValue::subSaturatedLanes(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    bool isSigned, SimValue& result) {
+    saturatedLaneWise<std::minus<SLongWord> >(
+        lhs, rhs, elementWidth, isSigned, result);
+}
+
+/**
+ * Adds the single precision float lanes of two vectors.
+ *
+ * @see addLanes()
+ */
+void
+SimValue::addFloatLanes(
+    const SimValue& lhs, const SimValue& rhs, SimValue& result) {
+    laneWise<FloatWord>(lhs, rhs, result, std::plus<FloatWord>());
+}
+
+/**
+ * Subtracts the single precision float lanes of two vectors.
+ *
+ * @see addLanes()
+ */
+void
+SimValue::subFloatLanes(
+    const SimValue& lhs, const SimValue& rhs, SimValue& result) {
+    laneWise<FloatWord>(lhs, rhs, result, std::minus<FloatWord>());
+}
+
+/**
+ * Multiplies the single precision float lanes of two vectors.
+ *
+ * @see addLanes()
+ */
+void
+SimValue::mulFloatLanes(
+    const SimValue& lhs, const SimValue& rhs, SimValue& result) {
+    laneWise<FloatWord>(lhs, rhs, result, std::multiplies<FloatWord>());
+}
+
+/**
+ * Compares the integer lanes of two vectors for equality.
+ *
+ * Lane i of the comparison result is stored to bit element i of the
+ * result.
+ *
+ * @see addLanes()
+ */
+void
+SimValue::equalLanes(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    SimValue& result) {
+
+    switch (elementWidth) {
+    case 8:
+        compareLanes<Byte>(lhs, rhs, result, std::equal_to<Byte>());
+        break;
+    case 16:
+        compareLanes<HalfWord>(
+            lhs, rhs, result, std::equal_to<HalfWord>());
+        break;
+    case 32:
+        compareLanes<Word>(lhs, rhs, result, std::equal_to<Word>());
+        break;
+    default:
+        assert(false && "Unsupported lane width.");
+    }
+}
+
+/**
+ * Tests if the integer lanes of the left hand vector are greater than
+ * the ones of the right hand vector.
+ *
+ * Lane i of the comparison result is stored to bit element i of the
+ * result.
+ *
+ * @see addLanes()
+ * @param isSigned True if the lanes are signed integers.
+ */
+void
+SimValue::greaterLanes(
+    const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+    bool isSigned, SimValue& result) {
+
+    switch (elementWidth) {
+    case 8:
+        if (isSigned) {
+            compareLanes<signed char>(
+                lhs, rhs, result, std::greater<signed char>());
+        } else {
+            compareLanes<Byte>(lhs, rhs, result, std::greater<Byte>());
+        }
+        break;
+    case 16:
+        if (isSigned) {
+            compareLanes<short>(lhs, rhs, result, std::greater<short>());
+        } else {
+            compareLanes<HalfWord>(
+                lhs, rhs, result, std::greater<HalfWord>());
+        }
+        break;
+    case 32:
+        if (isSigned) {
+            compareLanes<SIntWord>(
+                lhs, rhs, result, std::greater<SIntWord>());
+        } else {
+            compareLanes<Word>(lhs, rhs, result, std::greater<Word>());
+        }
+        break;
+    default:
+        assert(false && "Unsupported lane width.");
+    }
+}
+
+/**
+ * Picks lanes from two vectors by the lane indices of a third one.
+ *
+ * Index values below the lane count pick from the first vector, the
+ * rest from the second one, as in LLVM shufflevector. The indices wrap
+ * around at twice the lane count. Nothing is written to the result if
+ * the first vector is narrower than one lane.
+ *
+ * @see addLanes()
+ * @param first The first source vector.
+ * @param second The second source vector.
+ * @param indices The lane indices, in lanes of the same width.
+ */
+void
+SimValue::shuffleLanes(
+    const SimValue& first, const SimValue& second,
+    const SimValue& indices, size_t elementWidth, SimValue& result) {
+
+    switch (elementWidth) {
+    case 8:
+        shuffleVectorElements<Byte>(first, second, indices, result);
+        break;
+    case 16:
+        shuffleVectorElements<HalfWord>(first, second, indices, result);
+        break;
+    case 32:
+        shuffleVectorElements<Word>(first, second, indices, result);
+        break;
+    default:
+        assert(false && "Unsupported lane width.");
+    }
+}
+
 /**
  * Sets SimValue to correspond the hex value.
  *
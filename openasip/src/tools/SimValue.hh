@@ -191,6 +191,47 @@ public:
     void setFloatElement(size_t elementIndex, FloatWord data);
     void setDoubleFloatElement(size_t elementIndex, DoubleFloatWord data);
 
+    void byteElements(Byte* data, size_t count) const;
+    void halfWordElements(HalfWord* data, size_t count) const;
+    void wordElements(Word* data, size_t count) const;
+    void floatElements(FloatWord* data, size_t count) const;
+
+    void setByteElements(const Byte* data, size_t count);
+    void setHalfWordElements(const HalfWord* data, size_t count);
+    void setWordElements(const Word* data, size_t count);
+    void setFloatElements(const FloatWord* data, size_t count);
+
+    static void addLanes(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        SimValue& result);
+    static void subLanes(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        SimValue& result);
+    static void mulLanes(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        SimValue& result);
+    static void addSaturatedLanes(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        bool isSigned, SimValue& result);
+    static void subSaturatedLanes(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        bool isSigned, SimValue& result);
+    static void addFloatLanes(
+        const SimValue& lhs, const SimValue& rhs, SimValue& result);
+    static void subFloatLanes(
+        const SimValue& lhs, const SimValue& rhs, SimValue& result);
+    static void mulFloatLanes(
+        const SimValue& lhs, const SimValue& rhs, SimValue& result);
+    static void equalLanes(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        SimValue& result);
+    static void greaterLanes(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        bool isSigned, SimValue& result);
+    static void shuffleLanes(
+        const SimValue& first, const SimValue& second,
+        const SimValue& indices, size_t elementWidth, SimValue& result);
+
     void setValue(TCEString hexValue);
     void clearToZero(int bitWidth);
     void clearToZero();
@@ -210,6 +251,31 @@ private:
     T vectorElement(size_t elementIndex) const;
     template <typename T>
     void setVectorElement(size_t elementIndex, T data);
+    template <typename T>
+    void vectorElements(T* data, size_t count) const;
+    template <typename T>
+    void setVectorElements(const T* data, size_t count);
+
+    template <typename T, typename Operation>
+    static void laneWise(
+        const SimValue& lhs, const SimValue& rhs, SimValue& result,
+        Operation op);
+    template <typename Operation>
+    static void integerLaneWise(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        SimValue& result, Operation op);
+    template <typename WideOperation>
+    static void saturatedLaneWise(
+        const SimValue& lhs, const SimValue& rhs, size_t elementWidth,
+        bool isSigned, SimValue& result);
+    template <typename T, typename Compare>
+    static void compareLanes(
+        const SimValue& lhs, const SimValue& rhs, SimValue& result,
+        Compare compare);
+    template <typename T>
+    static void shuffleVectorElements(
+        const SimValue& first, const SimValue& second,
+        const SimValue& indices, SimValue& result);
 
     /// @todo This currently works, but there could be more optimal 8-byte, 
     /// 4-byte and 2-byte swapper functions for 2/4/8 byte swaps. The more
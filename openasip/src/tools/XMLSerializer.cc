@@ -61,9 +61,15 @@
 #include <xercesc/framework/MemBufInputSource.hpp>
 #include <xercesc/framework/Wrapper4InputSource.hpp>
 #include <xercesc/framework/MemBufFormatTarget.hpp>
+#include <xercesc/framework/LocalFileInputSource.hpp>
+#include <xercesc/sax/SAXParseException.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
 
 #include "XMLSerializer.hh"
+#include "BinarySerializer.hh"
 #include "DOMBuilderErrorHandler.hh"
+#include "SAXObjectStateBuilder.hh"
 #include "Conversion.hh"
 #include "FileSystem.hh"
 #include "Application.hh"
@@ -78,7 +84,8 @@ using std::ifstream;
 XMLSerializer::XMLSerializer() :
     Serializer(), sourceFile_(""), destinationFile_(""), schemaFile_(""),
     useSchema_(false), parser_(NULL), domImplementation_(NULL),
-    sourceString_(NULL), destinationString_(NULL), nsUri_("") {
+    sourceString_(NULL), destinationString_(NULL), nsUri_(""),
+    binaryOutput_(false), streaming_(false) {
 
     XMLPlatformUtils::Initialize();
 
@@ -189,6 +196,21 @@ XMLSerializer::setXMLNamespace(std::string nsUri) {
     nsUri_ = nsUri;
 }
 
+/**
+ * Sets/unsets the streaming mode for reading XML.
+ *
+ * In the streaming mode the ObjectState tree is built directly from the
+ * SAX events of the parser, so the DOM of the whole document is never
+ * kept in memory. The resulting tree is the same as in the DOM mode.
+ *
+ * @param streaming True sets and false unsets the streaming mode. Default
+ *                  value is false.
+ */
+void
+XMLSerializer::setStreaming(bool streaming) {
+    streaming_ = streaming;
+}
+
 /**
  * Reads object state from a file or string.
  *
@@ -233,32 +255,8 @@ XMLSerializer::writeState(const ObjectState* state) {
 void
 XMLSerializer::initializeParser() {
 
-    if (useSchema_ && schemaFile_ == "") {
-        string errorMsg = "No schema file set.";
-        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
-    }
-
     if (useSchema_) {
-
-        try {
-            ensureValidStream(schemaFile_);
-        } catch (UnreachableStream& exception) {
-            SerializerException error(__FILE__, __LINE__, __func__,
-                exception.errorMessage());
-            
-            error.setCause(exception);            
-            throw error;
-        }
-
-        string absoluteSchemaFile = schemaFile_;
-
-        // convert the given schemaFile path to absolute path if it isn't
-        if (FileSystem::isRelativePath(schemaFile_)) {
-            absoluteSchemaFile = FileSystem::currentWorkingDir() +
-                FileSystem::DIRECTORY_SEPARATOR + schemaFile_;
-        }
-
-        XMLCh* filePath = Conversion::toXMLCh(absoluteSchemaFile);
+        XMLCh* filePath = Conversion::toXMLCh(absoluteSchemaFile());
 #if XERCES_VERSION_MAJOR >= 3
         parser_->getDomConfig()->setParameter(XMLUni::fgXercesSchema, true);
         parser_->getDomConfig()->setParameter(XMLUni::fgDOMValidate, true);
@@ -290,6 +288,39 @@ XMLSerializer::initializeParser() {
 #endif    
 }
 
+/**
+ * Returns the absolute path of the schema file set.
+ *
+ * @return The schema file path.
+ * @exception SerializerException If no schema file is set or it cannot be
+ *                                read.
+ */
+std::string
+XMLSerializer::absoluteSchemaFile() const {
+
+    if (schemaFile_ == "") {
+        string errorMsg = "No schema file set.";
+        throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
+    }
+
+    try {
+        ensureValidStream(schemaFile_);
+    } catch (UnreachableStream& exception) {
+        SerializerException error(__FILE__, __LINE__, __func__,
+            exception.errorMessage());
+            
+        error.setCause(exception);            
+        throw error;
+    }
+
+    // convert the given schemaFile path to absolute path if it isn't
+    if (FileSystem::isRelativePath(schemaFile_)) {
+        return FileSystem::currentWorkingDir() +
+            FileSystem::DIRECTORY_SEPARATOR + schemaFile_;
+    }
+    return schemaFile_;
+}
+
 /**
  * Reads object state from an xml string.
  *
@@ -299,6 +330,13 @@ XMLSerializer::initializeParser() {
  */
 ObjectState*
 XMLSerializer::readString(const std::string& source) {
+    if (streaming_) {
+        MemBufInputSource input(
+            (const XMLByte*)source.c_str(), source.length(), "sourceXML",
+            false);
+        return readStreaming(input);
+    }
+
     initializeParser();
     DOMDocument* dom = NULL;
     DOMBuilderErrorHandler* errHandler = new DOMBuilderErrorHandler();
@@ -366,9 +404,6 @@ XMLSerializer::readString(const std::string& source) {
  */
 ObjectState*
 XMLSerializer::readFile(const std::string& sourceFile) {
-    initializeParser();
-    DOMDocument* dom = NULL;
-
     if (sourceFile == "") {
         string errorMsg = "No source file set.";
         throw SerializerException(__FILE__, __LINE__, __func__, errorMsg);
@@ -382,6 +417,15 @@ XMLSerializer::readFile(const std::string& sourceFile) {
             exception.errorMessage());
     }
 
+    if (streaming_) {
+        XMLCh* filePath = Conversion::toXMLCh(sourceFile);
+        LocalFileInputSource input(filePath);
+        XMLString::release(&filePath);
+        return readStreaming(input);
+    }
+
+    initializeParser();
+    DOMDocument* dom = NULL;
     DOMBuilderErrorHandler* errHandler = new DOMBuilderErrorHandler();
 #if XERCES_VERSION_MAJOR >= 3
     parser_->getDomConfig()->setParameter(
@@ -425,6 +469,78 @@ XMLSerializer::readFile(const std::string& sourceFile) {
     return rootState;
 }
 
+/**
+ * Reads the given XML input with a SAX parser and builds an ObjectState
+ * tree of it without creating a DOM.
+ *
+ * The input is validated with the current schema file if the setting is
+ * on.
+ *
+ * @param input The XML input.
+ * @return Root node of the created ObjectState tree.
+ * @exception SerializerException If an error occurs while reading.
+ */
+ObjectState*
+XMLSerializer::readStreaming(const InputSource& input) {
+
+    SAX2XMLReader* reader = XMLReaderFactory::createXMLReader();
+    reader->setFeature(XMLUni::fgSAX2CoreValidation, useSchema_);
+    reader->setFeature(XMLUni::fgXercesDynamic, false);
+    reader->setFeature(XMLUni::fgSAX2CoreNameSpaces, useSchema_);
+    reader->setFeature(XMLUni::fgSAX2CoreNameSpacePrefixes, useSchema_);
+    if (useSchema_) {
+        string schemaFile;
+        try {
+            schemaFile = absoluteSchemaFile();
+        } catch (const SerializerException&) {
+            delete reader;
+            throw;
+        }
+        reader->setFeature(XMLUni::fgXercesSchema, true);
+        reader->setFeature(XMLUni::fgXercesSchemaFullChecking, true);
+        XMLCh* filePath = Conversion::toXMLCh(schemaFile);
+        reader->setProperty(
+            XMLUni::fgXercesSchemaExternalNoNameSpaceSchemaLocation,
+            filePath);
+        XMLString::release(&filePath);
+    }
+
+    SAXObjectStateBuilder builder;
+    reader->setContentHandler(&builder);
+    reader->setErrorHandler(&builder);
+
+    string errorLog = "";
+    try {
+        reader->parse(input);
+    } catch (const SAXParseException&) {
+        // already in the error log of the builder
+    } catch (const XMLException& exception) {
+        errorLog = Conversion::XMLChToString(exception.getMessage());
+    } catch (const SAXException& exception) {
+        errorLog = Conversion::XMLChToString(exception.getMessage());
+    } catch (...) {
+        errorLog = "Unknown error while parsing XML.";
+    }
+    delete reader;
+    reader = NULL;
+
+    if (builder.errorCount() > 0) {
+        errorLog = builder.errorLog() + errorLog;
+    }
+    if (errorLog != "") {
+        throw SerializerException(__FILE__, __LINE__, __func__, errorLog);
+    }
+
+    ObjectState* rootState = builder.releaseState();
+    if (rootState == NULL) {
+        throw SerializerException(
+            __FILE__, __LINE__, __func__,
+            "Illegal file: " + Conversion::XMLChToString(
+                input.getSystemId()));
+    }
+    return rootState;
+}
+
 /**
  * Writes the given ObjectState tree into the current XML file set.
  *
@@ -527,6 +643,85 @@ XMLSerializer::sourceFile() const {
     return sourceFile_;
 }
 
+/**
+ * Sets/unsets writing of the binary format instead of XML.
+ *
+ * Only the serializers that support the binary format of their object
+ * model obey the setting. Reading detects the format automatically.
+ *
+ * @param binary True sets and false unsets binary output. Default value
+ *               is false.
+ */
+void
+XMLSerializer::setBinaryOutput(bool binary) {
+    binaryOutput_ = binary;
+}
+
+/**
+ * Tells whether the binary format should be written instead of XML.
+ *
+ * @return True if binary output is set.
+ */
+bool
+XMLSerializer::binaryOutput() const {
+    return binaryOutput_;
+}
+
+/**
+ * Tells whether the source file or string set is in the binary format.
+ *
+ * @return True if the source is binary data.
+ */
+bool
+XMLSerializer::hasBinarySource() const {
+    if (sourceFile_ != "") {
+        return BinarySerializer::isBinaryFile(sourceFile_);
+    } else if (sourceString_ != NULL) {
+        return BinarySerializer::isBinaryString(*sourceString_);
+    }
+    return false;
+}
+
+/**
+ * Reads an ObjectState tree from the binary source set.
+ *
+ * @param formatTag Format tag the binary data must have.
+ * @return Root of the created ObjectState tree.
+ * @exception SerializerException If the source is not valid binary data
+ *                                with the given tag.
+ */
+ObjectState*
+XMLSerializer::readBinaryState(const std::string& formatTag) const {
+    BinarySerializer serializer(formatTag);
+    if (sourceFile_ != "") {
+        serializer.setSourceFile(sourceFile_);
+    } else if (sourceString_ != NULL) {
+        serializer.setSourceString(*sourceString_);
+    }
+    return serializer.readState();
+}
+
+/**
+ * Writes the given ObjectState tree in the binary format to the
+ * destination set.
+ *
+ * @param state Root of the ObjectState tree.
+ * @param formatTag Format tag to write to the binary data.
+ * @exception SerializerException If the destination cannot be written.
+ */
+void
+XMLSerializer::writeBinaryState(
+    const ObjectState* state, const std::string& formatTag) const {
+
+    BinarySerializer serializer(formatTag);
+    if (destinationFile_ != "") {
+        serializer.setDestinationFile(destinationFile_);
+    } else if (destinationString_ != NULL) {
+        serializer.setDestinationString(*destinationString_);
+    }
+    serializer.writeState(state);
+}
+
 /**
  * Creates a DOM tree according to the given ObjectState tree.
  *
@@ -44,6 +44,7 @@
 #include <xercesc/dom/DOMBuilder.hpp>
 #endif
 #include <xercesc/dom/DOMDocument.hpp>
+#include <xercesc/sax/InputSource.hpp>
 
 #include "Serializable.hh"
 #include "Serializer.hh"
@@ -75,6 +76,10 @@ public:
 
     void setXMLNamespace(std::string nsUri);
 
+    void setBinaryOutput(bool binary);
+
+    void setStreaming(bool streaming);
+
     virtual ObjectState* readState();
 
     virtual void writeState(const ObjectState* rootState);
@@ -82,6 +87,12 @@ public:
 protected:
     std::string sourceFile() const;
 
+    bool binaryOutput() const;
+    bool hasBinarySource() const;
+    ObjectState* readBinaryState(const std::string& formatTag) const;
+    void writeBinaryState(
+        const ObjectState* state, const std::string& formatTag) const;
+
 private:
     /// Copying forbidden.
     XMLSerializer(const XMLSerializer&);
@@ -89,6 +100,9 @@ private:
     XMLSerializer& operator=(const XMLSerializer&);
 
     void initializeParser();
+    std::string absoluteSchemaFile() const;
+
+    ObjectState* readStreaming(const InputSource& input);
 
     virtual ObjectState* readFile(const std::string& fileName);
 
@@ -132,6 +146,10 @@ private:
 
     /// XML namespace URI
     std::string nsUri_;
+    /// Indicates if writeState writes the binary format instead of XML.
+    bool binaryOutput_;
+    /// Indicates if XML is read with SAX without building a DOM.
+    bool streaming_;
 };
 
 #endif
@@ -0,0 +1,256 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file HuffmanCodeTest.hh
+ *
+ * A test suite for HuffmanCode.
+ *
+ * @note rating: red
+ */
+
+#ifndef HUFFMAN_CODE_TEST_HH
+#define HUFFMAN_CODE_TEST_HH
+
+#include <TestSuite.h>
+#include <vector>
+
+#include "HuffmanCode.hh"
+#include "BitVector.hh"
+#include "Exception.hh"
+
+/**
+ * Class for testing the length limited canonical Huffman codes.
+ */
+class HuffmanCodeTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testCodeLengths();
+    void testCanonicalCodes();
+    void testLengthLimit();
+    void testRoundTrip();
+    void testSingleSymbol();
+    void testInvalidInput();
+
+private:
+    void assertPrefixFree(const HuffmanCode& code);
+    unsigned long long kraftSum(
+        const HuffmanCode& code, unsigned int limit);
+};
+
+/**
+ * Called before each test.
+ */
+void
+HuffmanCodeTest::setUp() {
+}
+
+/**
+ * Called after each test.
+ */
+void
+HuffmanCodeTest::tearDown() {
+}
+
+/**
+ * Tests that the lengths are those of a Huffman tree when the limit does
+ * not bind.
+ */
+void
+HuffmanCodeTest::testCodeLengths() {
+    std::vector<unsigned int> frequencies;
+    frequencies.push_back(8);
+    frequencies.push_back(4);
+    frequencies.push_back(2);
+    frequencies.push_back(1);
+    frequencies.push_back(1);
+
+    HuffmanCode code(frequencies, 12);
+    TS_ASSERT_EQUALS(code.symbolCount(), 5u);
+    TS_ASSERT_EQUALS(code.length(0), 1u);
+    TS_ASSERT_EQUALS(code.length(1), 2u);
+    TS_ASSERT_EQUALS(code.length(2), 3u);
+    TS_ASSERT_EQUALS(code.length(3), 4u);
+    TS_ASSERT_EQUALS(code.length(4), 4u);
+
+    // a complete code uses the whole code space
+    TS_ASSERT_EQUALS(kraftSum(code, 4), 16u);
+    assertPrefixFree(code);
+}
+
+/**
+ * Tests that the codes are assigned canonically: shorter codes first and
+ * consecutive codes of the same length in the order of the symbols.
+ */
+void
+HuffmanCodeTest::testCanonicalCodes() {
+    std::vector<unsigned int> frequencies;
+    frequencies.push_back(1);
+    frequencies.push_back(1);
+    frequencies.push_back(2);
+    frequencies.push_back(4);
+
+    HuffmanCode code(frequencies, 12);
+    TS_ASSERT_EQUALS(code.code(3).toString(), "0");
+    TS_ASSERT_EQUALS(code.code(2).toString(), "10");
+    TS_ASSERT_EQUALS(code.code(0).toString(), "110");
+    TS_ASSERT_EQUALS(code.code(1).toString(), "111");
+}
+
+/**
+ * Tests that the limit is respected and the codes stay decodable when it
+ * binds.
+ */
+void
+HuffmanCodeTest::testLengthLimit() {
+    // Fibonacci frequencies give the deepest Huffman tree
+    std::vector<unsigned int> frequencies;
+    unsigned int a = 1;
+    unsigned int b = 1;
+    for (int i = 0; i < 12; i++) {
+        frequencies.push_back(a);
+        unsigned int next = a + b;
+        a = b;
+        b = next;
+    }
+
+    HuffmanCode unlimited(frequencies, 32);
+    TS_ASSERT_EQUALS(unlimited.length(0), 11u);
+
+    const unsigned int limit = 5;
+    HuffmanCode limited(frequencies, limit);
+    for (unsigned int i = 0; i < limited.symbolCount(); i++) {
+        TS_ASSERT(limited.length(i) <= limit);
+        TS_ASSERT(limited.length(i) > 0);
+    }
+    TS_ASSERT(kraftSum(limited, limit) <= (1u << limit));
+    assertPrefixFree(limited);
+
+    // a limit too small for the symbols is raised to a fixed width index
+    HuffmanCode tooShort(frequencies, 1);
+    for (unsigned int i = 0; i < tooShort.symbolCount(); i++) {
+        TS_ASSERT(tooShort.length(i) <= 4u);
+    }
+    assertPrefixFree(tooShort);
+}
+
+/**
+ * Tests that a sequence of encoded symbols decodes back to the same
+ * symbols.
+ */
+void
+HuffmanCodeTest::testRoundTrip() {
+    std::vector<unsigned int> frequencies;
+    for (unsigned int i = 0; i < 20; i++) {
+        frequencies.push_back(1 + (i * 7) % 13);
+    }
+    HuffmanCode code(frequencies, 6);
+
+    std::vector<unsigned int> symbols;
+    for (unsigned int i = 0; i < 200; i++) {
+        symbols.push_back((i * 11 + i / 3) % frequencies.size());
+    }
+
+    BitVector bits;
+    unsigned long long expectedLength = 0;
+    for (unsigned int i = 0; i < symbols.size(); i++) {
+        code.encode(symbols.at(i), bits);
+        expectedLength += code.length(symbols.at(i));
+    }
+    TS_ASSERT_EQUALS(bits.size(), expectedLength);
+
+    unsigned int position = 0;
+    for (unsigned int i = 0; i < symbols.size(); i++) {
+        TS_ASSERT_EQUALS(code.decode(bits, position), symbols.at(i));
+    }
+    TS_ASSERT_EQUALS(position, bits.size());
+}
+
+/**
+ * Tests that a single symbol gets an empty code.
+ */
+void
+HuffmanCodeTest::testSingleSymbol() {
+    std::vector<unsigned int> frequencies(1, 5);
+    HuffmanCode code(frequencies, 12);
+    TS_ASSERT_EQUALS(code.length(0), 0u);
+
+    BitVector bits;
+    code.encode(0, bits);
+    TS_ASSERT_EQUALS(bits.size(), 0u);
+    unsigned int position = 0;
+    TS_ASSERT_EQUALS(code.decode(bits, position), 0u);
+    TS_ASSERT_EQUALS(position, 0u);
+}
+
+/**
+ * Tests the errors of unknown symbols and undecodable bits.
+ */
+void
+HuffmanCodeTest::testInvalidInput() {
+    std::vector<unsigned int> frequencies(4, 1);
+    HuffmanCode code(frequencies, 12);
+    TS_ASSERT_THROWS(code.length(4), OutOfRange);
+    TS_ASSERT_THROWS(code.code(4), OutOfRange);
+
+    // a truncated code cannot be decoded
+    BitVector bits;
+    code.encode(3, bits);
+    bits.pop_back();
+    unsigned int position = 0;
+    TS_ASSERT_THROWS(code.decode(bits, position), InvalidData);
+}
+
+/**
+ * Asserts that no code is a prefix of another.
+ */
+void
+HuffmanCodeTest::assertPrefixFree(const HuffmanCode& code) {
+    for (unsigned int i = 0; i < code.symbolCount(); i++) {
+        for (unsigned int j = 0; j < code.symbolCount(); j++) {
+            if (i == j || code.length(i) > code.length(j)) {
+                continue;
+            }
+            const BitVector& shorter = code.code(i);
+            const BitVector& longer = code.code(j);
+            bool prefix = true;
+            for (unsigned int b = 0; b < shorter.size(); b++) {
+                if (shorter.at(b) != longer.at(b)) {
+                    prefix = false;
+                    break;
+                }
+            }
+            TS_ASSERT(!prefix);
+        }
+    }
+}
+
+/**
+ * Returns the Kraft sum of the code lengths scaled by 2^limit.
+ */
+unsigned long long
+HuffmanCodeTest::kraftSum(const HuffmanCode& code, unsigned int limit) {
+    unsigned long long sum = 0;
+    for (unsigned int i = 0; i < code.symbolCount(); i++) {
+        sum += 1ULL << (limit - code.length(i));
+    }
+    return sum;
+}
+
+#endif
@@ -0,0 +1,179 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file ITemplateBrokerTest.hh
+ *
+ * A test suite for the order in which ITemplateBroker tries the
+ * instruction templates.
+ *
+ * @note rating: red
+ */
+
+#ifndef ITEMPLATE_BROKER_TEST_HH
+#define ITEMPLATE_BROKER_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+
+#include "ITemplateBroker.hh"
+#include "ITemplateResource.hh"
+#include "BusResource.hh"
+#include "SchedulingResource.hh"
+#include "InstructionTemplate.hh"
+#include "Machine.hh"
+
+/**
+ * Class for testing the template order of ITemplateBroker.
+ */
+class ITemplateBrokerTest : public CxxTest::TestSuite {
+public:
+    ITemplateBrokerTest();
+    ~ITemplateBrokerTest();
+
+    void setUp();
+    void tearDown();
+
+    void testColdCodeOrder();
+    void testHotCodeOrder();
+
+private:
+    void assertOrder(
+        const SchedulingResourceSet& templates, const std::string& names);
+
+    TTAMachine::Machine machine_;
+    /// Templates using two, one, no and one move slots for immediates.
+    ITemplateResource* a_;
+    ITemplateResource* b_;
+    ITemplateResource* c_;
+    ITemplateResource* d_;
+    BusResource bus1_;
+    BusResource bus2_;
+};
+
+/**
+ * Constructor.
+ */
+ITemplateBrokerTest::ITemplateBrokerTest() :
+    bus1_("b1", 32, 0, 0, 0, 0, 0), bus2_("b2", 32, 0, 0, 0, 0, 0) {
+
+    a_ = new ITemplateResource(
+        *new TTAMachine::InstructionTemplate("a", machine_));
+    b_ = new ITemplateResource(
+        *new TTAMachine::InstructionTemplate("b", machine_));
+    c_ = new ITemplateResource(
+        *new TTAMachine::InstructionTemplate("c", machine_));
+    d_ = new ITemplateResource(
+        *new TTAMachine::InstructionTemplate("d", machine_));
+
+    a_->addToDependentGroup(0, bus1_);
+    a_->addToDependentGroup(0, bus2_);
+    b_->addToDependentGroup(0, bus1_);
+    d_->addToDependentGroup(0, bus2_);
+}
+
+/**
+ * Destructor.
+ */
+ITemplateBrokerTest::~ITemplateBrokerTest() {
+    delete a_;
+    delete b_;
+    delete c_;
+    delete d_;
+}
+
+/**
+ * Resets the use counts.
+ */
+void
+ITemplateBrokerTest::setUp() {
+    a_->clear();
+    b_->clear();
+    c_->clear();
+    d_->clear();
+}
+
+/**
+ * Called after each test.
+ */
+void
+ITemplateBrokerTest::tearDown() {
+}
+
+/**
+ * Tests that cold code tries the least used templates first, then by name.
+ */
+void
+ITemplateBrokerTest::testColdCodeOrder() {
+    SchedulingResourceSet templates;
+    templates.insert(*d_);
+    templates.insert(*c_);
+    templates.insert(*b_);
+    templates.insert(*a_);
+
+    ITemplateBroker::sortTemplates(templates, false);
+    assertOrder(templates, "abcd");
+
+    a_->increaseUseCount();
+    ITemplateBroker::sortTemplates(templates, false);
+    assertOrder(templates, "bcda");
+}
+
+/**
+ * Tests that hot code tries the templates with the fewest move slots
+ * first, and those with the same slot count in the cold code order.
+ */
+void
+ITemplateBrokerTest::testHotCodeOrder() {
+    SchedulingResourceSet templates;
+    templates.insert(*a_);
+    templates.insert(*b_);
+    templates.insert(*c_);
+    templates.insert(*d_);
+
+    ITemplateBroker::sortTemplates(templates, true);
+    assertOrder(templates, "cbda");
+
+    // the use count orders the templates with the same slot count
+    b_->increaseUseCount();
+    ITemplateBroker::sortTemplates(templates, true);
+    assertOrder(templates, "cdba");
+
+    // but does not override the slot count
+    c_->increaseUseCount();
+    c_->increaseUseCount();
+    ITemplateBroker::sortTemplates(templates, true);
+    assertOrder(templates, "cdba");
+}
+
+/**
+ * Asserts the order of the templates in the set.
+ *
+ * @param names The one letter names of the templates in the expected order.
+ */
+void
+ITemplateBrokerTest::assertOrder(
+    const SchedulingResourceSet& templates, const std::string& names) {
+
+    TS_ASSERT_EQUALS(templates.count(), static_cast<int>(names.size()));
+    for (int i = 0; i < templates.count(); i++) {
+        TS_ASSERT_EQUALS(
+            templates.resource(i).name(), std::string(1, names.at(i)));
+    }
+}
+
+#endif
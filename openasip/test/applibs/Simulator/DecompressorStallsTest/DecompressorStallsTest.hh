@@ -0,0 +1,217 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file DecompressorStallsTest.hh
+ *
+ * A test suite for the decompressor stall accounting of the simulator.
+ *
+ * @note rating: red
+ */
+
+#ifndef DECOMPRESSOR_STALLS_TEST_HH
+#define DECOMPRESSOR_STALLS_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+
+#include "SimulatorFrontend.hh"
+#include "Program.hh"
+#include "Instruction.hh"
+#include "Address.hh"
+
+/// The machine of the simulated program.
+const std::string STALLS_MACHINE =
+    "../../../base/program/ProgramWriterTest/data/worm.adf";
+
+/// The simulated program.
+const std::string STALLS_PROGRAM =
+    "../../../base/program/ProgramWriterTest/data/worm.tpef";
+
+/// The stall file written by the tests.
+const std::string STALLS_FILE = "stalls.tmp";
+
+/**
+ * Class for testing that the decompressor stalls are added to the cycle
+ * count and belong to one program.
+ */
+class DecompressorStallsTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testStallsAreCounted();
+    void testStallsRemovedOnProgramLoad();
+    void testStallsLoadedBeforeProgram();
+    void testOtherEnginesRefuseStalls();
+
+private:
+    void writeStalls(
+        const SimulatorFrontend& frontend, unsigned int cycles);
+};
+
+/**
+ * Called before each test.
+ */
+void
+DecompressorStallsTest::setUp() {
+}
+
+/**
+ * Removes the stall file.
+ */
+void
+DecompressorStallsTest::tearDown() {
+    std::remove(STALLS_FILE.c_str());
+}
+
+/**
+ * Tests that the stalls of the executed instructions are added to the
+ * cycle count.
+ */
+void
+DecompressorStallsTest::testStallsAreCounted() {
+    const int steps = 100;
+
+    SimulatorFrontend plain(SimulatorFrontend::SIM_NORMAL);
+    std::ostringstream plainOutput;
+    plain.setOutputStream(plainOutput);
+    plain.loadMachine(STALLS_MACHINE);
+    plain.loadProgram(STALLS_PROGRAM);
+    plain.step(steps);
+    TS_ASSERT_EQUALS(plain.cycleCount(), ClockCycleCount(steps));
+    TS_ASSERT_EQUALS(plain.decompressorStallCycles(), ClockCycleCount(0));
+
+    SimulatorFrontend stalled(SimulatorFrontend::SIM_NORMAL);
+    std::ostringstream stalledOutput;
+    stalled.setOutputStream(stalledOutput);
+    stalled.loadMachine(STALLS_MACHINE);
+    stalled.loadProgram(STALLS_PROGRAM);
+    writeStalls(stalled, 2);
+    stalled.loadDecompressorStalls(STALLS_FILE);
+    stalled.step(steps);
+
+    // every instruction stalls, so each step takes three cycles
+    TS_ASSERT_EQUALS(
+        stalled.decompressorStallCycles(), ClockCycleCount(2 * steps));
+    TS_ASSERT_EQUALS(stalled.cycleCount(), ClockCycleCount(3 * steps));
+    TS_ASSERT_EQUALS(
+        stalled.programCounter(), plain.programCounter());
+
+    // restarting the simulation resets the stall count
+    stalled.loadProgram(STALLS_PROGRAM);
+    TS_ASSERT_EQUALS(stalled.decompressorStallCycles(), ClockCycleCount(0));
+}
+
+/**
+ * Tests that loading another program removes the stalls.
+ */
+void
+DecompressorStallsTest::testStallsRemovedOnProgramLoad() {
+    SimulatorFrontend frontend(SimulatorFrontend::SIM_NORMAL);
+    std::ostringstream output;
+    frontend.setOutputStream(output);
+    frontend.loadMachine(STALLS_MACHINE);
+    frontend.loadProgram(STALLS_PROGRAM);
+    writeStalls(frontend, 1);
+    frontend.loadDecompressorStalls(STALLS_FILE);
+    TS_ASSERT(!frontend.decompressorStalls().empty());
+
+    frontend.loadProgram(STALLS_PROGRAM);
+    TS_ASSERT(frontend.decompressorStalls().empty());
+    TS_ASSERT(output.str().find("removed") != std::string::npos);
+
+    frontend.step(10);
+    TS_ASSERT_EQUALS(frontend.cycleCount(), ClockCycleCount(10));
+}
+
+/**
+ * Tests that stalls loaded before a program apply to the next program
+ * only.
+ */
+void
+DecompressorStallsTest::testStallsLoadedBeforeProgram() {
+    SimulatorFrontend frontend(SimulatorFrontend::SIM_NORMAL);
+    std::ostringstream output;
+    frontend.setOutputStream(output);
+    frontend.loadMachine(STALLS_MACHINE);
+    frontend.loadProgram(STALLS_PROGRAM);
+    writeStalls(frontend, 1);
+
+    SimulatorFrontend fresh(SimulatorFrontend::SIM_NORMAL);
+    fresh.setOutputStream(output);
+    fresh.loadMachine(STALLS_MACHINE);
+    fresh.loadDecompressorStalls(STALLS_FILE);
+    fresh.loadProgram(STALLS_PROGRAM);
+    TS_ASSERT(!fresh.decompressorStalls().empty());
+    fresh.step(10);
+    TS_ASSERT_EQUALS(fresh.cycleCount(), ClockCycleCount(20));
+
+    fresh.loadProgram(STALLS_PROGRAM);
+    TS_ASSERT(fresh.decompressorStalls().empty());
+}
+
+/**
+ * Tests that only the interpretive engine simulates the stalls and that
+ * the other engines warn about loaded stalls.
+ */
+void
+DecompressorStallsTest::testOtherEnginesRefuseStalls() {
+    SimulatorFrontend frontend(SimulatorFrontend::SIM_NORMAL);
+    std::ostringstream output;
+    frontend.setOutputStream(output);
+    TS_ASSERT(frontend.simulatesDecompressorStalls());
+    frontend.loadMachine(STALLS_MACHINE);
+    frontend.loadProgram(STALLS_PROGRAM);
+    writeStalls(frontend, 1);
+
+    SimulatorFrontend ota(SimulatorFrontend::SIM_OTA);
+    TS_ASSERT(!ota.simulatesDecompressorStalls());
+    ota.setOutputStream(output);
+    ota.loadMachine(STALLS_MACHINE);
+    ota.loadDecompressorStalls(STALLS_FILE);
+    ota.loadProgram(STALLS_PROGRAM);
+    TS_ASSERT(output.str().find("Warning") != std::string::npos);
+}
+
+/**
+ * Writes a stall file that stalls every instruction of the program.
+ *
+ * @param frontend The frontend with the program loaded.
+ * @param cycles The stall cycles of each instruction.
+ */
+void
+DecompressorStallsTest::writeStalls(
+    const SimulatorFrontend& frontend, unsigned int cycles) {
+
+    const TTAProgram::Program& program = frontend.program();
+    InstructionAddress first =
+        program.firstInstruction().address().location();
+    InstructionAddress last =
+        program.lastInstruction().address().location();
+
+    std::ofstream stallFile(STALLS_FILE.c_str());
+    stallFile << "# instruction address, stall cycles" << std::endl;
+    for (InstructionAddress address = first; address <= last; ++address) {
+        stallFile << address << " " << cycles << std::endl;
+    }
+}
+
+#endif
@@ -0,0 +1,238 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file ExecutableInstructionTest.hh
+ *
+ * A test suite for ExecutableInstruction.
+ *
+ * @note rating: red
+ */
+
+#ifndef EXECUTABLE_INSTRUCTION_TEST_HH
+#define EXECUTABLE_INSTRUCTION_TEST_HH
+
+#include <TestSuite.h>
+
+#include "ExecutableInstruction.hh"
+#include "ExecutableMove.hh"
+#include "RegisterState.hh"
+#include "BusState.hh"
+#include "SimValue.hh"
+
+/**
+ * Class for testing ExecutableInstruction.
+ */
+class ExecutableInstructionTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testFastExecutionSwapsRegisters();
+    void testFastExecutionOfGuardedMoves();
+    void testFastExecutionMatchesExecute();
+};
+
+
+/**
+ * Called before each test.
+ */
+void
+ExecutableInstructionTest::setUp() {
+}
+
+
+/**
+ * Called after each test.
+ */
+void
+ExecutableInstructionTest::tearDown() {
+}
+
+/**
+ * Tests that executeFast() reads all sources before writing any
+ * destination, like execute() does.
+ */
+void
+ExecutableInstructionTest::testFastExecutionSwapsRegisters() {
+
+    RegisterState reg1(32);
+    RegisterState reg2(32);
+    BusState bus1(32);
+    BusState bus2(32);
+
+    SimValue value(32);
+    value = 1;
+    reg1.setValue(value);
+    value = 2;
+    reg2.setValue(value);
+
+    ExecutableInstruction instruction;
+    instruction.addExecutableMove(new ExecutableMove(reg1, bus1, reg2));
+    instruction.addExecutableMove(new ExecutableMove(reg2, bus2, reg1));
+
+    instruction.executeFast();
+    TS_ASSERT_EQUALS(reg1.value().uIntWordValue(), 2u);
+    TS_ASSERT_EQUALS(reg2.value().uIntWordValue(), 1u);
+
+    instruction.execute();
+    TS_ASSERT_EQUALS(reg1.value().uIntWordValue(), 1u);
+    TS_ASSERT_EQUALS(reg2.value().uIntWordValue(), 2u);
+
+    TS_ASSERT_EQUALS(instruction.executionCount(), 2u);
+    TS_ASSERT_EQUALS(instruction.moveExecutionCount(0), 2u);
+    TS_ASSERT_EQUALS(instruction.moveExecutionCount(1), 2u);
+}
+
+/**
+ * Tests that executeFast() squashes guarded moves like execute() does.
+ */
+void
+ExecutableInstructionTest::testFastExecutionOfGuardedMoves() {
+
+    RegisterState guard(1);
+    RegisterState src(32);
+    RegisterState dst1(32);
+    RegisterState dst2(32);
+    BusState bus1(32);
+    BusState bus2(32);
+
+    SimValue value(32);
+    value = 7;
+    src.setValue(value);
+    value = 0;
+    guard.setValue(value);
+
+    ExecutableInstruction instruction;
+    instruction.addExecutableMove(
+        new ExecutableMove(src, bus1, dst1, guard, false));
+    instruction.addExecutableMove(
+        new ExecutableMove(src, bus2, dst2, guard, true));
+
+    instruction.executeFast();
+    TS_ASSERT(instruction.moveSquashed(0));
+    TS_ASSERT(!instruction.moveSquashed(1));
+    TS_ASSERT_EQUALS(dst1.value().uIntWordValue(), 0u);
+    TS_ASSERT_EQUALS(dst2.value().uIntWordValue(), 7u);
+    TS_ASSERT_EQUALS(instruction.moveExecutionCount(0), 0u);
+    TS_ASSERT_EQUALS(instruction.moveExecutionCount(1), 1u);
+}
+
+/**
+ * Tests that executeFast() leaves the registers, the bus values, the bus
+ * squash flags and the execution counts in the same state as execute().
+ */
+void
+ExecutableInstructionTest::testFastExecutionMatchesExecute() {
+
+    const int setups = 2;
+    RegisterState* guard[setups];
+    RegisterState* src[setups];
+    RegisterState* dst1[setups];
+    RegisterState* dst2[setups];
+    RegisterState* dst3[setups];
+    BusState* bus1[setups];
+    BusState* bus2[setups];
+    BusState* bus3[setups];
+    ExecutableInstruction* instruction[setups];
+
+    SimValue value(32);
+    for (int i = 0; i < setups; ++i) {
+        guard[i] = new RegisterState(1);
+        src[i] = new RegisterState(32);
+        dst1[i] = new RegisterState(32);
+        dst2[i] = new RegisterState(32);
+        dst3[i] = new RegisterState(32);
+        bus1[i] = new BusState(32);
+        bus2[i] = new BusState(32);
+        bus3[i] = new BusState(32);
+        value = 5;
+        src[i]->setValue(value);
+
+        instruction[i] = new ExecutableInstruction();
+        instruction[i]->addExecutableMove(
+            new ExecutableMove(*src[i], *bus1[i], *dst1[i]));
+        instruction[i]->addExecutableMove(
+            new ExecutableMove(
+                *src[i], *bus2[i], *dst2[i], *guard[i], false));
+        instruction[i]->addExecutableMove(
+            new ExecutableMove(
+                *dst1[i], *bus3[i], *dst3[i], *guard[i], true));
+    }
+
+    for (int cycle = 0; cycle < 6; ++cycle) {
+        for (int i = 0; i < setups; ++i) {
+            value = cycle % 2;
+            guard[i]->setValue(value);
+            value = 5 + cycle;
+            src[i]->setValue(value);
+            bus1[i]->clear();
+            bus2[i]->clear();
+            bus3[i]->clear();
+        }
+        instruction[0]->execute();
+        instruction[1]->executeFast();
+
+        TS_ASSERT_EQUALS(
+            dst1[0]->value().uIntWordValue(), 
+            dst1[1]->value().uIntWordValue());
+        TS_ASSERT_EQUALS(
+            dst2[0]->value().uIntWordValue(), 
+            dst2[1]->value().uIntWordValue());
+        TS_ASSERT_EQUALS(
+            dst3[0]->value().uIntWordValue(), 
+            dst3[1]->value().uIntWordValue());
+        TS_ASSERT_EQUALS(
+            bus1[0]->value().uIntWordValue(), 
+            bus1[1]->value().uIntWordValue());
+        TS_ASSERT_EQUALS(
+            bus2[0]->value().uIntWordValue(), 
+            bus2[1]->value().uIntWordValue());
+        TS_ASSERT_EQUALS(
+            bus3[0]->value().uIntWordValue(), 
+            bus3[1]->value().uIntWordValue());
+        TS_ASSERT_EQUALS(bus1[0]->isSquashed(), bus1[1]->isSquashed());
+        TS_ASSERT_EQUALS(bus2[0]->isSquashed(), bus2[1]->isSquashed());
+        TS_ASSERT_EQUALS(bus3[0]->isSquashed(), bus3[1]->isSquashed());
+        TS_ASSERT_EQUALS(bus2[1]->isSquashed(), cycle % 2 == 0);
+        TS_ASSERT_EQUALS(bus3[1]->isSquashed(), cycle % 2 == 1);
+        for (std::size_t m = 0; m < 3; ++m) {
+            TS_ASSERT_EQUALS(
+                instruction[0]->moveSquashed(m), 
+                instruction[1]->moveSquashed(m));
+            TS_ASSERT_EQUALS(
+                instruction[0]->moveExecutionCount(m), 
+                instruction[1]->moveExecutionCount(m));
+        }
+    }
+    TS_ASSERT_EQUALS(
+        instruction[0]->executionCount(), instruction[1]->executionCount());
+
+    for (int i = 0; i < setups; ++i) {
+        delete instruction[i];
+        delete guard[i];
+        delete src[i];
+        delete dst1[i];
+        delete dst2[i];
+        delete dst3[i];
+        delete bus1[i];
+        delete bus2[i];
+        delete bus3[i];
+    }
+}
+
+#endif
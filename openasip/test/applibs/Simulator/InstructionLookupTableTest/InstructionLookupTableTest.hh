@@ -0,0 +1,142 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file InstructionLookupTableTest.hh
+ *
+ * A test suite for InstructionLookupTable.
+ *
+ * @note rating: red
+ */
+
+#ifndef INSTRUCTION_LOOKUP_TABLE_TEST_HH
+#define INSTRUCTION_LOOKUP_TABLE_TEST_HH
+
+#include <TestSuite.h>
+
+#include "InstructionLookupTable.hh"
+#include "InstructionMemory.hh"
+#include "ExecutableInstruction.hh"
+
+/**
+ * Class for testing the memoized instruction memory lookups.
+ */
+class InstructionLookupTableTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testAddressStep();
+    void testLookup();
+    void testModificationFlushes();
+};
+
+/**
+ * Called before each test.
+ */
+void
+InstructionLookupTableTest::setUp() {
+}
+
+/**
+ * Called after each test.
+ */
+void
+InstructionLookupTableTest::tearDown() {
+}
+
+/**
+ * Tests that the address step divides all the instruction distances.
+ */
+void
+InstructionLookupTableTest::testAddressStep() {
+    InstructionMemory memory(8);
+    TS_ASSERT_EQUALS(memory.addressStep(), 0u);
+    memory.addExecutableInstruction(8, new ExecutableInstruction());
+    TS_ASSERT_EQUALS(memory.addressStep(), 0u);
+    memory.addExecutableInstruction(20, new ExecutableInstruction());
+    TS_ASSERT_EQUALS(memory.addressStep(), 12u);
+    memory.addExecutableInstruction(16, new ExecutableInstruction());
+    TS_ASSERT_EQUALS(memory.addressStep(), 4u);
+    // a compressed instruction
+    memory.addExecutableInstruction(22, new ExecutableInstruction());
+    TS_ASSERT_EQUALS(memory.addressStep(), 2u);
+}
+
+/**
+ * Tests that the table returns the instructions of the memory.
+ */
+void
+InstructionLookupTableTest::testLookup() {
+    InstructionMemory memory(0);
+    ExecutableInstruction* first = new ExecutableInstruction();
+    ExecutableInstruction* second = new ExecutableInstruction();
+    ExecutableInstruction* implicit = new ExecutableInstruction();
+    memory.addExecutableInstruction(0, first);
+    memory.addExecutableInstruction(4, second);
+    memory.addImplicitExecutableInstruction(4, implicit);
+
+    InstructionLookupTable table(memory, 9);
+    for (int round = 0; round < 2; ++round) {
+        TS_ASSERT_EQUALS(table.lookup(0).instruction, first);
+        TS_ASSERT(table.lookup(0).implicitInstructions == NULL);
+        TS_ASSERT_EQUALS(table.lookup(4).instruction, second);
+        TS_ASSERT(table.lookup(4).implicitInstructions != NULL);
+        TS_ASSERT_EQUALS(table.lookup(4).implicitInstructions->size(), 1u);
+        TS_ASSERT_EQUALS(
+            table.lookup(4).implicitInstructions->at(0), implicit);
+        // addresses between the steps and after the end
+        TS_ASSERT(table.lookup(2).instruction == NULL);
+        TS_ASSERT(table.lookup(8).instruction == NULL);
+        TS_ASSERT(table.lookup(400).instruction == NULL);
+    }
+}
+
+/**
+ * Tests that adding instructions flushes the earlier lookups.
+ */
+void
+InstructionLookupTableTest::testModificationFlushes() {
+    InstructionMemory memory(0);
+    ExecutableInstruction* first = new ExecutableInstruction();
+    memory.addExecutableInstruction(0, first);
+    memory.addExecutableInstruction(8, new ExecutableInstruction());
+
+    InstructionLookupTable table(memory, 100);
+    TS_ASSERT(table.lookup(16).instruction == NULL);
+    TS_ASSERT(table.lookup(16).implicitInstructions == NULL);
+
+    const unsigned int count = memory.modificationCount();
+    ExecutableInstruction* added = new ExecutableInstruction();
+    memory.addExecutableInstruction(16, added);
+    TS_ASSERT_DIFFERS(memory.modificationCount(), count);
+    TS_ASSERT_EQUALS(table.lookup(16).instruction, added);
+
+    ExecutableInstruction* implicit = new ExecutableInstruction();
+    memory.addImplicitExecutableInstruction(16, implicit);
+    TS_ASSERT(table.lookup(16).implicitInstructions != NULL);
+
+    // an instruction between the earlier ones halves the address step
+    ExecutableInstruction* between = new ExecutableInstruction();
+    memory.addExecutableInstruction(12, between);
+    TS_ASSERT_EQUALS(memory.addressStep(), 4u);
+    TS_ASSERT_EQUALS(table.lookup(12).instruction, between);
+    TS_ASSERT_EQUALS(table.lookup(16).instruction, added);
+    TS_ASSERT_EQUALS(table.lookup(0).instruction, first);
+}
+
+#endif
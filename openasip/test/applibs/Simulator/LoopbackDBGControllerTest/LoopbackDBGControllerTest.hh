@@ -0,0 +1,162 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file LoopbackDBGControllerTest.hh
+ *
+ * A test suite for the block memory transfers of LoopbackDBGController.
+ *
+ * @note rating: red
+ */
+
+#ifndef LOOPBACK_DBG_CONTROLLER_TEST_HH
+#define LOOPBACK_DBG_CONTROLLER_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+#include <vector>
+
+#include "SimulatorFrontend.hh"
+#include "MemorySystem.hh"
+#include "Memory.hh"
+#include "Exception.hh"
+
+/// A machine with an 8-bit data address space 0..512.
+const std::string LOOPBACK_MACHINE = 
+    "../../../base/program/ProgramWriterTest/data/worm.adf";
+
+/// A program for the machine.
+const std::string LOOPBACK_PROGRAM = 
+    "../../../base/program/ProgramWriterTest/data/worm.tpef";
+
+/// The data address space of the machine.
+const std::string LOOPBACK_DATA_SPACE = "datamemory";
+
+/**
+ * Class for testing LoopbackDBGController.
+ *
+ * The memories of the loopback backend are RemoteMemory proxies, thus the
+ * accesses go through the controller to its emulated physical memories.
+ */
+class LoopbackDBGControllerTest : public CxxTest::TestSuite {
+public:
+    LoopbackDBGControllerTest();
+
+    void setUp();
+    void tearDown();
+
+    void testBlockRoundTrip();
+    void testBlockRangeCheck();
+
+private:
+    Memory& dataMemory();
+
+    SimulatorFrontend frontend_;
+};
+
+/**
+ * Constructor.
+ */
+LoopbackDBGControllerTest::LoopbackDBGControllerTest() :
+    frontend_(SimulatorFrontend::SIM_LOOPBACK) {
+}
+
+/**
+ * Called before each test.
+ */
+void
+LoopbackDBGControllerTest::setUp() {
+    frontend_.loadMachine(LOOPBACK_MACHINE);
+    frontend_.loadProgram(LOOPBACK_PROGRAM);
+}
+
+/**
+ * Called after each test.
+ */
+void
+LoopbackDBGControllerTest::tearDown() {
+}
+
+/**
+ * Returns the remote memory of the data address space.
+ */
+Memory&
+LoopbackDBGControllerTest::dataMemory() {
+    return *frontend_.memorySystem().memory(LOOPBACK_DATA_SPACE);
+}
+
+/**
+ * Tests that block writes and reads round-trip and agree with the
+ * single MAU accesses.
+ */
+void
+LoopbackDBGControllerTest::testBlockRoundTrip() {
+
+    Memory& memory = dataMemory();
+    const ULongWord address = 17;
+    const ULongWord count = 100;
+
+    std::vector<Memory::MAU> written(count);
+    for (ULongWord i = 0; i < count; ++i) {
+        written[i] = (i * 3 + 1) & 0xff;
+    }
+    memory.writeBlock(address, written.data(), count);
+
+    std::vector<Memory::MAU> read(count, 0);
+    memory.readBlock(address, read.data(), count);
+    for (ULongWord i = 0; i < count; ++i) {
+        TS_ASSERT_EQUALS(read[i], written[i]);
+        TS_ASSERT_EQUALS(memory.read(address + i), written[i]);
+    }
+
+    // a single MAU write is seen by a block read that spans it
+    memory.write(address + 10, Memory::MAU(0xab));
+    memory.readBlock(address + 5, read.data(), 10);
+    TS_ASSERT_EQUALS(read[4], written[9]);
+    TS_ASSERT_EQUALS(read[5], Memory::MAU(0xab));
+    TS_ASSERT_EQUALS(read[6], written[11]);
+
+    // a block that ends at the last address of the space
+    const ULongWord last = memory.end();
+    memory.writeBlock(last - 3, written.data(), 4);
+    memory.readBlock(last - 3, read.data(), 4);
+    for (ULongWord i = 0; i < 4; ++i) {
+        TS_ASSERT_EQUALS(read[i], written[i]);
+    }
+}
+
+/**
+ * Tests that blocks not fitting in the address space are rejected.
+ */
+void
+LoopbackDBGControllerTest::testBlockRangeCheck() {
+
+    Memory& memory = dataMemory();
+    std::vector<Memory::MAU> buffer(16, 0);
+
+    TS_ASSERT_THROWS(
+        memory.readBlock(memory.end() - 3, buffer.data(), 5), OutOfRange);
+    TS_ASSERT_THROWS(
+        memory.writeBlock(memory.end() + 1, buffer.data(), 1), OutOfRange);
+    // counts that do not fit in 32 bits must not wrap around in the check
+    TS_ASSERT_THROWS(
+        memory.readBlock(0, buffer.data(), 0x100000001ULL), OutOfRange);
+    TS_ASSERT_THROWS(
+        memory.writeBlock(0, buffer.data(), 0x100000000ULL), OutOfRange);
+}
+
+#endif
@@ -0,0 +1,242 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file UtilizationStatsTest.hh
+ *
+ * A test suite for the partial calculation of UtilizationStats.
+ *
+ * @note rating: red
+ */
+
+#ifndef UTILIZATION_STATS_TEST_HH
+#define UTILIZATION_STATS_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "SimulatorFrontend.hh"
+#include "UtilizationStats.hh"
+#include "ExecutableInstruction.hh"
+#include "Program.hh"
+#include "Instruction.hh"
+#include "NullInstruction.hh"
+#include "Machine.hh"
+#include "Bus.hh"
+#include "Socket.hh"
+#include "FunctionUnit.hh"
+#include "HWOperation.hh"
+#include "RegisterFile.hh"
+#include "StringTools.hh"
+
+/// The machine of the simulated program.
+const std::string UTILIZATION_MACHINE =
+    "../../../base/program/ProgramWriterTest/data/worm.adf";
+
+/// The simulated program.
+const std::string UTILIZATION_PROGRAM =
+    "../../../base/program/ProgramWriterTest/data/worm.tpef";
+
+/**
+ * Class for testing that UtilizationStats gives the same results when the
+ * executed instructions are split to ranges whose partial results are
+ * merged, as SimulationStatistics does when it uses several threads.
+ */
+class UtilizationStatsTest : public CxxTest::TestSuite {
+public:
+    UtilizationStatsTest();
+
+    void setUp();
+    void tearDown();
+
+    void testMergedPartialsMatchSequential();
+
+private:
+    /// Executed instructions and their execution counts.
+    typedef std::vector<
+        std::pair<const TTAProgram::Instruction*,
+                  const ExecutableInstruction*> > InstructionList;
+
+    void calculate(
+        UtilizationStats& stats, std::size_t begin, std::size_t end);
+    void assertEqualStats(
+        const UtilizationStats& expected, const UtilizationStats& actual);
+
+    SimulatorFrontend frontend_;
+    InstructionList instructions_;
+};
+
+/**
+ * Constructor.
+ */
+UtilizationStatsTest::UtilizationStatsTest() :
+    frontend_(SimulatorFrontend::SIM_NORMAL) {
+}
+
+/**
+ * Simulates a while and collects the instructions of the program.
+ */
+void
+UtilizationStatsTest::setUp() {
+    frontend_.loadMachine(UTILIZATION_MACHINE);
+    frontend_.loadProgram(UTILIZATION_PROGRAM);
+    frontend_.step(5000);
+
+    instructions_.clear();
+    const TTAProgram::Program& program = frontend_.program();
+    const TTAProgram::Instruction* instruction =
+        &program.firstInstruction();
+    while (instruction != &TTAProgram::NullInstruction::instance()) {
+        instructions_.push_back(
+            std::make_pair(
+                instruction,
+                &frontend_.executableInstructionAt(
+                    instruction->address().location())));
+        instruction = &program.nextInstruction(*instruction);
+    }
+}
+
+/**
+ * Called after each test.
+ */
+void
+UtilizationStatsTest::tearDown() {
+}
+
+/**
+ * Tests that merging the partial results of any split of the instructions
+ * gives the results of the sequential calculation.
+ *
+ * The partial calculators are created before the calculator they are
+ * merged to has seen any instruction, like in SimulationStatistics, and
+ * after it, so that both the new and the shared component indices are
+ * covered.
+ */
+void
+UtilizationStatsTest::testMergedPartialsMatchSequential() {
+
+    TS_ASSERT(instructions_.size() > 3);
+
+    UtilizationStats sequential;
+    calculate(sequential, 0, instructions_.size());
+
+    const std::size_t splits[] = {
+        0, 1, instructions_.size() / 3, instructions_.size() / 2,
+        instructions_.size()};
+    for (std::size_t s = 0; s < sizeof(splits) / sizeof(splits[0]); ++s) {
+        const std::size_t split = splits[s];
+
+        UtilizationStats first;
+        SimulationStatisticsCalculator* early = first.createPartial();
+        TS_ASSERT(early != NULL);
+        calculate(first, 0, split);
+        calculate(dynamic_cast<UtilizationStats&>(*early), split,
+                  instructions_.size());
+        first.mergePartial(*early);
+        delete early;
+        assertEqualStats(sequential, first);
+
+        UtilizationStats second;
+        calculate(second, 0, split);
+        SimulationStatisticsCalculator* late = second.createPartial();
+        calculate(dynamic_cast<UtilizationStats&>(*late), split,
+                  instructions_.size());
+        second.mergePartial(*late);
+        delete late;
+        assertEqualStats(sequential, second);
+    }
+}
+
+/**
+ * Invokes the calculator for a range of the collected instructions.
+ */
+void
+UtilizationStatsTest::calculate(
+    UtilizationStats& stats, std::size_t begin, std::size_t end) {
+
+    for (std::size_t i = begin; i < end; ++i) {
+        stats.calculateForInstruction(
+            *instructions_[i].first, *instructions_[i].second);
+    }
+}
+
+/**
+ * Asserts that the counts of all the machine components are equal.
+ */
+void
+UtilizationStatsTest::assertEqualStats(
+    const UtilizationStats& expected, const UtilizationStats& actual) {
+
+    const TTAMachine::Machine& machine = frontend_.machine();
+
+    const TTAMachine::Machine::BusNavigator buses = machine.busNavigator();
+    for (int i = 0; i < buses.count(); ++i) {
+        const std::string name = buses.item(i)->name();
+        TS_ASSERT_EQUALS(expected.busWrites(name), actual.busWrites(name));
+    }
+
+    const TTAMachine::Machine::SocketNavigator sockets =
+        machine.socketNavigator();
+    for (int i = 0; i < sockets.count(); ++i) {
+        const std::string name = sockets.item(i)->name();
+        TS_ASSERT_EQUALS(
+            expected.socketWrites(name), actual.socketWrites(name));
+    }
+
+    const TTAMachine::Machine::FunctionUnitNavigator fus =
+        machine.functionUnitNavigator();
+    for (int i = 0; i < fus.count(); ++i) {
+        const TTAMachine::FunctionUnit& fu = *fus.item(i);
+        TS_ASSERT_EQUALS(
+            expected.triggerCount(fu.name()), actual.triggerCount(fu.name()));
+        for (int op = 0; op < fu.operationCount(); ++op) {
+            const std::string operation =
+                StringTools::stringToUpper(fu.operation(op)->name());
+            TS_ASSERT_EQUALS(
+                expected.operationExecutions(fu.name(), operation),
+                actual.operationExecutions(fu.name(), operation));
+            TS_ASSERT_EQUALS(
+                expected.operationExecutions(operation),
+                actual.operationExecutions(operation));
+        }
+    }
+
+    const TTAMachine::Machine::RegisterFileNavigator rfs =
+        machine.registerFileNavigator();
+    for (int i = 0; i < rfs.count(); ++i) {
+        const TTAMachine::RegisterFile& rf = *rfs.item(i);
+        for (int reg = 0; reg < rf.size(); ++reg) {
+            TS_ASSERT_EQUALS(
+                expected.registerReads(rf.name(), reg),
+                actual.registerReads(rf.name(), reg));
+            TS_ASSERT_EQUALS(
+                expected.registerWrites(rf.name(), reg),
+                actual.registerWrites(rf.name(), reg));
+            TS_ASSERT_EQUALS(
+                expected.guardRegisterReads(rf.name(), reg),
+                actual.guardRegisterReads(rf.name(), reg));
+        }
+    }
+
+    TS_ASSERT_EQUALS(
+        expected.highestUsedRegisterIndex(),
+        actual.highestUsedRegisterIndex());
+}
+
+#endif
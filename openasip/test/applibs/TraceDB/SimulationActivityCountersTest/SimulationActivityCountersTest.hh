@@ -0,0 +1,170 @@
+/*
+    This file is part of TTA-Based Codesign Environment (TCE).
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+    all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file SimulationActivityCountersTest.hh
+ *
+ * A test suite for SimulationActivityCounters.
+ *
+ * @note rating: red
+ */
+
+#ifndef TTA_SIMULATION_ACTIVITY_COUNTERS_TEST_HH
+#define TTA_SIMULATION_ACTIVITY_COUNTERS_TEST_HH
+
+#include <TestSuite.h>
+
+#include "SimulationActivityCounters.hh"
+#include "Machine.hh"
+#include "Bus.hh"
+#include "Socket.hh"
+#include "FunctionUnit.hh"
+#include "RegisterFile.hh"
+
+/**
+ * Tests the in-memory activity counters.
+ */
+class SimulationActivityCountersTest : public CxxTest::TestSuite {
+public:
+    void testWriteCounts();
+    void testOperationTriggerCounts();
+    void testRegisterFileAccessCounts();
+    void testQueryWithMachineCopy();
+};
+
+/**
+ * Tests that bus and socket write counts are kept per component.
+ */
+void
+SimulationActivityCountersTest::testWriteCounts() {
+    TTAMachine::Bus bus1("B1", 32, 32, TTAMachine::Machine::ZERO);
+    TTAMachine::Bus bus2("B2", 32, 32, TTAMachine::Machine::ZERO);
+    TTAMachine::Socket socket("S1");
+
+    SimulationActivityCounters counters;
+    counters.setSimulatedCycleCount(100);
+    counters.addBusWriteCount(bus1, 10);
+    counters.addBusWriteCount(bus1, 5);
+    counters.addSocketWriteCount(socket, 7);
+
+    TS_ASSERT_EQUALS(counters.simulatedCycleCount(), 100u);
+    TS_ASSERT_EQUALS(counters.busWriteCount(bus1), 15u);
+    TS_ASSERT_EQUALS(counters.busWriteCount(bus2), 0u);
+    TS_ASSERT_EQUALS(counters.socketWriteCount(socket), 7u);
+
+    const ActivityCounters& activity = counters;
+    TS_ASSERT_EQUALS(activity.busWriteCount(bus1), 15u);
+}
+
+/**
+ * Tests that operation trigger counts are returned per function unit.
+ */
+void
+SimulationActivityCountersTest::testOperationTriggerCounts() {
+    TTAMachine::FunctionUnit alu("ALU");
+    TTAMachine::FunctionUnit lsu("LSU");
+
+    SimulationActivityCounters counters;
+    counters.addFunctionUnitOperationTriggerCount(alu, "ADD", 3);
+    counters.addFunctionUnitOperationTriggerCount(alu, "SUB", 4);
+
+    ActivityCounters::FUOperationTriggerCountList* triggers =
+        counters.functionUnitOperationTriggerCounts(alu);
+    TS_ASSERT_EQUALS(triggers->size(), 2u);
+    TS_ASSERT_EQUALS(triggers->front().get<0>(), "ADD");
+    TS_ASSERT_EQUALS(triggers->front().get<1>(), 3u);
+    TS_ASSERT_EQUALS(triggers->back().get<0>(), "SUB");
+    TS_ASSERT_EQUALS(triggers->back().get<1>(), 4u);
+    delete triggers;
+    triggers = NULL;
+
+    triggers = counters.functionUnitOperationTriggerCounts(lsu);
+    TS_ASSERT(triggers->empty());
+    delete triggers;
+    triggers = NULL;
+}
+
+/**
+ * Tests that concurrent register file accesses are returned per register
+ * file.
+ */
+void
+SimulationActivityCountersTest::testRegisterFileAccessCounts() {
+    TTAMachine::RegisterFile rf(
+        "RF", 32, 32, 2, 1, 0, TTAMachine::RegisterFile::NORMAL);
+
+    SimulationActivityCounters counters;
+    counters.addConcurrentRegisterFileAccessCount(rf, 2, 1, 20);
+
+    ActivityCounters::ConcurrentRFAccessCountList* accesses =
+        counters.registerFileAccessCounts(rf);
+    TS_ASSERT_EQUALS(accesses->size(), 1u);
+    TS_ASSERT_EQUALS(accesses->front().get<0>(), 2u);
+    TS_ASSERT_EQUALS(accesses->front().get<1>(), 1u);
+    TS_ASSERT_EQUALS(accesses->front().get<2>(), 20u);
+    delete accesses;
+    accesses = NULL;
+}
+
+/**
+ * Tests that the counts are found with the components of another copy of
+ * the machine, as the estimator queries them with the machine it loaded.
+ */
+void
+SimulationActivityCountersTest::testQueryWithMachineCopy() {
+    TTAMachine::Bus simulatedBus("B1", 32, 32, TTAMachine::Machine::ZERO);
+    TTAMachine::Socket simulatedSocket("S1");
+    TTAMachine::FunctionUnit simulatedFU("ALU");
+    TTAMachine::RegisterFile simulatedRF(
+        "RF", 32, 32, 2, 1, 0, TTAMachine::RegisterFile::NORMAL);
+
+    SimulationActivityCounters counters;
+    counters.addBusWriteCount(simulatedBus, 11);
+    counters.addSocketWriteCount(simulatedSocket, 12);
+    counters.addFunctionUnitOperationTriggerCount(simulatedFU, "ADD", 13);
+    counters.addConcurrentRegisterFileAccessCount(simulatedRF, 1, 1, 14);
+
+    TTAMachine::Bus bus("B1", 32, 32, TTAMachine::Machine::ZERO);
+    TTAMachine::Socket socket("S1");
+    TTAMachine::FunctionUnit fu("ALU");
+    TTAMachine::RegisterFile rf(
+        "RF", 32, 32, 2, 1, 0, TTAMachine::RegisterFile::NORMAL);
+
+    TS_ASSERT_EQUALS(counters.busWriteCount(bus), 11u);
+    TS_ASSERT_EQUALS(counters.socketWriteCount(socket), 12u);
+
+    ActivityCounters::FUOperationTriggerCountList* triggers =
+        counters.functionUnitOperationTriggerCounts(fu);
+    TS_ASSERT_EQUALS(triggers->size(), 1u);
+    TS_ASSERT_EQUALS(triggers->front().get<1>(), 13u);
+    delete triggers;
+    triggers = NULL;
+
+    ActivityCounters::ConcurrentRFAccessCountList* accesses =
+        counters.registerFileAccessCounts(rf);
+    TS_ASSERT_EQUALS(accesses->size(), 1u);
+    TS_ASSERT_EQUALS(accesses->front().get<2>(), 14u);
+    delete accesses;
+    accesses = NULL;
+}
+
+#endif
@@ -69,6 +69,7 @@ public:
                                double energyActive, double energyIdle);
     void testExactMatchTest();
     void testRFExactMatchTest();
+    void testSearchAfterInsert();
     
 private:
     CostDatabaseRegistry* costDatabaseRegistry_;
@@ -379,4 +380,67 @@ void CostDBExactMatchTest::testRFExactMatchTest() {
 }
 
 
+/**
+ * Test that entries inserted after a search are found by the later searches
+ * and that an entry with an equal key is merged into the existing one.
+ */
+void CostDBExactMatchTest::testSearchAfterInsert() {
+
+    CostDBEntry* bus1 = createBusEntry(1001, 1, 1, 1.0, 1.0, 1.0, 1.0);
+    createBusEntry(1001, 2, 2, 2.0, 2.0, 2.0, 2.0);
+
+    EntryKeyProperty* searchKeyProperty =
+        EntryKeyProperty::create(CostDBTypes::EK_MBUS);
+    searchKeyProperty->createFieldProperty(CostDBTypes::EKF_BUS_FANIN);
+
+    CostDBEntryKey* searchKey = new CostDBEntryKey(searchKeyProperty);
+    searchKey->addField(
+        new EntryKeyField(
+            new EntryKeyDataInt(1001),
+            searchKeyProperty->fieldProperty(CostDBTypes::EKF_BIT_WIDTH)));
+    searchKey->addField(
+        new EntryKeyField(
+            new EntryKeyDataInt(1),
+            searchKeyProperty->fieldProperty(CostDBTypes::EKF_BUS_FANIN)));
+
+    CostDBTypes::MatchTypeTable match;
+    match.push_back(
+        new MatchType(searchKeyProperty->
+                      fieldProperty(CostDBTypes::EKF_BIT_WIDTH),
+                      CostDBTypes::MATCH_EXACT));
+
+    CostDBTypes::EntryTable results = costDB_->search(*searchKey, match);
+    TS_ASSERT_EQUALS(results.size(), 2u);
+    delete searchKey;
+    searchKey = 0;
+
+    // the new entry must invalidate the index built by the first search,
+    // a different search key is used to bypass the query cache
+    createBusEntry(1001, 3, 3, 3.0, 3.0, 3.0, 3.0);
+    searchKey = new CostDBEntryKey(searchKeyProperty);
+    searchKey->addField(
+        new EntryKeyField(
+            new EntryKeyDataInt(1001),
+            searchKeyProperty->fieldProperty(CostDBTypes::EKF_BIT_WIDTH)));
+    searchKey->addField(
+        new EntryKeyField(
+            new EntryKeyDataInt(3),
+            searchKeyProperty->fieldProperty(CostDBTypes::EKF_BUS_FANIN)));
+    results = costDB_->search(*searchKey, match);
+    TS_ASSERT_EQUALS(results.size(), 3u);
+    delete searchKey;
+    searchKey = 0;
+
+    // statistics of an equal key are added into the existing entry
+    CostDBEntry* duplicate =
+        createBusEntry(1001, 1, 1, 4.0, 4.0, 4.0, 4.0);
+    delete duplicate;
+    duplicate = 0;
+    TS_ASSERT_EQUALS(bus1->statisticsCount(), 2);
+
+    delete match.at(0);
+    match.at(0) = 0;
+}
+
+
 #endif
@@ -42,11 +42,18 @@
 #include "IDFSerializer.hh"
 #include "ADFSerializer.hh"
 #include "Machine.hh"
+#include "SQLite.hh"
+#include "RelationalDBConnection.hh"
+#include "RelationalDBQueryResult.hh"
+#include "DataObject.hh"
+#include "Conversion.hh"
 
 using std::string;
 
 static const std::string DSDB_TEST_FILE_1 = "dsdb1.ddb";
 static const std::string DSDB_TEST_FILE_2 = "dsdb2.ddb";
+static const std::string DSDB_TEST_FILE_3 = "dsdb3.ddb";
+static const std::string DSDB_TEST_FILE_4 = "dsdb4.ddb";
 
 /**
  * Class that tests DSDBManager class.
@@ -58,6 +65,11 @@ public:
 
     void testCreatingDSDB();
     void testDSDB();
+    void testArchitectureCache();
+    void testBinaryArchitectures();
+
+private:
+    std::string binaryADFOf(const std::string& file, RowID id);
 };
 
 
@@ -263,4 +275,149 @@ DSDBManagerTest::testDSDB() {
     TS_ASSERT(FileSystem::fileExists(DSDB_TEST_FILE_1));
 }
 
+/**
+ * Tests that architectures handed out by the manager are independent
+ * of its in-memory architecture cache.
+ */
+void
+DSDBManagerTest::testArchitectureCache() {
+
+    FileSystem::removeFileOrDirectory(DSDB_TEST_FILE_3);
+    DSDBManager* manager = NULL;
+    TS_ASSERT_THROWS_NOTHING(
+        manager = DSDBManager::createNew(DSDB_TEST_FILE_3));
+
+    ADFSerializer adfSerializer;
+    adfSerializer.setSourceFile("data/test.adf");
+    TTAMachine::Machine* mach = adfSerializer.readMachine();
+    RowID archID = manager->addArchitecture(*mach);
+    TS_ASSERT_EQUALS(manager->addArchitecture(*mach), archID);
+    TS_ASSERT_EQUALS(manager->architectureId(*mach), archID);
+
+    std::shared_ptr<const TTAMachine::Machine> shared =
+        manager->sharedArchitecture(archID);
+    TS_ASSERT_EQUALS(shared->hash(), mach->hash());
+    TS_ASSERT_EQUALS(manager->sharedArchitecture(archID), shared);
+
+    // modifying a returned copy must not change the stored architecture
+    TTAMachine::Machine* copy = manager->architecture(archID);
+    int fuCount = copy->functionUnitNavigator().count();
+    delete copy->functionUnitNavigator().item(0);
+    TS_ASSERT_EQUALS(shared->functionUnitNavigator().count(), fuCount);
+    TTAMachine::Machine* copy2 = manager->architecture(archID);
+    TS_ASSERT_EQUALS(copy2->hash(), mach->hash());
+
+    // a modified machine is stored as a new architecture
+    RowID copyID = manager->addArchitecture(*copy);
+    TS_ASSERT_DIFFERS(copyID, archID);
+    TS_ASSERT_EQUALS(
+        manager->sharedArchitecture(copyID)->hash(), copy->hash());
+
+    delete copy;
+    delete copy2;
+    delete mach;
+
+    // a fresh manager has to parse the same architectures from the file
+    delete manager;
+    manager = new DSDBManager(DSDB_TEST_FILE_3);
+    TS_ASSERT_EQUALS(
+        manager->sharedArchitecture(archID)->functionUnitNavigator().count(),
+        fuCount);
+    delete manager;
+}
+
+/**
+ * Returns the binary ADF column of the given architecture.
+ *
+ * @param file The DSDB file.
+ * @param id RowID of the architecture.
+ * @return The column value, "NULL" if the column is null.
+ */
+std::string
+DSDBManagerTest::binaryADFOf(const std::string& file, RowID id) {
+    SQLite db;
+    RelationalDBConnection& connection = db.connect(file);
+    RelationalDBQueryResult* result = connection.query(
+        "SELECT adf_binary FROM architecture WHERE id=" +
+        Conversion::toString(id) + ";");
+    std::string value = "";
+    if (result->hasNext()) {
+        result->next();
+        value = result->data(0).isNull() ?
+            "NULL" : result->data(0).stringValue();
+    }
+    delete result;
+    db.close(connection);
+    return value;
+}
+
+/**
+ * Tests storing the architectures as binary ADFs and falling back to
+ * the XML for databases created before the binary ADF column existed.
+ */
+void
+DSDBManagerTest::testBinaryArchitectures() {
+
+    FileSystem::removeFileOrDirectory(DSDB_TEST_FILE_4);
+
+    ADFSerializer adfSerializer;
+    adfSerializer.setSourceFile("data/test.adf");
+    TTAMachine::Machine* mach = adfSerializer.readMachine();
+    std::string adf = "";
+    ADFSerializer writer;
+    writer.setDestinationString(adf);
+    writer.writeMachine(*mach);
+
+    // a version 0 database with an architecture stored only as XML
+    SQLite db;
+    RelationalDBConnection& connection = db.connect(DSDB_TEST_FILE_4);
+    connection.DDLQuery(
+        "CREATE TABLE architecture ("
+        "       id INTEGER PRIMARY KEY,"
+        "       connection_count INTEGER DEFAULT NULL, "
+        "       adf_hash VARCHAR,"
+        "       adf_xml VARCHAR)");
+    connection.updateQuery(
+        "INSERT INTO architecture(id, adf_hash, adf_xml) VALUES "
+        "(NULL, '" + mach->hash() + "', '" + adf + "');");
+    RowID oldID = connection.lastInsertRowID();
+    TS_ASSERT_EQUALS(connection.version(), 0);
+    db.close(connection);
+
+    DSDBManager* manager = new DSDBManager(DSDB_TEST_FILE_4);
+    TS_ASSERT_EQUALS(binaryADFOf(DSDB_TEST_FILE_4, oldID), "NULL");
+    TS_ASSERT_EQUALS(
+        manager->sharedArchitecture(oldID)->hash(), mach->hash());
+
+    // new architectures are stored in both formats
+    TTAMachine::Machine* modified = new TTAMachine::Machine(*mach);
+    delete modified->functionUnitNavigator().item(0);
+    RowID newID = manager->addArchitecture(*modified);
+    TS_ASSERT_DIFFERS(binaryADFOf(DSDB_TEST_FILE_4, newID), "NULL");
+    delete manager;
+
+    manager = new DSDBManager(DSDB_TEST_FILE_4);
+    TS_ASSERT_EQUALS(
+        manager->sharedArchitecture(newID)->hash(), modified->hash());
+    delete manager;
+
+    // a truncated binary ADF falls back to the XML
+    std::string truncated =
+        binaryADFOf(DSDB_TEST_FILE_4, newID).substr(0, 40);
+    RelationalDBConnection& updated = db.connect(DSDB_TEST_FILE_4);
+    TS_ASSERT_EQUALS(updated.version(), 1);
+    updated.updateQuery(
+        "UPDATE architecture SET adf_binary='" + truncated + "' WHERE id=" +
+        Conversion::toString(newID) + ";");
+    db.close(updated);
+
+    manager = new DSDBManager(DSDB_TEST_FILE_4);
+    TS_ASSERT_EQUALS(
+        manager->sharedArchitecture(newID)->hash(), modified->hash());
+    delete manager;
+
+    delete modified;
+    delete mach;
+}
+
 #endif
@@ -0,0 +1,121 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file MachineConnectivityMatrixTest.hh
+ *
+ * A test suite for MachineConnectivityMatrix.
+ *
+ * @note rating: red
+ */
+
+#ifndef MACHINE_CONNECTIVITY_MATRIX_TEST_HH
+#define MACHINE_CONNECTIVITY_MATRIX_TEST_HH
+
+#include <TestSuite.h>
+#include "MachineConnectivityMatrix.hh"
+#include "MachineConnectivityCheck.hh"
+#include "Machine.hh"
+#include "RegisterFile.hh"
+#include "FunctionUnit.hh"
+#include "FUPort.hh"
+#include "Socket.hh"
+#include "Bus.hh"
+#include "Segment.hh"
+
+class MachineConnectivityMatrixTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testConnections();
+    void testVersionInvalidation();
+};
+
+void
+MachineConnectivityMatrixTest::setUp() {
+}
+
+void
+MachineConnectivityMatrixTest::tearDown() {
+    MachineConnectivityMatrix::clearCache();
+}
+
+/**
+ * Tests the connectivity queries on a single bus machine.
+ */
+void
+MachineConnectivityMatrixTest::testConnections() {
+    TTAMachine::Machine* mach =
+        TTAMachine::Machine::loadFromADF("data/minimal.adf");
+    TTAMachine::RegisterFile* rf = mach->registerFileNavigator().item("RF");
+    TTAMachine::RegisterFile* boolRF =
+        mach->registerFileNavigator().item("bool");
+    TTAMachine::FunctionUnit* lsu = mach->functionUnitNavigator().item("lsu");
+
+    MachineConnectivityMatrix::Handle matrix =
+        MachineConnectivityMatrix::matrixFor(*mach);
+    TS_ASSERT_EQUALS(matrix->version(), mach->version());
+    TS_ASSERT(matrix->isConnected(*rf, *boolRF));
+    TS_ASSERT(matrix->isConnected(*rf, *lsu->port("in1t")));
+    TS_ASSERT(matrix->isConnected(*lsu->port("out1"), *rf));
+    TS_ASSERT(matrix->isConnected(*lsu->port("out1"), *lsu->port("in2")));
+    TS_ASSERT(!matrix->isConnected(*lsu->port("in2"), *lsu->port("in1t")));
+    TS_ASSERT_EQUALS(
+        matrix->sharedBuses(*lsu->port("out1"), *lsu->port("in1t")).size(),
+        1u);
+
+    // the same matrix is shared until the machine changes
+    TS_ASSERT_EQUALS(
+        MachineConnectivityMatrix::matrixFor(*mach).get(), matrix.get());
+
+    delete mach;
+}
+
+/**
+ * Tests that modifying the interconnection invalidates the matrix.
+ */
+void
+MachineConnectivityMatrixTest::testVersionInvalidation() {
+    TTAMachine::Machine* mach =
+        TTAMachine::Machine::loadFromADF("data/minimal.adf");
+    TTAMachine::RegisterFile* rf = mach->registerFileNavigator().item("RF");
+    TTAMachine::RegisterFile* boolRF =
+        mach->registerFileNavigator().item("bool");
+    TTAMachine::Bus* bus = mach->busNavigator().item("B1");
+    TTAMachine::Socket* rfOut = mach->socketNavigator().item("RF_o1");
+
+    TS_ASSERT(MachineConnectivityCheck::isConnected(*rf, *boolRF));
+    unsigned long long oldVersion = mach->version();
+
+    rfOut->detachBus(*bus);
+    TS_ASSERT_DIFFERS(mach->version(), oldVersion);
+
+    MachineConnectivityMatrix::Handle matrix =
+        MachineConnectivityMatrix::matrixFor(*mach);
+    TS_ASSERT_EQUALS(matrix->version(), mach->version());
+    TS_ASSERT(!matrix->isConnected(*rf, *boolRF));
+    TS_ASSERT(!MachineConnectivityCheck::isConnected(*rf, *boolRF));
+
+    // a copy of the machine is a different version
+    TTAMachine::Machine copy(*mach);
+    TS_ASSERT_DIFFERS(copy.version(), mach->version());
+
+    delete mach;
+}
+
+#endif
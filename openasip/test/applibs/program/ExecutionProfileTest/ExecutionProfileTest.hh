@@ -0,0 +1,182 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file ExecutionProfileTest.hh
+ *
+ * A test suite for ExecutionProfile.
+ *
+ * @note rating: red
+ */
+
+#ifndef EXECUTION_PROFILE_TEST_HH
+#define EXECUTION_PROFILE_TEST_HH
+
+#include <TestSuite.h>
+#include <string>
+#include <fstream>
+#include <cstdio>
+
+#include "ExecutionProfile.hh"
+#include "Exception.hh"
+
+/// The profile file written by the tests.
+const std::string PROFILE_FILE = "profile.tmp";
+
+/**
+ * Class for testing reading and writing the execution profiles.
+ */
+class ExecutionProfileTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testCounts();
+    void testWriteAndRead();
+    void testReadMergesCounts();
+    void testInvalidEntries();
+
+private:
+    void writeProfile(const std::string& contents);
+};
+
+/**
+ * Called before each test.
+ */
+void
+ExecutionProfileTest::setUp() {
+}
+
+/**
+ * Removes the profile file.
+ */
+void
+ExecutionProfileTest::tearDown() {
+    std::remove(PROFILE_FILE.c_str());
+}
+
+/**
+ * Tests that the highest count is kept and the hot thresholds.
+ */
+void
+ExecutionProfileTest::testCounts() {
+    ExecutionProfile profile;
+    TS_ASSERT(profile.isEmpty());
+    TS_ASSERT(!profile.isHot(0));
+
+    profile.addProcedureCount("main", 10);
+    profile.addProcedureCount("main", 5);
+    profile.addSourceLineCount("main.c", 12, 1000);
+    TS_ASSERT(!profile.isEmpty());
+    TS_ASSERT_EQUALS(profile.procedureCount("main"), CycleCount(10));
+    TS_ASSERT_EQUALS(profile.procedureCount("other"), CycleCount(0));
+    TS_ASSERT_EQUALS(
+        profile.sourceLineCount("main.c", 12), CycleCount(1000));
+    TS_ASSERT_EQUALS(profile.sourceLineCount("main.c", 13), CycleCount(0));
+    TS_ASSERT_EQUALS(profile.maxCount(), CycleCount(1000));
+
+    // hot counts reach HOT_THRESHOLD of the highest count
+    TS_ASSERT(profile.isHot(10));
+    TS_ASSERT(!profile.isHot(9));
+    TS_ASSERT(!profile.isHot(0));
+
+    // a stricter threshold
+    TS_ASSERT(profile.isHot(250, 0.25));
+    TS_ASSERT(!profile.isHot(249, 0.25));
+    TS_ASSERT(!profile.isHot(10, 0.25));
+}
+
+/**
+ * Tests that a written profile reads back with the same counts.
+ */
+void
+ExecutionProfileTest::testWriteAndRead() {
+    ExecutionProfile written;
+    written.addProcedureCount("main", 42);
+    written.addProcedureCount("operator new", 7);
+    written.addSourceLineCount("src/main.c", 3, 40);
+    written.addSourceLineCount("dir with spaces/x.c", 8, 2);
+    // a move without a source file name
+    written.addSourceLineCount("", 5, 9);
+    written.writeToFile(PROFILE_FILE);
+
+    ExecutionProfile read;
+    read.readFromFile(PROFILE_FILE);
+    TS_ASSERT_EQUALS(read.procedureCount("main"), CycleCount(42));
+    TS_ASSERT_EQUALS(read.procedureCount("operator new"), CycleCount(7));
+    TS_ASSERT_EQUALS(read.sourceLineCount("src/main.c", 3), CycleCount(40));
+    TS_ASSERT_EQUALS(
+        read.sourceLineCount("dir with spaces/x.c", 8), CycleCount(2));
+    TS_ASSERT_EQUALS(read.sourceLineCount("", 5), CycleCount(9));
+    TS_ASSERT_EQUALS(read.maxCount(), written.maxCount());
+}
+
+/**
+ * Tests that comments are skipped and the counts of several entries are
+ * merged.
+ */
+void
+ExecutionProfileTest::testReadMergesCounts() {
+    writeProfile(
+        "# a comment\n"
+        "\n"
+        "procedure 5 main\n"
+        "procedure 8 main\n"
+        "  line 3 10 a.c  \n");
+
+    ExecutionProfile profile;
+    profile.addProcedureCount("main", 6);
+    profile.readFromFile(PROFILE_FILE);
+    TS_ASSERT_EQUALS(profile.procedureCount("main"), CycleCount(8));
+    TS_ASSERT_EQUALS(profile.sourceLineCount("a.c", 10), CycleCount(3));
+    TS_ASSERT_EQUALS(profile.maxCount(), CycleCount(8));
+}
+
+/**
+ * Tests that malformed entries and missing files are reported.
+ */
+void
+ExecutionProfileTest::testInvalidEntries() {
+    ExecutionProfile profile;
+    TS_ASSERT_THROWS(
+        profile.readFromFile("no/such/profile"), IOException);
+
+    const char* invalid[] = {
+        "procedure many main\n",
+        "procedure -1 main\n",
+        "procedure 5\n",
+        "line 5 x a.c\n",
+        "line 5\n",
+        "block 5 main\n"
+    };
+    for (unsigned int i = 0; i < sizeof(invalid) / sizeof(invalid[0]);
+         i++) {
+        writeProfile(invalid[i]);
+        TS_ASSERT_THROWS(profile.readFromFile(PROFILE_FILE), InvalidData);
+    }
+}
+
+/**
+ * Writes the given text to the profile file.
+ */
+void
+ExecutionProfileTest::writeProfile(const std::string& contents) {
+    std::ofstream output(PROFILE_FILE.c_str());
+    output << contents;
+}
+
+#endif
@@ -90,6 +90,8 @@ const int coreCount = 4;
 const string DIR_SEP = FileSystem::DIRECTORY_SEPARATOR;
 const string FILE_TO_WRITE = "." + DIR_SEP + "data" + DIR_SEP + 
 "written.mdf";
+const string BINARY_FILE_TO_WRITE = "." + DIR_SEP + "data" + DIR_SEP + 
+"written.badf";
 
 
 /**
@@ -102,6 +104,7 @@ public:
     
     void testWriteState();
     void testReadState();
+    void testBinaryFormat();
 
 private:
 };
@@ -446,4 +449,49 @@ ADFSerializerTest::testReadState() {
     delete serializer;
 }
 
+
+/**
+ * Tests writing and auto-detected reading of the binary ADF format.
+ */
+void
+ADFSerializerTest::testBinaryFormat() {
+
+    ADFSerializer xmlReader;
+    xmlReader.setSourceFile(FILE_TO_WRITE);
+    Machine* mach = NULL;
+    CATCH_ANY(mach = xmlReader.readMachine());
+
+    ADFSerializer binaryWriter;
+    binaryWriter.setBinaryOutput(true);
+    binaryWriter.setDestinationFile(BINARY_FILE_TO_WRITE);
+    TS_ASSERT_THROWS_NOTHING(binaryWriter.writeMachine(*mach));
+
+    std::string binary;
+    binaryWriter.setDestinationString(binary);
+    TS_ASSERT_THROWS_NOTHING(binaryWriter.writeMachine(*mach));
+
+    // the format is detected from the file contents
+    ADFSerializer binaryReader;
+    binaryReader.setSourceFile(BINARY_FILE_TO_WRITE);
+    Machine* fromFile = NULL;
+    CATCH_ANY(fromFile = binaryReader.readMachine());
+    TS_ASSERT_EQUALS(fromFile->hash(), mach->hash());
+    TS_ASSERT(fromFile->triggerInvalidatesResults());
+    TS_ASSERT(fromFile->busNavigator().item(bus1Name)->guardCount() == 3);
+
+    binaryReader.setSourceString(binary);
+    Machine* fromString = NULL;
+    CATCH_ANY(fromString = binaryReader.readMachine());
+    TS_ASSERT_EQUALS(fromString->hash(), mach->hash());
+
+    // truncated data must be rejected
+    std::string truncated = binary.substr(0, binary.size() / 2);
+    binaryReader.setSourceString(truncated);
+    TS_ASSERT_THROWS(binaryReader.readState(), SerializerException);
+
+    delete fromString;
+    delete fromFile;
+    delete mach;
+}
+
 #endif
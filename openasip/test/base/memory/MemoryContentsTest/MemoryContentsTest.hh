@@ -46,6 +46,7 @@ public:
     void tearDown();
 
     void testStressTest();
+    void testContentDigest();
 };
 
 /**
@@ -94,5 +95,55 @@ MemoryContentsTest::testStressTest() {
     TS_ASSERT_LESS_THAN(mem.allocatedMemory(), accessCount*MEM_CHUNK_SIZE);
 }
 
+/**
+ * Tests that the incrementally updated content digest detects differing
+ * contents and matches a digest computed from scratch.
+ */
+void
+MemoryContentsTest::testContentDigest() {
+
+    const size_t size = 16*MEM_CHUNK_SIZE;
+    MemoryContents mem1(size);
+    MemoryContents mem2(size);
+
+    // unallocated and zero filled pages do not differ
+    TS_ASSERT_EQUALS(mem1.contentDigest(), mem2.contentDigest());
+    mem2.writeData(3*MEM_CHUNK_SIZE + 5, 0);
+    TS_ASSERT_EQUALS(mem1.contentDigest(), mem2.contentDigest());
+
+    // the same contents written in a different order
+    for (size_t i = 0; i < 100; ++i) {
+        mem1.writeData(i*37 % size, i + 1);
+    }
+    for (size_t i = 100; i > 0; --i) {
+        mem2.writeData((i - 1)*37 % size, i);
+    }
+    TS_ASSERT_EQUALS(mem1.contentDigest(), mem2.contentDigest());
+
+    // a single differing value, then restoring it
+    mem2.writeData(11*MEM_CHUNK_SIZE + 1, 0xBEEF);
+    TS_ASSERT_DIFFERS(mem1.contentDigest(), mem2.contentDigest());
+    mem2.writeData(11*MEM_CHUNK_SIZE + 1, 0);
+    TS_ASSERT_EQUALS(mem1.contentDigest(), mem2.contentDigest());
+
+    // the same values at swapped addresses
+    mem1.writeData(1, 7);
+    mem1.writeData(2, 8);
+    mem2.writeData(1, 8);
+    mem2.writeData(2, 7);
+    TS_ASSERT_DIFFERS(mem1.contentDigest(), mem2.contentDigest());
+
+    // the incremental digest equals the one computed from scratch
+    MemoryContents copy(size);
+    for (size_t i = 0; i < size; ++i) {
+        copy.writeData(i, mem1.readData(i));
+    }
+    TS_ASSERT_EQUALS(mem1.contentDigest(), copy.contentDigest());
+
+    // clearing starts the digest from scratch
+    MemoryContents empty(size);
+    mem1.clear();
+    TS_ASSERT_EQUALS(mem1.contentDigest(), empty.contentDigest());
+}
 
 #endif
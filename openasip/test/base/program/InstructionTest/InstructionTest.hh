@@ -43,6 +43,7 @@
 #include "RFPort.hh"
 #include "Bus.hh"
 #include "POMDisassembler.hh"
+#include "POMAllocator.hh"
 
 using namespace TTAMachine;
 using namespace TTAProgram;
@@ -53,6 +54,7 @@ public:
     void tearDown();
 
     void testInstruction();
+    void testPooledAllocation();
 
 private:
 };
@@ -154,4 +156,29 @@ InstructionTest::testInstruction() {
     delete reg_file;
 }
 
+/**
+ * Tests that instructions and terminals are allocated from the POM pools.
+ */
+void
+InstructionTest::testPooledAllocation() {
+    // the counts below hold only if the objects fit in the pools
+    TS_ASSERT(sizeof(Instruction) <= POMAllocator::MAX_POOLED_SIZE);
+    TS_ASSERT(sizeof(TerminalImmediate) <= POMAllocator::MAX_POOLED_SIZE);
+
+    const std::size_t liveBefore = POMAllocator::liveObjectCount();
+
+    Instruction* ins = new Instruction();
+    TerminalImmediate* term = new TerminalImmediate(SimValue(5, 32));
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore + 2);
+
+    std::shared_ptr<Immediate> imm = std::allocate_shared<Immediate>(
+        POMPoolAllocator<Immediate>(), term,
+        new TerminalImmediate(SimValue(0, 32)));
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore + 4);
+
+    imm.reset();
+    delete ins;
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore);
+}
+
 #endif
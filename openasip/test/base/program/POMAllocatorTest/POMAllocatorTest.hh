@@ -0,0 +1,181 @@
+/*
+ Copyright (C) 2026 Tampere University.
+
+ This library is free software; you can redistribute it and/or
+ modify it under the terms of the GNU Lesser General Public
+ License as published by the Free Software Foundation; either
+ version 2.1 of the License, or (at your option) any later version.
+
+ This library is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ Lesser General Public License for more details.
+
+ You should have received a copy of the GNU Lesser General Public
+ License along with this library; if not, write to the Free Software
+ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301 USA
+ */
+/**
+ * @file POMAllocatorTest.hh
+ *
+ * A test suite for POMAllocator.
+ *
+ * @note rating: red
+ */
+
+#ifndef POM_ALLOCATOR_TEST_HH
+#define POM_ALLOCATOR_TEST_HH
+
+#include <TestSuite.h>
+#include <vector>
+#include <cstring>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+#include "POMAllocator.hh"
+
+using namespace TTAProgram;
+
+/**
+ * Class for testing POMAllocator.
+ */
+class POMAllocatorTest : public CxxTest::TestSuite {
+public:
+    void setUp();
+    void tearDown();
+
+    void testLiveObjectCount();
+    void testThreads();
+};
+
+namespace {
+
+/// A block allocated in the tests.
+struct TestBlock {
+    unsigned char* data;
+    std::size_t size;
+};
+
+/**
+ * Allocates blocks of varying sizes and fills each with its own pattern.
+ */
+void
+allocateBlocks(std::vector<TestBlock>& blocks, std::size_t count, int seed) {
+    for (std::size_t i = 0; i < count; ++i) {
+        TestBlock block;
+        block.size = 1 + (i * 37 + seed) % POMAllocator::MAX_POOLED_SIZE;
+        block.data = 
+            static_cast<unsigned char*>(POMAllocator::allocate(block.size));
+        std::memset(block.data, (i + seed) & 0xff, block.size);
+        blocks.push_back(block);
+    }
+}
+
+/**
+ * Checks the patterns of the blocks and frees them.
+ *
+ * @return The number of blocks whose contents were overwritten.
+ */
+std::size_t
+freeBlocks(std::vector<TestBlock>& blocks, int seed) {
+    std::size_t corrupted = 0;
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        const unsigned char pattern = (i + seed) & 0xff;
+        for (std::size_t b = 0; b < blocks[i].size; ++b) {
+            if (blocks[i].data[b] != pattern) {
+                ++corrupted;
+                break;
+            }
+        }
+        POMAllocator::deallocate(blocks[i].data, blocks[i].size);
+    }
+    blocks.clear();
+    return corrupted;
+}
+
+/**
+ * Allocates and frees blocks repeatedly in a thread.
+ */
+void
+churnBlocks(int seed, std::size_t* corrupted) {
+    std::vector<TestBlock> blocks;
+    for (int round = 0; round < 20; ++round) {
+        allocateBlocks(blocks, 2000, seed + round);
+        *corrupted += freeBlocks(blocks, seed + round);
+    }
+}
+
+}
+
+/**
+ * Called before each test.
+ */
+void
+POMAllocatorTest::setUp() {
+}
+
+/**
+ * Called after each test.
+ */
+void
+POMAllocatorTest::tearDown() {
+}
+
+/**
+ * Tests that the live count follows the pooled and unpooled allocations.
+ */
+void
+POMAllocatorTest::testLiveObjectCount() {
+    const std::size_t liveBefore = POMAllocator::liveObjectCount();
+
+    const std::size_t maxSize = POMAllocator::MAX_POOLED_SIZE;
+    void* small = POMAllocator::allocate(8);
+    void* large = POMAllocator::allocate(maxSize);
+    void* unpooled = POMAllocator::allocate(maxSize + 1);
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore + 2);
+
+    POMAllocator::deallocate(small, 8);
+    POMAllocator::deallocate(large, maxSize);
+    POMAllocator::deallocate(unpooled, maxSize + 1);
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore);
+
+    // enough objects to purge the pool once they are all freed
+    std::vector<TestBlock> blocks;
+    allocateBlocks(blocks, 20000, 0);
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore + 20000);
+    TS_ASSERT_EQUALS(freeBlocks(blocks, 0), 0u);
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore);
+}
+
+/**
+ * Tests allocating in parallel threads and freeing objects in another
+ * thread than they were allocated in.
+ */
+void
+POMAllocatorTest::testThreads() {
+    const std::size_t liveBefore = POMAllocator::liveObjectCount();
+    const int threadCount = 4;
+
+    std::size_t corrupted[threadCount] = {0};
+    boost::thread_group threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.create_thread(
+            boost::bind(churnBlocks, i * 1000, &corrupted[i]));
+    }
+    threads.join_all();
+    for (int i = 0; i < threadCount; ++i) {
+        TS_ASSERT_EQUALS(corrupted[i], 0u);
+    }
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore);
+
+    // allocated in a thread that exits, freed here
+    std::vector<TestBlock> blocks;
+    boost::thread allocator(
+        boost::bind(allocateBlocks, boost::ref(blocks), 10000, 7));
+    allocator.join();
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore + 10000);
+    TS_ASSERT_EQUALS(freeBlocks(blocks, 7), 0u);
+    TS_ASSERT_EQUALS(POMAllocator::liveObjectCount(), liveBefore);
+}
+
+#endif
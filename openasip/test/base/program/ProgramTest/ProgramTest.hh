@@ -57,6 +57,7 @@ public:
     void testBasicFunctions();
     void testProcedureHandling();
     void testInstructionHandling();
+    void testAddressLookup();
 };
 
 
@@ -296,4 +297,62 @@ ProgramTest::testInstructionHandling() {
     TS_ASSERT_EQUALS(&prog1.nextInstruction(*ins3), ins7);
 }
 
+/**
+ * Tests finding procedures and instructions by address while the
+ * program is being modified.
+ */
+void
+ProgramTest::testAddressLookup() {
+
+    Machine dummy_mach;
+    AddressSpace as1("AS1", 32, 0, 99, dummy_mach);
+    Program prog1(as1);
+
+    Procedure* proc1 = new Procedure("proc1", as1, 0);
+    Procedure* empty = new Procedure("empty", as1, 0);
+    Procedure* proc2 = new Procedure("proc2", as1, 0);
+
+    prog1.addProcedure(proc1);
+    Instruction* ins1 = new Instruction;
+    Instruction* ins2 = new Instruction;
+    prog1.addInstruction(ins1);
+    prog1.addInstruction(ins2);
+    prog1.addProcedure(empty);
+    prog1.addProcedure(proc2);
+    Instruction* ins3 = new Instruction;
+    prog1.addInstruction(ins3);
+
+    TS_ASSERT_EQUALS(&prog1.procedureAt(0), proc1);
+    TS_ASSERT_EQUALS(&prog1.procedureAt(1), proc1);
+    TS_ASSERT_EQUALS(&prog1.procedureAt(2), proc2);
+    TS_ASSERT_EQUALS(&prog1.instructionAt(2), ins3);
+    TS_ASSERT_THROWS(prog1.procedureAt(3), KeyNotFound);
+
+    // growing the first procedure relocates the following ones
+    Instruction* ins4 = new Instruction;
+    proc1->insertAfter(*ins1, ins4);
+    TS_ASSERT_EQUALS(&prog1.instructionAt(1), ins4);
+    TS_ASSERT_EQUALS(&prog1.instructionAt(2), ins2);
+    TS_ASSERT_EQUALS(&prog1.procedureAt(3), proc2);
+    TS_ASSERT_EQUALS(&prog1.instructionAt(3), ins3);
+
+    // growing the last procedure
+    Instruction* ins5 = new Instruction;
+    proc2->add(ins5);
+    TS_ASSERT_EQUALS(&prog1.instructionAt(4), ins5);
+
+    proc1->remove(*ins4);
+    delete ins4;
+    TS_ASSERT_EQUALS(&prog1.instructionAt(2), ins3);
+    TS_ASSERT_EQUALS(&prog1.instructionAt(3), ins5);
+
+    prog1.removeProcedure(*proc1);
+    delete proc1;
+    // the following procedures move to the start of the removed one
+    TS_ASSERT_EQUALS(&prog1.procedureAt(0), proc2);
+    TS_ASSERT_EQUALS(&prog1.procedureAt(1), proc2);
+    TS_ASSERT_THROWS(prog1.procedureAt(2), KeyNotFound);
+    TS_ASSERT_EQUALS(&prog1.nextInstruction(*ins3), ins5);
+}
+
 #endif
@@ -40,6 +40,8 @@ using std::cout;
 using std::endl;
 #include <string>
 using std::string;
+#include <fstream>
+#include <vector>
 #include <TestSuite.h>
 #include "BaseType.hh"
 #include "BinaryStream.hh"
@@ -66,6 +68,7 @@ public:
     void testWritePos();
     void testSeekBeyondEof();
     void testFileSize();
+    void testMappedInput();
     
 private:
     /// Test binary stream.
@@ -532,4 +535,81 @@ BinaryStreamTest::testFileSize() {
     }
 } 
 
+
+/**
+ * Tests that reading a file through the memory mapping returns the same
+ * data as reading it with std::ifstream, and that writing to a stream
+ * that has been read so far switches to the file stream without losing
+ * the read position.
+ */
+inline void
+BinaryStreamTest::testMappedInput() {
+    writeTest_ = true;
+
+    std::ifstream reference(readTestFile_.c_str(), std::ios::binary);
+    std::vector<Byte> expected(
+        (std::istreambuf_iterator<char>(reference)),
+        std::istreambuf_iterator<char>());
+    TS_ASSERT_EQUALS(expected.size(), eofPos_);
+
+    try {
+        stream_ = new BinaryStream(readTestFile_, false);
+        TS_ASSERT_EQUALS(stream_->sizeOfFile(), eofPos_);
+
+        // mixed single and block reads over the whole file
+        std::vector<Byte> data(expected.size());
+        const unsigned int BLOCK_SIZE = 1000;
+        unsigned int pos = 0;
+        while (pos + BLOCK_SIZE + 1 <= expected.size()) {
+            data[pos++] = stream_->readByte();
+            stream_->readByteBlock(&data[pos], BLOCK_SIZE);
+            pos += BLOCK_SIZE;
+        }
+        while (pos < expected.size()) {
+            data[pos++] = stream_->readByte();
+        }
+        TS_ASSERT(data == expected);
+        TS_ASSERT(!stream_->endOfFile());
+        stream_->readByte();
+        TS_ASSERT(stream_->endOfFile());
+        TS_ASSERT_THROWS(stream_->readByte(), EndOfFile);
+
+        // words are assembled from the mapped bytes in big endian order
+        Word expectedWords[3];
+        for (unsigned int i = 0; i < 3; i++) {
+            expectedWords[i] =
+                (expected[4 * i] << 24) | (expected[4 * i + 1] << 16) |
+                (expected[4 * i + 2] << 8) | expected[4 * i + 3];
+        }
+        stream_->setReadPosition(4);
+        TS_ASSERT_EQUALS(stream_->readWord(), expectedWords[1]);
+        Word words[2];
+        stream_->setReadPosition(0);
+        stream_->readWordBlock(words, 2);
+        TS_ASSERT_EQUALS(words[0], expectedWords[0]);
+        TS_ASSERT_EQUALS(words[1], expectedWords[1]);
+        delete stream_;
+        stream_ = NULL;
+
+        // a copy of the file that is first read, then rewritten
+        std::ofstream copy(writeTestFile_.c_str(), std::ios::binary);
+        copy.write(
+            reinterpret_cast<const char*>(&expected[0]), expected.size());
+        copy.close();
+
+        stream_ = new BinaryStream(writeTestFile_, false);
+        stream_->setReadPosition(8);
+        TS_ASSERT_EQUALS(stream_->readWord(), expectedWords[2]);
+        stream_->writeWord(0x01020304);
+        TS_ASSERT_EQUALS(stream_->readPosition(), 12u);
+        stream_->setReadPosition(0);
+        TS_ASSERT_EQUALS(stream_->readWord(), 0x01020304u);
+    } catch (const Exception& error) {
+        TS_FAIL(error.fileName() + ":" +
+                Conversion::toString(error.lineNum()) + ":" +
+                error.procedureName() + ":" + "Error reading file: " +
+                error.errorMessage());
+    }
+}
+
 #endif
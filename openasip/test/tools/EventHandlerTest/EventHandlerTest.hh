@@ -52,6 +52,7 @@ public:
     void tearDown();
 
     void testRegisterListener();
+    void testHasListeners();
     
 private:
     /// The listener that is used in tests.
@@ -116,4 +117,35 @@ EventHandlerTest::testRegisterListener() {
     TS_ASSERT(checkRetval);
 }
 
+/**
+ * Tests the per-event listener flags.
+ */
+void
+EventHandlerTest::testHasListeners() {
+
+    Listener otherListener;
+    const int otherEvent = 3;
+
+    TS_ASSERT(!informer_->hasListeners(defaultEvent_));
+    TS_ASSERT(!informer_->hasListeners(otherEvent));
+
+    informer_->registerListener(defaultEvent_, listener_);
+    informer_->registerListener(defaultEvent_, listener_);
+    informer_->registerListener(defaultEvent_, &otherListener);
+    TS_ASSERT(informer_->hasListeners(defaultEvent_));
+    TS_ASSERT(!informer_->hasListeners(otherEvent));
+
+    // unregistering a listener that is not registered has no effect
+    informer_->unregisterListener(otherEvent, listener_);
+    TS_ASSERT(!informer_->hasListeners(otherEvent));
+
+    informer_->unregisterListener(defaultEvent_, listener_);
+    TS_ASSERT(informer_->hasListeners(defaultEvent_));
+    informer_->unregisterListener(defaultEvent_, &otherListener);
+    TS_ASSERT(!informer_->hasListeners(defaultEvent_));
+
+    // events without listeners are ignored
+    informer_->handleEvent(defaultEvent_);
+}
+
 #endif
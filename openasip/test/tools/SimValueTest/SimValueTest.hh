@@ -49,6 +49,7 @@ public:
     void testDivisions();
     void testProducts();
     void testEqualities();
+    void testLanes();
 
     void testMisc();
     
@@ -391,6 +392,83 @@ SimValueTest::testEqualities() {
     TS_ASSERT_EQUALS(res, 1);
 }
 
+/**
+ * Tests the bulk element accessors and the lane-wise operations.
+ */
+void
+SimValueTest::testLanes() {
+    SimValue lhs(512);
+    SimValue rhs(512);
+    SimValue result(512);
+
+    Byte bytes[64];
+    for (int i = 0; i < 64; ++i) {
+        bytes[i] = 100 + i;
+    }
+    lhs.setByteElements(bytes, 64);
+    TS_ASSERT_EQUALS(lhs.byteElement(63), 163);
+    for (int i = 0; i < 64; ++i) {
+        bytes[i] = 100;
+    }
+    rhs.setByteElements(bytes, 64);
+
+    SimValue::addLanes(lhs, rhs, 8, result);
+    TS_ASSERT_EQUALS(result.byteElement(0), 200);
+    TS_ASSERT_EQUALS(result.byteElement(63), 7);
+
+    SimValue::addSaturatedLanes(lhs, rhs, 8, false, result);
+    result.byteElements(bytes, 64);
+    TS_ASSERT_EQUALS(bytes[0], 200);
+    TS_ASSERT_EQUALS(bytes[63], 255);
+
+    SimValue::addSaturatedLanes(lhs, rhs, 8, true, result);
+    TS_ASSERT_EQUALS(result.byteElement(0), 127);
+
+    SimValue::subSaturatedLanes(rhs, lhs, 16, false, result);
+    TS_ASSERT_EQUALS(result.halfWordElement(0), 0);
+
+    SimValue::mulLanes(lhs, rhs, 16, result);
+    TS_ASSERT_EQUALS(
+        result.halfWordElement(1),
+        HalfWord(lhs.halfWordElement(1) * rhs.halfWordElement(1)));
+
+    SimValue::greaterLanes(lhs, rhs, 8, false, result);
+    TS_ASSERT_EQUALS(result.bitElement(0), 0u);
+    TS_ASSERT_EQUALS(result.bitElement(1), 1u);
+    result.clearToZero();
+    SimValue::equalLanes(lhs, lhs, 32, result);
+    TS_ASSERT_EQUALS(result.halfWordElement(0), 0xffff);
+    TS_ASSERT_EQUALS(result.bitElement(16), 0u);
+
+    SimValue first(128);
+    SimValue second(128);
+    SimValue indices(128);
+    Word words[4] = {10, 11, 12, 13};
+    first.setWordElements(words, 4);
+    words[0] = 20; words[1] = 21; words[2] = 22; words[3] = 23;
+    second.setWordElements(words, 4);
+    words[0] = 7; words[1] = 0; words[2] = 5; words[3] = 2;
+    indices.setWordElements(words, 4);
+    SimValue::shuffleLanes(first, second, indices, 32, first);
+    first.wordElements(words, 4);
+    TS_ASSERT_EQUALS(words[0], 23u);
+    TS_ASSERT_EQUALS(words[1], 10u);
+    TS_ASSERT_EQUALS(words[2], 21u);
+    TS_ASSERT_EQUALS(words[3], 12u);
+
+    // no lanes to pick when the vector is narrower than a lane
+    SimValue narrow(16);
+    SimValue::shuffleLanes(narrow, narrow, narrow, 32, first);
+    TS_ASSERT_EQUALS(first.wordElement(0), 23u);
+
+    FloatWord floats[4] = {1.5f, 2.0f, -3.0f, 4.0f};
+    first.setFloatElements(floats, 4);
+    SimValue::mulFloatLanes(first, first, second);
+    TS_ASSERT_EQUALS(second.floatElement(2), 9.0f);
+    SimValue::subFloatLanes(second, first, second);
+    TS_ASSERT_EQUALS(second.floatElement(0), 0.75f);
+}
+
 /**
  * Other tests.
  */
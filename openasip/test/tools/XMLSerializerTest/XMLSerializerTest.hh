@@ -47,6 +47,7 @@ public:
     void testReadState();
     void testWriteState();
     void testStringReadAndWrite();
+    void testStreamingRead();
 
 private:
     XMLSerializer* serializer_;
@@ -202,4 +203,47 @@ XMLSerializerTest::testStringReadAndWrite() {
     delete state;
     delete state2;
 }
+
+
+/**
+ * Tests that the streaming mode builds the same trees as the DOM mode.
+ */
+void
+XMLSerializerTest::testStreamingRead() {
+
+    serializer_->setSourceFile("./data/prode.conf");
+    serializer_->setUseSchema(true);
+    serializer_->setSchemaFile("./data/confschema.xsd");
+    ObjectState* domState = serializer_->readState();
+
+    serializer_->setStreaming(true);
+    ObjectState* saxState = NULL;
+    TS_ASSERT_THROWS_NOTHING(saxState = serializer_->readState());
+    TS_ASSERT(!(*saxState != *domState));
+
+    // the schema is still enforced
+    serializer_->setSourceFile("./data/prodeerr.conf");
+    TS_ASSERT_THROWS(serializer_->readState(), SerializerException);
+    serializer_->setSourceFile("./data/foobar");
+    TS_ASSERT_THROWS(serializer_->readState(), SerializerException);
+
+    // reading back a written string gives the same tree
+    std::string written;
+    serializer_->setDestinationString(written);
+    serializer_->writeState(domState);
+    serializer_->setUseSchema(false);
+    serializer_->setSourceString(written);
+    ObjectState* stringState = NULL;
+    TS_ASSERT_THROWS_NOTHING(stringState = serializer_->readState());
+    TS_ASSERT(!(*stringState != *domState));
+
+    std::string broken = "<testi><foo>true</bar></testi>";
+    serializer_->setSourceString(broken);
+    TS_ASSERT_THROWS(serializer_->readState(), SerializerException);
+
+    delete stringState;
+    delete saxState;
+    delete domState;
+}
+
 #endif
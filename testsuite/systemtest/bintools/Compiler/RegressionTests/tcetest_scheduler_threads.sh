@@ -0,0 +1,19 @@
+#!/bin/bash
+### TCE TESTCASE
+### title: The scheduled program does not depend on --scheduler-threads
+
+tcecc=../../../../../openasip/src/bintools/Compiler/tcecc
+mach=data/printf_machine_works.adf
+src=data/printf_broken.c
+single=$(mktemp tmpXXXXXX)
+parallel=$(mktemp tmpXXXXXX)
+
+# printf pulls in enough library functions for the threads to schedule
+# several procedures at the same time.
+$tcecc $src -O3 -a $mach --scheduler-threads=1 -o $single || exit 1
+$tcecc $src -O3 -a $mach --scheduler-threads=4 -o $parallel || exit 1
+
+cmp -s $single $parallel || \
+    echo "Scheduling with 1 and 4 threads gave different programs."
+
+rm -f $single $parallel
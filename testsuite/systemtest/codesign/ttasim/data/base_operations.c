@@ -0,0 +1,65 @@
+/**
+ * Exercises the base operations with edge case operands. The output of
+ * the interpretive and the compiled simulation must be identical.
+ */
+#include <stdio.h>
+
+volatile int values[] = {
+    0, 1, -1, 2, 7, 31, 0x7f, 0x80, 0xff, 0x7fff, 0x8000, 0xffff,
+    0x7fffffff, (int)0x80000000, (int)0xdeadbeef, 12345, -12345
+};
+
+#define VALUE_COUNT (sizeof(values) / sizeof(values[0]))
+
+static void
+printHex(unsigned int value) {
+    int i;
+    for (i = 28; i >= 0; i -= 4) {
+        putchar("0123456789abcdef"[(value >> i) & 0xf]);
+    }
+}
+
+static void
+printResult(char op, unsigned int result) {
+    putchar(op);
+    putchar(' ');
+    printHex(result);
+    putchar('\n');
+}
+
+int
+main() {
+    unsigned int i, j;
+    for (i = 0; i < VALUE_COUNT; ++i) {
+        int a = values[i];
+        unsigned int ua = (unsigned int)a;
+        printResult('n', (unsigned int)-a);
+        printResult('~', ~ua);
+        printResult('b', (unsigned int)(int)(signed char)a);
+        printResult('h', (unsigned int)(int)(short)a);
+        for (j = 0; j < VALUE_COUNT; ++j) {
+            int b = values[j];
+            unsigned int ub = (unsigned int)b;
+            unsigned int shift = ub & 31;
+            printResult('+', ua + ub);
+            printResult('-', ua - ub);
+            printResult('*', ua * ub);
+            printResult('&', ua & ub);
+            printResult('|', ua | ub);
+            printResult('^', ua ^ ub);
+            printResult('<', ua << shift);
+            printResult('>', (unsigned int)(a >> shift));
+            printResult('r', ua >> shift);
+            printResult('=', a == b);
+            printResult('g', a > b);
+            printResult('u', ua > ub);
+            if (b != 0 && !(a == (int)0x80000000 && b == -1)) {
+                printResult('/', (unsigned int)(a / b));
+                printResult('%', (unsigned int)(a % b));
+                printResult('d', ua / ub);
+                printResult('m', ua % ub);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,33 @@
+#!/bin/bash
+### TCE TESTCASE
+### title: Compares compiled and interpretive simulation of base operations
+### xstdout: OK
+
+# The compiled simulation expands the operations with OSAL trigger
+# semantics inline and calls the behavior for the others. Both must
+# produce the same results as the interpretive simulation.
+
+ADF=./data/wrong_conflict_detection.adf
+SRC=./data/base_operations.c
+TPEF=$(mktemp tmpXXXXXX.tpef)
+INTERP_OUT=$(mktemp tmpXXXXXX.txt)
+COMPILED_OUT=$(mktemp tmpXXXXXX.txt)
+
+function on_exit {
+    rm -f $TPEF $INTERP_OUT $COMPILED_OUT
+}
+trap on_exit EXIT
+
+tcecc -O2 -o $TPEF -a $ADF $SRC || { echo "FAILURE: compilation"; exit 1; }
+ttasim --no-debugmode -a $ADF -p $TPEF > $INTERP_OUT
+ttasim -q --no-debugmode -a $ADF -p $TPEF > $COMPILED_OUT
+
+[ ! -s "$INTERP_OUT" ] && { echo "FAILURE: no simulation output"; exit 1; }
+
+diff -q $INTERP_OUT $COMPILED_OUT > /dev/null
+if [ $? -ne 0 ]; then
+    echo "FAILURE: compiled simulation differs from the interpretive one"
+    exit 1
+fi
+echo "OK"
+exit 0
@@ -0,0 +1,27 @@
+#!/bin/bash
+# Tests the result cache of testhdb. The first run tests every entry, the
+# second one skips all the entries that passed, and editing the HDL file
+# of one entry makes only that entry run again.
+
+HDBTESTER=../../../../openasip/src/procgen/HDBEditor/testhdb
+HDB_DIR=../../../../openasip/hdb
+
+work=$(mktemp -d)
+cp -r $HDB_DIR/mixed_hdl.hdb $HDB_DIR/mixed_hdl $work/
+cache=$work/results
+
+function skipped {
+    $HDBTESTER --jobs 2 --result-cache $cache $work/mixed_hdl.hdb 2>&1 | \
+        grep -c "is unchanged since it last passed"
+}
+
+echo "skipped on the first run: $(skipped)"
+passed=$(wc -l < $cache)
+if [ "$(skipped)" -eq "$passed" ]; then
+    echo "all passed entries skipped on the second run"
+fi
+echo "-- edited" >> $work/mixed_hdl/vhdl/reflect.vhdl
+echo "tested again after an edit: $(( passed - $(skipped) ))"
+
+rm -rf $work
+exit 0